@@ -56,6 +56,9 @@
 /*================== Includes =============================================*/
 #include "can.h"
 
+#include "mcu.h"
+#include "os.h"
+
 /*================== Macros and Definitions ===============================*/
 #define ID_16BIT_FIFO0          0
 #define ID_16BIT_FIFO1          1
@@ -69,6 +72,14 @@
 uint8_t canNode0_listenonly_mode = 0;
 uint8_t canNode1_listenonly_mode = 0;
 
+/**
+ * upper limits of the bins of the queueing delay histogram in us, the last bin has no upper limit.
+ * The COM command printcanbus prints the bins with these limits.
+ */
+static const uint32_t can_txdelay_binlimits_us[CAN_TX_DELAY_HISTOGRAM_BINS - 1] = {
+    250, 500, 1000, 2000, 5000, 10000, 20000
+};
+
 #if CAN_USE_CAN_NODE0
 #if CAN0_USE_TX_BUFFER
 CAN_TX_BUFFERELEMENT_s can0_txbufferelements[CAN0_TX_BUFFER_LENGTH];
@@ -86,14 +97,38 @@ CAN_RX_BUFFER_s can0_rxbuffer = {
 };
 #endif
 
-#if CAN0_BUFFER_BYPASS_NUMBER_OF_IDs > 0
-uint8_t can0_fastLinkIndex[CAN0_BUFFER_BYPASS_NUMBER_OF_IDs];   /* Link Table for bufferBypassing */
-#endif
+CAN_RX_LOOKUP_s can0_rxlookup[CAN0_RX_LOOKUP_LENGTH];   /* receive IDs sorted for the lookup */
+uint8_t can0_rxlookup_length = 0;
 
 CAN_ERROR_s CAN0_errorStruct = {
     .canError = HAL_CAN_ERROR_NONE,
     .canErrorCounter = { 0, 0, 0, 0, 0, 0, 0, 0, 0 },
 };
+
+CAN_TX_STATISTICS_s can0_txstatistics = {
+    .nr_of_frames = 0,
+    .frames_per_second = 0,
+    .buffer_highwatermark = 0,
+};
+
+CAN_RX_STATISTICS_s can0_rxstatistics = {
+    .nr_of_frames = 0,
+    .nr_of_unknown_frames = 0,
+    .nr_of_dropped_frames = 0,
+    .buffer_highwatermark = 0,
+    .isr_cycles_last = 0,
+    .isr_cycles_max = 0,
+    .dispatch_cycles_last = 0,
+    .dispatch_cycles_max = 0,
+};
+
+CAN_BUS_STATISTICS_s can0_busstatistics = {
+    .busload_permille = 0,
+    .errors_per_second = 0,
+    .tx_delay_max_us = 0,
+    .tx_latency_max_us = 0,
+    .window_bits = 0,
+};
 #endif
 
 #if CAN_USE_CAN_NODE1
@@ -114,14 +149,38 @@ CAN_RX_BUFFER_s can1_rxbuffer = {
 };
 #endif
 
-#if CAN1_BUFFER_BYPASS_NUMBER_OF_IDs > 0
-uint8_t can1_fastLinkIndex[CAN1_BUFFER_BYPASS_NUMBER_OF_IDs];   /* Link Table for bufferBypassing */
-#endif
+CAN_RX_LOOKUP_s can1_rxlookup[CAN1_RX_LOOKUP_LENGTH];   /* receive IDs sorted for the lookup */
+uint8_t can1_rxlookup_length = 0;
 
 CAN_ERROR_s CAN1_errorStruct = {
     .canError = HAL_CAN_ERROR_NONE,
     .canErrorCounter = { 0, 0, 0, 0, 0, 0, 0, 0, 0 },
 };
+
+CAN_TX_STATISTICS_s can1_txstatistics = {
+    .nr_of_frames = 0,
+    .frames_per_second = 0,
+    .buffer_highwatermark = 0,
+};
+
+CAN_RX_STATISTICS_s can1_rxstatistics = {
+    .nr_of_frames = 0,
+    .nr_of_unknown_frames = 0,
+    .nr_of_dropped_frames = 0,
+    .buffer_highwatermark = 0,
+    .isr_cycles_last = 0,
+    .isr_cycles_max = 0,
+    .dispatch_cycles_last = 0,
+    .dispatch_cycles_max = 0,
+};
+
+CAN_BUS_STATISTICS_s can1_busstatistics = {
+    .busload_permille = 0,
+    .errors_per_second = 0,
+    .tx_delay_max_us = 0,
+    .tx_latency_max_us = 0,
+    .window_bits = 0,
+};
 #endif
 
 
@@ -152,12 +211,30 @@ static uint8_t CAN_GetNextID(CAN_MSG_RX_TYPE_s* can_RxMsgs, uint8_t numberOfRxID
         uint8_t filterCase);
 static uint8_t CAN_NumberOfNeededFilters(CAN_MSG_RX_TYPE_s* can_RxMsgs, uint8_t* numberOfDifferentIDs, uint32_t* error);
 static uint32_t CAN_InitFilter(CAN_HandleTypeDef* ptrHcan, CAN_MSG_RX_TYPE_s* can_RxMsgs, uint8_t numberOfRxMsgs);
+static uint8_t CAN_InitRxLookup(CAN_RX_LOOKUP_s* rxlookup, uint8_t rxlookupLength, CAN_MSG_RX_TYPE_s* can_RxMsgs,
+        uint8_t numberOfRxMsgs, uint32_t* bypassIDs, uint8_t numberOfBypassIDs);
 
 /* Interrupts */
 static void CAN_Disable_Transmit_IT(CAN_HandleTypeDef* ptrHcan);
 static void CAN_TxCpltCallback(CAN_NodeTypeDef_e canNode);
 static void CAN_ErrorCallback(CAN_HandleTypeDef* ptrHhcan);
 static STD_RETURN_TYPE_e CAN_RxMsg(CAN_NodeTypeDef_e canNode, CAN_HandleTypeDef* ptrHcan, uint8_t FIFONumber);
+static uint8_t CAN_AcknowledgeMailbox(CAN_HandleTypeDef* ptrHcan, uint32_t flagRQCP, uint32_t flagTXOK,
+        uint8_t mailbox, CAN_TX_STATISTICS_s* txstatistics, CAN_BUS_STATISTICS_s* busstatistics);
+static uint8_t CAN_GetFreeTxMailbox(CAN_HandleTypeDef* ptrHcan);
+
+/* Statistics */
+static CAN_TX_STATISTICS_s* CAN_GetTxStatisticsPtr(CAN_NodeTypeDef_e canNode);
+static uint8_t CAN_GetTxBufferFillLevel(CAN_TX_BUFFER_s* can_txbuffer);
+static CAN_RX_STATISTICS_s* CAN_GetRxStatisticsPtr(CAN_NodeTypeDef_e canNode);
+static uint8_t CAN_GetRxBufferFillLevel(CAN_RX_BUFFER_s* can_rxbuffer);
+static CAN_BUS_STATISTICS_s* CAN_GetBusStatisticsPtr(CAN_NodeTypeDef_e canNode);
+static uint8_t CAN_GetFrameBits(uint32_t IDE, uint32_t DLC);
+static void CAN_RecordTxLoad(CAN_BUS_STATISTICS_s* busstatistics, uint8_t mailbox, CanTxMsgTypeDef* msg,
+        uint32_t enqueuecycles);
+
+/* Lookup */
+static const CAN_RX_LOOKUP_s* CAN_FindRxLookup(CAN_NodeTypeDef_e canNode, uint32_t msgID);
 
 /* Buffer/Interpreter */
 static STD_RETURN_TYPE_e CAN_BufferBypass(CAN_NodeTypeDef_e canNode, uint32_t msgID, uint8_t* rxData, uint8_t DLC,
@@ -196,6 +273,13 @@ uint32_t CAN_Init(void) {
         retval |= STD_ERR_BIT_7;
     }
 
+    /* Sort the received IDs for the lookup */
+    can0_rxlookup_length = CAN_InitRxLookup(&can0_rxlookup[0], CAN0_RX_LOOKUP_LENGTH, &can0_RxMsgs[0],
+            can_CAN0_rx_length, &can0_bufferBypass_RxMsgs[0], CAN0_BUFFER_BYPASS_NUMBER_OF_IDs);
+    if (can0_rxlookup_length < can_CAN0_rx_length) {
+        retval |= STD_ERR_BIT_15;
+    }
+
     /* Enable CAN0 message receive interrupt FIFO0 */
     if (HAL_CAN_Receive_IT(&hcan0, CAN_FIFO0) != HAL_OK) {
         retval |= STD_ERR_BIT_8;
@@ -236,6 +320,13 @@ uint32_t CAN_Init(void) {
         retval |= STD_ERR_BIT_12;
     }
 
+    /* Sort the received IDs for the lookup */
+    can1_rxlookup_length = CAN_InitRxLookup(&can1_rxlookup[0], CAN1_RX_LOOKUP_LENGTH, &can1_RxMsgs[0],
+            can_CAN1_rx_length, &can1_bufferBypass_RxMsgs[0], CAN1_BUFFER_BYPASS_NUMBER_OF_IDs);
+    if (can1_rxlookup_length < can_CAN1_rx_length) {
+        retval |= STD_ERR_BIT_16;
+    }
+
     /* Enable CAN1 message receive interrupt FIFO0 */
     if (HAL_CAN_Receive_IT(&hcan1, CAN_FIFO0) != HAL_OK) {
         retval |= STD_ERR_BIT_13;
@@ -255,6 +346,56 @@ uint32_t CAN_Init(void) {
     return retval;
 }
 
+/**
+ * @brief  Builds the receive lookup table of a CAN node
+ *
+ * The IDs of the receive configuration are sorted by insertion sort, messages
+ * with the same ID keep the order of the configuration. Messages whose ID is
+ * listed in bypassIDs are marked to bypass the receive buffer.
+ *
+ * @param  rxlookup:           lookup table to fill
+ * @param  rxlookupLength:     maximum number of entries of the lookup table
+ * @param  can_RxMsgs:         receive configuration of the node
+ * @param  numberOfRxMsgs:     number of messages in can_RxMsgs
+ * @param  bypassIDs:          IDs that bypass the receive buffer
+ * @param  numberOfBypassIDs:  number of IDs in bypassIDs
+ *
+ * @retval number of entries in the lookup table
+ */
+static uint8_t CAN_InitRxLookup(CAN_RX_LOOKUP_s* rxlookup, uint8_t rxlookupLength, CAN_MSG_RX_TYPE_s* can_RxMsgs,
+        uint8_t numberOfRxMsgs, uint32_t* bypassIDs, uint8_t numberOfBypassIDs) {
+    CAN_RX_LOOKUP_s entry;
+    uint8_t length = 0;
+    uint8_t i = 0;
+    uint8_t k = 0;
+
+    if (numberOfRxMsgs > rxlookupLength) {
+        numberOfRxMsgs = rxlookupLength;
+    }
+
+    for (i = 0; i < numberOfRxMsgs; i++) {
+        entry.ID = can_RxMsgs[i].ID;
+        entry.rxIndex = i;
+        entry.bypass = 0;
+        for (k = 0; k < numberOfBypassIDs; k++) {
+            if (bypassIDs[k] == entry.ID) {
+                entry.bypass = 1;
+                break;
+            }
+        }
+
+        /* insert behind all entries with a lower or the same ID */
+        k = length;
+        while (k > 0 && rxlookup[k - 1].ID > entry.ID) {
+            rxlookup[k] = rxlookup[k - 1];
+            k--;
+        }
+        rxlookup[k] = entry;
+        length++;
+    }
+    return length;
+}
+
 /**
  * @brief  Initializes message filtering
  * @retval 0: if no error occurred, otherwise error code
@@ -463,34 +604,6 @@ static uint8_t CAN_NumberOfNeededFilters(CAN_MSG_RX_TYPE_s* can_RxMsgs, uint8_t*
     }
 
     for (int i = 0; i < can_rx_length; i++) {
-#if CAN0_BUFFER_BYPASS_NUMBER_OF_IDs > 0 && CAN_USE_CAN_NODE0 == 1
-
-        if (can_RxMsgs  ==  &can0_RxMsgs[0]) {
-            /* Set buffer bypass IDs link table */
-            for (int k = 0; k < CAN0_BUFFER_BYPASS_NUMBER_OF_IDs; k++) {
-                if (can_RxMsgs[i].ID  ==  can0_bufferBypass_RxMsgs[k]) {
-                    /* bypass ID  ==  ID in message receive struct */
-
-                    can0_fastLinkIndex[k] = i;   /* set for can_bufferBypass_RxMsgs[k] link to array index */
-                    break;
-                }
-            }
-        }
-#endif
-#if CAN1_BUFFER_BYPASS_NUMBER_OF_IDs > 0 && CAN_USE_CAN_NODE1 == 1
-
-        if (can_RxMsgs  ==  &can1_RxMsgs[0]) {
-            /* Set buffer bypass IDs link table */
-            for (int k = 0; k < CAN1_BUFFER_BYPASS_NUMBER_OF_IDs; k++) {
-                if (can1_RxMsgs[i].ID  ==  can1_bufferBypass_RxMsgs[k]) {
-                    /* bypass ID  ==  ID in message receive struct */
-
-                    can1_fastLinkIndex[k] = i;   /* set for can1_bufferBypass_RxMsgs[k] link to array index */
-                    break;
-                }
-            }
-        }
-#endif
         if (can_RxMsgs[i].mask  ==  0 && IS_CAN_STDID(can_RxMsgs[i].ID)) {
             /* ID List mode 16bit */
 
@@ -598,17 +711,75 @@ static uint8_t CAN_GetNextID(CAN_MSG_RX_TYPE_s* can_RxMsgs, uint8_t numberOfRxID
  ****************************************/
 
 void CAN_TX_IRQHandler(CAN_HandleTypeDef* ptrHcan) {
+    uint8_t completed = FALSE;
+    CAN_TX_STATISTICS_s* txstatistics = NULL;
+    CAN_BUS_STATISTICS_s* busstatistics = NULL;
+
+    if (ptrHcan->Instance  ==  CAN2) {
+        txstatistics = CAN_GetTxStatisticsPtr(CAN_NODE0);
+        busstatistics = CAN_GetBusStatisticsPtr(CAN_NODE0);
+    } else {
+        txstatistics = CAN_GetTxStatisticsPtr(CAN_NODE1);
+        busstatistics = CAN_GetBusStatisticsPtr(CAN_NODE1);
+    }
+
     /* Check End of transmission flag */
     if (__HAL_CAN_GET_IT_SOURCE(ptrHcan, CAN_IT_TME)) {
-        if ((__HAL_CAN_TRANSMIT_STATUS(ptrHcan, CAN_TXMAILBOX_0))
-                || (__HAL_CAN_TRANSMIT_STATUS(ptrHcan, CAN_TXMAILBOX_1))
-                || (__HAL_CAN_TRANSMIT_STATUS(ptrHcan, CAN_TXMAILBOX_2))) {
-            /* Call transmit function */
+        /* Acknowledge every completed mailbox, a completion flag left set would retrigger the interrupt */
+        completed |= CAN_AcknowledgeMailbox(ptrHcan, CAN_FLAG_RQCP0, CAN_FLAG_TXOK0, 0, txstatistics, busstatistics);
+        completed |= CAN_AcknowledgeMailbox(ptrHcan, CAN_FLAG_RQCP1, CAN_FLAG_TXOK1, 1, txstatistics, busstatistics);
+        completed |= CAN_AcknowledgeMailbox(ptrHcan, CAN_FLAG_RQCP2, CAN_FLAG_TXOK2, 2, txstatistics, busstatistics);
+        if (completed  ==  TRUE) {
+            /* Call transmit function, refills all free mailboxes */
             CAN_Disable_Transmit_IT(ptrHcan);
         }
     }
 }
 
+/**
+ * @brief  Acknowledges a completed transmit mailbox and counts the transmitted frame
+ *
+ *         For a successful transmission the latency of the frame is recorded and
+ *         the frame is added to the bits on the bus of the current window.
+ *
+ * @param  ptrHcan:        pointer to a CAN_HandleTypeDef structure that contains
+ *                         the configuration information for the specified CAN.
+ * @param  flagRQCP:       request completed flag of the mailbox
+ * @param  flagTXOK:       transmission OK flag of the mailbox
+ * @param  mailbox:        number of the mailbox
+ * @param  txstatistics:   transmit statistics of the CAN node, NULL if not used
+ * @param  busstatistics:  bus statistics of the CAN node, NULL if not used
+ *
+ * @retval TRUE if the mailbox completed a request, otherwise FALSE
+ */
+static uint8_t CAN_AcknowledgeMailbox(CAN_HandleTypeDef* ptrHcan, uint32_t flagRQCP, uint32_t flagTXOK,
+        uint8_t mailbox, CAN_TX_STATISTICS_s* txstatistics, CAN_BUS_STATISTICS_s* busstatistics) {
+    uint8_t retVal = FALSE;
+    uint32_t latency = 0;
+
+    if (__HAL_CAN_GET_FLAG(ptrHcan, flagRQCP)) {
+        if (__HAL_CAN_GET_FLAG(ptrHcan, flagTXOK)) {
+            if (txstatistics != NULL) {
+                txstatistics->nr_of_frames++;
+            }
+            if (busstatistics != NULL) {
+                latency = MCU_CyclesToMicroseconds(MCU_GetCycleCounter() - busstatistics->txmailbox.enqueuecycles[mailbox]);
+                busstatistics->tx_latency_last_us = latency;
+                if (latency > busstatistics->tx_latency_max_us) {
+                    busstatistics->tx_latency_max_us = latency;
+                }
+                busstatistics->window_bits += busstatistics->txmailbox.bits[mailbox];
+            }
+        } else if (txstatistics != NULL) {
+            txstatistics->nr_of_failed_frames++;
+        }
+        /* Clears RQCP, TXOK, ALST and TERR of the mailbox */
+        __HAL_CAN_CLEAR_FLAG(ptrHcan, flagRQCP);
+        retVal = TRUE;
+    }
+    return retVal;
+}
+
 
 void CAN_RX_IRQHandler(CAN_NodeTypeDef_e canNode, CAN_HandleTypeDef* ptrHcan) {
     /* Check End of reception flag for FIFO0 */
@@ -833,6 +1004,8 @@ STD_RETURN_TYPE_e CAN_TxMsg(CAN_NodeTypeDef_e canNode, uint32_t msgID, uint8_t*
     STD_RETURN_TYPE_e retVal = E_NOT_OK;
     CanTxMsgTypeDef Message;
     CAN_HandleTypeDef *ptrHcan;
+    uint32_t enqueuecycles = MCU_GetCycleCounter();
+    uint8_t mailbox = CAN_NR_OF_TX_MAILBOXES;
 
     if (canNode  ==  CAN_NODE0) {
         if (canNode0_listenonly_mode)
@@ -863,7 +1036,11 @@ STD_RETURN_TYPE_e CAN_TxMsg(CAN_NodeTypeDef_e canNode, uint32_t msgID, uint8_t*
         }
         Message.RTR = RTR;
         ptrHcan->pTxMsg = &Message;
+        mailbox = CAN_GetFreeTxMailbox(ptrHcan);
         retVal = HAL_CAN_Transmit_IT(ptrHcan);
+        if (retVal == E_OK) {
+            CAN_RecordTxLoad(CAN_GetBusStatisticsPtr(canNode), mailbox, &Message, enqueuecycles);
+        }
     } else {
         retVal = E_NOT_OK;
     }
@@ -876,8 +1053,10 @@ STD_RETURN_TYPE_e CAN_Send(CAN_NodeTypeDef_e canNode, uint32_t msgID, uint8_t* p
         uint32_t RTR) {
     STD_RETURN_TYPE_e retVal = E_NOT_OK;
     uint8_t tmptxbuffer_wr;
+    uint8_t fillLevel = 0;
 
     CAN_TX_BUFFER_s* can_txbuffer = NULL;
+    CAN_TX_STATISTICS_s* txstatistics = CAN_GetTxStatisticsPtr(canNode);
 
     if (canNode  ==  CAN_NODE0) {
 #if CAN_USE_CAN_NODE0 == 1
@@ -902,6 +1081,9 @@ STD_RETURN_TYPE_e CAN_Send(CAN_NodeTypeDef_e canNode, uint32_t msgID, uint8_t* p
             } else {
                 /* buffer full */
                 retVal = E_NOT_OK;
+                if (txstatistics != NULL) {
+                    txstatistics->nr_of_dropped_frames++;
+                }
             }
         } else {
             can_txbuffer->ptrWrite++;
@@ -935,6 +1117,14 @@ STD_RETURN_TYPE_e CAN_Send(CAN_NodeTypeDef_e canNode, uint32_t msgID, uint8_t* p
         can_txbuffer->buffer[tmptxbuffer_wr].msg.Data[5] = ptrMsgData[5];
         can_txbuffer->buffer[tmptxbuffer_wr].msg.Data[6] = ptrMsgData[6];
         can_txbuffer->buffer[tmptxbuffer_wr].msg.Data[7] = ptrMsgData[7];
+        can_txbuffer->buffer[tmptxbuffer_wr].enqueuecycles = MCU_GetCycleCounter();
+
+        if (txstatistics != NULL) {
+            fillLevel = CAN_GetTxBufferFillLevel(can_txbuffer);
+            if (fillLevel > txstatistics->buffer_highwatermark) {
+                txstatistics->buffer_highwatermark = fillLevel;
+            }
+        }
 
         retVal = E_OK;
     } else {
@@ -947,9 +1137,11 @@ STD_RETURN_TYPE_e CAN_Send(CAN_NodeTypeDef_e canNode, uint32_t msgID, uint8_t* p
 
 STD_RETURN_TYPE_e CAN_TxMsgBuffer(CAN_NodeTypeDef_e canNode) {
     STD_RETURN_TYPE_e retVal = E_NOT_OK;
+    uint8_t mailbox = CAN_NR_OF_TX_MAILBOXES;
 
     CAN_TX_BUFFER_s* can_txbuffer = NULL;
     CAN_HandleTypeDef* ptrHcan = NULL;
+    CAN_BUS_STATISTICS_s* busstatistics = CAN_GetBusStatisticsPtr(canNode);
 
     if (canNode  ==  CAN_NODE0) {
 #if CAN_USE_CAN_NODE0 == 1
@@ -967,22 +1159,22 @@ STD_RETURN_TYPE_e CAN_TxMsgBuffer(CAN_NodeTypeDef_e canNode) {
 #endif
     }
     if (can_txbuffer != NULL) {
-        if ((can_txbuffer->ptrWrite  ==  can_txbuffer->ptrRead)
-                && (can_txbuffer->buffer[can_txbuffer->ptrRead].newMsg  ==  0)) {
-            /* nothing to transmit, buffer is empty */
-            retVal = E_NOT_OK;
-        } else {
+        /* hand messages to the hardware until all transmit mailboxes are full or the buffer is empty */
+        while ((can_txbuffer->ptrWrite != can_txbuffer->ptrRead)
+                || (can_txbuffer->buffer[can_txbuffer->ptrRead].newMsg != 0)) {
             ptrHcan->pTxMsg = &can_txbuffer->buffer[can_txbuffer->ptrRead].msg;
-            retVal = HAL_CAN_Transmit_IT(ptrHcan);
-            if (retVal  ==  E_OK) {
-                /* No Error during start of transmission */
-                can_txbuffer->buffer[can_txbuffer->ptrRead].newMsg = 0;    /* Msg is sent, set newMsg to 0, to allow writing of new data in buffer space */
-                can_txbuffer->ptrRead++;
-                can_txbuffer->ptrRead = can_txbuffer->ptrRead % can_txbuffer->length;
-
-            } else {
-                retVal = E_NOT_OK;        /* Error during transmission, retransmit message later */
+            mailbox = CAN_GetFreeTxMailbox(ptrHcan);
+            if (HAL_CAN_Transmit_IT(ptrHcan) != HAL_OK) {
+                /* no free mailbox or error during start of transmission, retransmit message later */
+                break;
             }
+            CAN_RecordTxLoad(busstatistics, mailbox, &can_txbuffer->buffer[can_txbuffer->ptrRead].msg,
+                    can_txbuffer->buffer[can_txbuffer->ptrRead].enqueuecycles);
+            /* No Error during start of transmission */
+            can_txbuffer->buffer[can_txbuffer->ptrRead].newMsg = 0;    /* Msg is sent, set newMsg to 0, to allow writing of new data in buffer space */
+            can_txbuffer->ptrRead++;
+            can_txbuffer->ptrRead = can_txbuffer->ptrRead % can_txbuffer->length;
+            retVal = E_OK;
         }
     } else {
         /* no transmit buffer active */
@@ -992,6 +1184,236 @@ STD_RETURN_TYPE_e CAN_TxMsgBuffer(CAN_NodeTypeDef_e canNode) {
     return retVal;
 }
 
+void CAN_UpdateTxRate(CAN_NodeTypeDef_e canNode, uint32_t timestamp) {
+    CAN_TX_STATISTICS_s* txstatistics = CAN_GetTxStatisticsPtr(canNode);
+    uint32_t elapsed = 0;
+
+    if (txstatistics != NULL) {
+        elapsed = timestamp - txstatistics->window_starttime;
+        if (elapsed >= CAN_TX_RATE_WINDOW_MS) {
+            txstatistics->frames_per_second = (uint16_t)(((txstatistics->nr_of_frames - txstatistics->window_startframes) * 1000) / elapsed);
+            txstatistics->window_starttime = timestamp;
+            txstatistics->window_startframes = txstatistics->nr_of_frames;
+        }
+    }
+}
+
+
+STD_RETURN_TYPE_e CAN_GetTxStatistics(CAN_NodeTypeDef_e canNode, CAN_TX_STATISTICS_s *txstatistics) {
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
+    CAN_TX_STATISTICS_s* nodestatistics = CAN_GetTxStatisticsPtr(canNode);
+
+    if (nodestatistics != NULL && txstatistics != NULL) {
+        *txstatistics = *nodestatistics;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief  Returns the transmit statistics of a CAN node
+ *
+ * @param  canNode: CAN node
+ *
+ * @retval pointer to the statistics, NULL if the node is not used
+ */
+static CAN_TX_STATISTICS_s* CAN_GetTxStatisticsPtr(CAN_NodeTypeDef_e canNode) {
+    CAN_TX_STATISTICS_s* txstatistics = NULL;
+
+    if (canNode  ==  CAN_NODE0) {
+#if CAN_USE_CAN_NODE0 == 1
+        txstatistics = &can0_txstatistics;
+#endif
+    } else if (canNode  ==  CAN_NODE1) {
+#if CAN_USE_CAN_NODE1 == 1
+        txstatistics = &can1_txstatistics;
+#endif
+    }
+    return txstatistics;
+}
+
+/**
+ * @brief  Returns the number of messages waiting in a transmit buffer
+ *
+ * @param  can_txbuffer: transmit buffer
+ *
+ * @retval number of messages in the buffer
+ */
+static uint8_t CAN_GetTxBufferFillLevel(CAN_TX_BUFFER_s* can_txbuffer) {
+    uint8_t fillLevel = 0;
+
+    if (can_txbuffer->ptrWrite  ==  can_txbuffer->ptrRead) {
+        /* buffer is either empty or full */
+        if (can_txbuffer->buffer[can_txbuffer->ptrRead].newMsg != 0) {
+            fillLevel = can_txbuffer->length;
+        }
+    } else {
+        fillLevel = (can_txbuffer->ptrWrite + can_txbuffer->length - can_txbuffer->ptrRead) % can_txbuffer->length;
+    }
+    return fillLevel;
+}
+
+/**
+ * @brief  Returns the transmit mailbox that HAL_CAN_Transmit_IT() loads next
+ *
+ *         The mailboxes are checked in the same order as in HAL_CAN_Transmit_IT().
+ *
+ * @param  ptrHcan: pointer to a CAN_HandleTypeDef structure that contains
+ *                  the configuration information for the specified CAN.
+ *
+ * @retval number of the mailbox, CAN_NR_OF_TX_MAILBOXES if no mailbox is free
+ */
+static uint8_t CAN_GetFreeTxMailbox(CAN_HandleTypeDef* ptrHcan) {
+    uint8_t mailbox = CAN_NR_OF_TX_MAILBOXES;
+
+    if ((ptrHcan->Instance->TSR & CAN_TSR_TME0) == CAN_TSR_TME0) {
+        mailbox = 0;
+    } else if ((ptrHcan->Instance->TSR & CAN_TSR_TME1) == CAN_TSR_TME1) {
+        mailbox = 1;
+    } else if ((ptrHcan->Instance->TSR & CAN_TSR_TME2) == CAN_TSR_TME2) {
+        mailbox = 2;
+    }
+    return mailbox;
+}
+
+/**
+ * @brief  Records the queueing delay of a frame that has been loaded into a transmit mailbox
+ *
+ * @param  busstatistics:  bus statistics of the CAN node, NULL if not used
+ * @param  mailbox:        number of the mailbox
+ * @param  msg:            frame in the mailbox
+ * @param  enqueuecycles:  core clock cycle counter when the frame was added
+ *
+ * @retval none (void)
+ */
+static void CAN_RecordTxLoad(CAN_BUS_STATISTICS_s* busstatistics, uint8_t mailbox, CanTxMsgTypeDef* msg,
+        uint32_t enqueuecycles) {
+    uint32_t delay = 0;
+    uint8_t bin = 0;
+
+    if (busstatistics != NULL && mailbox < CAN_NR_OF_TX_MAILBOXES) {
+        busstatistics->txmailbox.enqueuecycles[mailbox] = enqueuecycles;
+        busstatistics->txmailbox.bits[mailbox] = CAN_GetFrameBits(msg->IDE, msg->DLC);
+
+        delay = MCU_CyclesToMicroseconds(MCU_GetCycleCounter() - enqueuecycles);
+        busstatistics->tx_delay_last_us = delay;
+        if (delay > busstatistics->tx_delay_max_us) {
+            busstatistics->tx_delay_max_us = delay;
+        }
+        if (delay > busstatistics->window_delay_max_us) {
+            busstatistics->window_delay_max_us = delay;
+        }
+        while ((bin < (CAN_TX_DELAY_HISTOGRAM_BINS - 1)) && (delay > can_txdelay_binlimits_us[bin])) {
+            bin++;
+        }
+        busstatistics->tx_delay_histogram[bin]++;
+    }
+}
+
+/**
+ * @brief  Returns the length of a data frame on the bus
+ *
+ *         The length includes the interframe space and the worst case number of
+ *         stuff bits between the start of frame and the end of the CRC.
+ *
+ * @param  IDE:  CAN_ID_STD or CAN_ID_EXT
+ * @param  DLC:  data length code
+ *
+ * @retval length of the frame in bits
+ */
+static uint8_t CAN_GetFrameBits(uint32_t IDE, uint32_t DLC) {
+    uint32_t stuffedBits = 0;
+
+    if (DLC > 8) {
+        DLC = 8;
+    }
+    if (IDE == CAN_ID_STD) {
+        stuffedBits = 34 + (8 * DLC);   /* start of frame, 11 bit ID, control field, data, CRC */
+    } else {
+        stuffedBits = 54 + (8 * DLC);   /* start of frame, 29 bit ID, control field, data, CRC */
+    }
+    /* CRC delimiter, ACK, end of frame and interframe space are not stuffed */
+    return (uint8_t)(stuffedBits + 13 + ((stuffedBits - 1) / 4));
+}
+
+void CAN_UpdateBusStatistics(CAN_NodeTypeDef_e canNode, uint32_t timestamp) {
+    CAN_BUS_STATISTICS_s* busstatistics = CAN_GetBusStatisticsPtr(canNode);
+    CAN_HandleTypeDef* ptrHcan = NULL;
+    CAN_ERROR_s* errorStruct = NULL;
+    uint32_t bitrate = 0;
+    uint32_t errors = 0;
+    uint32_t elapsed = 0;
+    uint8_t i = 0;
+
+    if (canNode  ==  CAN_NODE0) {
+#if CAN_USE_CAN_NODE0 == 1
+        ptrHcan = &hcan0;
+        errorStruct = &CAN0_errorStruct;
+        bitrate = CAN0_BAUDRATE;
+#endif
+    } else if (canNode  ==  CAN_NODE1) {
+#if CAN_USE_CAN_NODE1 == 1
+        ptrHcan = &hcan1;
+        errorStruct = &CAN1_errorStruct;
+        bitrate = CAN1_BAUDRATE;
+#endif
+    }
+
+    if (busstatistics != NULL && ptrHcan != NULL) {
+        elapsed = timestamp - busstatistics->window_starttime;
+        if (elapsed >= CAN_TX_RATE_WINDOW_MS) {
+            for (i = 0; i < (sizeof(errorStruct->canErrorCounter) / sizeof(errorStruct->canErrorCounter[0])); i++) {
+                errors += errorStruct->canErrorCounter[i];
+            }
+            /* bits on the bus relative to the bits that fit into the window, in 0.1 % */
+            busstatistics->busload_permille = (uint16_t)(((uint64_t)busstatistics->window_bits * 1000000u) /
+                    ((uint64_t)bitrate * elapsed));
+            busstatistics->errors_per_second = (uint16_t)(((errors - busstatistics->window_starterrors) * 1000u) / elapsed);
+            busstatistics->tx_error_counter = (uint8_t)((ptrHcan->Instance->ESR & CAN_ESR_TEC) >> 16);
+            busstatistics->rx_error_counter = (uint8_t)((ptrHcan->Instance->ESR & CAN_ESR_REC) >> 24);
+            busstatistics->tx_delay_window_max_us = busstatistics->window_delay_max_us;
+
+            busstatistics->window_bits = 0;
+            busstatistics->window_delay_max_us = 0;
+            busstatistics->window_starttime = timestamp;
+            busstatistics->window_starterrors = errors;
+        }
+    }
+}
+
+STD_RETURN_TYPE_e CAN_GetBusStatistics(CAN_NodeTypeDef_e canNode, CAN_BUS_STATISTICS_s *busstatistics) {
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
+    CAN_BUS_STATISTICS_s* nodestatistics = CAN_GetBusStatisticsPtr(canNode);
+
+    if (nodestatistics != NULL && busstatistics != NULL) {
+        *busstatistics = *nodestatistics;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief  Returns the bus statistics of a CAN node
+ *
+ * @param  canNode: CAN node
+ *
+ * @retval pointer to the statistics, NULL if the node is not used
+ */
+static CAN_BUS_STATISTICS_s* CAN_GetBusStatisticsPtr(CAN_NodeTypeDef_e canNode) {
+    CAN_BUS_STATISTICS_s* busstatistics = NULL;
+
+    if (canNode  ==  CAN_NODE0) {
+#if CAN_USE_CAN_NODE0 == 1
+        busstatistics = &can0_busstatistics;
+#endif
+    } else if (canNode  ==  CAN_NODE1) {
+#if CAN_USE_CAN_NODE1 == 1
+        busstatistics = &can1_busstatistics;
+#endif
+    }
+    return busstatistics;
+}
+
 /* ***************************************
  *  Receive message
  ****************************************/
@@ -1007,38 +1429,28 @@ STD_RETURN_TYPE_e CAN_TxMsgBuffer(CAN_NodeTypeDef_e canNode) {
  */
 static STD_RETURN_TYPE_e CAN_RxMsg(CAN_NodeTypeDef_e canNode, CAN_HandleTypeDef* ptrHcan, uint8_t FIFONumber) {
     STD_RETURN_TYPE_e retVal = E_NOT_OK;
-    uint8_t bypassLinkIndex = 0;
+    uint32_t startcycles = MCU_GetCycleCounter();
     uint32_t msgID;
+    const CAN_RX_LOOKUP_s* rxlookup = NULL;
+    CAN_MSG_RX_TYPE_s* can_rxmsgs = NULL;
+    CAN_RX_STATISTICS_s* rxstatistics = CAN_GetRxStatisticsPtr(canNode);
+    CAN_BUS_STATISTICS_s* busstatistics = CAN_GetBusStatisticsPtr(canNode);
 
 #if CAN0_USE_RX_BUFFER || CAN1_USE_RX_BUFFER
-    uint32_t* can_bufferbypass_rxmsgs = NULL;
-    uint32_t bufferbypasslength = 0;
     CAN_RX_BUFFER_s* can_rxbuffer = NULL;
-    CAN_MSG_RX_TYPE_s* can_rxmsgs = NULL;
-    uint8_t* can_fastLinkIndex = NULL;
 #endif
 
     /* Set pointer on respective RxBuffer */
     if (canNode  ==  CAN_NODE1) {
 #if CAN1_USE_RX_BUFFER && CAN_USE_CAN_NODE1 == 1
         can_rxbuffer = &can1_rxbuffer;
-#if CAN1_BUFFER_BYPASS_NUMBER_OF_IDs > 0
-        can_rxmsgs = &can1_RxMsgs[0];
-        can_bufferbypass_rxmsgs = &can1_bufferBypass_RxMsgs[0];
-        bufferbypasslength = CAN1_BUFFER_BYPASS_NUMBER_OF_IDs;
-        can_fastLinkIndex = &can1_fastLinkIndex[0];
-#endif
 #endif
+        can_rxmsgs = &can1_RxMsgs[0];
     } else if (canNode  ==  CAN_NODE0) {
 #if CAN0_USE_RX_BUFFER && CAN_USE_CAN_NODE0 == 1
         can_rxbuffer = &can0_rxbuffer;
-#if CAN0_BUFFER_BYPASS_NUMBER_OF_IDs > 0
-        can_rxmsgs = &can0_RxMsgs[0];
-        can_bufferbypass_rxmsgs = &can0_bufferBypass_RxMsgs[0];
-        bufferbypasslength = CAN0_BUFFER_BYPASS_NUMBER_OF_IDs;
-        can_fastLinkIndex = &can0_fastLinkIndex[0];
-#endif
 #endif
+        can_rxmsgs = &can0_RxMsgs[0];
     }
 
     /* Get message ID */
@@ -1049,58 +1461,62 @@ static STD_RETURN_TYPE_e CAN_RxMsg(CAN_NodeTypeDef_e canNode, CAN_HandleTypeDef*
         msgID = (uint32_t)0x1FFFFFFF & (ptrHcan->Instance->sFIFOMailBox[FIFONumber].RIR >> 3);
     }
 
-#if CAN1_BUFFER_BYPASS_NUMBER_OF_IDs > 0 || CAN0_BUFFER_BYPASS_NUMBER_OF_IDs > 0
-    if (can_bufferbypass_rxmsgs != NULL) {
-        /* only needed when messages are bypassed */
-
-        for (bypassLinkIndex = 0; bypassLinkIndex < bufferbypasslength; bypassLinkIndex++) {
-            if (msgID  ==  can_bufferbypass_rxmsgs[bypassLinkIndex]) {
-                break;
-            }
-        }
+    if (busstatistics != NULL) {
+        busstatistics->window_bits += CAN_GetFrameBits(ptrHcan->pRxMsg->IDE,
+                (uint8_t)0x0F & ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDTR);
     }
-#endif
-    if (bypassLinkIndex >= bufferbypasslength && can_rxbuffer != NULL) {
+
+    /* Look up the configuration of the message, also tells if it bypasses the buffer */
+    rxlookup = CAN_FindRxLookup(canNode, msgID);
+
+    if ((rxlookup == NULL || rxlookup->bypass == 0) && can_rxbuffer != NULL) {
         /* ##### Use buffer / Copy data in buffer ##### */
 
 #if CAN0_USE_RX_BUFFER || CAN1_USE_RX_BUFFER
         /* NO NEED TO DISABLE INTERRUPTS, BECAUSE FUNCTION IS CALLED FROM ISR */
+        CAN_RX_BUFFERELEMENT_s* element = &can_rxbuffer->buffer[can_rxbuffer->ptrWrite];
 
-        /* Set to 1 to mark message as new received. Set to 0 when reading message from buffer */
-        can_rxbuffer->buffer[can_rxbuffer->ptrWrite].newMsg = 1;
-
-        /* Get message ID */
-        can_rxbuffer->buffer[can_rxbuffer->ptrWrite].ID = msgID;
-        can_rxbuffer->buffer[can_rxbuffer->ptrWrite].RTR = (uint8_t)0x02
-                & ptrHcan->Instance->sFIFOMailBox[FIFONumber].RIR;
-
-        /* Get the DLC */
-        can_rxbuffer->buffer[can_rxbuffer->ptrWrite].DLC = (uint8_t)0x0F
-                & ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDTR;
-
-        /* Get the data field */
-        can_rxbuffer->buffer[can_rxbuffer->ptrWrite].Data[0] = (uint8_t)0xFF
-                & ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDLR;
-        can_rxbuffer->buffer[can_rxbuffer->ptrWrite].Data[1] = (uint8_t)0xFF
-                & (ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDLR >> 8);
-        can_rxbuffer->buffer[can_rxbuffer->ptrWrite].Data[2] = (uint8_t)0xFF
-                & (ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDLR >> 16);
-        can_rxbuffer->buffer[can_rxbuffer->ptrWrite].Data[3] = (uint8_t)0xFF
-                & (ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDLR >> 24);
-        can_rxbuffer->buffer[can_rxbuffer->ptrWrite].Data[4] = (uint8_t)0xFF
-                & ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDHR;
-        can_rxbuffer->buffer[can_rxbuffer->ptrWrite].Data[5] = (uint8_t)0xFF
-                & (ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDHR >> 8);
-        can_rxbuffer->buffer[can_rxbuffer->ptrWrite].Data[6] = (uint8_t)0xFF
-                & (ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDHR >> 16);
-        can_rxbuffer->buffer[can_rxbuffer->ptrWrite].Data[7] = (uint8_t)0xFF
-                & (ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDHR >> 24);
-
-        /* Increment write pointer */
-        can_rxbuffer->ptrWrite++;
-        can_rxbuffer->ptrWrite = can_rxbuffer->ptrWrite % can_rxbuffer->length;
+        if (element->newMsg == 1) {
+            /* Buffer full, the oldest messages are kept and this message is dropped */
+            if (rxstatistics != NULL) {
+                rxstatistics->nr_of_dropped_frames++;
+            }
+        } else {
+            /* Get message ID */
+            element->ID = msgID;
+
+            /* The task that parses the message may run much later, the time of the measurement is the reception */
+            element->timestamp = OS_getOSSysTick();
+            element->RTR = (uint8_t)0x02 & ptrHcan->Instance->sFIFOMailBox[FIFONumber].RIR;
+
+            /* Get the DLC */
+            element->DLC = (uint8_t)0x0F & ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDTR;
+
+            /* Get the data field */
+            element->Data[0] = (uint8_t)0xFF & ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDLR;
+            element->Data[1] = (uint8_t)0xFF & (ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDLR >> 8);
+            element->Data[2] = (uint8_t)0xFF & (ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDLR >> 16);
+            element->Data[3] = (uint8_t)0xFF & (ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDLR >> 24);
+            element->Data[4] = (uint8_t)0xFF & ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDHR;
+            element->Data[5] = (uint8_t)0xFF & (ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDHR >> 8);
+            element->Data[6] = (uint8_t)0xFF & (ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDHR >> 16);
+            element->Data[7] = (uint8_t)0xFF & (ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDHR >> 24);
+
+            /* Set to 1 after the data is complete to mark message as new received. Set to 0 when reading message from buffer */
+            element->newMsg = 1;
+
+            /* Increment write pointer */
+            can_rxbuffer->ptrWrite = (can_rxbuffer->ptrWrite + 1) % can_rxbuffer->length;
+
+            if (rxstatistics != NULL) {
+                uint8_t fillLevel = CAN_GetRxBufferFillLevel(can_rxbuffer);
+                if (fillLevel > rxstatistics->buffer_highwatermark) {
+                    rxstatistics->buffer_highwatermark = fillLevel;
+                }
+            }
+        }
 #endif
-    } else if (bypassLinkIndex < bufferbypasslength && can_rxmsgs != NULL && can_fastLinkIndex != NULL) {
+    } else if (rxlookup != NULL && rxlookup->bypass == 1) {
         /* ##### Buffer active but bypassed ##### */
 
 #if (CAN1_BUFFER_BYPASS_NUMBER_OF_IDs > 0 || CAN0_BUFFER_BYPASS_NUMBER_OF_IDs > 0) && (CAN_USE_CAN_NODE0 == 1 || CAN_USE_CAN_NODE1 == 1)
@@ -1124,8 +1540,8 @@ static STD_RETURN_TYPE_e CAN_RxMsg(CAN_NodeTypeDef_e canNode, CAN_HandleTypeDef*
         RTR = (uint8_t)0x02 & ptrHcan->Instance->sFIFOMailBox[FIFONumber].RIR;
 
         /* Call callback function */
-        if (can_rxmsgs[can_fastLinkIndex[bypassLinkIndex]].func != NULL) {
-            can_rxmsgs[can_fastLinkIndex[bypassLinkIndex]].func(msgID, &fastLinkBuffer[0], DLC, RTR);
+        if (can_rxmsgs[rxlookup->rxIndex].func != NULL) {
+            can_rxmsgs[rxlookup->rxIndex].func(msgID, &fastLinkBuffer[0], DLC, RTR);
         } else {
             /* No callback function defined */
             CAN_BufferBypass(canNode, msgID, &fastLinkBuffer[0], DLC, RTR);
@@ -1134,16 +1550,6 @@ static STD_RETURN_TYPE_e CAN_RxMsg(CAN_NodeTypeDef_e canNode, CAN_HandleTypeDef*
     } else {
         /* ##### Buffer not active ##### */
 
-        CAN_MSG_RX_TYPE_s* msgRXstruct;
-        uint8_t length;
-        if (canNode == CAN_NODE0) {
-            msgRXstruct = &can0_RxMsgs[0];
-            length = can_CAN0_rx_length;
-        } else {
-            msgRXstruct = &can1_RxMsgs[0];
-            length = can_CAN1_rx_length;
-        }
-
         /* Set the Id */
         ptrHcan->pRxMsg->StdId = msgID;
 
@@ -1161,16 +1567,9 @@ static STD_RETURN_TYPE_e CAN_RxMsg(CAN_NodeTypeDef_e canNode, CAN_HandleTypeDef*
         ptrHcan->pRxMsg->Data[6] = (uint8_t)0xFF & (ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDHR >> 16);
         ptrHcan->pRxMsg->Data[7] = (uint8_t)0xFF & (ptrHcan->Instance->sFIFOMailBox[FIFONumber].RDHR >> 24);
 
-        uint8_t i = 0;
-        for (; i < length; i++) {
-            if (msgRXstruct[i].ID == msgID) {
-                break;
-            }
-        }
-
         /* Interpret received message */
-        if (msgRXstruct[i].func != NULL) {
-            msgRXstruct[i].func(msgID, ptrHcan->pRxMsg->Data, ptrHcan->pRxMsg->DLC, ptrHcan->pRxMsg->RTR);
+        if (rxlookup != NULL && can_rxmsgs[rxlookup->rxIndex].func != NULL) {
+            can_rxmsgs[rxlookup->rxIndex].func(msgID, ptrHcan->pRxMsg->Data, ptrHcan->pRxMsg->DLC, ptrHcan->pRxMsg->RTR);
         } else {
             CAN_InterpretReceivedMsg(canNode, ptrHcan->pRxMsg->StdId, ptrHcan->pRxMsg->Data, ptrHcan->pRxMsg->DLC,
                 ptrHcan->pRxMsg->RTR);
@@ -1188,6 +1587,17 @@ static STD_RETURN_TYPE_e CAN_RxMsg(CAN_NodeTypeDef_e canNode, CAN_HandleTypeDef*
         __HAL_CAN_FIFO_RELEASE(ptrHcan, CAN_FIFO1);
     }
 
+    if (rxstatistics != NULL) {
+        rxstatistics->nr_of_frames++;
+        if (rxlookup == NULL) {
+            rxstatistics->nr_of_unknown_frames++;
+        }
+        rxstatistics->isr_cycles_last = MCU_GetCycleCounter() - startcycles;
+        if (rxstatistics->isr_cycles_last > rxstatistics->isr_cycles_max) {
+            rxstatistics->isr_cycles_max = rxstatistics->isr_cycles_last;
+        }
+    }
+
     /* Return function status */
     retVal = E_OK;
 
@@ -1195,6 +1605,137 @@ static STD_RETURN_TYPE_e CAN_RxMsg(CAN_NodeTypeDef_e canNode, CAN_HandleTypeDef*
 }
 
 
+
+uint8_t CAN_GetRxMessageIndex(CAN_NodeTypeDef_e canNode, uint32_t msgID) {
+    uint8_t retVal = CAN_RX_INVALID_INDEX;
+    const CAN_RX_LOOKUP_s* rxlookup = CAN_FindRxLookup(canNode, msgID);
+
+    if (rxlookup != NULL) {
+        retVal = rxlookup->rxIndex;
+    }
+    return retVal;
+}
+
+
+/**
+ * @brief  Searches a message ID in the receive lookup table of a CAN node
+ *
+ * Binary search for the first entry with the ID, so that the number of
+ * comparisons only grows with the logarithm of the number of received IDs.
+ *
+ * @param  canNode: CAN node
+ * @param  msgID:   message ID
+ *
+ * @retval pointer to the lookup entry, NULL if the ID is not configured
+ */
+static const CAN_RX_LOOKUP_s* CAN_FindRxLookup(CAN_NodeTypeDef_e canNode, uint32_t msgID) {
+    const CAN_RX_LOOKUP_s* rxlookup = NULL;
+    uint8_t length = 0;
+    uint8_t low = 0;
+    uint8_t high = 0;
+    uint8_t middle = 0;
+
+    if (canNode  ==  CAN_NODE0) {
+#if CAN_USE_CAN_NODE0 == 1
+        rxlookup = &can0_rxlookup[0];
+        length = can0_rxlookup_length;
+#endif
+    } else if (canNode  ==  CAN_NODE1) {
+#if CAN_USE_CAN_NODE1 == 1
+        rxlookup = &can1_rxlookup[0];
+        length = can1_rxlookup_length;
+#endif
+    }
+
+    if (rxlookup != NULL) {
+        high = length;
+        while (low < high) {
+            middle = low + (high - low) / 2;
+            if (rxlookup[middle].ID < msgID) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        if (low < length && rxlookup[low].ID == msgID) {
+            rxlookup = &rxlookup[low];
+        } else {
+            rxlookup = NULL;
+        }
+    }
+    return rxlookup;
+}
+
+
+void CAN_UpdateRxDispatchCycles(CAN_NodeTypeDef_e canNode, uint32_t cycles) {
+    CAN_RX_STATISTICS_s* rxstatistics = CAN_GetRxStatisticsPtr(canNode);
+
+    if (rxstatistics != NULL) {
+        rxstatistics->dispatch_cycles_last = cycles;
+        if (cycles > rxstatistics->dispatch_cycles_max) {
+            rxstatistics->dispatch_cycles_max = cycles;
+        }
+    }
+}
+
+
+STD_RETURN_TYPE_e CAN_GetRxStatistics(CAN_NodeTypeDef_e canNode, CAN_RX_STATISTICS_s *rxstatistics) {
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
+    CAN_RX_STATISTICS_s* nodestatistics = CAN_GetRxStatisticsPtr(canNode);
+
+    if (nodestatistics != NULL && rxstatistics != NULL) {
+        *rxstatistics = *nodestatistics;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+
+/**
+ * @brief  Gets the receive statistics of a CAN node
+ *
+ * @param  canNode: CAN node
+ *
+ * @retval pointer to the statistics, NULL if the node is not used
+ */
+static CAN_RX_STATISTICS_s* CAN_GetRxStatisticsPtr(CAN_NodeTypeDef_e canNode) {
+    CAN_RX_STATISTICS_s* rxstatistics = NULL;
+
+    if (canNode  ==  CAN_NODE0) {
+#if CAN_USE_CAN_NODE0 == 1
+        rxstatistics = &can0_rxstatistics;
+#endif
+    } else if (canNode  ==  CAN_NODE1) {
+#if CAN_USE_CAN_NODE1 == 1
+        rxstatistics = &can1_rxstatistics;
+#endif
+    }
+    return rxstatistics;
+}
+
+
+/**
+ * @brief  Gets the number of messages waiting in a receive buffer
+ *
+ * @param  can_rxbuffer: receive buffer
+ *
+ * @retval number of unread messages
+ */
+static uint8_t CAN_GetRxBufferFillLevel(CAN_RX_BUFFER_s* can_rxbuffer) {
+    uint8_t fillLevel = 0;
+
+    if (can_rxbuffer->ptrWrite  ==  can_rxbuffer->ptrRead) {
+        /* buffer is either empty or full */
+        if (can_rxbuffer->buffer[can_rxbuffer->ptrRead].newMsg != 0) {
+            fillLevel = can_rxbuffer->length;
+        }
+    } else {
+        fillLevel = (can_rxbuffer->ptrWrite + can_rxbuffer->length - can_rxbuffer->ptrRead) % can_rxbuffer->length;
+    }
+    return fillLevel;
+}
+
+
 STD_RETURN_TYPE_e CAN_ReceiveBuffer(CAN_NodeTypeDef_e canNode, Can_PduType* msg) {
     /* E_OK is returned, if buffer is empty and interpret function is called successful */
     STD_RETURN_TYPE_e retVal = E_NOT_OK;
@@ -1219,22 +1760,24 @@ STD_RETURN_TYPE_e CAN_ReceiveBuffer(CAN_NodeTypeDef_e canNode, Can_PduType* msg)
         can_rxbuffer = NULL;
     }
 
-    if (can_rxbuffer->ptrWrite
-            != can_rxbuffer->ptrRead&& can_rxbuffer->buffer[can_rxbuffer->ptrRead].newMsg  ==  1 && can_rxbuffer != NULL) {
+    if (can_rxbuffer != NULL && can_rxbuffer->buffer[can_rxbuffer->ptrRead].newMsg  ==  1) {
         /* buffer not empty */
-        msg->id = can_rxbuffer->buffer[can_rxbuffer->ptrRead].ID;
-        msg->dlc = can_rxbuffer->buffer[can_rxbuffer->ptrRead].DLC;
+        CAN_RX_BUFFERELEMENT_s* element = &can_rxbuffer->buffer[can_rxbuffer->ptrRead];
+
+        msg->id = element->ID;
+        msg->dlc = element->DLC;
+        msg->timestamp = element->timestamp;
 
         for (int i = 0; i < 8; i++) {
-            msg->sdu[i] = can_rxbuffer->buffer[can_rxbuffer->ptrRead].Data[i];
+            msg->sdu[i] = element->Data[i];
         }
 
-        /* Set to 0 to mark buffer entry as read. Set to 1 when writing message into buffer */
-        can_rxbuffer->buffer[can_rxbuffer->ptrRead].newMsg = 0;
+        /* Move to next buffer element before the element is released, so that
+         * the receive interrupt never writes into the element being read */
+        can_rxbuffer->ptrRead = (can_rxbuffer->ptrRead + 1) % can_rxbuffer->length;
 
-        /* Move to next buffer element */
-        can_rxbuffer->ptrRead++;
-        can_rxbuffer->ptrRead = can_rxbuffer->ptrRead % can_rxbuffer->length;
+        /* Set to 0 to mark buffer entry as read. Set to 1 when writing message into buffer */
+        element->newMsg = 0;
         retVal = E_OK;
     }
 #endif
@@ -73,6 +73,26 @@
 #define CAN1_TX_BUFFER_LENGTH    CAN1_TRANSMIT_BUFFER_LENGTH
 #define CAN1_RX_BUFFER_LENGTH    CAN1_RECEIVE_BUFFER_LENGTH
 
+/**
+ * length of the window over which the transmitted frames per second and the bus load are calculated in ms
+ */
+#define CAN_TX_RATE_WINDOW_MS    1000
+
+/**
+ * index returned by CAN_GetRxMessageIndex() for IDs that are not configured
+ */
+#define CAN_RX_INVALID_INDEX     0xFFu
+
+/**
+ * number of transmit mailboxes of a CAN node
+ */
+#define CAN_NR_OF_TX_MAILBOXES   3u
+
+/**
+ * number of bins of the queueing delay histogram, the bin limits are set in can.c
+ */
+#define CAN_TX_DELAY_HISTOGRAM_BINS  8u
+
 typedef enum {
     CAN_ERROR_NONE = HAL_CAN_ERROR_NONE, /*!< No error             */
     CAN_ERROR_EWG = HAL_CAN_ERROR_EWG, /*!< EWG error            */
@@ -102,12 +122,20 @@ typedef struct CAN_RX_BUFFERELEMENT {
     uint8_t DLC;
     uint8_t RTR;
     uint8_t Data[8];
-    uint8_t newMsg;
+    uint32_t timestamp;         /*!< OS tick in ms at the reception of the message */
+    volatile uint8_t newMsg;    /*!< 1 while the element holds a message that has not been read */
 } CAN_RX_BUFFERELEMENT_s;
 
+/**
+ * receive buffer of a CAN node
+ *
+ * Single producer (receive interrupt), single consumer (CAN_ReceiveBuffer()).
+ * An element is full as long as its newMsg flag is set, a message received
+ * while the element at ptrWrite is full is dropped and counted.
+ */
 typedef struct CAN_RX_BUFFER {
-    uint8_t ptrRead;
-    uint8_t ptrWrite;
+    volatile uint8_t ptrRead;
+    volatile uint8_t ptrWrite;
     uint8_t length;
     CAN_RX_BUFFERELEMENT_s* buffer;
 } CAN_RX_BUFFER_s;
@@ -115,6 +143,7 @@ typedef struct CAN_RX_BUFFER {
 typedef struct CAN_TX_BUFFERELEMENT {
     CanTxMsgTypeDef msg;
     uint8_t newMsg;
+    uint32_t enqueuecycles;     /*!< core clock cycle counter when the message was added by CAN_Send() */
 } CAN_TX_BUFFERELEMENT_s;
 
 typedef struct CAN_TX_BUFFER {
@@ -124,6 +153,77 @@ typedef struct CAN_TX_BUFFER {
     CAN_TX_BUFFERELEMENT_s* buffer;
 } CAN_TX_BUFFER_s;
 
+/**
+ * transmit statistics of a CAN node
+ */
+typedef struct CAN_TX_STATISTICS {
+    uint32_t nr_of_frames;              /*!< frames transmitted successfully                                */
+    uint32_t nr_of_failed_frames;       /*!< transmissions completed without success (e.g. aborted)         */
+    uint32_t nr_of_dropped_frames;      /*!< frames not added because the transmit buffer was full          */
+    uint16_t frames_per_second;         /*!< frames transmitted successfully during the last rate window    */
+    uint8_t buffer_highwatermark;       /*!< maximum number of frames waiting in the transmit buffer        */
+    uint32_t window_starttime;          /*!< start of the current rate window in ms                         */
+    uint32_t window_startframes;        /*!< nr_of_frames at the start of the current rate window           */
+} CAN_TX_STATISTICS_s;
+
+/**
+ * frames in the transmit mailboxes of a CAN node
+ */
+typedef struct CAN_TX_MAILBOX {
+    uint32_t enqueuecycles[CAN_NR_OF_TX_MAILBOXES];   /*!< core clock cycle counter when the frame was added to the buffer */
+    uint8_t bits[CAN_NR_OF_TX_MAILBOXES];             /*!< length of the frame on the bus in bits                          */
+} CAN_TX_MAILBOX_s;
+
+/**
+ * bus statistics of a CAN node
+ *
+ * The queueing delay of a frame is the time from CAN_Send() until the frame is
+ * loaded into a transmit mailbox, the latency the time from CAN_Send() until
+ * the transmission is completed. The bus load is estimated from the length of
+ * the frames transmitted and received, including the worst case number of
+ * stuff bits.
+ */
+typedef struct CAN_BUS_STATISTICS {
+    uint16_t busload_permille;          /*!< bus load during the last window in 0.1 %                       */
+    uint16_t errors_per_second;         /*!< errors counted in CAN_ERROR_s during the last window per second */
+    uint8_t tx_error_counter;           /*!< transmit error counter (TEC) at the end of the last window     */
+    uint8_t rx_error_counter;           /*!< receive error counter (REC) at the end of the last window      */
+    uint32_t tx_delay_last_us;          /*!< queueing delay of the last frame                               */
+    uint32_t tx_delay_max_us;           /*!< maximum queueing delay                                         */
+    uint32_t tx_delay_window_max_us;    /*!< maximum queueing delay during the last window                  */
+    uint32_t tx_latency_last_us;        /*!< latency of the last frame                                      */
+    uint32_t tx_latency_max_us;         /*!< maximum latency                                                */
+    uint32_t tx_delay_histogram[CAN_TX_DELAY_HISTOGRAM_BINS];   /*!< number of frames per queueing delay bin */
+    CAN_TX_MAILBOX_s txmailbox;         /*!< frames in the transmit mailboxes                               */
+    uint32_t window_bits;               /*!< bits transmitted and received during the current window        */
+    uint32_t window_delay_max_us;       /*!< maximum queueing delay during the current window               */
+    uint32_t window_starttime;          /*!< start of the current window in ms                              */
+    uint32_t window_starterrors;        /*!< sum of the error counters at the start of the current window   */
+} CAN_BUS_STATISTICS_s;
+
+/**
+ * entry of the receive lookup table of a CAN node, sorted by ID
+ */
+typedef struct CAN_RX_LOOKUP {
+    uint32_t ID;                        /*!< message ID                                                     */
+    uint8_t rxIndex;                    /*!< index of the message in the receive configuration              */
+    uint8_t bypass;                     /*!< 1 if the message bypasses the receive buffer, otherwise 0      */
+} CAN_RX_LOOKUP_s;
+
+/**
+ * receive statistics of a CAN node
+ */
+typedef struct CAN_RX_STATISTICS {
+    uint32_t nr_of_frames;              /*!< frames received                                                */
+    uint32_t nr_of_unknown_frames;      /*!< frames received with an ID that is not configured              */
+    uint32_t nr_of_dropped_frames;      /*!< frames dropped because the receive buffer was full             */
+    uint8_t buffer_highwatermark;       /*!< maximum number of frames waiting in the receive buffer         */
+    uint32_t isr_cycles_last;           /*!< core clock cycles needed in the ISR for the last frame         */
+    uint32_t isr_cycles_max;            /*!< maximum core clock cycles needed in the ISR for a frame        */
+    uint32_t dispatch_cycles_last;      /*!< core clock cycles needed to look up and parse the last frame   */
+    uint32_t dispatch_cycles_max;       /*!< maximum core clock cycles needed to look up and parse a frame  */
+} CAN_RX_STATISTICS_s;
+
 /*================== Constant and Variable Definitions ====================*/
 /**
  * @brief  CAN listen only transceiver mode of CAN node 0
@@ -213,7 +313,11 @@ extern STD_RETURN_TYPE_e CAN_Send(CAN_NodeTypeDef_e canNode, uint32_t msgID, uin
         uint32_t msgLength, uint32_t RTR);
 
 /**
- * @brief  Transmits a can message from transmit buffer
+ * @brief  Transmits can messages from transmit buffer
+ *
+ *         Messages are handed to the hardware until all three transmit mailboxes
+ *         are full or the buffer is empty. The transmit mailbox empty interrupt
+ *         refills the mailboxes in the same way.
  *
  *         ------------------------ IMPORTANT!!!! --------------------------------
  *         Make sure that this function is not interrupted by the operating system
@@ -221,10 +325,56 @@ extern STD_RETURN_TYPE_e CAN_Send(CAN_NodeTypeDef_e canNode, uint32_t msgID, uin
  *
  * @param canNode:  canNode on which the message shall be transmitted
  *
- * @retval E_OK if transmission successful, otherwise E_NOT_OK
+ * @retval E_OK if at least one message was handed to the hardware, otherwise E_NOT_OK
  */
 extern STD_RETURN_TYPE_e CAN_TxMsgBuffer(CAN_NodeTypeDef_e canNode);
 
+/**
+ * @brief  Updates the transmitted frames per second of a CAN node
+ *
+ *         The rate is calculated over windows of CAN_TX_RATE_WINDOW_MS and must be
+ *         updated cyclically with a period much shorter than the window.
+ *
+ * @param canNode:    CAN node
+ * @param timestamp:  current time in ms
+ *
+ * @retval none (void)
+ */
+extern void CAN_UpdateTxRate(CAN_NodeTypeDef_e canNode, uint32_t timestamp);
+
+/**
+ * @brief  Gets the transmit statistics of a CAN node
+ *
+ * @param canNode:       CAN node
+ * @param txstatistics:  pointer where to store the statistics
+ *
+ * @retval E_OK if the node is used, otherwise E_NOT_OK
+ */
+extern STD_RETURN_TYPE_e CAN_GetTxStatistics(CAN_NodeTypeDef_e canNode, CAN_TX_STATISTICS_s *txstatistics);
+
+/**
+ * @brief  Updates the bus load, the error rate and the error counters of a CAN node
+ *
+ *         The values are calculated over windows of CAN_TX_RATE_WINDOW_MS and must be
+ *         updated cyclically with a period much shorter than the window.
+ *
+ * @param canNode:    CAN node
+ * @param timestamp:  current time in ms
+ *
+ * @retval none (void)
+ */
+extern void CAN_UpdateBusStatistics(CAN_NodeTypeDef_e canNode, uint32_t timestamp);
+
+/**
+ * @brief  Gets the bus statistics of a CAN node
+ *
+ * @param canNode:        CAN node
+ * @param busstatistics:  pointer where to store the statistics
+ *
+ * @retval E_OK if the node is used, otherwise E_NOT_OK
+ */
+extern STD_RETURN_TYPE_e CAN_GetBusStatistics(CAN_NodeTypeDef_e canNode, CAN_BUS_STATISTICS_s *busstatistics);
+
 /* Read Message */
 
 /**
@@ -237,6 +387,41 @@ extern STD_RETURN_TYPE_e CAN_TxMsgBuffer(CAN_NodeTypeDef_e canNode);
  */
 extern STD_RETURN_TYPE_e CAN_ReceiveBuffer(CAN_NodeTypeDef_e canNode, Can_PduType* msg);
 
+/**
+ * @brief  Looks up a received message ID in the receive configuration of a CAN node
+ *
+ *         The lookup is a binary search over the IDs of can0_RxMsgs[] respectively
+ *         can1_RxMsgs[], sorted in CAN_Init(). It is used by the receive interrupt
+ *         and by the parsing of buffered messages.
+ *
+ * @param canNode:  CAN node
+ * @param msgID:    message ID
+ *
+ * @retval index of the message in the receive configuration of the node,
+ *         CAN_RX_INVALID_INDEX if the ID is not configured
+ */
+extern uint8_t CAN_GetRxMessageIndex(CAN_NodeTypeDef_e canNode, uint32_t msgID);
+
+/**
+ * @brief  Records the core clock cycles needed to dispatch a buffered message
+ *
+ * @param canNode:  CAN node on which the message has been received
+ * @param cycles:   core clock cycles needed to look up and parse the message
+ *
+ * @retval none (void)
+ */
+extern void CAN_UpdateRxDispatchCycles(CAN_NodeTypeDef_e canNode, uint32_t cycles);
+
+/**
+ * @brief  Gets the receive statistics of a CAN node
+ *
+ * @param canNode:       CAN node
+ * @param rxstatistics:  pointer where to store the statistics
+ *
+ * @retval E_OK if the node is used, otherwise E_NOT_OK
+ */
+extern STD_RETURN_TYPE_e CAN_GetRxStatistics(CAN_NodeTypeDef_e canNode, CAN_RX_STATISTICS_s *rxstatistics);
+
 /* Sleep mode */
 
 /**
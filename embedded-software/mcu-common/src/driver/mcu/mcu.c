@@ -163,6 +163,25 @@ uint32_t MCU_SystemResetStatus(uint32_t* regValue) {
 }
 
 
+void MCU_InitCycleCounter(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;     /* enable trace and debug blocks (DWT) */
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+uint32_t MCU_GetCycleCounter(void) {
+    return (DWT->CYCCNT);
+}
+
+uint32_t MCU_CyclesToMicroseconds(uint32_t cycles) {
+    return (cycles / (SystemCoreClock / 1000000));
+}
+
+uint32_t MCU_MicrosecondsToCycles(uint32_t microseconds) {
+    return (microseconds * (SystemCoreClock / 1000000));
+}
+
+
 void MCU_GetDeviceID(MCU_DeviceID_s * deviceID) {
     /* Base address of device ID register  0x1FFF 7A10 */
     deviceID->off0 = (*(volatile uint32_t *)(0x1FFF7A10 + 0x0));
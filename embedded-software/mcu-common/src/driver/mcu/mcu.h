@@ -112,6 +112,40 @@ extern uint32_t MCU_SystemResetStatus(uint32_t* regValue);
  */
 extern uint32_t MCU_GetTimeBase(void);
 
+/**
+ * @brief   enables the DWT cycle counter of the Cortex-M4 core
+ *
+ * The counter runs with the core clock and wraps around after 2^32 cycles
+ * (about 23s at 180MHz), differences of two readings are therefore only
+ * valid for shorter intervals.
+ */
+extern void MCU_InitCycleCounter(void);
+
+/**
+ * @brief   gets the current value of the DWT cycle counter
+ *
+ * @return  number of core clock cycles since MCU_InitCycleCounter()
+ */
+extern uint32_t MCU_GetCycleCounter(void);
+
+/**
+ * @brief   converts a number of core clock cycles to microseconds
+ *
+ * @param   cycles  difference of two readings of MCU_GetCycleCounter()
+ *
+ * @return  time in microseconds
+ */
+extern uint32_t MCU_CyclesToMicroseconds(uint32_t cycles);
+
+/**
+ * @brief   converts microseconds to a number of core clock cycles
+ *
+ * @param   microseconds  time in microseconds
+ *
+ * @return  number of core clock cycles, to compare with differences of MCU_GetCycleCounter()
+ */
+extern uint32_t MCU_MicrosecondsToCycles(uint32_t microseconds);
+
 /**
  * @brief   Get unique device ID
  */
@@ -71,6 +71,11 @@ static SPI_STATE_s spi_state = {
 
 const uint8_t spi_cmdDummy[1]={0x00};
 
+/**
+ * function called when a transmission on the main isoSPI interface has finished
+ */
+static SPI_TRANSFER_COMPLETE_CALLBACK_f spi_transferCompleteCallback = NULL_PTR;
+
 /*================== Function Prototypes ==================================*/
 void SPI_Wait(void);
 STD_RETURN_TYPE_e SPI_SendDummyByte(uint8_t busID, SPI_HandleType_s *hspi);
@@ -125,6 +130,9 @@ void HAL_SPI_TxRxCpltCallback(SPI_HandleType_s *hspi) {
             spi_state.dummyByte_ongoing = FALSE;
         } else {
             spi_state.transmit_ongoing = FALSE;
+            if (spi_transferCompleteCallback != NULL_PTR) {
+                spi_transferCompleteCallback();
+            }
         }
     }
     if (hspi  ==  &spi_devices[1]) {
@@ -147,6 +155,9 @@ void HAL_SPI_TxCpltCallback(SPI_HandleType_s *hspi) {
             spi_state.dummyByte_ongoing = FALSE;
         } else {
             spi_state.transmit_ongoing = FALSE;
+            if (spi_transferCompleteCallback != NULL_PTR) {
+                spi_transferCompleteCallback();
+            }
         }
     }
 
@@ -316,3 +327,7 @@ extern STD_RETURN_TYPE_e SPI_IsTransmitOngoing(void) {
 extern void SPI_SetTransmitOngoing(void) {
     spi_state.transmit_ongoing = TRUE;
 }
+
+void SPI_SetTransferCompleteCallback(SPI_TRANSFER_COMPLETE_CALLBACK_f callback) {
+    spi_transferCompleteCallback = callback;
+}
@@ -69,6 +69,12 @@ typedef struct {
     uint8_t counter;                  /*!< general purpose counter */
 } SPI_STATE_s;
 
+/**
+ * function called from interrupt context when a transmission on the main isoSPI
+ * interface has finished
+ */
+typedef void (*SPI_TRANSFER_COMPLETE_CALLBACK_f)(void);
+
 /*================== Constant and Variable Definitions ====================*/
 
 /*================== Function Prototypes ==================================*/
@@ -154,6 +160,16 @@ extern STD_RETURN_TYPE_e SPI_IsTransmitOngoing(void);
  */
 extern void SPI_SetTransmitOngoing(void);
 
+/**
+ * @brief   registers a function that is called when a transmission on the main isoSPI interface has finished.
+ *
+ * The callback is executed in the SPI/DMA interrupt after the transmit status has been reset.
+ * It is not called for the wake-up dummy byte.
+ *
+ * @param   callback    function to call, NULL_PTR to remove the callback
+ */
+extern void SPI_SetTransferCompleteCallback(SPI_TRANSFER_COMPLETE_CALLBACK_f callback);
+
 
 
 /*================== Function Implementations =============================*/
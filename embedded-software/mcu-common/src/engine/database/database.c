@@ -59,17 +59,68 @@
 
 /*================== Macros and Definitions ===============================*/
 /**
- * Maximum queue timeout time in milliseconds
+ * Maximum time in milliseconds a writer waits for another writer of the same
+ * data block to finish
  */
-#define DATA_QUEUE_TIMEOUT_MS   10
+#define DATA_WRITE_TIMEOUT_MS   10
+
+/**
+ * Cycle time of the database task in milliseconds
+ */
+#define DATA_TASK_CYCLE_MS      1
+
+/**
+ * Number of lock-free read attempts before a reader falls back to copying the
+ * data block inside a critical section
+ */
+#define DATA_READ_MAX_RETRIES   3
+
+/**
+ * Prevents the compiler and the CPU from reordering memory accesses across
+ * the sequence counter accesses. Can be predefined for builds on other
+ * targets, e.g., the host tests in tools/hosttest.
+ */
+#ifndef DATA_MEMORY_BARRIER
+#define DATA_MEMORY_BARRIER()   __asm volatile ("dmb" ::: "memory")
+#endif
 
 /*================== Constant and Variable Definitions ====================*/
 /* FIXME Some uninitialized variables */
 static DATA_BLOCK_ACCESS_s data_block_access[DATA_MAX_BLOCK_NR];
+
+/**
+ * One mutex per data block to serialize concurrent writers. Readers never
+ * take this mutex.
+ */
 static SemaphoreHandle_t data_base_mutex[DATA_MAX_BLOCK_NR];
-QueueHandle_t data_queue;
+
+/**
+ * subscriptions of tasks to data blocks
+ */
+static DATA_SUBSCRIPTION_s data_subscriptions[DATA_MAX_SUBSCRIPTIONS];
+
+/**
+ * number of used entries in data_subscriptions
+ */
+static uint8_t data_nr_of_subscriptions = 0;
+
+#if DATA_ENABLE_ACCESS_STATISTICS == 1
+/**
+ * access statistics of every data block
+ */
+static DATA_ACCESS_STATISTICS_s data_access_statistics[DATA_MAX_BLOCK_NR];
+#endif
 
 /*================== Function Prototypes ==================================*/
+static uint8_t DATA_IsValidRange(DATA_BLOCK_ID_TYPE_e blockID, uint16_t offset, uint16_t length);
+static void DATA_SetTimestamp(void *blockptr);
+static void DATA_CopyRanges(DATA_BLOCK_ID_TYPE_e blockID, const DATA_BLOCK_RANGE_s *ranges, uint8_t nr_of_ranges);
+static STD_RETURN_TYPE_e DATA_WriteBlockData(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e blockID, uint16_t offset, uint16_t length);
+static void DATA_CommitBlock(DATA_BLOCK_ID_TYPE_e blockID, void *srcdataptr, uint16_t offset, uint16_t length);
+static void DATA_NotifySubscribers(DATA_BLOCK_ID_TYPE_e blockID);
+#if DATA_ENABLE_ACCESS_STATISTICS == 1
+static void DATA_RecordLatency(DATA_LATENCY_s *latency, uint32_t starttime);
+#endif
 
 /*================== Function Implementations =============================*/
 
@@ -83,33 +134,24 @@ void DATA_Init(void) {
         }
     }
 
-    /* FIXME What is mymessage structures? */
-    /* Create a queue capable of containing 10 pointers to mymessage structures.
-       These should be passed by pointer as they contain a lot of data.
-       data_queueID = xQueueCreate(devptr->nr_of_blockheader, sizeof(DATA_QUEUE_MESSAGE_s)); */    /* FIXME number of queues=1 should be enough */
-
-/*     if (data_queueID  ==  NULL_PTR) {
-             Failed to create the queue
-           ;   @ TODO Error Handling
-       }
-*/
-
     /* Iterate over database and set respective read/write pointer for each database entry */
     for (uint16_t i = 0; i < data_base_dev.nr_of_blockheader; i++) {
         /* Set write pointer to database entry */
-        data_block_access[i].WRptr = (void*)*(uint32_t*)(data_base_dev.blockheaderptr + i);
+        data_block_access[i].WRptr = (data_base_dev.blockheaderptr + i)->blockptr;
 
         /* Set read pointer */
         if ((data_base_dev.blockheaderptr + i)->buffertype  ==  DOUBLE_BUFFERING) {
             /* If database entry is double buffered -> set read pointer to
              * second section. After writing first database entry, pointer are
              * swapped and read pointer then points to written entry. */
-            data_block_access[i].RDptr = (void*)((uint32_t)data_block_access[i].WRptr + (data_base_dev.blockheaderptr + i)->datalength);
+            data_block_access[i].RDptr = (void*)((uint8_t *)data_block_access[i].WRptr + (data_base_dev.blockheaderptr + i)->datalength);
 
         } else {
             /* Single buffering -> read = write pointer */
             data_block_access[i].RDptr = data_block_access[i].WRptr;
         }
+        data_block_access[i].nr_of_buffer = (data_base_dev.blockheaderptr + i)->buffertype;
+        data_block_access[i].sequence = 0;
 
         /* Initialize database entry with 0, set read and write pointer in case double
          * buffering is used for database entries */
@@ -129,155 +171,211 @@ void DATA_Init(void) {
 
         /* Create a mutex for each database entry */
         data_base_mutex[i] = xSemaphoreCreateMutex();
+
+        if (data_base_mutex[i] == NULL_PTR) {
+            /* Failed to create the mutex */
+            /* @ TODO Error Handling */
+            while (1) {
+                /* TODO: explain why infinite loop */
+            }
+        }
     }
+}
 
-    /* Create queue to transfer data to/from database */
 
-    /* Create a queue capable of containing a pointer of type DATA_QUEUE_MESSAGE_s
-    Data of Messages are passed by pointer as they contain a lot of data. */
-    data_queue = xQueueCreate(1, sizeof(DATA_QUEUE_MESSAGE_s));
+STD_RETURN_TYPE_e DB_WriteBlock(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e  blockID) {
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
 
-    if (data_queue == NULL_PTR) {
-        /* Failed to create the queue */
-        /* @ TODO Error Handling */
-        while (1) {
-            /* TODO: explain why infinite loop */
-        }
+    if (blockID < DATA_MAX_BLOCK_NR) {  /* plausibility check */
+        retVal = DATA_WriteBlockData(dataptrfromSender, blockID, 0, (data_base_dev.blockheaderptr + blockID)->datalength);
+    }
+
+    return retVal;
+}
+
+
+STD_RETURN_TYPE_e DB_WriteBlockPartial(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e  blockID, uint16_t offset, uint16_t length) {
+    return DATA_WriteBlockData(dataptrfromSender, blockID, offset, length);
+}
+
+
+void DATA_Task(void) {
+    DIAG_SysMonNotify(DIAG_SYSMON_DATABASE_ID, 0);        /* task is running, state = ok */
+    OS_taskDelay(DATA_TASK_CYCLE_MS);
+}
+
+
+STD_RETURN_TYPE_e DB_ReadBlock(void *dataptrtoReceiver, DATA_BLOCK_ID_TYPE_e  blockID) {
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
+
+    if (blockID < DATA_MAX_BLOCK_NR) {  /* plausibility check */
+        retVal = DB_ReadBlockPartial(dataptrtoReceiver, blockID, 0, (data_base_dev.blockheaderptr + blockID)->datalength);
     }
+
+    return retVal;
 }
 
 
-void DB_WriteBlock(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e  blockID) {
-    /* dataptrfromSender is a pointer to data of caller function
-       dataptr_toptr_fromSender is a pointer to this pointer
-       this is used for passing message variable by reference
-       note: xQueueSend() always takes message variable by value */
-    DATA_QUEUE_MESSAGE_s data_send_msg;
-    TickType_t queuetimeout;
+STD_RETURN_TYPE_e DB_ReadBlockPartial(void *dataptrtoReceiver, DATA_BLOCK_ID_TYPE_e  blockID, uint16_t offset, uint16_t length) {
+    DATA_BLOCK_RANGE_s range;
+
+    range.dataptrtoReceiver = dataptrtoReceiver;
+    range.offset = offset;
+    range.length = length;
+
+    return DB_ReadBlockRanges(&range, 1, blockID);
+}
+
+
+STD_RETURN_TYPE_e DB_ReadBlockRanges(const DATA_BLOCK_RANGE_s *ranges, uint8_t nr_of_ranges, DATA_BLOCK_ID_TYPE_e  blockID) {
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
+    uint32_t sequence;
+    uint32_t starttime = OS_getOSSysTick();
+    uint8_t retries = 0;
+    uint8_t locked = FALSE;
+    uint8_t validRanges = FALSE;
 
     if (vPortCheckCriticalSection()) {
         configASSERT(0);
     }
 
-    queuetimeout = DATA_QUEUE_TIMEOUT_MS / portTICK_RATE_MS;
-    if (queuetimeout == 0) {
-        queuetimeout = 1;
+    if ((ranges != NULL_PTR) && (nr_of_ranges > 0)) {  /* plausibility check */
+        validRanges = TRUE;
+        for (uint8_t r = 0; r < nr_of_ranges; r++) {
+            if (!DATA_IsValidRange(blockID, ranges[r].offset, ranges[r].length) || (ranges[r].dataptrtoReceiver == NULL_PTR)) {
+                validRanges = FALSE;
+            }
+        }
     }
 
-    /* prepare send message with attributes of data block */
-    data_send_msg.blockID = blockID;
-    data_send_msg.value.voidptr = dataptrfromSender;
-    data_send_msg.accesstype = WRITE_ACCESS;
-    /* Send a pointer to a message object and
-       maximum block time: queuetimeout */
-    xQueueSend(data_queue, (void *) &data_send_msg, queuetimeout);
+    if (validRanges == TRUE) {
+        for (uint8_t i = 0; (i < DATA_READ_MAX_RETRIES) && (retVal == E_NOT_OK); i++) {
+            sequence = data_block_access[blockID].sequence;
+            if ((sequence & 1u) == 0) {
+                DATA_MEMORY_BARRIER();
+                DATA_CopyRanges(blockID, ranges, nr_of_ranges);
+                DATA_MEMORY_BARRIER();
+                if (data_block_access[blockID].sequence == sequence) {
+                    /* No commit took place while copying -> copy is consistent */
+                    retVal = E_OK;
+                }
+            }
+            if (retVal == E_NOT_OK) {
+                retries++;
+            }
+        }
+
+        if (retVal == E_NOT_OK) {
+            /* Writers with higher priority committed during every attempt:
+             * copy once with the scheduler locked, which takes bounded time */
+            OS_TaskEnter_Critical();
+            DATA_CopyRanges(blockID, ranges, nr_of_ranges);
+            OS_TaskExit_Critical();
+            locked = TRUE;
+            retVal = E_OK;
+        }
+
+#if DATA_ENABLE_ACCESS_STATISTICS == 1
+        OS_TaskEnter_Critical();
+        DATA_RecordLatency(&data_access_statistics[blockID].read, starttime);
+        data_access_statistics[blockID].read_retries += retries;
+        if (locked == TRUE) {
+            data_access_statistics[blockID].read_locked++;
+        }
+        OS_TaskExit_Critical();
+#endif
+    }
+
+    return retVal;
 }
 
 
-void DATA_Task(void) {
-    DATA_QUEUE_MESSAGE_s receive_msg;
-    void *srcdataptr;
-    void *dstdataptr;
-    DATA_BLOCK_ID_TYPE_e blockID;
-    DATA_BLOCK_ACCESS_TYPE_e    accesstype; /* read or write access type */
-    uint16_t datalength;
-    DATA_BLOCK_BUFFER_TYPE_e buffertype;
-
-    if (data_queue != NULL_PTR) {
-        if (xQueueReceive(data_queue, (&receive_msg), (TickType_t) 1)) {  /* scan queue and wait for a message up to a maximum amount of 1ms (block time) */
-            /* ptrrcvmessage now points to message of sender which contains data pointer and data block ID */
-            blockID = receive_msg.blockID;
-            srcdataptr = receive_msg.value.voidptr;
-            accesstype = receive_msg.accesstype;
-            if ((blockID < DATA_MAX_BLOCK_NR) && (srcdataptr != NULL_PTR)) {  /* plausibility check */
-                /* get entries of blockheader and write pointer */
-                if (accesstype == WRITE_ACCESS) {
-                    /* write access to data blocks */
-                    datalength = (data_base_dev.blockheaderptr + blockID)->datalength;
-                    buffertype = (data_base_dev.blockheaderptr + blockID)->buffertype;
-                    dstdataptr = data_block_access[blockID].WRptr;
-
-                    /* Check if there any read accesses taking place (in tasks with lower priorities)*/
-                    if (xSemaphoreTake(data_base_mutex[blockID], 0)  ==  TRUE) {
-                        uint32_t *previousTimestampptr = NULL_PTR;
-                        uint32_t *timestampptr = NULL_PTR;
-
-                        /* Set timestamp pointer */
-                        timestampptr = (uint32_t *)srcdataptr;
-                        /* Set previous timestampptr */
-                        previousTimestampptr = (uint32_t *)srcdataptr;
-                        previousTimestampptr++;
-
-                        /* Write previous timestamp */
-                        *previousTimestampptr = *timestampptr;
-                        /* Write timestamp */
-                        *(uint32_t *)srcdataptr = OS_getOSSysTick();
-
-                        memcpy(dstdataptr, srcdataptr, datalength);
-                        xSemaphoreGive(data_base_mutex[blockID]);
-                        if (buffertype  ==  DOUBLE_BUFFERING) {
-                            /* swap the WR and RD pointers:
-                               WRptr always points to buffer to be written next time and changed afterwards
-                               RDptr always points to buffer to be read next time */
-                            data_block_access[blockID].WRptr = data_block_access[blockID].RDptr;
-                            data_block_access[blockID].RDptr = dstdataptr;
-                        }
-                    } else {
-                        dstdataptr = data_block_access[blockID].WRptr;
-                    }
-                } else if (accesstype == READ_ACCESS) {
-                    /* Read access to data blocks */
-                    datalength = (data_base_dev.blockheaderptr + blockID)->datalength;
-                    buffertype = (data_base_dev.blockheaderptr + blockID)->buffertype;
-                    dstdataptr = srcdataptr;
-
-                    if (buffertype  ==  DOUBLE_BUFFERING) {
-                        if (xSemaphoreTake(data_base_mutex[blockID], 0)  ==  TRUE) {
-                            srcdataptr = data_block_access[blockID].RDptr;
-                            if (srcdataptr != NULL_PTR) {
-                                memcpy(dstdataptr, srcdataptr, datalength);
-                                xSemaphoreGive(data_base_mutex[blockID]);
-                            }
-                        }
-                    } else if (buffertype  ==  SINGLE_BUFFERING) {
-                            srcdataptr = data_block_access[blockID].RDptr;
-                            if (srcdataptr != NULL_PTR) {
-                                memcpy(dstdataptr, srcdataptr, datalength);
-                            }
-                    }
-                } else {
-            /* TODO: explain why empty else */
-                }
-            }
+STD_RETURN_TYPE_e DATA_Subscribe(DATA_BLOCK_ID_TYPE_e blockID, TaskHandle_t task, uint32_t notificationBits) {
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
+
+    if ((blockID < DATA_MAX_BLOCK_NR) && (task != NULL_PTR)) {
+        OS_TaskEnter_Critical();
+        if (data_nr_of_subscriptions < DATA_MAX_SUBSCRIPTIONS) {
+            data_subscriptions[data_nr_of_subscriptions].blockID = blockID;
+            data_subscriptions[data_nr_of_subscriptions].task = task;
+            data_subscriptions[data_nr_of_subscriptions].notificationBits = notificationBits;
+            data_nr_of_subscriptions++;
+            retVal = E_OK;
         }
-        DIAG_SysMonNotify(DIAG_SYSMON_DATABASE_ID, 0);        /* task is running, state = ok */
+        OS_TaskExit_Critical();
     }
+
+    return retVal;
 }
 
 
-STD_RETURN_TYPE_e DB_ReadBlock(void *dataptrtoReceiver, DATA_BLOCK_ID_TYPE_e  blockID) {
-    DATA_QUEUE_MESSAGE_s data_send_msg;
-    TickType_t queuetimeout;
+uint32_t DATA_GetBlockVersion(DATA_BLOCK_ID_TYPE_e blockID) {
+    uint32_t version = 0;
 
-    if (vPortCheckCriticalSection()) {
-        configASSERT(0);
+    if (blockID < DATA_MAX_BLOCK_NR) {
+        /* Every commit increments the sequence counter twice */
+        version = data_block_access[blockID].sequence / 2;
     }
 
-    queuetimeout = DATA_QUEUE_TIMEOUT_MS / portTICK_RATE_MS;
-    if (queuetimeout  ==  0) {
-        queuetimeout = 1;
+    return version;
+}
+
+
+uint8_t DATA_HasBlockChanged(DATA_BLOCK_ID_TYPE_e blockID, uint32_t *version) {
+    uint8_t retVal = FALSE;
+    uint32_t currentVersion = DATA_GetBlockVersion(blockID);
+
+    if (version != NULL_PTR) {
+        if (*version != currentVersion) {
+            *version = currentVersion;
+            retVal = TRUE;
+        }
     }
 
-    /* prepare send message with attributes of data block */
-    data_send_msg.blockID = blockID;
-    data_send_msg.value.voidptr = dataptrtoReceiver;
-    data_send_msg.accesstype = READ_ACCESS;
+    return retVal;
+}
+
+
+STD_RETURN_TYPE_e DATA_GetAccessStatistics(DATA_BLOCK_ID_TYPE_e blockID, DATA_ACCESS_STATISTICS_s *statistics) {
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
+
+#if DATA_ENABLE_ACCESS_STATISTICS == 1
+    if ((blockID < DATA_MAX_BLOCK_NR) && (statistics != NULL_PTR)) {
+        OS_TaskEnter_Critical();
+        *statistics = data_access_statistics[blockID];
+        OS_TaskExit_Critical();
+        retVal = E_OK;
+    }
+#endif
+
+    return retVal;
+}
+
+
+void DATA_ResetAccessStatistics(void) {
+#if DATA_ENABLE_ACCESS_STATISTICS == 1
+    OS_TaskEnter_Critical();
+    memset(data_access_statistics, 0, sizeof(data_access_statistics));
+    OS_TaskExit_Critical();
+#endif
+}
+
+
+uint32_t DATA_GetLatencyPercentile(const DATA_LATENCY_s *latency, uint8_t percent) {
+    uint32_t sum = 0;
+    uint32_t bin = 0;
 
-    /* Send a pointer to a message object and */
-    /* maximum block time: queuetimeout */
-    xQueueSend(data_queue, (void *) &data_send_msg, queuetimeout);
+    if ((latency != NULL_PTR) && (latency->nr_of_accesses > 0)) {
+        for (bin = 0; bin < (DATA_LATENCY_HISTOGRAM_BINS - 1); bin++) {
+            sum += latency->histogram[bin];
+            /* 64 bit to prevent an overflow of the multiplication */
+            if (((uint64_t)sum * 100u) >= ((uint64_t)latency->nr_of_accesses * percent)) {
+                break;
+            }
+        }
+    }
 
-    return E_OK;
+    return bin;
 }
 
 /* FIXME not used  currently - delete? */
@@ -287,3 +385,228 @@ void * DATA_GetTablePtrBeginCritical(DATA_BLOCK_ID_TYPE_e  blockID) {
 }
 
 /*================== Static functions =====================================*/
+/**
+ * @brief   checks that a part of a data block lies within the data block
+ *
+ * @param   blockID     data block
+ * @param   offset      offset in bytes from the beginning of the data block
+ * @param   length      number of bytes
+ *
+ * @return  TRUE if the part is not empty and within the data block, FALSE otherwise
+ */
+static uint8_t DATA_IsValidRange(DATA_BLOCK_ID_TYPE_e blockID, uint16_t offset, uint16_t length) {
+    uint8_t retVal = FALSE;
+
+    if ((blockID < DATA_MAX_BLOCK_NR) && (length > 0)) {
+        if (((uint32_t)offset + length) <= (data_base_dev.blockheaderptr + blockID)->datalength) {
+            retVal = TRUE;
+        }
+    }
+
+    return retVal;
+}
+
+
+/**
+ * @brief   shifts the timestamp of a data block to the previous timestamp
+ *          and sets the timestamp to the current OS tick
+ *
+ * @param   blockptr    pointer to the beginning of the data block
+ */
+static void DATA_SetTimestamp(void *blockptr) {
+    uint32_t *timestampptr = (uint32_t *)blockptr;
+    uint32_t *previousTimestampptr = timestampptr + 1;
+
+    /* Write previous timestamp */
+    *previousTimestampptr = *timestampptr;
+    /* Write timestamp */
+    *timestampptr = OS_getOSSysTick();
+}
+
+
+/**
+ * @brief   copies parts of the published data of a data block
+ *
+ * The caller checks the ranges and detects a concurrent commit.
+ *
+ * @param   blockID         data block
+ * @param   ranges          parts of the data block and where they are copied to
+ * @param   nr_of_ranges    number of entries in ranges
+ */
+static void DATA_CopyRanges(DATA_BLOCK_ID_TYPE_e blockID, const DATA_BLOCK_RANGE_s *ranges, uint8_t nr_of_ranges) {
+    /* RDptr is read once, so all parts come from the same buffer */
+    uint8_t *srcdataptr = (uint8_t *)data_block_access[blockID].RDptr;
+
+    for (uint8_t r = 0; r < nr_of_ranges; r++) {
+        memcpy(ranges[r].dataptrtoReceiver, srcdataptr + ranges[r].offset, ranges[r].length);
+    }
+}
+
+
+/**
+ * @brief   serializes the writers of a data block and publishes the new data
+ *
+ * A write of the whole data block takes the timestamps from the sender,
+ * which are updated in the sender's struct. A partial write updates the
+ * timestamps of the data block in the database.
+ *
+ * @param   dataptrfromSender   pointer to the new data
+ * @param   blockID             data block
+ * @param   offset              offset in bytes from the beginning of the data block
+ * @param   length              number of bytes to write
+ *
+ * @return  E_OK if the data was stored, E_NOT_OK otherwise
+ */
+static STD_RETURN_TYPE_e DATA_WriteBlockData(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e blockID, uint16_t offset, uint16_t length) {
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
+    TickType_t writetimeout;
+    uint32_t starttime = OS_getOSSysTick();
+    uint8_t mutexTaken = FALSE;
+
+    if (vPortCheckCriticalSection()) {
+        configASSERT(0);
+    }
+
+    writetimeout = DATA_WRITE_TIMEOUT_MS / portTICK_RATE_MS;
+    if (writetimeout == 0) {
+        writetimeout = 1;
+    }
+
+    if (DATA_IsValidRange(blockID, offset, length) && (dataptrfromSender != NULL_PTR)) {  /* plausibility check */
+        /* Only writers take the mutex: wait until another writer of this block is finished */
+        if (xSemaphoreTake(data_base_mutex[blockID], 0)  ==  TRUE) {
+            mutexTaken = TRUE;
+        } else {
+#if DATA_ENABLE_ACCESS_STATISTICS == 1
+            OS_TaskEnter_Critical();
+            data_access_statistics[blockID].write_contention++;
+            OS_TaskExit_Critical();
+#endif
+            if (xSemaphoreTake(data_base_mutex[blockID], writetimeout)  ==  TRUE) {
+                mutexTaken = TRUE;
+            }
+        }
+
+        if (mutexTaken == TRUE) {
+            if (length == (data_base_dev.blockheaderptr + blockID)->datalength) {
+                DATA_SetTimestamp(dataptrfromSender);
+            }
+            DATA_CommitBlock(blockID, dataptrfromSender, offset, length);
+            xSemaphoreGive(data_base_mutex[blockID]);
+            DATA_NotifySubscribers(blockID);
+            retVal = E_OK;
+        }
+
+#if DATA_ENABLE_ACCESS_STATISTICS == 1
+        OS_TaskEnter_Critical();
+        if (retVal == E_OK) {
+            DATA_RecordLatency(&data_access_statistics[blockID].write, starttime);
+        } else {
+            data_access_statistics[blockID].dropped_writes++;
+        }
+        OS_TaskExit_Critical();
+#endif
+    }
+
+    return retVal;
+}
+
+
+/**
+ * @brief   publishes new data of a data block
+ *
+ * Must be called with the mutex of the data block taken. For double
+ * buffered blocks the data is copied into the buffer readers do not use and
+ * then the buffers are swapped. For a partial write the rest of that buffer
+ * is first filled with the currently published data. Single buffered blocks
+ * are overwritten in place. In both cases the sequence counter is odd while
+ * the published data changes, so readers detect and repeat an inconsistent
+ * copy.
+ *
+ * @param   blockID     data block to be written
+ * @param   srcdataptr  pointer to the new data
+ * @param   offset      offset in bytes from the beginning of the data block
+ * @param   length      number of bytes to write
+ */
+static void DATA_CommitBlock(DATA_BLOCK_ID_TYPE_e blockID, void *srcdataptr, uint16_t offset, uint16_t length) {
+    uint8_t *dstdataptr = (uint8_t *)data_block_access[blockID].WRptr;
+    uint16_t datalength = (data_base_dev.blockheaderptr + blockID)->datalength;
+    uint8_t partial = (length < datalength) ? TRUE : FALSE;
+
+    if (data_block_access[blockID].nr_of_buffer == DOUBLE_BUFFERING) {
+        /* No reader uses the write buffer, copy without locking. RDptr
+         * only changes in a commit, which needs the mutex we hold */
+        if (partial == TRUE) {
+            memcpy(dstdataptr, data_block_access[blockID].RDptr, datalength);
+        }
+        memcpy(dstdataptr + offset, srcdataptr, length);
+        if (partial == TRUE) {
+            DATA_SetTimestamp(dstdataptr);
+        }
+        OS_TaskEnter_Critical();
+        data_block_access[blockID].sequence++;
+        DATA_MEMORY_BARRIER();
+        /* swap the WR and RD pointers:
+           WRptr always points to buffer to be written next time and changed afterwards
+           RDptr always points to buffer to be read next time */
+        data_block_access[blockID].WRptr = data_block_access[blockID].RDptr;
+        data_block_access[blockID].RDptr = dstdataptr;
+        DATA_MEMORY_BARRIER();
+        data_block_access[blockID].sequence++;
+        OS_TaskExit_Critical();
+    } else {
+        /* Single buffering: readers use the same buffer, overwrite it in one go */
+        OS_TaskEnter_Critical();
+        data_block_access[blockID].sequence++;
+        DATA_MEMORY_BARRIER();
+        memcpy(dstdataptr + offset, srcdataptr, length);
+        if (partial == TRUE) {
+            DATA_SetTimestamp(dstdataptr);
+        }
+        DATA_MEMORY_BARRIER();
+        data_block_access[blockID].sequence++;
+        OS_TaskExit_Critical();
+    }
+}
+
+
+/**
+ * @brief   notifies all tasks that subscribed to a data block
+ *
+ * @param   blockID     data block that was written
+ */
+static void DATA_NotifySubscribers(DATA_BLOCK_ID_TYPE_e blockID) {
+    /* Subscriptions are only added, entries below the count never change */
+    uint8_t nr_of_subscriptions = data_nr_of_subscriptions;
+
+    for (uint8_t i = 0; i < nr_of_subscriptions; i++) {
+        if (data_subscriptions[i].blockID == blockID) {
+            xTaskNotify(data_subscriptions[i].task, data_subscriptions[i].notificationBits, eSetBits);
+        }
+    }
+}
+
+
+#if DATA_ENABLE_ACCESS_STATISTICS == 1
+/**
+ * @brief   adds the duration of one access to a latency histogram
+ *
+ * Must be called inside a critical section.
+ *
+ * @param   latency     latency histogram of the access type
+ * @param   starttime   OS tick at the beginning of the access
+ */
+static void DATA_RecordLatency(DATA_LATENCY_s *latency, uint32_t starttime) {
+    uint32_t duration = OS_getOSSysTick() - starttime;
+
+    latency->nr_of_accesses++;
+    if (duration < (DATA_LATENCY_HISTOGRAM_BINS - 1)) {
+        latency->histogram[duration]++;
+    } else {
+        latency->histogram[DATA_LATENCY_HISTOGRAM_BINS - 1]++;
+    }
+    if (duration > latency->max) {
+        latency->max = duration;
+    }
+}
+#endif
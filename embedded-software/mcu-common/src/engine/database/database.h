@@ -58,30 +58,103 @@
 /*================== Includes =============================================*/
 #include "database_cfg.h"
 #include "os.h"
+#include <stddef.h>
 
 
 /*================== Macros and Definitions ===============================*/
-/* FIXME doxygen comments */
-typedef struct {
-    /* FIXME what is the intention of this union? isn't it dangerous if someone expects a pointer to and accesses via .u32ptr, but there is a value stored in value? */
-    union {
-        uint32_t                u32value;    /*  reference by uint32_t value   */
-        uint32_t                *u32ptr;    /*  reference by uint32_t pointer */
-        void                    *voidptr;    /*  reference by general pointer */
-    } value;
-    DATA_BLOCK_ID_TYPE_e        blockID;    /* definition of used message data type */
-    DATA_BLOCK_ACCESS_TYPE_e    accesstype; /* read or write access type */
-} DATA_QUEUE_MESSAGE_s;
+/**
+ * offset of a field inside a data block struct, e.g.,
+ * DATA_FIELD_OFFSET(DATA_BLOCK_MINMAX_s, voltage_min)
+ */
+#define DATA_FIELD_OFFSET(type, field)      ((uint16_t)offsetof(type, field))
+
+/**
+ * size of a field inside a data block struct
+ */
+#define DATA_FIELD_SIZE(type, field)        ((uint16_t)sizeof(((type *)0)->field))
 
+/**
+ * number of bytes from the beginning of field first to the end of field last
+ * (first must not be located behind last)
+ */
+#define DATA_FIELD_RANGE_SIZE(type, first, last)    \
+    ((uint16_t)(DATA_FIELD_OFFSET(type, last) + DATA_FIELD_SIZE(type, last) - DATA_FIELD_OFFSET(type, first)))
 
+/**
+ * reads a single field of a data block, e.g.,
+ * DB_ReadField(&minmax.voltage_min, DATA_BLOCK_ID_MINMAX, DATA_BLOCK_MINMAX_s, voltage_min)
+ */
+#define DB_ReadField(dataptrtoReceiver, blockID, type, field)   \
+    DB_ReadBlockPartial((dataptrtoReceiver), (blockID), DATA_FIELD_OFFSET(type, field), DATA_FIELD_SIZE(type, field))
+
+/**
+ * reads all fields of a data block from field first up to and including
+ * field last with one consistent copy
+ */
+#define DB_ReadFieldRange(dataptrtoReceiver, blockID, type, first, last)   \
+    DB_ReadBlockPartial((dataptrtoReceiver), (blockID), DATA_FIELD_OFFSET(type, first), DATA_FIELD_RANGE_SIZE(type, first, last))
+
+/**
+ * writes a single field of a data block, all other fields keep their value
+ */
+#define DB_WriteField(dataptrfromSender, blockID, type, field)  \
+    DB_WriteBlockPartial((dataptrfromSender), (blockID), DATA_FIELD_OFFSET(type, field), DATA_FIELD_SIZE(type, field))
+
+/**
+ * part of a data block to be copied by DB_ReadBlockRanges()
+ */
 typedef struct {
-    void                           *RDptr;
-    void                           *WRptr;
-    DATA_BLOCK_BUFFER_TYPE_e  nr_of_buffer;    /* todo really needed? */
+    void *dataptrtoReceiver;    /*!< pointer where the part is copied to                */
+    uint16_t offset;            /*!< offset in bytes from the beginning of the data block */
+    uint16_t length;            /*!< number of bytes to copy                            */
+} DATA_BLOCK_RANGE_s;
+
+/**
+ * access information of a data block
+ *
+ * Readers copy from RDptr without any lock. The sequence counter is
+ * incremented once before and once after every commit of a writer, so it is
+ * odd while a commit is in progress. A reader retries its copy if the counter
+ * was odd or changed while copying (sequence lock).
+ */
+typedef struct {
+    void                           *RDptr;          /*!< buffer readers copy from                         */
+    void                           *WRptr;          /*!< buffer the next write goes to                    */
+    DATA_BLOCK_BUFFER_TYPE_e  nr_of_buffer;         /*!< todo really needed?                              */
+    volatile uint32_t               sequence;       /*!< sequence lock counter, odd while being committed */
 } DATA_BLOCK_ACCESS_s;
 
+/**
+ * latency histogram of one access type of a data block
+ */
+typedef struct {
+    uint32_t nr_of_accesses;                                /*!< number of recorded accesses                      */
+    uint32_t histogram[DATA_LATENCY_HISTOGRAM_BINS];        /*!< bin i: accesses that took i OS ticks, last bin: longer */
+    uint32_t max;                                           /*!< longest access in OS ticks                       */
+} DATA_LATENCY_s;
+
+/**
+ * access statistics of a data block
+ */
+typedef struct {
+    DATA_LATENCY_s read;            /*!< latency of DB_ReadBlock()                                          */
+    DATA_LATENCY_s write;           /*!< latency of DB_WriteBlock()                                         */
+    uint32_t dropped_writes;        /*!< writes dropped because another writer blocked the data block       */
+    uint32_t write_contention;      /*!< writes that had to wait for another writer of the data block       */
+    uint32_t read_retries;          /*!< lock-free read copies that were inconsistent and had to be repeated */
+    uint32_t read_locked;           /*!< reads that were copied inside a critical section                  */
+} DATA_ACCESS_STATISTICS_s;
+
+/**
+ * subscription of a task to a data block
+ */
+typedef struct {
+    DATA_BLOCK_ID_TYPE_e blockID;           /*!< data block the task subscribed to             */
+    TaskHandle_t task;                      /*!< task that is notified                         */
+    uint32_t notificationBits;              /*!< bits set in the notification value of the task */
+} DATA_SUBSCRIPTION_s;
+
 /*================== Constant and Variable Definitions ====================*/
-extern QueueHandle_t data_queue;
 
 
 /*================== Function Prototypes ==================================*/
@@ -92,19 +165,74 @@ extern void DATA_Init(void);
 
 /**
  * @brief   Stores a datablock in database
+ *
+ * The data is copied in the context of the caller. Concurrent writers of the
+ * same data block are serialized, readers are never blocked.
+ *
  * @param   blockID (type: DATA_BLOCK_ID_TYPE_e)
  * @param   dataptrfromSender (type: void *)
+ * @return  E_OK if the data was stored, E_NOT_OK if the write was dropped
  */
-extern void DB_WriteBlock(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e  blockID);
+extern STD_RETURN_TYPE_e DB_WriteBlock(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e  blockID);
 
 /**
  * @brief   Reads a datablock in database by value
+ *
+ * The data block is copied in the context of the caller. The copy is
+ * consistent, i.e., it never contains parts of two different writes.
+ *
  * @param   blockID (type: DATA_BLOCK_ID_TYPE_e)
  * @param   dataptrtoReceiver (type: void *)
- * @return  STD_RETURN_TYPE_e
+ * @return  E_OK if the block was copied, E_NOT_OK on invalid parameters
  */
 extern STD_RETURN_TYPE_e DB_ReadBlock(void *dataptrtoReceiver, DATA_BLOCK_ID_TYPE_e  blockID);
 
+/**
+ * @brief   Reads a part of a datablock in database by value
+ *
+ * Only the bytes [offset, offset + length) of the data block are copied to
+ * dataptrtoReceiver, which needs to provide length bytes. The copy is
+ * consistent like with DB_ReadBlock(). Use DB_ReadField() or
+ * DB_ReadFieldRange() to get offset and length from the data block struct.
+ *
+ * @param   dataptrtoReceiver   pointer where the data is copied to
+ * @param   blockID             data block
+ * @param   offset              offset in bytes from the beginning of the data block
+ * @param   length              number of bytes to copy
+ * @return  E_OK if the data was copied, E_NOT_OK on invalid parameters
+ */
+extern STD_RETURN_TYPE_e DB_ReadBlockPartial(void *dataptrtoReceiver, DATA_BLOCK_ID_TYPE_e  blockID, uint16_t offset, uint16_t length);
+
+/**
+ * @brief   Reads several parts of a datablock in database by value
+ *
+ * All parts are copied from the same write of the data block, e.g., values
+ * together with their valid flags. Each part is copied like with
+ * DB_ReadBlockPartial().
+ *
+ * @param   ranges          parts of the data block and where they are copied to
+ * @param   nr_of_ranges    number of entries in ranges
+ * @param   blockID         data block
+ * @return  E_OK if the data was copied, E_NOT_OK on invalid parameters
+ */
+extern STD_RETURN_TYPE_e DB_ReadBlockRanges(const DATA_BLOCK_RANGE_s *ranges, uint8_t nr_of_ranges, DATA_BLOCK_ID_TYPE_e  blockID);
+
+/**
+ * @brief   Stores a part of a datablock in database
+ *
+ * The length bytes of dataptrfromSender replace the bytes
+ * [offset, offset + length) of the data block, all other bytes keep their
+ * value. The timestamp and previous timestamp of the data block are updated
+ * in the database, the sender does not need to provide them.
+ *
+ * @param   dataptrfromSender   pointer to the new data
+ * @param   blockID             data block
+ * @param   offset              offset in bytes from the beginning of the data block
+ * @param   length              number of bytes to write
+ * @return  E_OK if the data was stored, E_NOT_OK if the write was dropped or on invalid parameters
+ */
+extern STD_RETURN_TYPE_e DB_WriteBlockPartial(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e  blockID, uint16_t offset, uint16_t length);
+
  /**
  * @brief   Gets a pointer to datablock in database ()
  * @param   blockID (type: DATA_BLOCK_ID_TYPE_e)
@@ -112,8 +240,77 @@ extern STD_RETURN_TYPE_e DB_ReadBlock(void *dataptrtoReceiver, DATA_BLOCK_ID_TYP
   */
 extern void * DATA_GetTablePtrBeginCritical(DATA_BLOCK_ID_TYPE_e  blockID);
 
+ /**
+  * @brief   subscribes a task to changes of a data block
+  *
+  * Whenever new data of the data block is stored, the notification bits are
+  * set in the notification value of the task (xTaskNotify() with eSetBits).
+  * The task can wait for them with xTaskNotifyWait(). Should be called
+  * during initialization, subscriptions can not be removed.
+  *
+  * @param   blockID             data block
+  * @param   task                task to notify
+  * @param   notificationBits    bits to set in the notification value of the task
+  *
+  * @return  E_OK if subscribed, E_NOT_OK if no subscription is left (see DATA_MAX_SUBSCRIPTIONS)
+  */
+extern STD_RETURN_TYPE_e DATA_Subscribe(DATA_BLOCK_ID_TYPE_e blockID, TaskHandle_t task, uint32_t notificationBits);
+
+ /**
+  * @brief   gets the version of a data block
+  *
+  * The version is incremented whenever new data of the data block is
+  * stored. It allows cyclic users to skip their work if nothing changed.
+  *
+  * @param   blockID     data block
+  *
+  * @return  version of the data block
+  */
+extern uint32_t DATA_GetBlockVersion(DATA_BLOCK_ID_TYPE_e blockID);
+
+ /**
+  * @brief   checks if new data of a data block was stored since the last call
+  *
+  * @param   blockID     data block
+  * @param   version     version seen by the caller at the last call, updated to the current version
+  *
+  * @return  TRUE if the data block changed since the last call, FALSE otherwise
+  */
+extern uint8_t DATA_HasBlockChanged(DATA_BLOCK_ID_TYPE_e blockID, uint32_t *version);
+
+ /**
+  * @brief   copies the access statistics of a data block
+  *
+  * @param   blockID     data block
+  * @param   statistics  pointer where the statistics are copied to
+  *
+  * @return  E_OK if statistics were copied, E_NOT_OK if not available
+  */
+extern STD_RETURN_TYPE_e DATA_GetAccessStatistics(DATA_BLOCK_ID_TYPE_e blockID, DATA_ACCESS_STATISTICS_s *statistics);
+
+ /**
+  * @brief   resets the access statistics of all data blocks
+  */
+extern void DATA_ResetAccessStatistics(void);
+
+ /**
+  * @brief   calculates a percentile of a latency histogram
+  *
+  * The result is the smallest latency for which at least the given
+  * percentage of all accesses were as fast or faster.
+  *
+  * @param   latency     latency histogram
+  * @param   percent     requested percentile (e.g., 50 or 99)
+  *
+  * @return  latency in OS ticks
+  */
+extern uint32_t DATA_GetLatencyPercentile(const DATA_LATENCY_s *latency, uint8_t percent);
+
  /**
   * @brief   trigger of database manager
+  *
+  * Accesses are done in the context of the caller, the task only reports to
+  * the system monitoring and then blocks for DATA_TASK_CYCLE_MS.
   */
 extern void DATA_Task(void);
 
@@ -58,9 +58,26 @@
 
 #include "database.h"
 #include "diag.h"
+#include "mcu.h"
 #include "os.h"
 
 /*================== Macros and Definitions ===============================*/
+/**
+ * marks entries of the message to signal index that refer to the CAN1 signal arrays
+ */
+#define CANS_SIGNALINDEX_CAN1       0x8000u
+
+#if CANS_TX_ON_DELTA == TRUE
+/**
+ * transmit state of a message that is transmitted on delta
+ */
+typedef struct {
+    uint64_t last_data;     /*!< data of the last transmission, without rolling counter */
+    uint32_t last_tx_ms;    /*!< scheduler time of the last transmission in ms */
+    uint8_t counter;        /*!< rolling counter of the next transmission */
+    uint8_t transmitted;    /*!< FALSE until the message has been transmitted once */
+} CANS_TX_ON_DELTA_s;
+#endif
 
 /*================== Constant and Variable Definitions ====================*/
 static CANS_STATE_s cans_state = {
@@ -71,9 +88,85 @@ static CANS_STATE_s cans_state = {
 
 static DATA_BLOCK_STATEREQUEST_s canstatereq_tab;
 
+/**
+ * next due time in ms of each periodic transmit message. Indices below
+ * can_CAN0_tx_length refer to CAN0 messages, the following ones to CAN1 messages.
+ */
+static uint32_t cans_tx_duetime[CANS_MAX_PERIODIC_TX_MESSAGES];
+
+/**
+ * binary min-heap of periodic transmit message indices, ordered by their due time
+ */
+static uint16_t cans_tx_heap[CANS_MAX_PERIODIC_TX_MESSAGES];
+static uint16_t cans_tx_heap_length = 0;
+
+/**
+ * time in ms of the transmit scheduler, advanced by CANS_TICK_MS per call of CANS_PeriodicTransmit()
+ */
+static uint32_t cans_tx_time_ms = 0;
+
+/**
+ * message to signal index of the transmit signals: the signals of message m are
+ * listed in cans_tx_signalindex[cans_tx_signalstart[m]] to
+ * cans_tx_signalindex[cans_tx_signalstart[m + 1] - 1]. Entries with
+ * CANS_SIGNALINDEX_CAN1 set refer to cans_CAN1_signals_tx, the others to
+ * cans_CAN0_signals_tx. Only the first cans_tx_nr_of_indexed_messages messages
+ * are indexed.
+ */
+static uint16_t cans_tx_signalstart[CANS_MAX_PERIODIC_TX_MESSAGES + 1];
+static uint16_t cans_tx_signalindex[CANS_MAX_TX_SIGNALS];
+static uint16_t cans_tx_nr_of_indexed_messages = 0;
+
+/**
+ * message to signal index of the receive signals, same layout as for the transmit signals
+ */
+static uint16_t cans_rx_signalstart[CANS_MAX_RX_MESSAGES + 1];
+static uint16_t cans_rx_signalindex[CANS_MAX_RX_SIGNALS];
+static uint16_t cans_rx_nr_of_indexed_messages = 0;
+
+#if CANS_TX_PHASE_SPREADING == TRUE
+/**
+ * number of periodic messages due per tick over the hyperperiod, used to spread the transmit phases
+ */
+static uint8_t cans_tx_slotload[CANS_TX_SPREAD_MAX_TICKS];
+
+/**
+ * number of ticks in cans_tx_slotload: the hyperperiod of the periodic messages, at most CANS_TX_SPREAD_MAX_TICKS
+ */
+static uint32_t cans_tx_spread_ticks = 1;
+#endif
+
+#if CANS_TX_ON_DELTA == TRUE
+/**
+ * transmit state of the messages transmitted on delta, in the order of cans_tx_ondelta_cfg[]
+ */
+static CANS_TX_ON_DELTA_s cans_tx_ondelta[CANS_MAX_ON_DELTA_TX_MESSAGES];
+#endif
+
+/**
+ * dropped receive frames of each CAN node at the last check, indexed by CAN_NodeTypeDef_e
+ */
+static uint32_t cans_rx_dropped_frames[2] = { 0, 0 };
+
+/**
+ * OS tick at the reception of the message whose signals are parsed
+ */
+static uint32_t cans_rx_timestamp = 0;
+
+#if CANS_HEARTBEAT_SUPERVISION == TRUE
+/**
+ * heartbeat supervision of the CAN peers, indexed by CANS_heartbeatPeer_e
+ */
+static CANS_HEARTBEAT_s cans_heartbeat[CANS_NR_OF_HEARTBEAT_PEERS];
+#endif
+
 /*================== Function Prototypes ==================================*/
 static STD_RETURN_TYPE_e CANS_PeriodicTransmit(void);
 static STD_RETURN_TYPE_e CANS_PeriodicReceive(void);
+static void CANS_CheckRxOverflow(CAN_NodeTypeDef_e canNode);
+#if CANS_HEARTBEAT_SUPERVISION == TRUE
+static void CANS_CheckHeartbeats(void);
+#endif
 static void CANS_SetSignalData(CANS_signal_s signal, uint64_t value, uint8_t *dataPtr);
 static void CANS_GetSignalData(uint64_t *dst, CANS_signal_s signal, uint8_t *dataPtr);
 static void CANS_ComposeMessage(CAN_NodeTypeDef_e canNode, CANS_messagesTx_e msgIdx, uint8_t dataptr[]);
@@ -81,11 +174,48 @@ static void CANS_ParseMessage(CAN_NodeTypeDef_e canNode, CANS_messagesRx_e msgId
 static uint8_t CANS_CheckCanTiming(void);
 static void CANS_SetCurrentSensorPresent(uint8_t command);
 static void CANS_SetCurrentSensorCCPresent(uint8_t command);
+static const CANS_signal_s *CANS_GetSignals(CANS_messageDirection_t direction, uint32_t node, uint16_t *nrOfSignals);
+static uint16_t CANS_BuildSignalIndex(CANS_messageDirection_t direction, uint16_t nrOfMessages,
+        uint16_t signalstart[], uint16_t signalindex[], uint16_t maxNrOfSignals);
+static void CANS_ComposeSignal(const CANS_signal_s *signals, uint32_t sigIdx, uint8_t dataptr[]);
+static void CANS_ParseSignal(const CANS_signal_s *signals, uint32_t sigIdx, uint32_t setterIdx, uint8_t dataptr[]);
+static void CANS_InitTxScheduler(void);
+static const CAN_MSG_TX_TYPE_s *CANS_GetPeriodicTxMessage(uint32_t msgIdx);
+#if CANS_TX_PHASE_SPREADING == TRUE
+static uint32_t CANS_GetTxHyperperiod(void);
+static uint32_t CANS_SpreadTxPhase(uint32_t repetition_time, uint32_t repetition_phase);
+#endif
+static uint8_t CANS_IsTxDueBefore(uint16_t msgIdxA, uint16_t msgIdxB);
+static void CANS_TxHeapSiftUp(uint16_t position);
+static void CANS_TxHeapSiftDown(uint16_t position);
+static void CANS_TransmitPeriodicMessage(CAN_NodeTypeDef_e canNode, uint32_t nodeMsgIdx,
+        const CAN_MSG_TX_TYPE_s *txMsg, CANS_messagesTx_e msgIdx, uint32_t diagParameter);
+#if CANS_TX_ON_DELTA == TRUE
+static CANS_TX_ON_DELTA_s *CANS_GetOnDeltaState(CANS_messagesTx_e msgIdx, const CANS_TX_ON_DELTA_CFG_s **cfg);
+static uint8_t CANS_IsOnDeltaTxDue(CANS_messagesTx_e msgIdx, const CANS_TX_ON_DELTA_CFG_s *cfg,
+        const CANS_TX_ON_DELTA_s *state, uint64_t data);
+#endif
 /*================== Function Implementations =============================*/
 
 /*================== Public functions =====================================*/
 void CANS_Init(void) {
-    /* custom initialization could be made here. right now no need for any init */
+    uint32_t nrOfMessages = 0;
+
+    nrOfMessages = (uint32_t)can_CAN0_tx_length + can_CAN1_tx_length;
+    if (nrOfMessages > CANS_MAX_PERIODIC_TX_MESSAGES) {
+        nrOfMessages = CANS_MAX_PERIODIC_TX_MESSAGES;
+    }
+    cans_tx_nr_of_indexed_messages = CANS_BuildSignalIndex(CAN_TX_DIRECTION, (uint16_t)nrOfMessages,
+            cans_tx_signalstart, cans_tx_signalindex, CANS_MAX_TX_SIGNALS);
+
+    nrOfMessages = (uint32_t)can_CAN0_rx_length + can_CAN1_rx_length;
+    if (nrOfMessages > CANS_MAX_RX_MESSAGES) {
+        nrOfMessages = CANS_MAX_RX_MESSAGES;
+    }
+    cans_rx_nr_of_indexed_messages = CANS_BuildSignalIndex(CAN_RX_DIRECTION, (uint16_t)nrOfMessages,
+            cans_rx_signalstart, cans_rx_signalindex, CANS_MAX_RX_SIGNALS);
+
+    CANS_InitTxScheduler();
 }
 
 void CANS_MainFunction(void) {
@@ -98,21 +228,34 @@ void CANS_MainFunction(void) {
 }
 
 
+uint32_t CANS_GetRxTimestamp(void) {
+    return cans_rx_timestamp;
+}
+
+
 STD_RETURN_TYPE_e CANS_AddMessage(CAN_NodeTypeDef_e canNode, uint32_t msgID, uint8_t* ptrMsgData,
         uint32_t msgLength, uint32_t RTR) {
     STD_RETURN_TYPE_e retVal = E_NOT_OK;
     OS_TaskEnter_Critical();
     /* Function should not be interrupted by the OS during the execution */
     retVal = CAN_Send(canNode, msgID, ptrMsgData, msgLength, RTR);
+    if (retVal == E_OK) {
+        /* start the transmission right away if a mailbox is free */
+        (void)CAN_TxMsgBuffer(canNode);
+    }
     OS_TaskExit_Critical();
     return retVal;
 }
 
 STD_RETURN_TYPE_e CANS_TransmitBuffer(CAN_NodeTypeDef_e canNode) {
     STD_RETURN_TYPE_e retVal = E_NOT_OK;
+    uint32_t now = 0;
     OS_TaskEnter_Critical();
     /* Function should not be interrupted by the OS during the execution */
+    now = OS_getOSSysTick();
     retVal = CAN_TxMsgBuffer(canNode);
+    CAN_UpdateTxRate(canNode, now);
+    CAN_UpdateBusStatistics(canNode, now);
     OS_TaskExit_Critical();
     return retVal;
 }
@@ -128,67 +271,481 @@ STD_RETURN_TYPE_e CANS_TransmitMessage(CAN_NodeTypeDef_e canNode, uint32_t msgID
 
 /*================== Static functions =====================================*/
 /**
- * handles the processing of messages that are meant to be transmitted.
+ * returns the transmit or receive signal array of a CAN node
  *
- * This function looks for the repetition times and the repetition phase of
- * messages that are intended to be sent periodically. If a comparison with
- * an internal counter (i.e., the counter how often this function has been called)
- * states that a transmit is pending, the message is composed by call of CANS_ComposeMessage
- * and transfered to the buffer of the CAN module. If a callback function
- * is declared in configuration, this callback is called after successful transmission.
+ * @param[in]  direction    CAN_TX_DIRECTION for the transmit signals, CAN_RX_DIRECTION for the receive signals
+ * @param[in]  node         0 for CAN0, 1 for CAN1
+ * @param[out] nrOfSignals  number of signals in the array
  *
- * @return E_OK if a successful transfer to CAN buffer occured, E_NOT_OK otherwise
+ * @return pointer to the signal array
  */
-static STD_RETURN_TYPE_e CANS_PeriodicTransmit(void) {
-    static uint32_t counter_ticks = 0;
+static const CANS_signal_s *CANS_GetSignals(CANS_messageDirection_t direction, uint32_t node, uint16_t *nrOfSignals) {
+    const CANS_signal_s *signals = NULL_PTR;
+    if (direction == CAN_TX_DIRECTION) {
+        signals = (node == 0) ? cans_CAN0_signals_tx : cans_CAN1_signals_tx;
+        *nrOfSignals = (node == 0) ? cans_CAN0_signals_tx_length : cans_CAN1_signals_tx_length;
+    } else {
+        signals = (node == 0) ? cans_CAN0_signals_rx : cans_CAN1_signals_rx;
+        *nrOfSignals = (node == 0) ? cans_CAN0_signals_rx_length : cans_CAN1_signals_rx_length;
+    }
+    return signals;
+}
+
+/**
+ * builds the message to signal index for the transmit or receive signals of CAN0 and CAN1.
+ *
+ * The signals are sorted by message with a counting sort, so that the signals of
+ * a message can be looked up without searching all signals.
+ *
+ * @param direction       CAN_TX_DIRECTION for the transmit signals, CAN_RX_DIRECTION for the receive signals
+ * @param nrOfMessages    number of messages to index, signals of messages beyond are left out
+ * @param signalstart     array of nrOfMessages + 1 entries, filled with the start of the signals of each message
+ * @param signalindex     array filled with the signal indices sorted by message
+ * @param maxNrOfSignals  size of signalindex
+ *
+ * @return number of indexed messages, 0 if the signals do not fit into signalindex
+ */
+static uint16_t CANS_BuildSignalIndex(CANS_messageDirection_t direction, uint16_t nrOfMessages,
+        uint16_t signalstart[], uint16_t signalindex[], uint16_t maxNrOfSignals) {
+    const CANS_signal_s *signals = NULL_PTR;
+    uint16_t nrOfSignals = 0;
+    uint16_t flag = 0;
+    uint32_t node = 0;
     uint32_t i = 0;
-    STD_RETURN_TYPE_e result = E_NOT_OK;
+    uint32_t msgIdx = 0;
 
-#if CAN_USE_CAN_NODE0 == TRUE
-    for (i = 0; i < can_CAN0_tx_length; i++) {
-        if (((counter_ticks * CANS_TICK_MS) % (can_CAN0_messages_tx[i].repetition_time)) == can_CAN0_messages_tx[i].repetition_phase) {
-            Can_PduType PduToSend = { {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 0x0, 8 };
-            CANS_ComposeMessage(CAN_NODE0, (CANS_messagesTx_e)(i), PduToSend.sdu);
-            PduToSend.id = can_CAN0_messages_tx[i].ID;
-
-            result = CANS_AddMessage(CAN_NODE0, PduToSend.id, PduToSend.sdu, PduToSend.dlc, 0);
-
-            if (result == E_NOT_OK) {
-                DIAG_Handler(DIAG_CH_CANS_CAN_MOD_FAILURE, DIAG_EVENT_NOK, 1, NULL_PTR);
-            } else {
-                DIAG_Handler(DIAG_CH_CANS_CAN_MOD_FAILURE, DIAG_EVENT_OK, 1, NULL_PTR);
+    for (i = 0; i <= nrOfMessages; i++) {
+        signalstart[i] = 0;
+    }
+
+    /* count the signals of each message */
+    for (node = 0; node < 2; node++) {
+        signals = CANS_GetSignals(direction, node, &nrOfSignals);
+        if (nrOfSignals >= CANS_SIGNALINDEX_CAN1) {
+            return 0;
+        }
+        for (i = 0; i < nrOfSignals; i++) {
+            msgIdx = (direction == CAN_TX_DIRECTION) ? (uint32_t)signals[i].msgIdx.Tx : (uint32_t)signals[i].msgIdx.Rx;
+            if (msgIdx < nrOfMessages) {
+                signalstart[msgIdx + 1]++;
             }
-            if (can_CAN0_messages_tx[i].cbk_func != NULL_PTR && result == E_OK) {
-                can_CAN0_messages_tx[i].cbk_func(i, NULL_PTR);
+        }
+    }
+
+    for (i = 0; i < nrOfMessages; i++) {
+        signalstart[i + 1] += signalstart[i];
+    }
+    if (signalstart[nrOfMessages] > maxNrOfSignals) {
+        return 0;
+    }
+
+    /* fill in the signal indices, signalstart[m] is used as write position of message m */
+    for (node = 0; node < 2; node++) {
+        signals = CANS_GetSignals(direction, node, &nrOfSignals);
+        flag = (node == 0) ? 0 : CANS_SIGNALINDEX_CAN1;
+        for (i = 0; i < nrOfSignals; i++) {
+            msgIdx = (direction == CAN_TX_DIRECTION) ? (uint32_t)signals[i].msgIdx.Tx : (uint32_t)signals[i].msgIdx.Rx;
+            if (msgIdx < nrOfMessages) {
+                signalindex[signalstart[msgIdx]] = (uint16_t)i | flag;
+                signalstart[msgIdx]++;
             }
         }
     }
+
+    /* write positions now point to the start of the next message, shift them back */
+    for (i = nrOfMessages; i > 0; i--) {
+        signalstart[i] = signalstart[i - 1];
+    }
+    signalstart[0] = 0;
+
+    return nrOfMessages;
+}
+
+/**
+ * initializes the transmit scheduler of the periodic messages.
+ *
+ * The first due time of every message is its repetition phase (spread over the
+ * ticks if CANS_TX_PHASE_SPREADING is TRUE) and all messages are inserted in
+ * the min-heap ordered by due time. Messages with a repetition time of 0 are
+ * not transmitted periodically.
+ */
+static void CANS_InitTxScheduler(void) {
+    uint32_t i = 0;
+    uint16_t msgIdx = 0;
+    const CAN_MSG_TX_TYPE_s *txMsg = NULL_PTR;
+
+    cans_tx_heap_length = 0;
+    cans_tx_time_ms = 0;
+#if CANS_TX_ON_DELTA == TRUE
+    for (i = 0; i < CANS_MAX_ON_DELTA_TX_MESSAGES; i++) {
+        cans_tx_ondelta[i].last_data = 0;
+        cans_tx_ondelta[i].last_tx_ms = 0;
+        cans_tx_ondelta[i].counter = 0;
+        cans_tx_ondelta[i].transmitted = FALSE;
+    }
+#endif
+#if CANS_TX_PHASE_SPREADING == TRUE
+    cans_tx_spread_ticks = CANS_GetTxHyperperiod();
+    for (i = 0; i < CANS_TX_SPREAD_MAX_TICKS; i++) {
+        cans_tx_slotload[i] = 0;
+    }
 #endif
 
+    for (i = 0; i < ((uint32_t)can_CAN0_tx_length + can_CAN1_tx_length); i++) {
+        txMsg = CANS_GetPeriodicTxMessage(i);
+        if (txMsg == NULL_PTR) {
+            continue;
+        }
+        msgIdx = (uint16_t)i;
+#if CANS_TX_PHASE_SPREADING == TRUE
+        cans_tx_duetime[msgIdx] = CANS_SpreadTxPhase(txMsg->repetition_time, txMsg->repetition_phase);
+#else
+        cans_tx_duetime[msgIdx] = txMsg->repetition_phase;
+#endif
+        cans_tx_heap[cans_tx_heap_length] = msgIdx;
+        cans_tx_heap_length++;
+        CANS_TxHeapSiftUp(cans_tx_heap_length - 1);
+    }
+}
+
+/**
+ * returns a periodic transmit message of the enabled CAN nodes.
+ *
+ * @param msgIdx    index of the message, the messages of CAN1 follow the ones of CAN0
+ *
+ * @return pointer to the message, NULL_PTR if its node is not used, it is not transmitted
+ *         periodically or its index is not below CANS_MAX_PERIODIC_TX_MESSAGES
+ */
+static const CAN_MSG_TX_TYPE_s *CANS_GetPeriodicTxMessage(uint32_t msgIdx) {
+    const CAN_MSG_TX_TYPE_s *txMsg = NULL_PTR;
+
+    if (msgIdx < can_CAN0_tx_length) {
+#if CAN_USE_CAN_NODE0 == TRUE
+        txMsg = &can_CAN0_messages_tx[msgIdx];
+#endif
+    } else {
 #if CAN_USE_CAN_NODE1 == TRUE
-    for (i = 0; i < can_CAN1_tx_length; i++) {
-        if (((counter_ticks * CANS_TICK_MS) % (can_CAN1_messages_tx[i].repetition_time)) == can_CAN1_messages_tx[i].repetition_phase) {
-            Can_PduType PduToSend = { {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 0x0, 8 };
-            CANS_ComposeMessage(CAN_NODE1, (CANS_messagesTx_e)i + can_CAN0_tx_length, PduToSend.sdu);
-            PduToSend.id = can_CAN1_messages_tx[i].ID;
-
-            result = CANS_AddMessage(CAN_NODE1, PduToSend.id, PduToSend.sdu, PduToSend.dlc, 0);
-
-            if (result == E_NOT_OK) {
-                DIAG_Handler(DIAG_CH_CANS_CAN_MOD_FAILURE, DIAG_EVENT_NOK, 0, NULL_PTR);
-            } else {
-                DIAG_Handler(DIAG_CH_CANS_CAN_MOD_FAILURE, DIAG_EVENT_OK, 0, NULL_PTR);
+        txMsg = &can_CAN1_messages_tx[msgIdx - can_CAN0_tx_length];
+#endif
+    }
+    if ((txMsg != NULL_PTR) && ((txMsg->repetition_time == 0) || (msgIdx >= CANS_MAX_PERIODIC_TX_MESSAGES))) {
+        txMsg = NULL_PTR;
+    }
+    return txMsg;
+}
+
+#if CANS_TX_PHASE_SPREADING == TRUE
+/**
+ * calculates the hyperperiod of the periodic messages.
+ *
+ * The hyperperiod is the least common multiple of the repetition times of all
+ * periodic messages in ticks. After it, the transmit pattern repeats.
+ *
+ * @return hyperperiod in ticks, CANS_TX_SPREAD_MAX_TICKS if it is longer
+ */
+static uint32_t CANS_GetTxHyperperiod(void) {
+    uint32_t hyperperiod = 1;
+    uint32_t period = 0;
+    uint32_t a = 0;
+    uint32_t b = 0;
+    uint32_t rest = 0;
+    uint32_t i = 0;
+    const CAN_MSG_TX_TYPE_s *txMsg = NULL_PTR;
+
+    for (i = 0; i < ((uint32_t)can_CAN0_tx_length + can_CAN1_tx_length); i++) {
+        txMsg = CANS_GetPeriodicTxMessage(i);
+        if (txMsg == NULL_PTR) {
+            continue;
+        }
+        period = txMsg->repetition_time / CANS_TICK_MS;
+        if (period == 0) {
+            period = 1;
+        }
+        /* greatest common divisor of hyperperiod and period */
+        a = hyperperiod;
+        b = period;
+        while (b != 0) {
+            rest = a % b;
+            a = b;
+            b = rest;
+        }
+        if ((hyperperiod / a) > (CANS_TX_SPREAD_MAX_TICKS / period)) {
+            hyperperiod = CANS_TX_SPREAD_MAX_TICKS;
+            break;
+        }
+        hyperperiod = (hyperperiod / a) * period;
+    }
+    return hyperperiod;
+}
+
+/**
+ * chooses the first due time of a periodic message.
+ *
+ * A message with the period p that is first due at tick t is due at the ticks
+ * t + k*p. The load of a candidate tick is the largest number of messages
+ * already due at one of these ticks within the hyperperiod, taken modulo the
+ * hyperperiod. Starting from the configured phase, the candidate with the
+ * lowest load within one repetition period is chosen, the first one if
+ * several have the same load. The load of the ticks of the chosen candidate
+ * is then updated. If the hyperperiod is longer than CANS_TX_SPREAD_MAX_TICKS,
+ * the load is tracked over CANS_TX_SPREAD_MAX_TICKS ticks and is only an
+ * approximation.
+ *
+ * @param repetition_time   repetition time of the message in ms
+ * @param repetition_phase  configured repetition phase of the message in ms
+ *
+ * @return first due time of the message in ms
+ */
+static uint32_t CANS_SpreadTxPhase(uint32_t repetition_time, uint32_t repetition_phase) {
+    uint32_t period = repetition_time / CANS_TICK_MS;
+    uint32_t phase = (repetition_phase + CANS_TICK_MS - 1) / CANS_TICK_MS;
+    uint32_t slot = 0;
+    uint32_t candidate = 0;
+    uint32_t best = phase;
+    uint8_t load = 0;
+    uint8_t bestload = UINT8_MAX;
+    uint32_t k = 0;
+    uint32_t j = 0;
+
+    if (period == 0) {
+        period = 1;
+    }
+
+    for (k = 0; k < period; k++) {
+        candidate = phase + k;
+        load = 0;
+        for (j = 0; j < cans_tx_spread_ticks; j += period) {
+            slot = (candidate + j) % cans_tx_spread_ticks;
+            if (cans_tx_slotload[slot] > load) {
+                load = cans_tx_slotload[slot];
             }
-            if (can_CAN1_messages_tx[i].cbk_func != NULL_PTR && result == E_OK) {
-                can_CAN1_messages_tx[i].cbk_func(i, NULL_PTR);
+        }
+
+        if (load < bestload) {
+            bestload = load;
+            best = candidate;
+        }
+        if (load == 0) {
+            break;
+        }
+    }
+
+    for (j = 0; j < cans_tx_spread_ticks; j += period) {
+        slot = (best + j) % cans_tx_spread_ticks;
+        if (cans_tx_slotload[slot] < UINT8_MAX) {
+            cans_tx_slotload[slot]++;
+        }
+    }
+
+    return best * CANS_TICK_MS;
+}
+#endif
+
+/**
+ * compares the due times of two periodic messages, robust against overflow of the time
+ *
+ * @return TRUE if message msgIdxA is due before message msgIdxB, FALSE otherwise
+ */
+static uint8_t CANS_IsTxDueBefore(uint16_t msgIdxA, uint16_t msgIdxB) {
+    uint8_t retVal = FALSE;
+    if ((int32_t)(cans_tx_duetime[msgIdxA] - cans_tx_duetime[msgIdxB]) < 0) {
+        retVal = TRUE;
+    }
+    return retVal;
+}
+
+/**
+ * moves the heap entry at position up until its parent is not due later
+ */
+static void CANS_TxHeapSiftUp(uint16_t position) {
+    uint16_t parent = 0;
+    uint16_t msgIdx = cans_tx_heap[position];
+
+    while (position > 0) {
+        parent = (position - 1) / 2;
+        if (CANS_IsTxDueBefore(msgIdx, cans_tx_heap[parent]) == FALSE) {
+            break;
+        }
+        cans_tx_heap[position] = cans_tx_heap[parent];
+        position = parent;
+    }
+    cans_tx_heap[position] = msgIdx;
+}
+
+/**
+ * moves the heap entry at position down until none of its children is due earlier
+ */
+static void CANS_TxHeapSiftDown(uint16_t position) {
+    uint16_t child = 0;
+    uint16_t msgIdx = cans_tx_heap[position];
+
+    while ((2 * position + 1) < cans_tx_heap_length) {
+        child = 2 * position + 1;
+        if (((child + 1) < cans_tx_heap_length) &&
+                (CANS_IsTxDueBefore(cans_tx_heap[child + 1], cans_tx_heap[child]) == TRUE)) {
+            child++;
+        }
+        if (CANS_IsTxDueBefore(cans_tx_heap[child], msgIdx) == FALSE) {
+            break;
+        }
+        cans_tx_heap[position] = cans_tx_heap[child];
+        position = child;
+    }
+    cans_tx_heap[position] = msgIdx;
+}
+
+#if CANS_TX_ON_DELTA == TRUE
+/**
+ * looks up the transmit state of a message that is transmitted on delta
+ *
+ * @param[in]  msgIdx   symbolic name of the message
+ * @param[out] cfg      range of cans_tx_ondelta_cfg[] the message belongs to
+ *
+ * @return pointer to the transmit state, NULL_PTR if the message is transmitted periodically
+ */
+static CANS_TX_ON_DELTA_s *CANS_GetOnDeltaState(CANS_messagesTx_e msgIdx, const CANS_TX_ON_DELTA_CFG_s **cfg) {
+    uint32_t stateIdx = 0;
+    uint16_t i = 0;
+
+    for (i = 0; i < cans_tx_ondelta_cfg_length; i++) {
+        if (((uint32_t)msgIdx >= (uint32_t)cans_tx_ondelta_cfg[i].first_msg) &&
+                ((uint32_t)msgIdx < ((uint32_t)cans_tx_ondelta_cfg[i].first_msg + cans_tx_ondelta_cfg[i].nr_of_messages))) {
+            stateIdx += (uint32_t)msgIdx - cans_tx_ondelta_cfg[i].first_msg;
+            if (stateIdx >= CANS_MAX_ON_DELTA_TX_MESSAGES) {
+                return NULL_PTR;
             }
+            *cfg = &cans_tx_ondelta_cfg[i];
+            return &cans_tx_ondelta[stateIdx];
         }
+        stateIdx += cans_tx_ondelta_cfg[i].nr_of_messages;
+    }
+    return NULL_PTR;
+}
+
+/**
+ * decides if a message that is transmitted on delta needs to be transmitted.
+ *
+ * This is the case for the first transmission, when the maximum silence time
+ * has expired or when the data changed by more than the deadband since the
+ * last transmission.
+ *
+ * @param msgIdx    symbolic name of the message
+ * @param cfg       range of cans_tx_ondelta_cfg[] the message belongs to
+ * @param state     transmit state of the message
+ * @param data      composed data of the message, without rolling counter
+ *
+ * @return TRUE if the message needs to be transmitted, FALSE otherwise
+ */
+static uint8_t CANS_IsOnDeltaTxDue(CANS_messagesTx_e msgIdx, const CANS_TX_ON_DELTA_CFG_s *cfg,
+        const CANS_TX_ON_DELTA_s *state, uint64_t data) {
+    uint8_t retVal = FALSE;
+
+    if (state->transmitted == FALSE) {
+        retVal = TRUE;
+    } else if ((cans_tx_time_ms - state->last_tx_ms) >= cfg->max_silence_ms) {
+        retVal = TRUE;
+    } else if (cfg->changed == NULL_PTR) {
+        retVal = (data != state->last_data) ? TRUE : FALSE;
+    } else {
+        retVal = cfg->changed(msgIdx, state->last_data, data);
+    }
+    return retVal;
+}
+#endif
+
+/**
+ * composes a periodic message and transfers it to the buffer of the CAN module
+ *
+ * Messages that are transmitted on delta are only transferred if
+ * CANS_IsOnDeltaTxDue() reports a change or an expired silence time. Their
+ * rolling counter is inserted into the data and advanced with every successful
+ * transfer.
+ *
+ * @param canNode        CAN node on which the message is transmitted
+ * @param nodeMsgIdx     index of the message in the transmit configuration of the node
+ * @param txMsg          transmit configuration of the message
+ * @param msgIdx         symbolic name of the message
+ * @param diagParameter  parameter passed to the diagnosis handler
+ */
+static void CANS_TransmitPeriodicMessage(CAN_NodeTypeDef_e canNode, uint32_t nodeMsgIdx,
+        const CAN_MSG_TX_TYPE_s *txMsg, CANS_messagesTx_e msgIdx, uint32_t diagParameter) {
+    STD_RETURN_TYPE_e result = E_NOT_OK;
+    Can_PduType PduToSend = { {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 0x0, 8 };
+#if CANS_TX_ON_DELTA == TRUE
+    uint64_t *dataPtr64 = (uint64_t *)PduToSend.sdu;
+    uint64_t counterMask = 0;
+    uint64_t data = 0;
+    const CANS_TX_ON_DELTA_CFG_s *ondeltaCfg = NULL_PTR;
+    CANS_TX_ON_DELTA_s *ondeltaState = NULL_PTR;
+#endif
+
+    CANS_ComposeMessage(canNode, msgIdx, PduToSend.sdu);
+    PduToSend.id = txMsg->ID;
+
+#if CANS_TX_ON_DELTA == TRUE
+    ondeltaState = CANS_GetOnDeltaState(msgIdx, &ondeltaCfg);
+    if (ondeltaState != NULL_PTR) {
+        counterMask = (uint64_t)ondeltaCfg->counter_mask << ondeltaCfg->counter_shift;
+        data = dataPtr64[0] & ~counterMask;
+        if (CANS_IsOnDeltaTxDue(msgIdx, ondeltaCfg, ondeltaState, data) == FALSE) {
+            return;
+        }
+        dataPtr64[0] = data | (((uint64_t)ondeltaState->counter << ondeltaCfg->counter_shift) & counterMask);
+    }
+#endif
+
+    result = CANS_AddMessage(canNode, PduToSend.id, PduToSend.sdu, PduToSend.dlc, 0);
+
+#if CANS_TX_ON_DELTA == TRUE
+    if ((ondeltaState != NULL_PTR) && (result == E_OK)) {
+        ondeltaState->last_data = data;
+        ondeltaState->last_tx_ms = cans_tx_time_ms;
+        ondeltaState->counter = (ondeltaState->counter + 1) & ondeltaCfg->counter_mask;
+        ondeltaState->transmitted = TRUE;
     }
 #endif
 
-    result = E_NOT_OK;
+    if (result == E_NOT_OK) {
+        DIAG_Handler(DIAG_CH_CANS_CAN_MOD_FAILURE, DIAG_EVENT_NOK, diagParameter, NULL_PTR);
+    } else {
+        DIAG_Handler(DIAG_CH_CANS_CAN_MOD_FAILURE, DIAG_EVENT_OK, diagParameter, NULL_PTR);
+    }
+    if (txMsg->cbk_func != NULL_PTR && result == E_OK) {
+        txMsg->cbk_func(nodeMsgIdx, NULL_PTR);
+    }
+}
 
-    counter_ticks++;
+/**
+ * handles the processing of messages that are meant to be transmitted.
+ *
+ * The periodic messages are kept in a min-heap ordered by their next due time.
+ * Only the messages that are due are taken from the top of the heap: each one is
+ * composed by call of CANS_ComposeMessage and transfered to the buffer of the
+ * CAN module, then its due time is advanced by its repetition time and it is
+ * moved back down the heap. If a callback function is declared in
+ * configuration, this callback is called after successful transmission.
+ *
+ * @return TRUE
+ */
+static STD_RETURN_TYPE_e CANS_PeriodicTransmit(void) {
+    uint16_t msgIdx = 0;
+    const CAN_MSG_TX_TYPE_s *txMsg = NULL_PTR;
+
+    while ((cans_tx_heap_length > 0) &&
+            ((int32_t)(cans_tx_time_ms - cans_tx_duetime[cans_tx_heap[0]]) >= 0)) {
+        msgIdx = cans_tx_heap[0];
+        if (msgIdx < can_CAN0_tx_length) {
+            txMsg = &can_CAN0_messages_tx[msgIdx];
+            CANS_TransmitPeriodicMessage(CAN_NODE0, msgIdx, txMsg, (CANS_messagesTx_e)msgIdx, 1);
+        } else {
+            txMsg = &can_CAN1_messages_tx[msgIdx - can_CAN0_tx_length];
+            CANS_TransmitPeriodicMessage(CAN_NODE1, msgIdx - can_CAN0_tx_length, txMsg, (CANS_messagesTx_e)msgIdx, 0);
+        }
+        cans_tx_duetime[msgIdx] += txMsg->repetition_time;
+        CANS_TxHeapSiftDown(0);
+    }
+
+    cans_tx_time_ms += CANS_TICK_MS;
     return TRUE;
 }
 
@@ -196,51 +753,105 @@ static STD_RETURN_TYPE_e CANS_PeriodicTransmit(void) {
  * handles the processing of received CAN messages.
  *
  * This function gets the messages in the receive buffer
- * of the CAN module. If a message ID is
- * matching one of the IDs in the configuration of
- * CANS module, the signal processing is executed
- * by call to CANS_ParseMessage.
+ * of the CAN module. The message ID is looked up in the
+ * receive configuration with CAN_GetRxMessageIndex(). If it
+ * is configured, the signal processing is executed
+ * by call to CANS_ParseMessage. The cycles needed for lookup
+ * and parsing are recorded in the receive statistics of the node.
  *
  * @return E_OK, if a message has been received and parsed, E_NOT_OK otherwise
  */
 static STD_RETURN_TYPE_e CANS_PeriodicReceive(void) {
     Can_PduType msg = {};
     STD_RETURN_TYPE_e result_node0 = E_NOT_OK, result_node1 = E_NOT_OK;
-    uint32_t i = 0;
+    uint32_t startcycles = 0;
+    uint8_t i = 0;
 
 #if CAN_USE_CAN_NODE0 == TRUE
     while (CAN_ReceiveBuffer(CAN_NODE0, &msg)  ==  E_OK) {
-        for (i = 0; i < can_CAN0_rx_length; i++) {
-            if (msg.id  ==  can0_RxMsgs[i].ID) {
-                CANS_ParseMessage(CAN_NODE0, (CANS_messagesRx_e)i, msg.sdu);
-                result_node0 = E_OK;
-            }
+        startcycles = MCU_GetCycleCounter();
+        i = CAN_GetRxMessageIndex(CAN_NODE0, msg.id);
+        if (i != CAN_RX_INVALID_INDEX) {
+            cans_rx_timestamp = msg.timestamp;
+            CANS_ParseMessage(CAN_NODE0, (CANS_messagesRx_e)i, msg.sdu);
+            result_node0 = E_OK;
         }
+        CAN_UpdateRxDispatchCycles(CAN_NODE0, MCU_GetCycleCounter() - startcycles);
     }
+    CANS_CheckRxOverflow(CAN_NODE0);
 #else
     result_node0 = E_OK;
 #endif
 
 #if CAN_USE_CAN_NODE1 == TRUE
     while (CAN_ReceiveBuffer(CAN_NODE1, &msg) == E_OK) {
-        for (i = 0; i < can_CAN1_rx_length; i++) {
-            if (msg.id == can1_RxMsgs[i].ID) {
-                CANS_ParseMessage(CAN_NODE1, (CANS_messagesRx_e)i + can_CAN0_rx_length, msg.sdu);
-                result_node1 = E_OK;
-            }
+        startcycles = MCU_GetCycleCounter();
+        i = CAN_GetRxMessageIndex(CAN_NODE1, msg.id);
+        if (i != CAN_RX_INVALID_INDEX) {
+            cans_rx_timestamp = msg.timestamp;
+            CANS_ParseMessage(CAN_NODE1, (CANS_messagesRx_e)i + can_CAN0_rx_length, msg.sdu);
+            result_node1 = E_OK;
         }
+        CAN_UpdateRxDispatchCycles(CAN_NODE1, MCU_GetCycleCounter() - startcycles);
     }
+    CANS_CheckRxOverflow(CAN_NODE1);
 #else
     result_node1 = E_OK;
 #endif
 
-#if defined(ITRI_MOD_11)
-    extern void cans_check_heartbeat();
-    cans_check_heartbeat();
+#if CANS_HEARTBEAT_SUPERVISION == TRUE
+    CANS_CheckHeartbeats();
 #endif
 
     return result_node0 && result_node1;
 }
+
+
+/**
+ * reports dropped receive frames of a CAN node to the diagnosis module.
+ *
+ * The drop counter of the receive statistics is compared to its value at the
+ * last check, the node is passed as parameter of the diagnosis event.
+ *
+ * @param canNode   CAN node to check
+ */
+static void CANS_CheckRxOverflow(CAN_NodeTypeDef_e canNode) {
+    CAN_RX_STATISTICS_s rxstatistics;
+
+    if (CAN_GetRxStatistics(canNode, &rxstatistics) == E_OK) {
+        if (rxstatistics.nr_of_dropped_frames != cans_rx_dropped_frames[canNode]) {
+            cans_rx_dropped_frames[canNode] = rxstatistics.nr_of_dropped_frames;
+            DIAG_Handler(DIAG_CH_CAN_RX_OVERFLOW, DIAG_EVENT_NOK, (uint32_t)canNode, NULL_PTR);
+        } else {
+            DIAG_Handler(DIAG_CH_CAN_RX_OVERFLOW, DIAG_EVENT_OK, (uint32_t)canNode, NULL_PTR);
+        }
+    }
+}
+
+
+#if CANS_HEARTBEAT_SUPERVISION == TRUE
+/**
+ * checks the heartbeat of all supervised CAN peers.
+ *
+ * When the time since the last heartbeat of a peer exceeds its timeout, the
+ * reaction of the peer is called once and the supervision of the peer stops
+ * until the next heartbeat.
+ */
+static void CANS_CheckHeartbeats(void) {
+    uint32_t now = OS_getOSSysTick();
+    uint32_t i = 0;
+
+    for (i = 0; i < CANS_NR_OF_HEARTBEAT_PEERS; i++) {
+        if (cans_heartbeat[i].alive == 1 && (now - cans_heartbeat[i].last_tick) > cans_heartbeat_cfg[i].timeout_ms) {
+            cans_heartbeat[i].alive = 0;
+            cans_heartbeat[i].nr_of_timeouts++;
+            if (cans_heartbeat_cfg[i].reaction != NULL_PTR) {
+                cans_heartbeat_cfg[i].reaction((CANS_heartbeatPeer_e)i);
+            }
+        }
+    }
+}
+#endif
 /**
  * @brief   generates bitfield, which masks the bits where the actual signal (defined by its bitlength) is located
  *
@@ -292,75 +903,131 @@ static void CANS_SetSignalData(CANS_signal_s signal, uint64_t value, uint8_t *da
     dataPtr64[0] |= ((((uint64_t)value) & bitmask) << bitposition);
 }
 
+/**
+ * composes one signal into the message data, the signal data is received by its getter callback function
+ *
+ * @param[in]  signals   signal array of the CAN node
+ * @param[in]  sigIdx    index of the signal in the signal array
+ * @param[out] dataptr   message data in which the signal data is inserted
+ */
+static void CANS_ComposeSignal(const CANS_signal_s *signals, uint32_t sigIdx, uint8_t dataptr[]) {
+    uint64_t value = 0;
+    if (signals[sigIdx].getter != NULL_PTR) {
+        signals[sigIdx].getter(sigIdx, &value);
+    }
+    CANS_SetSignalData(signals[sigIdx], value, dataptr);
+}
+
+/**
+ * parses one signal from the message data, the signal data is handed over to its setter callback function
+ *
+ * @param[in]  signals    signal array of the CAN node
+ * @param[in]  sigIdx     index of the signal in the signal array
+ * @param[in]  setterIdx  signal index passed to the setter callback function
+ * @param[in]  dataptr    message data from which the signal data is extracted
+ */
+static void CANS_ParseSignal(const CANS_signal_s *signals, uint32_t sigIdx, uint32_t setterIdx, uint8_t dataptr[]) {
+    uint64_t value = 0;
+    CANS_GetSignalData(&value, signals[sigIdx], dataptr);
+    if (signals[sigIdx].setter != NULL_PTR) {
+        signals[sigIdx].setter(setterIdx, &value);
+    }
+}
+
 /**
  * composes message data from all signals associated with this msgIdx
  *
- * signal data is received by callback getter functions
+ * signal data is received by callback getter functions. The signals of the
+ * message are taken from the message to signal index built in CANS_Init(),
+ * messages that are not indexed are searched in all signals. Cell data
+ * messages are composed by CANS_ComposeCellDataMessage().
  *
+ * @param[in] canNode  CAN node on which the message is transmitted
  * @param[in] msgIdx   message index for which the data should be composed
  * @param[out] dataptr  pointer where the message data should be stored to
  */
 static void CANS_ComposeMessage(CAN_NodeTypeDef_e canNode, CANS_messagesTx_e msgIdx, uint8_t dataptr[]) {
     uint32_t i = 0;
     uint32_t nrTxSignals = 0;
-    /* find multiplexor if multiplexed signal */
-
-    CANS_signal_s *cans_signals_tx;
+    uint16_t node_flag = 0;
+    const CANS_signal_s *cans_signals_tx = NULL_PTR;
 
     if (canNode == CAN_NODE0) {
-        cans_signals_tx = (CANS_signal_s *)&cans_CAN0_signals_tx;
+        cans_signals_tx = cans_CAN0_signals_tx;
         nrTxSignals = cans_CAN0_signals_tx_length;
+        node_flag = 0;
     } else if (canNode == CAN_NODE1) {
-        cans_signals_tx = (CANS_signal_s *)&cans_CAN1_signals_tx;
+        cans_signals_tx = cans_CAN1_signals_tx;
         nrTxSignals = cans_CAN1_signals_tx_length;
+        node_flag = CANS_SIGNALINDEX_CAN1;
+    } else {
+        return;
     }
 
-    for (i = 0; i < nrTxSignals; i++) {
-        if (cans_signals_tx[i].msgIdx.Tx == msgIdx) {
-            /* simple, not multiplexed signal */
-            uint64_t value = 0;
-            if (cans_signals_tx[i].getter != NULL_PTR) {
-                cans_signals_tx[i].getter(i, &value);
+    /* cell data messages are packed as a whole, see cansignal_gen_cfg.h */
+    if ((canNode == CAN_NODE0) && (CANS_ComposeCellDataMessage(msgIdx, dataptr) == TRUE)) {
+        return;
+    }
+
+    if ((uint32_t)msgIdx < cans_tx_nr_of_indexed_messages) {
+        for (i = cans_tx_signalstart[msgIdx]; i < cans_tx_signalstart[msgIdx + 1]; i++) {
+            if ((cans_tx_signalindex[i] & CANS_SIGNALINDEX_CAN1) == node_flag) {
+                CANS_ComposeSignal(cans_signals_tx, cans_tx_signalindex[i] & ~CANS_SIGNALINDEX_CAN1, dataptr);
+            }
+        }
+    } else {
+        for (i = 0; i < nrTxSignals; i++) {
+            if (cans_signals_tx[i].msgIdx.Tx == msgIdx) {
+                CANS_ComposeSignal(cans_signals_tx, i, dataptr);
             }
-            CANS_SetSignalData(cans_signals_tx[i], value, dataptr);
-        } else {
-            /* TODO: explain why empty else */
         }
     }
 }
+
 /**
  * @brief   parses signal data from message associated with this msgIdx
  *
- * signal data is received by callback setter functions
+ * signal data is received by callback setter functions. The signals of the
+ * message are taken from the message to signal index built in CANS_Init(),
+ * messages that are not indexed are searched in all signals.
  *
+ * @param[in]   canNode  CAN node on which the message has been received
  * @param[in]   msgIdx   message index for which the data should be parsed
  * @param[in]   dataptr  pointer where the message data is stored
 */
 static void CANS_ParseMessage(CAN_NodeTypeDef_e canNode, CANS_messagesRx_e msgIdx, uint8_t dataptr[]) {
     uint32_t i = 0;
+    uint32_t sigIdx = 0;
+    uint32_t nrRxSignals = 0;
+    uint32_t setterOffset = 0;
+    uint16_t node_flag = 0;
+    const CANS_signal_s *cans_signals_rx = NULL_PTR;
 
     if (canNode == CAN_NODE0) {
-        for (i = 0; i < cans_CAN0_signals_rx_length; i++) {
-            /* Iterate over CAN0 rx signals and find message */
-
-            if (cans_CAN0_signals_rx[i].msgIdx.Rx  ==  msgIdx) {
-                uint64_t value = 0;
-                CANS_GetSignalData(&value, cans_CAN0_signals_rx[i], dataptr);
-                if (cans_CAN0_signals_rx[i].setter != NULL_PTR) {
-                    cans_CAN0_signals_rx[i].setter(i, &value);
-                }
+        cans_signals_rx = cans_CAN0_signals_rx;
+        nrRxSignals = cans_CAN0_signals_rx_length;
+        node_flag = 0;
+        setterOffset = 0;
+    } else if (canNode == CAN_NODE1) {
+        cans_signals_rx = cans_CAN1_signals_rx;
+        nrRxSignals = cans_CAN1_signals_rx_length;
+        node_flag = CANS_SIGNALINDEX_CAN1;
+        setterOffset = cans_CAN0_signals_rx_length;
+    } else {
+        return;
+    }
+
+    if ((uint32_t)msgIdx < cans_rx_nr_of_indexed_messages) {
+        for (i = cans_rx_signalstart[msgIdx]; i < cans_rx_signalstart[msgIdx + 1]; i++) {
+            if ((cans_rx_signalindex[i] & CANS_SIGNALINDEX_CAN1) == node_flag) {
+                sigIdx = cans_rx_signalindex[i] & ~CANS_SIGNALINDEX_CAN1;
+                CANS_ParseSignal(cans_signals_rx, sigIdx, setterOffset + sigIdx, dataptr);
             }
         }
-    } else if (canNode == CAN_NODE1) {
-        for (i = 0; i < cans_CAN1_signals_rx_length; i++) {
-            /* Iterate over CAN1 rx signals and find message */
-
-            if (cans_CAN1_signals_rx[i].msgIdx.Rx  ==  msgIdx) {
-                uint64_t value = 0;
-                CANS_GetSignalData(&value, cans_CAN1_signals_rx[i], dataptr);
-                if (cans_CAN1_signals_rx[i].setter != NULL_PTR) {
-                    cans_CAN1_signals_rx[i].setter(cans_CAN0_signals_rx_length + i, &value);
-                }
+    } else {
+        for (i = 0; i < nrRxSignals; i++) {
+            if (cans_signals_rx[i].msgIdx.Rx == msgIdx) {
+                CANS_ParseSignal(cans_signals_rx, i, setterOffset + i, dataptr);
             }
         }
     }
@@ -515,3 +1182,43 @@ extern uint8_t CANS_IsCurrentSensorCCPresent(void) {
 
     return (retval);
 }
+
+
+void CANS_ReceiveHeartbeat(CANS_heartbeatPeer_e peer) {
+#if CANS_HEARTBEAT_SUPERVISION == TRUE
+    uint32_t now = OS_getOSSysTick();
+    uint32_t interval = 0;
+
+    if ((uint32_t)peer < CANS_NR_OF_HEARTBEAT_PEERS) {
+        OS_TaskEnter_Critical();
+        if (cans_heartbeat[peer].alive == 1) {
+            interval = now - cans_heartbeat[peer].last_tick;
+            cans_heartbeat[peer].interval_last = interval;
+            if (interval < cans_heartbeat[peer].interval_min || cans_heartbeat[peer].interval_max == 0) {
+                cans_heartbeat[peer].interval_min = interval;
+            }
+            if (interval > cans_heartbeat[peer].interval_max) {
+                cans_heartbeat[peer].interval_max = interval;
+            }
+        }
+        cans_heartbeat[peer].alive = 1;
+        cans_heartbeat[peer].last_tick = now;
+        cans_heartbeat[peer].nr_of_heartbeats++;
+        OS_TaskExit_Critical();
+    }
+#endif
+}
+
+STD_RETURN_TYPE_e CANS_GetHeartbeat(CANS_heartbeatPeer_e peer, CANS_HEARTBEAT_s *heartbeat) {
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
+
+#if CANS_HEARTBEAT_SUPERVISION == TRUE
+    if ((uint32_t)peer < CANS_NR_OF_HEARTBEAT_PEERS && heartbeat != NULL_PTR) {
+        OS_TaskEnter_Critical();
+        *heartbeat = cans_heartbeat[peer];
+        OS_TaskExit_Critical();
+        retVal = E_OK;
+    }
+#endif
+    return retVal;
+}
@@ -73,12 +73,26 @@ typedef struct {
     uint8_t current_sensor_cc_present;         /*!< defines if a CC info is being sent  */
 } CANS_STATE_s;
 
+/**
+ * heartbeat supervision state and statistics of a CAN peer, times are in ms
+ * of the OS system tick
+ */
+typedef struct {
+    uint8_t alive;                  /*!< 1 while heartbeats are received within the timeout */
+    uint32_t last_tick;             /*!< time of the last heartbeat */
+    uint32_t nr_of_heartbeats;      /*!< heartbeats received */
+    uint32_t nr_of_timeouts;        /*!< heartbeat timeouts detected */
+    uint32_t interval_last;         /*!< time between the last two heartbeats */
+    uint32_t interval_min;          /*!< minimum time between two heartbeats */
+    uint32_t interval_max;          /*!< maximum time between two heartbeats, the worst-case jitter is interval_max - interval_min */
+} CANS_HEARTBEAT_s;
+
 
 /*================== Function Prototypes ==================================*/
 /**
  * initializes local variables and module internals needed to use conversion of
- * can signals. Until now no initialization is needed and thus the function does
- * nothing.
+ * can signals, i.e., the scheduler of the periodic transmit messages. Must be
+ * called once after CAN_Init().
  */
 extern void CANS_Init(void);
 
@@ -89,12 +103,42 @@ extern void CANS_Init(void);
 extern void CANS_MainFunction(void);
 
 extern void CANS_Enable_Periodic(uint8_t command);
+
+/**
+ * gets the time at which the message whose signals are parsed was received.
+ * The receive interrupt takes the time, so it does not depend on when the
+ * CANS task gets to the message. Only valid in the setter functions of the
+ * receive signals.
+ *
+ * @return OS tick in ms at the reception of the message
+ */
+extern uint32_t CANS_GetRxTimestamp(void);
+
+/**
+ * signals a heartbeat of a CAN peer, the peer is supervised from the first
+ * heartbeat on until its timeout in cans_heartbeat_cfg[] expires.
+ *
+ * @param peer  CAN peer that sent the heartbeat
+ */
+extern void CANS_ReceiveHeartbeat(CANS_heartbeatPeer_e peer);
+
+/**
+ * gets the heartbeat supervision state and statistics of a CAN peer
+ *
+ * @param peer       CAN peer
+ * @param heartbeat  pointer where to store the state
+ *
+ * @return E_OK if the peer is supervised, otherwise E_NOT_OK
+ */
+extern STD_RETURN_TYPE_e CANS_GetHeartbeat(CANS_heartbeatPeer_e peer, CANS_HEARTBEAT_s *heartbeat);
 extern uint8_t CANS_IsCurrentSensorPresent(void);
 extern uint8_t CANS_IsCurrentSensorCCPresent(void);
 
 /**
  * @brief  Add message to transmit buffer, message will be transmitted shortly after.
  *
+ * If a transmit mailbox is free, the transmission of the buffer is started immediately.
+ *
  * @param  canNode: canNode on which the message shall be transmitted
  * @param  msgID:    ID of the message that will be transmitted
  * @param  ptrMsgData:    pointer to a uint8_t array that contains the message that will be transmitted
@@ -111,6 +155,8 @@ extern STD_RETURN_TYPE_e CANS_AddMessage(CAN_NodeTypeDef_e canNode, uint32_t msg
 /**
  * @brief  Transmits canNode transmit buffer
  *
+ * Fills all free transmit mailboxes from the buffer and updates the transmitted frames per second.
+ *
  * @param canNode:  canNode on which the message shall be transmitted
  *
  * @retval E_OK if transmission successful, otherwise E_NOT_OK
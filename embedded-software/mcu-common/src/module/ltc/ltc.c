@@ -56,6 +56,7 @@
 #include "database.h"
 #include "diag.h"
 #include "ltc_pec.h"
+#include "mcu.h"
 #include "os.h"
 
 #if defined(ITRI_MOD)
@@ -85,6 +86,17 @@
 #define LTC_SAVELASTSTATES()    ltc_state.laststate = ltc_state.state; \
                                 ltc_state.lastsubstate = ltc_state.substate
 
+/**
+ * TRUE if the PEC of the register group of LTC ic was valid in the last reception
+ */
+#define LTC_IS_PEC_VALID(ic)    (((ltc_RXPECerrors[(ic) / 32] >> ((ic) % 32)) & 1) == 0)
+
+/**
+ * Returned if no entry of the measurement plan is due
+ */
+#define LTC_PLAN_NO_ENTRY           0xFF
+#define LTC_PLAN_NO_MEASUREMENT     0xFF
+
 /*================== Constant and Variable Definitions ====================*/
 
 static uint8_t ltc_used_cells_index = 0;
@@ -104,6 +116,37 @@ static int32_t ltc_openwire_delta[BS_NR_OF_BAT_CELLS];
 
 static LTC_ERRORTABLE_s LTC_ErrorTable[BS_NR_OF_MODULES];  /* init in LTC_ResetErrorTable-function */
 
+/**
+ * PEC error bitmap of the last reception, bit set -> PEC of the corresponding LTC was wrong
+ */
+static uint32_t ltc_RXPECerrors[LTC_PEC_BITMAP_WORDS(LTC_N_LTC)];
+
+/**
+ * cycle time statistics of the cell voltage measurement
+ */
+static LTC_CYCLETIME_s ltc_cycletime = {
+    .voltage    = { .last = 0, .min = UINT32_MAX, .max = 0 },
+    .period     = { .last = 0, .min = UINT32_MAX, .max = 0 },
+    .nr_of_cycles = 0,
+};
+static uint32_t ltc_cycle_starttime = 0;            /* cycle counter at the start of the voltage measurement */
+static uint8_t ltc_cycle_started = FALSE;           /* TRUE while a voltage measurement is timed */
+
+static uint32_t ltc_plan_cycle = 0;                 /* cell voltage measurement cycle counter of the measurement plan */
+static uint32_t ltc_plan_pending = 0;               /* bit n set: entry n of the measurement plan was due, but not made yet */
+
+/**
+ * per module statistics of the cell voltages and temperatures, updated while the values are stored
+ */
+static LTC_STATS_s ltc_voltage_stats[BS_NR_OF_MODULES];
+static LTC_STATS_s ltc_temperature_stats[BS_NR_OF_MODULES];
+
+#if LTC_EVENT_DRIVEN_SCHEDULING == TRUE
+static TaskHandle_t ltc_eventtask = NULL;           /* task notified at the end of each SPI transmission */
+static LTC_STATEMACH_e ltc_event_laststate = LTC_STATEMACH_UNINITIALIZED;
+static uint8_t ltc_event_lastsubstate = 0;
+#endif
+
 
 static LTC_STATE_s ltc_state = {
     .timer                   = 0,
@@ -132,6 +175,9 @@ static LTC_STATE_s ltc_state = {
     .ltc_muxcycle_finished   = E_NOT_OK,
     .check_spi_flag          = FALSE,
     .balance_control_done     = FALSE,
+    .pipeline_mux_configured  = FALSE,
+    .pipeline_voltage_started = FALSE,
+    .pipeline_aux_started     = FALSE,
 };
 
 static const uint8_t ltc_cmdDummy[1]={0x00};
@@ -207,7 +253,7 @@ static uint8_t ltc_TXBufferClock[4+9];
 static uint8_t ltc_TXPECBufferClock[4+9];
 
 #if defined(ITRI_MOD_2_b)
-#include "..\..\..\..\mcu-primary\src\general\third_party\ltc_itri.h"
+#include "../../../../mcu-primary/src/general/third_party/ltc_itri.h"
 extern LTC_EBM_CMD_s ltc_ebm_cmd;
 #endif // ITRI_MOD_2_b
 
@@ -227,7 +273,7 @@ static STD_RETURN_TYPE_e LTC_StartGPIOMeasurement(LTC_ADCMODE_e adcMode, LTC_ADC
 static STD_RETURN_TYPE_e LTC_StartOpenWireMeasurement(LTC_ADCMODE_e adcMode, uint8_t PUP);
 
 static uint16_t LTC_Get_MeasurementTCycle(LTC_ADCMODE_e adcMode, LTC_ADCMEAS_CHAN_e  adcMeasCh);
-static void LTC_SaveRXtoVoltagebuffer(uint8_t registerSet, uint8_t *rxBuffer, uint8_t PEC_valid);
+static void LTC_SaveRXtoVoltagebuffer(uint8_t registerSet, uint8_t *rxBuffer);
 static void LTC_SaveRXtoGPIOBuffer(uint8_t registerSet, uint8_t *rxBuffer);
 
 static STD_RETURN_TYPE_e LTC_RX_PECCheck(uint8_t *DataBufferSPI_RX_with_PEC);
@@ -257,6 +303,25 @@ static void LTC_SetTransferTimes(void);
 
 static LTC_RETURN_TYPE_e LTC_CheckStateRequest(LTC_STATE_REQUEST_e statereq);
 
+static void LTC_UpdateTiming(LTC_TIMING_s *timing, uint32_t duration);
+static void LTC_StartCycleTime(void);
+static void LTC_StopCycleTime(void);
+#if LTC_EVENT_DRIVEN_SCHEDULING == TRUE
+static void LTC_SPITransferComplete(void);
+#endif
+static uint8_t LTC_IsMeasurementPlanned(LTC_PLAN_MEASUREMENT_e measurement);
+static uint8_t LTC_IsPlanEntryDue(uint8_t entry);
+static uint8_t LTC_GetNextPlanEntry(void);
+static uint8_t LTC_GetNextPlannedMeasurement(void);
+static void LTC_StartPlannedMeasurement(void);
+static void LTC_SelectNextMeasurement(void);
+static void LTC_ResetStats(LTC_STATS_s *stats);
+static void LTC_AddToStats(LTC_STATS_s *stats, int16_t value, uint8_t index);
+#if LTC_PIPELINED_MEASUREMENT == TRUE
+static uint16_t LTC_GetRemainingConversionTime(uint32_t endtime);
+static STD_RETURN_TYPE_e LTC_StartPipelinedVoltageMeasurement(void);
+#endif
+
 
 /*================== Function Implementations =============================*/
 #if defined(ITRI_MOD_2_b)
@@ -463,6 +528,8 @@ static void LTC_Initialize_Database(void) {
 
     ltc_cellvoltage.state = 0;
     ltc_cellvoltage.timestamp = 0;
+    ltc_cellvoltage.voltage_min = 0;
+    ltc_cellvoltage.voltage_min_index = 0;
     ltc_minmax.voltage_min = 0;
     ltc_minmax.voltage_max = 0;
     ltc_minmax.voltage_module_number_min = 0;
@@ -487,6 +554,10 @@ static void LTC_Initialize_Database(void) {
     for (i=0; i < BS_NR_OF_TEMP_SENSORS; i++) {
         ltc_celltemperature.temperature[i] = 0;
     }
+    for (i=0; i < BS_NR_OF_MODULES; i++) {
+        LTC_ResetStats(&ltc_voltage_stats[i]);
+        LTC_ResetStats(&ltc_temperature_stats[i]);
+    }
 
     ltc_balancing_feedback.state = 0;
     ltc_balancing_feedback.timestamp = 0;
@@ -548,25 +619,24 @@ static void LTC_Initialize_Database(void) {
 /**
  * @brief   stores the measured voltages in the database.
  *
- * This function loops through the data of all modules in the LTC daisy-chain that are
- * stored in the LTC_CellVoltages buffer and writes them in the database.
+ * This function writes the cell voltages of all modules in the LTC daisy-chain in the
+ * database, together with the minimum, maximum and mean values. These are merged from
+ * the per module statistics collected while the voltages were stored.
  * At each write iteration, the variable named "state" and related to voltages in the
  * database is incremented.
  *
  */
 extern void LTC_SaveVoltages(void) {
     uint16_t i = 0;
-    uint16_t j = 0;
     uint16_t min = 0;
     uint16_t max = 0;
-    uint32_t mean = 0;
+    uint32_t sum = 0;
+    uint16_t nr_of_values = 0;
     uint8_t module_number_min = 0;
     uint8_t module_number_max = 0;
     uint8_t cell_number_min = 0;
     uint8_t cell_number_max = 0;
 
-    max = min = ltc_cellvoltage.voltage[0];
-    mean = 0;
     for (i=0; i < BS_NR_OF_MODULES; i++) {
 #if defined(ITRI_MOD_2)
 		if (ltc_ebm_cmd == LTC_EBM_CURR_CALI && ltc_ebm_cali[i].isCali > 0) {
@@ -586,47 +656,43 @@ extern void LTC_SaveVoltages(void) {
 		}
 #endif
 
-        for (j=0; j < BS_NR_OF_BAT_CELLS_PER_MODULE; j++) {
-
-#if defined(ITRI_MOD_6)
-            if (ltc_ebm_cali[i].isCali == 0) {
-				if (j == LTC_EBM_BAT_CURR_IDX) ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j] -= ltc_ebm_cali[i].curBat_offset;
-				if (j == LTC_EBM_MOD_CURR_IDX) ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j] -= ltc_ebm_cali[i].curMod_offset;
-            }
-#endif
-#if defined(ITRI_MOD_13)
-            if (j >= ITRI_NR_OF_BAT_CELLS_PER_MODULE) break;
-#endif
-            mean += ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j];
-            //DEBUG_PRINTF(("[%s:%d]vol:%u i:%u j:%u\r\n", __func__, __LINE__, ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j], i, j));
-            if (ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j] < min) {
-                min = ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j];
-                //if (min < 1) DEBUG_PRINTF(("[%s:%d]min:%u i:%u j:%u\r\n", __func__, __LINE__, min, i, j));
-
-                module_number_min = i;
-                cell_number_min = j;
-            }
-            if (ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j] > max) {
-                max = ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j];
-                module_number_max = i;
-                cell_number_max = j;
-            }
+        ltc_minmax.voltage_module_sum[i] = (uint32_t)ltc_voltage_stats[i].sum;
+        ltc_minmax.voltage_module_min[i] = (uint16_t)ltc_voltage_stats[i].min;
+        ltc_minmax.voltage_module_max[i] = (uint16_t)ltc_voltage_stats[i].max;
+        if (ltc_voltage_stats[i].nr_of_values == 0) {
+            continue;
+        }
+        /* the first module with the extreme value wins, as the cells are added in ascending order */
+        if (nr_of_values == 0 || ltc_voltage_stats[i].min < min) {
+            min = (uint16_t)ltc_voltage_stats[i].min;
+            module_number_min = i;
+            cell_number_min = ltc_voltage_stats[i].index_min;
         }
+        if (nr_of_values == 0 || ltc_voltage_stats[i].max > max) {
+            max = (uint16_t)ltc_voltage_stats[i].max;
+            module_number_max = i;
+            cell_number_max = ltc_voltage_stats[i].index_max;
+        }
+        sum += (uint32_t)ltc_voltage_stats[i].sum;
+        nr_of_values += ltc_voltage_stats[i].nr_of_values;
     }
-    mean /= (BS_NR_OF_BAT_CELLS);
 
-    DB_ReadBlock(&ltc_minmax, DATA_BLOCK_ID_MINMAX);
     ltc_cellvoltage.state++;
     ltc_minmax.state++;
-    ltc_minmax.voltage_mean = mean;
-    ltc_minmax.previous_voltage_min = ltc_minmax.voltage_min;
-    ltc_minmax.voltage_min = min;
-    ltc_minmax.voltage_module_number_min = module_number_min;
-    ltc_minmax.voltage_cell_number_min = cell_number_min;
-    ltc_minmax.previous_voltage_max = ltc_minmax.voltage_max;
-    ltc_minmax.voltage_max = max;
-    ltc_minmax.voltage_module_number_max = module_number_max;
-    ltc_minmax.voltage_cell_number_max = cell_number_max;
+    if (nr_of_values > 0) {
+        ltc_minmax.voltage_mean = sum/nr_of_values;
+        ltc_minmax.previous_voltage_min = ltc_minmax.voltage_min;
+        ltc_minmax.voltage_min = min;
+        ltc_minmax.voltage_module_number_min = module_number_min;
+        ltc_minmax.voltage_cell_number_min = cell_number_min;
+        ltc_minmax.previous_voltage_max = ltc_minmax.voltage_max;
+        ltc_minmax.voltage_max = max;
+        ltc_minmax.voltage_module_number_max = module_number_max;
+        ltc_minmax.voltage_cell_number_max = cell_number_max;
+        /* the minimum is also written with the voltages, as readers of both blocks can get them from different measurements */
+        ltc_cellvoltage.voltage_min = min;
+        ltc_cellvoltage.voltage_min_index = (uint16_t)(module_number_min*BS_NR_OF_BAT_CELLS_PER_MODULE + cell_number_min);
+    }
     DB_WriteBlock(&ltc_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
     DB_WriteBlock(&ltc_minmax, DATA_BLOCK_ID_MINMAX);
 
@@ -635,62 +701,71 @@ extern void LTC_SaveVoltages(void) {
 /**
  * @brief   stores the measured temperatures and the measured multiplexer feedbacks in the database.
  *
- * This function loops through the temperature and multiplexer feedback data of all modules
- * in the LTC daisy-chain that are stored in the LTC_MultiplexerVoltages buffer and writes
- * them in the database.
+ * This function writes the temperatures of all modules in the LTC daisy-chain in the
+ * database, together with the minimum, maximum and mean values merged from the per module
+ * statistics of the last multiplexer sequence. The statistics are then reset for the next sequence.
  * At each write iteration, the variables named "state" and related to temperatures and multiplexer feedbacks
  * in the database are incremented.
  *
  */
 extern void LTC_SaveTemperatures(void) {
     uint16_t i = 0;
-    uint16_t j = 0;
     int16_t min = 0;
-    uint16_t max = 0;
-    int32_t mean = 0;
+    int16_t max = 0;
+    int32_t sum = 0;
+    uint16_t nr_of_values = 0;
     uint8_t module_number_min = 0;
     uint8_t module_number_max = 0;
     uint8_t sensor_number_min = 0;
     uint8_t sensor_number_max = 0;
 
-    max = min = ltc_celltemperature.temperature[0];
-    mean = 0;
     for (i=0; i < BS_NR_OF_MODULES; i++) {
-        for (j=0; j < BS_NR_OF_TEMP_SENSORS_PER_MODULE; j++) {
-            mean += ltc_celltemperature.temperature[i*(BS_NR_OF_TEMP_SENSORS_PER_MODULE)+j];
-            if (ltc_celltemperature.temperature[i*(BS_NR_OF_TEMP_SENSORS_PER_MODULE)+j] < min) {
-                min = ltc_celltemperature.temperature[i*(BS_NR_OF_TEMP_SENSORS_PER_MODULE)+j];
-                module_number_min = i;
-                sensor_number_min = j;
-            }
-            if (ltc_celltemperature.temperature[i*(BS_NR_OF_TEMP_SENSORS_PER_MODULE)+j] > max) {
-                max = ltc_celltemperature.temperature[i*(BS_NR_OF_TEMP_SENSORS_PER_MODULE)+j];
-                module_number_max = i;
-                sensor_number_max = j;
-            }
+        ltc_minmax.temperature_module_min[i] = ltc_temperature_stats[i].min;
+        ltc_minmax.temperature_module_max[i] = ltc_temperature_stats[i].max;
+        if (ltc_temperature_stats[i].nr_of_values == 0) {
+            continue;
         }
+        if (nr_of_values == 0 || ltc_temperature_stats[i].min < min) {
+            min = ltc_temperature_stats[i].min;
+            module_number_min = i;
+            sensor_number_min = ltc_temperature_stats[i].index_min;
+        }
+        if (nr_of_values == 0 || ltc_temperature_stats[i].max > max) {
+            max = ltc_temperature_stats[i].max;
+            module_number_max = i;
+            sensor_number_max = ltc_temperature_stats[i].index_max;
+        }
+        sum += ltc_temperature_stats[i].sum;
+        nr_of_values += ltc_temperature_stats[i].nr_of_values;
+    }
+    /* the next multiplexer sequence starts a new set of temperatures */
+    for (i=0; i < BS_NR_OF_MODULES; i++) {
+        LTC_ResetStats(&ltc_temperature_stats[i]);
     }
-    mean /= (BS_NR_OF_TEMP_SENSORS);
 
-    DB_ReadBlock(&ltc_minmax, DATA_BLOCK_ID_MINMAX);
     ltc_celltemperature.state++;
     ltc_minmax.state++;
-    ltc_minmax.temperature_mean = mean;
-    ltc_minmax.temperature_min = min;
-    ltc_minmax.temperature_module_number_min = module_number_min;
-    ltc_minmax.temperature_sensor_number_min = sensor_number_min;
-    ltc_minmax.temperature_max = max;
-    ltc_minmax.temperature_module_number_max = module_number_max;
-    ltc_minmax.temperature_sensor_number_max = sensor_number_max;
+    if (nr_of_values > 0) {
+        ltc_minmax.temperature_mean = (float)sum/(float)nr_of_values;
+        ltc_minmax.temperature_min = min;
+        ltc_minmax.temperature_module_number_min = module_number_min;
+        ltc_minmax.temperature_sensor_number_min = sensor_number_min;
+        ltc_minmax.temperature_max = max;
+        ltc_minmax.temperature_module_number_max = module_number_max;
+        ltc_minmax.temperature_sensor_number_max = sensor_number_max;
+    }
 
 #if defined(ITRI_MOD_2_a)
 	{
     	uint16_t nr_of_gpio = 5;	// unsupport 18 cells board
+    	uint16_t j = 0;
 		for (i=0; i < BS_NR_OF_MODULES; i++) {
 				for (j=0; j < nr_of_gpio; j++) {
-					ltc_celltemperature.temperature[i*(BS_NR_OF_TEMP_SENSORS_PER_MODULE)+j] = ltc_allgpiovoltage.gpiovoltage[i*(BS_NR_OF_TEMP_SENSORS_PER_MODULE)+j];
+					ltc_celltemperature.temperature[i*(BS_NR_OF_TEMP_SENSORS_PER_MODULE)+j] = ltc_allgpiovoltage.gpiovoltage[i*(BS_NR_OF_GPIOS_PER_MODULE)+j];
 				}
 				ltc_celltemperature.temperature[i*(BS_NR_OF_TEMP_SENSORS_PER_MODULE)+nr_of_gpio] = ltc_allgpiovoltage.gpio_ref_vol[i];
+				/* the GPIO voltages of LTCs with a wrong PEC are published as invalid, the reference voltage is a constant */
+				ltc_celltemperature.valid_temperaturePECs[i] = ltc_allgpiovoltage.valid_gpioPECs[i] & (uint16_t)((1u << nr_of_gpio) - 1u);
 		}
 	}
 #endif // ITRI_MOD_2_a
@@ -800,6 +875,60 @@ extern LTC_STATEMACH_e LTC_GetState(void) {
     return (ltc_state.state);
 }
 
+void LTC_GetCycleTime(LTC_CYCLETIME_s *cycletime) {
+    OS_TaskEnter_Critical();
+    *cycletime = ltc_cycletime;
+    OS_TaskExit_Critical();
+}
+
+void LTC_ResetCycleTime(void) {
+    OS_TaskEnter_Critical();
+    ltc_cycletime.voltage.last = 0;
+    ltc_cycletime.voltage.min = UINT32_MAX;
+    ltc_cycletime.voltage.max = 0;
+    ltc_cycletime.period.last = 0;
+    ltc_cycletime.period.min = UINT32_MAX;
+    ltc_cycletime.period.max = 0;
+    ltc_cycletime.nr_of_cycles = 0;
+    ltc_cycle_started = FALSE;
+    OS_TaskExit_Critical();
+}
+
+#if LTC_EVENT_DRIVEN_SCHEDULING == TRUE
+void LTC_InitEventDrivenScheduling(TaskHandle_t task) {
+    ltc_eventtask = task;
+    SPI_SetTransferCompleteCallback(LTC_SPITransferComplete);
+}
+
+void LTC_WaitForEvent(void) {
+    uint32_t starttime = OS_getOSSysTick();
+    uint32_t elapsed = 0;
+
+    if (ltc_state.timer == 0) {
+        /* no waiting time: continue at once if the last trigger changed the state,
+         * otherwise the state machine waits for a request -> check again in the next tick */
+        if (ltc_state.state == ltc_event_laststate && ltc_state.substate == ltc_event_lastsubstate) {
+            ulTaskNotifyTake(pdTRUE, 1);
+        }
+    } else {
+        while (elapsed < ltc_state.timer) {
+            /* state machine only waits for the SPI transmission */
+            if (ltc_state.check_spi_flag == TRUE && SPI_IsTransmitOngoing() == FALSE) {
+                break;
+            }
+            /* wait at most one tick to keep the system monitoring alive during long conversions */
+            ulTaskNotifyTake(pdTRUE, 1);
+            DIAG_SysMonNotify(DIAG_SYSMON_LTC_ID, 0);
+            elapsed = OS_getOSSysTick() - starttime;
+        }
+        ltc_state.timer = 0;
+    }
+
+    ltc_event_laststate = ltc_state.state;
+    ltc_event_lastsubstate = ltc_state.substate;
+}
+#endif
+
 /**
  * @brief   transfers the current state request to the state machine.
  *
@@ -846,7 +975,6 @@ void LTC_Trigger(void) {
     uint8_t tmpbusID = 0;
     LTC_ADCMODE_e tmpadcMode = LTC_ADCMODE_UNDEFINED;
     LTC_ADCMEAS_CHAN_e tmpadcMeasCh = LTC_ADCMEAS_UNDEFINED;
-    uint8_t PEC_valid = FALSE;
 
     /* Check re-entrance of function */
     if (LTC_CheckReEntrance())
@@ -954,6 +1082,9 @@ void LTC_Trigger(void) {
         case LTC_STATEMACH_INITIALIZED:
             LTC_IF_INITIALIZED_CALLBACK();
             LTC_SAVELASTSTATES();
+            ltc_state.pipeline_mux_configured = FALSE;
+            ltc_state.pipeline_voltage_started = FALSE;
+            ltc_state.pipeline_aux_started = FALSE;
             ltc_state.timer = LTC_STATEMACH_SHORTTIME;
             ltc_state.state = LTC_STATEMACH_STARTMEAS;
             ltc_state.substate = LTC_ENTRY;
@@ -966,6 +1097,25 @@ void LTC_Trigger(void) {
             ltc_state.adcMeasCh = LTC_ADCMEAS_ALLCHANNEL;
 
             ltc_state.check_spi_flag = FALSE;
+#if LTC_PIPELINED_MEASUREMENT == TRUE
+#if !defined(ITRI_MOD_2_d)
+            if (ltc_state.pipeline_mux_configured == FALSE && LTC_IsMeasurementPlanned(LTC_PLAN_MUXMEASUREMENT) == TRUE) {
+                /* multiplexer is switched while a pipelined cell voltage conversion may still be running */
+                ltc_state.state = LTC_STATEMACH_MUXMEASUREMENT;
+                ltc_state.substate = LTC_STATEMACH_MUXCONFIGURATION_INIT;
+                ltc_state.timer = 0;
+                break;
+            }
+#endif // ITRI_MOD_2_d
+            if (ltc_state.pipeline_voltage_started == TRUE) {
+                /* cell voltage conversion was already started during the last GPIO readout: wait for the rest of it */
+                ltc_state.timer = LTC_GetRemainingConversionTime(ltc_state.pipeline_voltage_endtime);
+                ltc_state.pipeline_voltage_started = FALSE;
+                ltc_state.state = LTC_STATEMACH_READVOLTAGE;
+                ltc_state.substate = LTC_START_AUX_MEASUREMENT_READVOLTAGE;
+                break;
+            }
+#endif
             retVal = LTC_StartVoltageMeasurement(ltc_state.adcMode, ltc_state.adcMeasCh);
 
             if ((retVal != E_OK)) {
@@ -973,17 +1123,75 @@ void LTC_Trigger(void) {
                 ltc_state.timer = LTC_STATEMACH_SHORTTIME;
             } else {
                 DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0, NULL_PTR);
+                LTC_StartCycleTime();
                 ltc_state.timer = ltc_state.commandTransferTime + LTC_Get_MeasurementTCycle(ltc_state.adcMode, ltc_state.adcMeasCh);
             }
                 ltc_state.state = LTC_STATEMACH_READVOLTAGE;
+#if LTC_PIPELINED_MEASUREMENT == TRUE
+                ltc_state.substate = LTC_START_AUX_MEASUREMENT_READVOLTAGE;
+#else
                 ltc_state.substate = LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE;
+#endif
 
             break;
 
         /****************************READ VOLTAGE************************************/
         case LTC_STATEMACH_READVOLTAGE:
 
+#if LTC_PIPELINED_MEASUREMENT == TRUE
+            if (ltc_state.substate == LTC_START_AUX_MEASUREMENT_READVOLTAGE) {
+                /* cell voltage conversion finished: convert the GPIOs while the cell voltages are read */
+                ltc_state.timer = 0;
+#if defined(ITRI_MOD_2_d)
+                if (LTC_GetNextPlannedMeasurement() == LTC_PLAN_ALLGPIOMEASUREMENT) {
+                    ltc_state.check_spi_flag = TRUE;
+                    SPI_SetTransmitOngoing();
+                    retVal = LTC_StartGPIOMeasurement(LTC_GPIO_MEASUREMENT_MODE, LTC_ADCMEAS_ALLCHANNEL);
+                    if (retVal != E_OK) {
+                        DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_NOK, 0, NULL_PTR);
+                    } else {
+                        DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0, NULL_PTR);
+                        ltc_state.pipeline_aux_endtime = OS_getOSSysTick() + ltc_state.commandTransferTime +
+                                LTC_Get_MeasurementTCycle(LTC_GPIO_MEASUREMENT_MODE, LTC_ADCMEAS_ALLCHANNEL);
+                        ltc_state.pipeline_aux_started = TRUE;
+                        ltc_state.timer = ltc_state.commandTransferTime;
+                    }
+                }
+#else
+                ltc_state.pipeline_mux_configured = FALSE;
+                if (LTC_IsMeasurementPlanned(LTC_PLAN_MUXMEASUREMENT) == FALSE) {
+                    /* no multiplexer measurement in this cycle */
+                } else if (ltc_state.muxmeas_seqptr->muxCh == 0xFF) {
+                    /* actual multiplexer is switched off, go further with next step of sequence */
+                    ++ltc_state.muxmeas_seqptr;
+                } else {
+                    ltc_state.check_spi_flag = TRUE;
+                    SPI_SetTransmitOngoing();
+                    /* user multiplexer type -> connected to GPIO2! */
+                    if (ltc_state.muxmeas_seqptr->muxID == 1 || ltc_state.muxmeas_seqptr->muxID == 2) {
+                        retVal = LTC_StartGPIOMeasurement(LTC_GPIO_MEASUREMENT_MODE, LTC_ADCMEAS_SINGLECHANNEL_GPIO2);
+                    } else {
+                        retVal = LTC_StartGPIOMeasurement(LTC_GPIO_MEASUREMENT_MODE, LTC_ADCMEAS_SINGLECHANNEL_GPIO1);
+                    }
+                    if (retVal != E_OK) {
+                        DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_NOK, 0, NULL_PTR);
+                    } else {
+                        DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0, NULL_PTR);
+                        ltc_state.pipeline_aux_endtime = OS_getOSSysTick() + ltc_state.commandTransferTime +
+                                LTC_Get_MeasurementTCycle(LTC_GPIO_MEASUREMENT_MODE, LTC_ADCMEAS_SINGLECHANNEL_GPIO2);
+                        ltc_state.pipeline_aux_started = TRUE;
+                        ltc_state.timer = ltc_state.commandTransferTime;
+                    }
+                }
+#endif // ITRI_MOD_2_d
+                ltc_state.substate = LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE;
+
+                break;
+
+            } else if (ltc_state.substate == LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE) {
+#else
             if (ltc_state.substate == LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE) {
+#endif
                 ltc_state.check_spi_flag = TRUE;
                 SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDCVA), ltc_RXPECbuffer);
@@ -1001,12 +1209,10 @@ void LTC_Trigger(void) {
             } else if (ltc_state.substate == LTC_READ_VOLTAGE_REGISTER_B_RDCVB_READVOLTAGE) {
                 if (LTC_RX_PECCheck(ltc_RXPECbuffer) != E_OK) {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_NOK, 0, NULL_PTR);
-                    PEC_valid = FALSE;
                 } else {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_OK, 0, NULL_PTR);
-                    PEC_valid = TRUE;
                 }
-                LTC_SaveRXtoVoltagebuffer(0, ltc_RXPECbuffer, PEC_valid);
+                LTC_SaveRXtoVoltagebuffer(0, ltc_RXPECbuffer);
 
                 SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDCVB), ltc_RXPECbuffer);
@@ -1025,12 +1231,10 @@ void LTC_Trigger(void) {
             } else if (ltc_state.substate == LTC_READ_VOLTAGE_REGISTER_C_RDCVC_READVOLTAGE) {
                 if (LTC_RX_PECCheck(ltc_RXPECbuffer) != E_OK) {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_NOK, 0, NULL_PTR);
-                    PEC_valid = FALSE;
                 } else {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_OK, 0, NULL_PTR);
-                    PEC_valid = TRUE;
                 }
-                LTC_SaveRXtoVoltagebuffer(1, ltc_RXPECbuffer, PEC_valid);
+                LTC_SaveRXtoVoltagebuffer(1, ltc_RXPECbuffer);
 
                 SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDCVC), ltc_RXPECbuffer);
@@ -1048,12 +1252,10 @@ void LTC_Trigger(void) {
             } else if (ltc_state.substate == LTC_READ_VOLTAGE_REGISTER_D_RDCVD_READVOLTAGE) {
                 if (LTC_RX_PECCheck(ltc_RXPECbuffer) != E_OK) {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_NOK, 0, NULL_PTR);
-                    PEC_valid = FALSE;
                 } else {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_OK, 0, NULL_PTR);
-                    PEC_valid = TRUE;
                 }
-                LTC_SaveRXtoVoltagebuffer(2, ltc_RXPECbuffer, PEC_valid);
+                LTC_SaveRXtoVoltagebuffer(2, ltc_RXPECbuffer);
 
                 SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDCVD), ltc_RXPECbuffer);
@@ -1076,12 +1278,10 @@ void LTC_Trigger(void) {
             } else if (ltc_state.substate == LTC_READ_VOLTAGE_REGISTER_E_RDCVE_READVOLTAGE) {
                 if (LTC_RX_PECCheck(ltc_RXPECbuffer) != E_OK) {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_NOK, 0, NULL_PTR);
-                    PEC_valid = FALSE;
                 } else {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_OK, 0, NULL_PTR);
-                    PEC_valid = TRUE;
                 }
-                LTC_SaveRXtoVoltagebuffer(3, ltc_RXPECbuffer, PEC_valid);
+                LTC_SaveRXtoVoltagebuffer(3, ltc_RXPECbuffer);
 
                 SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDCVE), ltc_RXPECbuffer);
@@ -1104,12 +1304,10 @@ void LTC_Trigger(void) {
             } else if (ltc_state.substate == LTC_READ_VOLTAGE_REGISTER_F_RDCVF_READVOLTAGE) {
                 if (LTC_RX_PECCheck(ltc_RXPECbuffer) != E_OK) {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_NOK, 0, NULL_PTR);
-                    PEC_valid = FALSE;
                 } else {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_OK, 0, NULL_PTR);
-                    PEC_valid = TRUE;
                 }
-                LTC_SaveRXtoVoltagebuffer(4, ltc_RXPECbuffer, PEC_valid);
+                LTC_SaveRXtoVoltagebuffer(4, ltc_RXPECbuffer);
 
                 SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDCVF), ltc_RXPECbuffer);
@@ -1127,28 +1325,38 @@ void LTC_Trigger(void) {
             } else if (ltc_state.substate == LTC_EXIT_READVOLTAGE) {
                 if (LTC_RX_PECCheck(ltc_RXPECbuffer) != E_OK) {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_NOK, 0, NULL_PTR);
-                    PEC_valid = FALSE;
                 } else {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_OK, 0, NULL_PTR);
-                    PEC_valid = TRUE;
                 }
                 if (BS_MAX_SUPPORTED_CELLS == 12) {
-                    LTC_SaveRXtoVoltagebuffer(3, ltc_RXPECbuffer, PEC_valid);
+                    LTC_SaveRXtoVoltagebuffer(3, ltc_RXPECbuffer);
                 } else if (BS_MAX_SUPPORTED_CELLS == 15) {
-                    LTC_SaveRXtoVoltagebuffer(4, ltc_RXPECbuffer, PEC_valid);
+                    LTC_SaveRXtoVoltagebuffer(4, ltc_RXPECbuffer);
                 } else if (BS_MAX_SUPPORTED_CELLS == 18) {
-                    LTC_SaveRXtoVoltagebuffer(5, ltc_RXPECbuffer, PEC_valid);
+                    LTC_SaveRXtoVoltagebuffer(5, ltc_RXPECbuffer);
                 }
 
                 /* Switch to different state if read voltage state is reused
                  * e.g. open-wire check...                                */
                 if (ltc_state.reusageMeasurementMode == LTC_NOT_REUSED) {
                     LTC_SaveVoltages();
+                    LTC_StopCycleTime();
                     ltc_state.state = LTC_STATEMACH_MUXMEASUREMENT;
 #if defined(ITRI_MOD_2_d)
                     ltc_state.substate = LTC_STATEMACH_STOREMUXMEASUREMENT;
+#elif LTC_PIPELINED_MEASUREMENT == TRUE
+                    if (ltc_state.pipeline_aux_started == TRUE) {
+                        ltc_state.pipeline_aux_started = FALSE;
+                        ltc_state.substate = LTC_STATEMACH_STARTVOLTAGE_PIPELINED;
+                    } else {
+                        LTC_SelectNextMeasurement();
+                    }
 #else
-                    ltc_state.substate = LTC_STATEMACH_MUXCONFIGURATION_INIT;
+                    if (LTC_IsMeasurementPlanned(LTC_PLAN_MUXMEASUREMENT) == TRUE) {
+                        ltc_state.substate = LTC_STATEMACH_MUXCONFIGURATION_INIT;
+                    } else {
+                        LTC_SelectNextMeasurement();
+                    }
 #endif // ITRI_MOD_2_d
                 } else if (ltc_state.reusageMeasurementMode == LTC_REUSE_READVOLT_FOR_ADOW_PUP) {
                     ltc_state.state = LTC_STATEMACH_OPENWIRE_CHECK;
@@ -1274,6 +1482,40 @@ void LTC_Trigger(void) {
                 break;
 
             } else if (ltc_state.substate == LTC_STATEMACH_MUXMEASUREMENT) {
+#if LTC_PIPELINED_MEASUREMENT == TRUE
+                if (LTC_GOTO_MUX_CHECK == FALSE) {
+                    if (ltc_state.timer == 0 && SPI_IsTransmitOngoing() == TRUE) {
+                        DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_NOK, 0, NULL_PTR);
+                    } else {
+                        DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0, NULL_PTR);
+                    }
+                }
+                /* multiplexer configured: the GPIO conversion is started after the next cell voltage conversion */
+                ltc_state.pipeline_mux_configured = TRUE;
+                ltc_state.check_spi_flag = FALSE;
+                ltc_state.state = LTC_STATEMACH_STARTMEAS;
+                ltc_state.substate = LTC_ENTRY;
+                ltc_state.timer = 0;
+                break;
+
+            } else if (ltc_state.substate == LTC_STATEMACH_STARTVOLTAGE_PIPELINED) {
+                ltc_state.check_spi_flag = FALSE;
+                ltc_state.timer = LTC_GetRemainingConversionTime(ltc_state.pipeline_aux_endtime);
+                if (ltc_state.timer > 0) {
+                    /* GPIO conversion still running */
+                    break;
+                }
+                /* if all GPIOs or open-wire are measured next, the next cell voltage conversion is started later */
+                if (LTC_GetNextPlannedMeasurement() == LTC_PLAN_BALANCECONTROL ||
+                        LTC_GetNextPlannedMeasurement() == LTC_PLAN_NO_MEASUREMENT) {
+                    if (LTC_StartPipelinedVoltageMeasurement() == E_OK) {
+                        ltc_state.timer = ltc_state.commandTransferTime;
+                    }
+                }
+                ltc_state.substate = LTC_STATEMACH_READMUXMEASUREMENT;
+
+                break;
+#else
                 if (ltc_state.muxmeas_seqptr->muxCh == 0xFF) {
                     /* actual multiplexer is switched off, so do not make a measurement and follow up with next step (mux configuration) */
                     ++ltc_state.muxmeas_seqptr;         /*  go further with next step of sequence
@@ -1311,6 +1553,7 @@ void LTC_Trigger(void) {
                 ltc_state.substate = LTC_STATEMACH_READMUXMEASUREMENT;
 
                 break;
+#endif // LTC_PIPELINED_MEASUREMENT
 
             } else if (ltc_state.substate == LTC_STATEMACH_READMUXMEASUREMENT) {
                 ltc_state.check_spi_flag = TRUE;
@@ -1341,72 +1584,28 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_NOK, 0, NULL_PTR);
                 } else {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_OK, 0, NULL_PTR);
-                    LTC_SaveMuxMeasurement(ltc_RXPECbuffer, ltc_state.muxmeas_seqptr);
                 }
+                LTC_SaveMuxMeasurement(ltc_RXPECbuffer, ltc_state.muxmeas_seqptr);
 
                 ++ltc_state.muxmeas_seqptr;
 #endif // ITRI_MOD_2_d
 
-                ltc_state.timer = 0;
-                if (ltc_state.balance_control_done == TRUE) {
-                    statereq = LTC_TransferStateRequest(&tmpbusID, &tmpadcMode, &tmpadcMeasCh);
-#if defined(ITRI_MOD_2_b)
-                    if (statereq == LTC_STATE_EBMCONTROL_REQUEST) {
-						ltc_state.state = LTC_STATEMACH_EBMCONTROL;
-						ltc_state.substate = LTC_START_EBMCONTROL;
-						ltc_state.balance_control_done = FALSE;
-#else
-                    if (statereq == LTC_STATE_USER_IO_WRITE_REQUEST) {
-                        ltc_state.state = LTC_STATEMACH_USER_IO_CONTROL;
-                        ltc_state.substate = LTC_USER_IO_SET_OUTPUT_REGISTER;
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_USER_IO_READ_REQUEST) {
-                        ltc_state.state = LTC_STATEMACH_USER_IO_FEEDBACK;
-                        ltc_state.substate = LTC_USER_IO_READ_INPUT_REGISTER;
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_EEPROM_READ_REQUEST) {
-                        ltc_state.state = LTC_STATEMACH_EEPROM_READ;
-                        ltc_state.substate = LTC_EEPROM_READ_DATA1;
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_EEPROM_WRITE_REQUEST) {
-                        ltc_state.state = LTC_STATEMACH_EEPROM_WRITE;
-                        ltc_state.substate = LTC_EEPROM_WRITE_DATA1;
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_TEMP_SENS_READ_REQUEST) {
-                        ltc_state.state = LTC_STATEMACH_TEMP_SENS_READ;
-                        ltc_state.substate = LTC_TEMP_SENS_SEND_DATA1;
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATEMACH_BALANCEFEEDBACK_REQUEST) {
-                        ltc_state.state = LTC_STATEMACH_BALANCEFEEDBACK;
-                        ltc_state.substate = LTC_ENTRY;
-                        ltc_state.balance_control_done = FALSE;
-                    }   else if (statereq == LTC_STATE_OPENWIRE_CHECK_REQUEST) {
-                        ltc_state.state = LTC_STATEMACH_OPENWIRE_CHECK;
-                        ltc_state.substate = LTC_REQUEST_PULLUP_CURRENT_OPENWIRE_CHECK;
-                        /* Send ADOW command with PUP two times */
-                        ltc_state.resendCommandCounter = LTC_NMBR_REQ_ADOW_COMMANDS;
-                        ltc_state.balance_control_done = FALSE;
-#endif // ITRI_MOD_2_b
-                    } else {
-#if defined(ITRI_MOD_2_c)
-                    	ltc_state.state = LTC_STATEMACH_ALLGPIOMEASUREMENT;
-                    	ltc_state.substate = LTC_READ_AUXILIARY_REGISTER_A_RDAUXA;
-#else
-                        ltc_state.state = LTC_STATEMACH_BALANCECONTROL;
-                        ltc_state.substate = LTC_CONFIG_BALANCECONTROL;
-#endif // ITRI_MOD_2_c
-                        ltc_state.balance_control_done = TRUE;
-                    }
-                } else {
-#if defined(ITRI_MOD_2_c)
-                	ltc_state.state = LTC_STATEMACH_ALLGPIOMEASUREMENT;
-                	ltc_state.substate = LTC_READ_AUXILIARY_REGISTER_A_RDAUXA;
-#else
-                    ltc_state.state = LTC_STATEMACH_BALANCECONTROL;
-                    ltc_state.substate = LTC_CONFIG_BALANCECONTROL;
-#endif // ITRI_MOD_2_c
-                    ltc_state.balance_control_done = TRUE;
+                LTC_SelectNextMeasurement();
+
+#if LTC_PIPELINED_MEASUREMENT == TRUE
+                /* the selected state sends its own ADC commands: let a pipelined conversion finish and discard it */
+                if (ltc_state.state != LTC_STATEMACH_BALANCECONTROL && ltc_state.state != LTC_STATEMACH_STARTMEAS &&
+                        ltc_state.pipeline_voltage_started == TRUE) {
+                    ltc_state.check_spi_flag = FALSE;
+                    ltc_state.timer = LTC_GetRemainingConversionTime(ltc_state.pipeline_voltage_endtime);
+                    ltc_state.pipeline_voltage_started = FALSE;
+                }
+                if (ltc_state.state != LTC_STATEMACH_ALLGPIOMEASUREMENT && ltc_state.pipeline_aux_started == TRUE) {
+                    ltc_state.check_spi_flag = FALSE;
+                    ltc_state.timer = LTC_GetRemainingConversionTime(ltc_state.pipeline_aux_endtime);
+                    ltc_state.pipeline_aux_started = FALSE;
                 }
+#endif
 
                 break;
             }
@@ -1489,6 +1688,16 @@ void LTC_Trigger(void) {
                 ltc_state.adcMeasCh = LTC_ADCMEAS_ALLCHANNEL;
 
                 ltc_state.check_spi_flag = FALSE;
+#if LTC_PIPELINED_MEASUREMENT == TRUE
+                if (ltc_state.pipeline_aux_started == TRUE) {
+                    /* GPIO conversion was already started during the cell voltage readout: wait for the rest of it */
+                    ltc_state.timer = LTC_GetRemainingConversionTime(ltc_state.pipeline_aux_endtime);
+                    ltc_state.pipeline_aux_started = FALSE;
+                    ltc_state.state = LTC_STATEMACH_READALLGPIO;
+                    ltc_state.substate = LTC_START_VOLTAGE_MEASUREMENT_READALLGPIO;
+                    break;
+                }
+#endif
                 retVal = LTC_StartGPIOMeasurement(ltc_state.adcMode, ltc_state.adcMeasCh);
 
                 if ((retVal != E_OK)) {
@@ -1498,7 +1707,11 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0, NULL_PTR);
                     ltc_state.timer = ltc_state.commandTransferTime + LTC_Get_MeasurementTCycle(ltc_state.adcMode, ltc_state.adcMeasCh);
                     ltc_state.state = LTC_STATEMACH_READALLGPIO;
+#if LTC_PIPELINED_MEASUREMENT == TRUE
+                    ltc_state.substate = LTC_START_VOLTAGE_MEASUREMENT_READALLGPIO;
+#else
                     ltc_state.substate = LTC_READ_AUXILIARY_REGISTER_A_RDAUXA;
+#endif
                 }
 
                 break;
@@ -1506,7 +1719,21 @@ void LTC_Trigger(void) {
         /****************************READ ALL GPIO VOLTAGE************************************/
         case LTC_STATEMACH_READALLGPIO:
 
+#if LTC_PIPELINED_MEASUREMENT == TRUE
+            if (ltc_state.substate == LTC_START_VOLTAGE_MEASUREMENT_READALLGPIO) {
+                /* all-GPIO conversion finished: convert the next cell voltages while the GPIO registers are read */
+                ltc_state.timer = 0;
+                if (LTC_StartPipelinedVoltageMeasurement() == E_OK) {
+                    ltc_state.timer = ltc_state.commandTransferTime;
+                }
+                ltc_state.substate = LTC_READ_AUXILIARY_REGISTER_A_RDAUXA;
+
+                break;
+
+            } else if (ltc_state.substate == LTC_READ_AUXILIARY_REGISTER_A_RDAUXA) {
+#else
             if (ltc_state.substate == LTC_READ_AUXILIARY_REGISTER_A_RDAUXA) {
+#endif
                 ltc_state.check_spi_flag = TRUE;
                 SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDAUXA), ltc_RXPECbuffer);
@@ -1526,8 +1753,8 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_NOK, 0, NULL_PTR);
                 } else {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_OK, 0, NULL_PTR);
-                    LTC_SaveRXtoGPIOBuffer(0, ltc_RXPECbuffer);
                 }
+                LTC_SaveRXtoGPIOBuffer(0, ltc_RXPECbuffer);
 
                 SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDAUXB), ltc_RXPECbuffer);
@@ -1552,8 +1779,8 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_NOK, 0, NULL_PTR);
                 } else {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_OK, 0, NULL_PTR);
-                    LTC_SaveRXtoGPIOBuffer(1, ltc_RXPECbuffer);
                 }
+                LTC_SaveRXtoGPIOBuffer(1, ltc_RXPECbuffer);
 
                 SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDAUXC), ltc_RXPECbuffer);
@@ -1573,8 +1800,8 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_NOK, 0, NULL_PTR);
                 } else {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_OK, 0, NULL_PTR);
-                    LTC_SaveRXtoGPIOBuffer(2, ltc_RXPECbuffer);
                 }
+                LTC_SaveRXtoGPIOBuffer(2, ltc_RXPECbuffer);
 
                 SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDAUXD), ltc_RXPECbuffer);
@@ -1594,17 +1821,16 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_NOK, 0, NULL_PTR);
                 } else {
                     DIAG_Handler(DIAG_CH_LTC_PEC, DIAG_EVENT_OK, 0, NULL_PTR);
-                    if (BS_MAX_SUPPORTED_CELLS == 12) {
-                        LTC_SaveRXtoGPIOBuffer(1, ltc_RXPECbuffer);
-                    } else if (BS_MAX_SUPPORTED_CELLS > 12) {
-                        LTC_SaveRXtoGPIOBuffer(3, ltc_RXPECbuffer);
-                    }
+                }
+                if (BS_MAX_SUPPORTED_CELLS == 12) {
+                    LTC_SaveRXtoGPIOBuffer(1, ltc_RXPECbuffer);
+                } else if (BS_MAX_SUPPORTED_CELLS > 12) {
+                    LTC_SaveRXtoGPIOBuffer(3, ltc_RXPECbuffer);
                 }
 
                 LTC_SaveAllGPIOMeasurement();
 
                 ltc_state.timer = 0;
-#if defined(ITRI_MOD_2_c)
                 ltc_state.check_spi_flag = FALSE;
                 ltc_state.state = LTC_STATEMACH_STARTMEAS;
                 ltc_state.substate = LTC_ENTRY;
@@ -1612,50 +1838,6 @@ void LTC_Trigger(void) {
 #if defined(ITRI_MOD_13)
 				LTC_SetFirstMeasurementCycleFinished();
 #endif
-#else
-                if (ltc_state.balance_control_done == TRUE) {
-                    statereq = LTC_TransferStateRequest(&tmpbusID, &tmpadcMode, &tmpadcMeasCh);
-                    if (statereq == LTC_STATE_USER_IO_WRITE_REQUEST) {
-                        ltc_state.state = LTC_STATEMACH_USER_IO_CONTROL;
-                        ltc_state.substate = LTC_USER_IO_SET_OUTPUT_REGISTER;
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_USER_IO_READ_REQUEST) {
-                        ltc_state.state = LTC_STATEMACH_USER_IO_FEEDBACK;
-                        ltc_state.substate = LTC_USER_IO_READ_INPUT_REGISTER;
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_EEPROM_READ_REQUEST) {
-                        ltc_state.state = LTC_STATEMACH_EEPROM_READ;
-                        ltc_state.substate = LTC_EEPROM_READ_DATA1;
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_EEPROM_WRITE_REQUEST) {
-                        ltc_state.state = LTC_STATEMACH_EEPROM_WRITE;
-                        ltc_state.substate = LTC_EEPROM_WRITE_DATA1;
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_TEMP_SENS_READ_REQUEST) {
-                        ltc_state.state = LTC_STATEMACH_TEMP_SENS_READ;
-                        ltc_state.substate = LTC_TEMP_SENS_SEND_DATA1;
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATEMACH_BALANCEFEEDBACK_REQUEST) {
-                        ltc_state.state = LTC_STATEMACH_BALANCEFEEDBACK;
-                        ltc_state.substate = LTC_ENTRY;
-                        ltc_state.balance_control_done = FALSE;
-                    }  else if (statereq == LTC_STATE_OPENWIRE_CHECK_REQUEST) {
-                        ltc_state.state = LTC_STATEMACH_OPENWIRE_CHECK;
-                        /* Send ADOW command with PUP two times */
-                        ltc_state.resendCommandCounter = LTC_NMBR_REQ_ADOW_COMMANDS;
-                        ltc_state.substate = LTC_REQUEST_PULLUP_CURRENT_OPENWIRE_CHECK;
-                        ltc_state.balance_control_done = FALSE;
-                    } else {
-                        ltc_state.state = LTC_STATEMACH_BALANCECONTROL;
-                        ltc_state.substate = LTC_CONFIG_BALANCECONTROL;
-                        ltc_state.balance_control_done = TRUE;
-                    }
-                } else {
-                    ltc_state.state = LTC_STATEMACH_BALANCECONTROL;
-                    ltc_state.substate = LTC_CONFIG_BALANCECONTROL;
-                    ltc_state.balance_control_done = TRUE;
-                }
-#endif // ITRI_MOD_2_c
             }
             break;
 
@@ -2450,12 +2632,51 @@ void LTC_Trigger(void) {
 
 
 
+/**
+ * @brief   resets the statistics of one module.
+ *
+ * @param   stats   statistics to reset
+ */
+static void LTC_ResetStats(LTC_STATS_s *stats) {
+    stats->sum = 0;
+    stats->min = 0;
+    stats->max = 0;
+    stats->index_min = 0;
+    stats->index_max = 0;
+    stats->nr_of_values = 0;
+}
+
+/**
+ * @brief   adds a value to the statistics of one module.
+ *
+ * The values are added in ascending order of their index, so for equal values
+ * the index of the first value is kept, the same as when the stored values are scanned.
+ *
+ * @param   stats   statistics of the module
+ * @param   value   value to add
+ * @param   index   index of the value in the module (cell or temperature sensor)
+ */
+static void LTC_AddToStats(LTC_STATS_s *stats, int16_t value, uint8_t index) {
+    if (stats->nr_of_values == 0 || value < stats->min) {
+        stats->min = value;
+        stats->index_min = index;
+    }
+    if (stats->nr_of_values == 0 || value > stats->max) {
+        stats->max = value;
+        stats->index_max = index;
+    }
+    stats->sum += value;
+    stats->nr_of_values++;
+}
+
 /**
  * @brief   saves the multiplexer values read from the LTC daisy-chain.
  *
  * After a voltage measurement was initiated on GPIO 1 to read the currently selected
  * multiplexer voltage, the results is read via SPI from the daisy-chain.
  * This function is called to store the result from the transmission in a buffer.
+ * Only the values of LTCs with a valid PEC are stored, for temperature sensors the
+ * PEC status is kept per sensor in valid_temperaturePECs.
  *
  * @param   *DataBufferSPI_RX   buffer containing the data obtained from the SPI transmission
  * @param   muxseqptr           pointer to the multiplexer sequence, which configures the currently selected multiplexer ID and channel
@@ -2474,6 +2695,8 @@ static void LTC_SaveMuxMeasurement(uint8_t *rxBuffer, LTC_MUX_CH_CFG_s  *muxseqp
     /* user multiplexer type -> connected to GPIO2! */
     if (muxseqptr->muxID == 1 || muxseqptr->muxID == 2) {
         for (i=0; i < LTC_N_LTC; i++) {
+            if (!LTC_IS_PEC_VALID(i))
+                continue;
             if (muxseqptr->muxID == 1)
                 ch_idx = 0 + muxseqptr->muxCh;    /* channel index 0..7 */
             else
@@ -2487,14 +2710,22 @@ static void LTC_SaveMuxMeasurement(uint8_t *rxBuffer, LTC_MUX_CH_CFG_s  *muxseqp
     } else {
         /* temperature multiplexer type -> connected to GPIO1! */
         for (i=0; i < LTC_N_LTC; i++) {
-            val_ui = *((uint16_t *)(&rxBuffer[4+i*8]));
-            /* GPIO voltage in 100uV -> * 0.1 ----  conversion to V from mV * 0.001 ----- -> 0.0001 */
-            temperature = (int16_t)LTC_Convert_MuxVoltages_to_Temperatures((float)(val_ui)*0.0001);        /* Unit Celsius */
             sensor_idx = ltc_muxsensortemperatur_cfg[muxseqptr->muxCh];
             /* if wrong configuration: exit and write nothing */
             if (sensor_idx >= BS_NR_OF_TEMP_SENSORS_PER_MODULE)
                 return;
+            if (!LTC_IS_PEC_VALID(i)) {
+                ltc_celltemperature.valid_temperaturePECs[i] |= (uint16_t)(1u << sensor_idx);
+                /* the last valid temperature of the sensor is kept */
+                LTC_AddToStats(&ltc_temperature_stats[i], ltc_celltemperature.temperature[i*(BS_NR_OF_TEMP_SENSORS_PER_MODULE)+sensor_idx], sensor_idx);
+                continue;
+            }
+            val_ui = *((uint16_t *)(&rxBuffer[4+i*8]));
+            /* GPIO voltage in 100uV -> * 0.1 ----  conversion to V from mV * 0.001 ----- -> 0.0001 */
+            temperature = (int16_t)LTC_Convert_MuxVoltages_to_Temperatures((float)(val_ui)*0.0001);        /* Unit Celsius */
             ltc_celltemperature.temperature[i*(BS_NR_OF_TEMP_SENSORS_PER_MODULE)+sensor_idx] = temperature;
+            ltc_celltemperature.valid_temperaturePECs[i] &= (uint16_t)~(1u << sensor_idx);
+            LTC_AddToStats(&ltc_temperature_stats[i], temperature, sensor_idx);
         }
     }
 }
@@ -2509,19 +2740,21 @@ static void LTC_SaveMuxMeasurement(uint8_t *rxBuffer, LTC_MUX_CH_CFG_s  *muxseqp
  * There are 6 register to read _(A,B,C,D,E,F) to get all cell voltages.
  * Only one register can be read at a time.
  * This function is called to store the result from the transmission in a buffer.
+ * The voltages of LTCs with a wrong PEC are not stored, their cells are only marked
+ * invalid in valid_voltPECs while the indices are still managed.
  *
  * @param   registerSet    voltage register that was read (voltage register A,B,C,D,E or F)
  * @param   *rxBuffer      buffer containing the data obtained from the SPI transmission
- * @param   PEC_valid      tells the functions if the PEC is valid or not, if not, manage indices but do not store
  *
  */
-static void LTC_SaveRXtoVoltagebuffer(uint8_t registerSet, uint8_t *rxBuffer, uint8_t PEC_valid) {
+static void LTC_SaveRXtoVoltagebuffer(uint8_t registerSet, uint8_t *rxBuffer) {
     uint16_t i = 0;
     uint16_t j = 0;
     uint16_t i_offset = 0;
     uint16_t voltage_index = 0;
     uint16_t val_ui = 0;
     uint16_t voltage = 0;
+    uint16_t cell_index = 0;
     uint8_t incrementations = 0;
 
     if (registerSet == 0) {
@@ -2546,9 +2779,12 @@ static void LTC_SaveRXtoVoltagebuffer(uint8_t registerSet, uint8_t *rxBuffer, ui
         return;
     }
 
-    /* reinitialize index counter at begin of cycle */
+    /* reinitialize index counter and statistics at begin of cycle */
     if (i_offset == 0) {
         ltc_used_cells_index = 0;
+        for (i=0; i < LTC_N_LTC; i++) {
+            LTC_ResetStats(&ltc_voltage_stats[i]);
+        }
     }
 
     /* Retrieve data without command and CRC*/
@@ -2566,14 +2802,31 @@ static void LTC_SaveRXtoVoltagebuffer(uint8_t registerSet, uint8_t *rxBuffer, ui
             if (ltc_voltage_input_used[voltage_index] == 1) {
                 val_ui = *((uint16_t *)(&rxBuffer[4+2*j+i*8]));
                 voltage = (uint16_t)(((float)(val_ui))*100e-6*1000.0);        /* Unit V -> in mV */
-                if (PEC_valid == TRUE) {
 #if defined(ITRI_MOD_60)
-                	ltc_cellvoltage.voltage[voltage_index+i*(BS_NR_OF_BAT_CELLS_PER_MODULE)] = voltage;
+                cell_index = voltage_index;
 #else
-                    ltc_cellvoltage.voltage[ltc_used_cells_index+i*(BS_NR_OF_BAT_CELLS_PER_MODULE)] = voltage;
+                cell_index = ltc_used_cells_index;
 #endif
-
+                if (LTC_IS_PEC_VALID(i)) {
+#if defined(ITRI_MOD_6)
+                    if (ltc_ebm_cali[i].isCali == 0) {
+                        if (cell_index == LTC_EBM_BAT_CURR_IDX) voltage -= ltc_ebm_cali[i].curBat_offset;
+                        if (cell_index == LTC_EBM_MOD_CURR_IDX) voltage -= ltc_ebm_cali[i].curMod_offset;
+                    }
+#endif
+                    ltc_cellvoltage.voltage[cell_index+i*(BS_NR_OF_BAT_CELLS_PER_MODULE)] = voltage;
+                    ltc_cellvoltage.valid_voltPECs[i] &= ~((uint32_t)1 << cell_index);
+                } else {
+                    ltc_cellvoltage.valid_voltPECs[i] |= (uint32_t)1 << cell_index;
                 }
+#if defined(ITRI_MOD_13)
+                if (cell_index < ITRI_NR_OF_BAT_CELLS_PER_MODULE) {
+                    LTC_AddToStats(&ltc_voltage_stats[i], (int16_t)ltc_cellvoltage.voltage[cell_index+i*(BS_NR_OF_BAT_CELLS_PER_MODULE)], cell_index);
+                }
+#else
+                /* cells of LTCs with a wrong PEC enter the statistics with their last valid voltage */
+                LTC_AddToStats(&ltc_voltage_stats[i], (int16_t)ltc_cellvoltage.voltage[cell_index+i*(BS_NR_OF_BAT_CELLS_PER_MODULE)], cell_index);
+#endif
 
                 ltc_used_cells_index++;
                 incrementations++;
@@ -2601,54 +2854,54 @@ static void LTC_SaveRXtoVoltagebuffer(uint8_t registerSet, uint8_t *rxBuffer, ui
  * Only one register can be read at a time.
  * This function is called to store the result from the transmission in a buffer.
  *
+ * The GPIO voltages of LTCs with a wrong PEC are not stored. The last valid voltages
+ * of these LTCs are kept and the GPIOs of the register group are marked invalid in
+ * valid_gpioPECs until a register group with a valid PEC is read again.
+ *
  * @param   registerSet    voltage register that was read (auxiliary register A, B, C or D)
  * @param   *rxBuffer      buffer containing the data obtained from the SPI transmission
  *
  */
 static void LTC_SaveRXtoGPIOBuffer(uint8_t registerSet, uint8_t *rxBuffer) {
     uint16_t i = 0;
+    uint8_t j = 0;
     uint8_t i_offset = 0;
+    uint8_t nr_of_gpios = 0;
+    uint16_t gpio_mask = 0;
 
     if (registerSet == 0) {
-    /* RDAUXA command -> GPIO register group A */
+        /* RDAUXA command -> GPIO register group A */
         i_offset = 0;
-        /* Retrieve data without command and CRC*/
-        for (i = 0; i < LTC_N_LTC; i++) {
-            /* values received in 100uV -> divide by 10 to convert to mV */
-            ltc_allgpiovoltage.gpiovoltage[0 + i_offset + BS_NR_OF_GPIOS_PER_MODULE*i]= *((uint16_t *)(&rxBuffer[4+i*8]))/10;
-            ltc_allgpiovoltage.gpiovoltage[1 + i_offset + BS_NR_OF_GPIOS_PER_MODULE*i]= *((uint16_t *)(&rxBuffer[6+i*8]))/10;
-            ltc_allgpiovoltage.gpiovoltage[2 + i_offset + BS_NR_OF_GPIOS_PER_MODULE*i]= *((uint16_t *)(&rxBuffer[8+i*8]))/10;
-        }
+        nr_of_gpios = 3;
     } else if (registerSet == 1) {
         /* RDAUXB command -> GPIO register group B */
         i_offset = 3;
-        /* Retrieve data without command and CRC*/
-        for (i = 0; i < LTC_N_LTC; i++) {
-            /* values received in 100uV -> divide by 10 to convert to mV */
-            ltc_allgpiovoltage.gpiovoltage[0 + i_offset + BS_NR_OF_GPIOS_PER_MODULE*i]= *((uint16_t *)(&rxBuffer[4+i*8]))/10;
-            ltc_allgpiovoltage.gpiovoltage[1 + i_offset + BS_NR_OF_GPIOS_PER_MODULE*i]= *((uint16_t *)(&rxBuffer[6+i*8]))/10;
-        }
+        nr_of_gpios = 2;
     } else if (registerSet == 2) {
         /* RDAUXC command -> GPIO register group C, for 18 cell version */
         i_offset = 5;
-        /* Retrieve data without command and CRC*/
-        for (i = 0; i < LTC_N_LTC; i++) {
-            /* values received in 100uV -> divide by 10 to convert to mV */
-            ltc_allgpiovoltage.gpiovoltage[0 + i_offset + BS_NR_OF_GPIOS_PER_MODULE*i]= *((uint16_t *)(&rxBuffer[4+i*8]))/10;
-            ltc_allgpiovoltage.gpiovoltage[1 + i_offset + BS_NR_OF_GPIOS_PER_MODULE*i]= *((uint16_t *)(&rxBuffer[6+i*8]))/10;
-            ltc_allgpiovoltage.gpiovoltage[2 + i_offset + BS_NR_OF_GPIOS_PER_MODULE*i]= *((uint16_t *)(&rxBuffer[8+i*8]))/10;
-        }
+        nr_of_gpios = 3;
     } else if (registerSet == 3) {
         /* RDAUXD command -> GPIO register group D, for 18 cell version */
         i_offset = 8;
-        /* Retrieve data without command and CRC*/
-        for (i = 0; i < LTC_N_LTC; i++) {
-            /* values received in 100uV -> divide by 10 to convert to mV */
-            ltc_allgpiovoltage.gpiovoltage[0 + i_offset + BS_NR_OF_GPIOS_PER_MODULE*i]= *((uint16_t *)(&rxBuffer[4+i*8]))/10;
-        }
+        nr_of_gpios = 1;
     } else {
         return;
     }
+    gpio_mask = (uint16_t)(((1u << nr_of_gpios) - 1u) << i_offset);
+
+    /* Retrieve data without command and CRC*/
+    for (i = 0; i < LTC_N_LTC; i++) {
+        if (!LTC_IS_PEC_VALID(i)) {
+            ltc_allgpiovoltage.valid_gpioPECs[i] |= gpio_mask;
+            continue;
+        }
+        for (j = 0; j < nr_of_gpios; j++) {
+            /* values received in 100uV -> divide by 10 to convert to mV */
+            ltc_allgpiovoltage.gpiovoltage[j + i_offset + BS_NR_OF_GPIOS_PER_MODULE*i] = *((uint16_t *)(&rxBuffer[4+2*j+i*8]))/10;
+        }
+        ltc_allgpiovoltage.valid_gpioPECs[i] &= (uint16_t)~gpio_mask;
+    }
 }
 
 
@@ -2735,8 +2988,6 @@ static STD_RETURN_TYPE_e LTC_Init(void) {
     STD_RETURN_TYPE_e statusSPI = E_NOT_OK;
     STD_RETURN_TYPE_e retVal = E_OK;
 
-    uint8_t PEC_Check[6];
-    uint16_t PEC_result = 0;
     uint16_t i = 0;
 
 #if defined(ITRI_MOD_6)
@@ -2783,18 +3034,17 @@ static STD_RETURN_TYPE_e LTC_Init(void) {
     ltc_TXPECbuffer[3] = ltc_cmdWRCFG[3];
 
     for (i=0; i < LTC_N_LTC; i++) {
-        PEC_Check[0] = ltc_TXPECbuffer[4+i*8] = ltc_TXBuffer[0+i*6];
-        PEC_Check[1] = ltc_TXPECbuffer[5+i*8] = ltc_TXBuffer[1+i*6];
-        PEC_Check[2] = ltc_TXPECbuffer[6+i*8] = ltc_TXBuffer[2+i*6];
-        PEC_Check[3] = ltc_TXPECbuffer[7+i*8] = ltc_TXBuffer[3+i*6];
-        PEC_Check[4] = ltc_TXPECbuffer[8+i*8] = ltc_TXBuffer[4+i*6];
-        PEC_Check[5] = ltc_TXPECbuffer[9+i*8] = ltc_TXBuffer[5+i*6];
-
-        PEC_result = LTC_pec15_calc(6, PEC_Check);
-        ltc_TXPECbuffer[10+i*8]=(uint8_t)((PEC_result>>8)&0xff);
-        ltc_TXPECbuffer[11+i*8]=(uint8_t)(PEC_result&0xff);
+        ltc_TXPECbuffer[4+i*8] = ltc_TXBuffer[0+i*6];
+        ltc_TXPECbuffer[5+i*8] = ltc_TXBuffer[1+i*6];
+        ltc_TXPECbuffer[6+i*8] = ltc_TXBuffer[2+i*6];
+        ltc_TXPECbuffer[7+i*8] = ltc_TXBuffer[3+i*6];
+        ltc_TXPECbuffer[8+i*8] = ltc_TXBuffer[4+i*6];
+        ltc_TXPECbuffer[9+i*8] = ltc_TXBuffer[5+i*6];
     }  /* end for */
 
+    /* calculate the PECs directly in the transmit buffer */
+    LTC_pec15_fillChain(&ltc_TXPECbuffer[4], LTC_N_LTC);
+
     statusSPI = LTC_SendData(ltc_TXPECbuffer);
 
     if (statusSPI != E_OK) {
@@ -3133,56 +3383,342 @@ static STD_RETURN_TYPE_e LTC_StartOpenWireMeasurement(LTC_ADCMODE_e adcMode, uin
  * This function computes the PEC (CRC) from the data received by the daisy-chain.
  * It compares it with the PEC sent by the LTCs.
  * If there are errors, the array LTC_ErrorTable is updated to locate the LTCs in daisy-chain
- * that transmitted corrupt data.
+ * that transmitted corrupt data. The result of every LTC is kept in the bitmap ltc_RXPECerrors,
+ * so that the save functions can store the data of all LTCs with a valid PEC.
  *
  * @param   *DataBufferSPI_RX_with_PEC   data obtained from the SPI transmission
  *
- * @return  retVal                       E_OK if PEC check is OK, E_NOT_OK otherwise
+ * @return  retVal                       E_OK if the PECs of all LTCs are OK, E_NOT_OK otherwise
  *
  */
 static STD_RETURN_TYPE_e LTC_RX_PECCheck(uint8_t *DataBufferSPI_RX_with_PEC) {
     uint16_t i = 0;
-    STD_RETURN_TYPE_e retVal = E_OK;
-    uint8_t PEC_TX[2];
-    uint16_t PEC_result = 0;
-    uint8_t PEC_Check[6] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    uint16_t nr_of_errors = 0;
 
-    /* check all PECs and put data without command and PEC in DataBufferSPI_RX (easier to use) */
-    for (i=0; i < LTC_N_LTC; i++) {
-        PEC_Check[0] = DataBufferSPI_RX_with_PEC[4+i*8];
-        PEC_Check[1] = DataBufferSPI_RX_with_PEC[5+i*8];
-        PEC_Check[2] = DataBufferSPI_RX_with_PEC[6+i*8];
-        PEC_Check[3] = DataBufferSPI_RX_with_PEC[7+i*8];
-        PEC_Check[4] = DataBufferSPI_RX_with_PEC[8+i*8];
-        PEC_Check[5] = DataBufferSPI_RX_with_PEC[9+i*8];
-
-        PEC_result = LTC_pec15_calc(6, PEC_Check);
-        PEC_TX[0]=(uint8_t)((PEC_result>>8)&0xff);
-        PEC_TX[1]=(uint8_t)(PEC_result&0xff);
-
-        /* if calculated PEC not equal to received PEC */
-        if ((PEC_TX[0] != DataBufferSPI_RX_with_PEC[10+i*8]) || (PEC_TX[1] != DataBufferSPI_RX_with_PEC[11+i*8])) {
-            /* update error table of the corresponding LTC */
-            if (LTC_DISCARD_PEC == FALSE) {
-                LTC_ErrorTable[i].LTC = 1;
-            }
-            retVal = E_NOT_OK;
+    /* check the PECs of the whole daisy-chain in place, the data starts after command and PEC */
+    nr_of_errors = LTC_pec15_checkChain(&DataBufferSPI_RX_with_PEC[4], LTC_N_LTC, ltc_RXPECerrors);
 
-        } else {
-            /* update error table of the corresponding LTC */
+    for (i=0; i < LTC_N_LTC; i++) {
+        /* update error table of the corresponding LTC */
+        if (LTC_IS_PEC_VALID(i)) {
             LTC_ErrorTable[i].LTC = 0;
-            retVal = E_OK;
+        } else if (LTC_DISCARD_PEC == FALSE) {
+            LTC_ErrorTable[i].LTC = 1;
         }
     }
 
     if (LTC_DISCARD_PEC == TRUE) {
+        /* treat all received data as valid */
+        for (i=0; i < LTC_PEC_BITMAP_WORDS(LTC_N_LTC); i++) {
+            ltc_RXPECerrors[i] = 0;
+        }
         return E_OK;
+    }
+
+    return (nr_of_errors == 0) ? E_OK : E_NOT_OK;
+}
+
+
+/**
+ * @brief   adds a duration to a timing statistic.
+ *
+ * @param   timing      timing statistic to update
+ * @param   duration    measured duration in microseconds
+ */
+static void LTC_UpdateTiming(LTC_TIMING_s *timing, uint32_t duration) {
+    timing->last = duration;
+    if (duration < timing->min) {
+        timing->min = duration;
+    }
+    if (duration > timing->max) {
+        timing->max = duration;
+    }
+}
+
+
+/**
+ * @brief   marks the start of a cell voltage measurement for the cycle time statistics.
+ *
+ * The time since the start of the previous voltage measurement is recorded as measurement period.
+ */
+static void LTC_StartCycleTime(void) {
+    uint32_t now = MCU_GetCycleCounter();
+
+    OS_TaskEnter_Critical();
+    if (ltc_cycletime.nr_of_cycles > 0) {
+        LTC_UpdateTiming(&ltc_cycletime.period, MCU_CyclesToMicroseconds(now - ltc_cycle_starttime));
+    }
+    ltc_cycle_starttime = now;
+    ltc_cycle_started = TRUE;
+    OS_TaskExit_Critical();
+}
+
+
+/**
+ * @brief   marks the end of a cell voltage measurement (all voltage registers read and stored).
+ */
+static void LTC_StopCycleTime(void) {
+    uint32_t now = MCU_GetCycleCounter();
+
+    OS_TaskEnter_Critical();
+    if (ltc_cycle_started == TRUE) {
+        LTC_UpdateTiming(&ltc_cycletime.voltage, MCU_CyclesToMicroseconds(now - ltc_cycle_starttime));
+        ltc_cycletime.nr_of_cycles++;
+        ltc_cycle_started = FALSE;
+    }
+    OS_TaskExit_Critical();
+}
+
+
+#if LTC_EVENT_DRIVEN_SCHEDULING == TRUE
+/**
+ * @brief   called by the SPI driver in interrupt context when a transmission has finished.
+ *
+ * Wakes up the task that runs the LTC state machine.
+ */
+static void LTC_SPITransferComplete(void) {
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+
+    if (ltc_eventtask != NULL) {
+        vTaskNotifyGiveFromISR(ltc_eventtask, &higherPriorityTaskWoken);
+        portYIELD_FROM_ISR(higherPriorityTaskWoken);
+    }
+}
+#endif
+
+
+/**
+ * @brief   checks if an entry of the measurement plan is due in the current cycle.
+ *
+ * @param   entry   index of the entry in ltc_measurement_plan
+ *
+ * @return  TRUE if the entry is due, FALSE otherwise
+ */
+static uint8_t LTC_IsPlanEntryDue(uint8_t entry) {
+    const LTC_PLAN_ENTRY_s *planentry = &ltc_measurement_plan.entries[entry];
+
+    if (planentry->divider == 0) {
+        return FALSE;
+    }
+    return ((ltc_plan_cycle % planentry->divider) == (planentry->offset % planentry->divider)) ? TRUE : FALSE;
+}
+
+
+/**
+ * @brief   checks if a measurement is made in the current cycle according to the measurement plan.
+ *
+ * Used for the multiplexer measurement, which is made together with the cell voltages.
+ *
+ * @param   measurement     measurement to check
+ *
+ * @return  TRUE if the measurement is made in the current cycle, FALSE otherwise
+ */
+static uint8_t LTC_IsMeasurementPlanned(LTC_PLAN_MEASUREMENT_e measurement) {
+    uint8_t i = 0;
+
+    for (i = 0; i < ltc_measurement_plan.nr_of_entries; i++) {
+        if (ltc_measurement_plan.entries[i].measurement == measurement && LTC_IsPlanEntryDue(i) == TRUE) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+
+/**
+ * @brief   gets the entry of the measurement plan that is made after the cell voltages of the current cycle.
+ *
+ * This is the first entry (in table order) that is pending from earlier cycles or due in the current cycle.
+ * The multiplexer measurement is not considered.
+ *
+ * @return  index of the entry in ltc_measurement_plan, LTC_PLAN_NO_ENTRY if no measurement is due
+ */
+static uint8_t LTC_GetNextPlanEntry(void) {
+    uint8_t i = 0;
+
+    for (i = 0; i < ltc_measurement_plan.nr_of_entries; i++) {
+        if (ltc_measurement_plan.entries[i].measurement == LTC_PLAN_MUXMEASUREMENT) {
+            continue;
+        }
+        if ((ltc_plan_pending & (1u << i)) != 0 || LTC_IsPlanEntryDue(i) == TRUE) {
+            return i;
+        }
+    }
+    return LTC_PLAN_NO_ENTRY;
+}
+
+
+/**
+ * @brief   gets the measurement that is made after the cell voltages of the current cycle.
+ *
+ * @return  measurement (LTC_PLAN_MEASUREMENT_e), LTC_PLAN_NO_MEASUREMENT if no measurement is due
+ */
+static uint8_t LTC_GetNextPlannedMeasurement(void) {
+    uint8_t entry = LTC_GetNextPlanEntry();
+
+    if (entry == LTC_PLAN_NO_ENTRY) {
+        return LTC_PLAN_NO_MEASUREMENT;
+    }
+    return ltc_measurement_plan.entries[entry].measurement;
+}
+
+
+/**
+ * @brief   switches the state machine to the next measurement of the measurement plan.
+ *
+ * Marks all entries due in the current cycle as pending, starts the first pending one and
+ * advances the plan to the next cycle. If no measurement is due, the next cell voltage
+ * measurement is started.
+ */
+static void LTC_StartPlannedMeasurement(void) {
+    uint8_t entry = LTC_GetNextPlanEntry();
+    uint8_t i = 0;
+
+    for (i = 0; i < ltc_measurement_plan.nr_of_entries; i++) {
+        if (ltc_measurement_plan.entries[i].measurement != LTC_PLAN_MUXMEASUREMENT && LTC_IsPlanEntryDue(i) == TRUE) {
+            ltc_plan_pending |= (1u << i);
+        }
+    }
+    ++ltc_plan_cycle;
+
+    ltc_state.state = LTC_STATEMACH_STARTMEAS;
+    ltc_state.substate = LTC_ENTRY;
+    if (entry == LTC_PLAN_NO_ENTRY) {
+        return;
+    }
+    ltc_plan_pending &= ~(1u << entry);
+
+    switch (ltc_measurement_plan.entries[entry].measurement) {
+        case LTC_PLAN_ALLGPIOMEASUREMENT:
+            ltc_state.state = LTC_STATEMACH_ALLGPIOMEASUREMENT;
+            ltc_state.substate = LTC_READ_AUXILIARY_REGISTER_A_RDAUXA;
+            break;
+        case LTC_PLAN_BALANCECONTROL:
+            ltc_state.state = LTC_STATEMACH_BALANCECONTROL;
+            ltc_state.substate = LTC_CONFIG_BALANCECONTROL;
+            break;
+        case LTC_PLAN_OPENWIRE_CHECK:
+            ltc_state.state = LTC_STATEMACH_OPENWIRE_CHECK;
+            ltc_state.substate = LTC_REQUEST_PULLUP_CURRENT_OPENWIRE_CHECK;
+            /* Send ADOW command with PUP two times */
+            ltc_state.resendCommandCounter = LTC_NMBR_REQ_ADOW_COMMANDS;
+            break;
+        default:
+            break;
+    }
+}
+
+
+/**
+ * @brief   selects the state that follows the cell voltage (and multiplexer) measurement.
+ *
+ * A pending state request is handled if the planned measurements were made in the last cycle.
+ * Otherwise, the next measurement of the measurement plan is started.
+ */
+static void LTC_SelectNextMeasurement(void) {
+    LTC_STATE_REQUEST_e statereq = LTC_STATE_NO_REQUEST;
+    uint8_t tmpbusID = 0;
+    LTC_ADCMODE_e tmpadcMode = LTC_ADCMODE_UNDEFINED;
+    LTC_ADCMEAS_CHAN_e tmpadcMeasCh = LTC_ADCMEAS_UNDEFINED;
+
+    ltc_state.timer = 0;
+    if (ltc_state.balance_control_done == TRUE) {
+        statereq = LTC_TransferStateRequest(&tmpbusID, &tmpadcMode, &tmpadcMeasCh);
+    }
+
+#if defined(ITRI_MOD_2_b)
+    if (statereq == LTC_STATE_EBMCONTROL_REQUEST) {
+        ltc_state.state = LTC_STATEMACH_EBMCONTROL;
+        ltc_state.substate = LTC_START_EBMCONTROL;
+        ltc_state.balance_control_done = FALSE;
+#else
+    if (statereq == LTC_STATE_USER_IO_WRITE_REQUEST) {
+        ltc_state.state = LTC_STATEMACH_USER_IO_CONTROL;
+        ltc_state.substate = LTC_USER_IO_SET_OUTPUT_REGISTER;
+        ltc_state.balance_control_done = FALSE;
+    } else if (statereq == LTC_STATE_USER_IO_READ_REQUEST) {
+        ltc_state.state = LTC_STATEMACH_USER_IO_FEEDBACK;
+        ltc_state.substate = LTC_USER_IO_READ_INPUT_REGISTER;
+        ltc_state.balance_control_done = FALSE;
+    } else if (statereq == LTC_STATE_EEPROM_READ_REQUEST) {
+        ltc_state.state = LTC_STATEMACH_EEPROM_READ;
+        ltc_state.substate = LTC_EEPROM_READ_DATA1;
+        ltc_state.balance_control_done = FALSE;
+    } else if (statereq == LTC_STATE_EEPROM_WRITE_REQUEST) {
+        ltc_state.state = LTC_STATEMACH_EEPROM_WRITE;
+        ltc_state.substate = LTC_EEPROM_WRITE_DATA1;
+        ltc_state.balance_control_done = FALSE;
+    } else if (statereq == LTC_STATE_TEMP_SENS_READ_REQUEST) {
+        ltc_state.state = LTC_STATEMACH_TEMP_SENS_READ;
+        ltc_state.substate = LTC_TEMP_SENS_SEND_DATA1;
+        ltc_state.balance_control_done = FALSE;
+    } else if (statereq == LTC_STATEMACH_BALANCEFEEDBACK_REQUEST) {
+        ltc_state.state = LTC_STATEMACH_BALANCEFEEDBACK;
+        ltc_state.substate = LTC_ENTRY;
+        ltc_state.balance_control_done = FALSE;
+    } else if (statereq == LTC_STATE_OPENWIRE_CHECK_REQUEST) {
+        ltc_state.state = LTC_STATEMACH_OPENWIRE_CHECK;
+        ltc_state.substate = LTC_REQUEST_PULLUP_CURRENT_OPENWIRE_CHECK;
+        /* Send ADOW command with PUP two times */
+        ltc_state.resendCommandCounter = LTC_NMBR_REQ_ADOW_COMMANDS;
+        ltc_state.balance_control_done = FALSE;
+#endif // ITRI_MOD_2_b
     } else {
-        return (retVal);
+        LTC_StartPlannedMeasurement();
+        ltc_state.balance_control_done = TRUE;
     }
 }
 
 
+#if LTC_PIPELINED_MEASUREMENT == TRUE
+/**
+ * @brief   gets the time left until a conversion started earlier is finished.
+ *
+ * @param   endtime     OS tick at which the conversion is finished
+ *
+ * @return  remaining conversion time in ms, 0 if the conversion is finished
+ */
+static uint16_t LTC_GetRemainingConversionTime(uint32_t endtime) {
+    int32_t remaining = (int32_t)(endtime - OS_getOSSysTick());
+
+    if (remaining <= 0) {
+        return 0;
+    }
+    return (uint16_t)remaining;
+}
+
+
+/**
+ * @brief   starts the cell voltage conversion of the next measurement cycle while registers of the
+ *          current cycle are still read out.
+ *
+ * The state machine continues as soon as the command has been sent.
+ *
+ * @return  E_OK if the command was sent, E_NOT_OK otherwise (the conversion is then started in
+ *          LTC_STATEMACH_STARTMEAS)
+ */
+static STD_RETURN_TYPE_e LTC_StartPipelinedVoltageMeasurement(void) {
+    STD_RETURN_TYPE_e retVal = E_OK;
+
+    ltc_state.check_spi_flag = TRUE;
+    SPI_SetTransmitOngoing();
+    retVal = LTC_StartVoltageMeasurement(LTC_VOLTAGE_MEASUREMENT_MODE, LTC_ADCMEAS_ALLCHANNEL);
+    if (retVal != E_OK) {
+        DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_NOK, 0, NULL_PTR);
+        ltc_state.check_spi_flag = FALSE;
+    } else {
+        DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0, NULL_PTR);
+        LTC_StartCycleTime();
+        ltc_state.pipeline_voltage_endtime = OS_getOSSysTick() + ltc_state.commandTransferTime +
+                LTC_Get_MeasurementTCycle(LTC_VOLTAGE_MEASUREMENT_MODE, LTC_ADCMEAS_ALLCHANNEL);
+        ltc_state.pipeline_voltage_started = TRUE;
+    }
+
+    return retVal;
+}
+#endif
+
+
 /**
  * @brief   send command to the LTC daisy-chain and receives data from the LTC daisy-chain.
  *
@@ -3254,8 +3790,6 @@ static STD_RETURN_TYPE_e LTC_RX(uint8_t *Command, uint8_t *DataBufferSPI_RX_with
 static STD_RETURN_TYPE_e LTC_TX(uint8_t *Command, uint8_t *DataBufferSPI_TX, uint8_t *DataBufferSPI_TX_with_PEC) {
     uint16_t i = 0;
     STD_RETURN_TYPE_e statusSPI = E_NOT_OK;
-    uint16_t PEC_result = 0;
-    uint8_t PEC_Check[6] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
     /*  DataBufferSPI_TX contains the data to send.
         The transmission function calculates the needed PEC.
@@ -3270,20 +3804,18 @@ static STD_RETURN_TYPE_e LTC_TX(uint8_t *Command, uint8_t *DataBufferSPI_TX, uin
     DataBufferSPI_TX_with_PEC[2] = Command[2];
     DataBufferSPI_TX_with_PEC[3] = Command[3];
 
-    /* Calculate PEC of all data (1 PEC value for 6 bytes) */
     for (i=0; i < LTC_N_LTC; i++) {
-        PEC_Check[0] = DataBufferSPI_TX_with_PEC[4+i*8] = DataBufferSPI_TX[0+i*6];
-        PEC_Check[1] = DataBufferSPI_TX_with_PEC[5+i*8] = DataBufferSPI_TX[1+i*6];
-        PEC_Check[2] = DataBufferSPI_TX_with_PEC[6+i*8] = DataBufferSPI_TX[2+i*6];
-        PEC_Check[3] = DataBufferSPI_TX_with_PEC[7+i*8] = DataBufferSPI_TX[3+i*6];
-        PEC_Check[4] = DataBufferSPI_TX_with_PEC[8+i*8] = DataBufferSPI_TX[4+i*6];
-        PEC_Check[5] = DataBufferSPI_TX_with_PEC[9+i*8] = DataBufferSPI_TX[5+i*6];
-
-        PEC_result = LTC_pec15_calc(6, PEC_Check);
-        DataBufferSPI_TX_with_PEC[10+i*8]=(uint8_t)((PEC_result>>8)&0xff);
-        DataBufferSPI_TX_with_PEC[11+i*8]=(uint8_t)(PEC_result&0xff);
+        DataBufferSPI_TX_with_PEC[4+i*8] = DataBufferSPI_TX[0+i*6];
+        DataBufferSPI_TX_with_PEC[5+i*8] = DataBufferSPI_TX[1+i*6];
+        DataBufferSPI_TX_with_PEC[6+i*8] = DataBufferSPI_TX[2+i*6];
+        DataBufferSPI_TX_with_PEC[7+i*8] = DataBufferSPI_TX[3+i*6];
+        DataBufferSPI_TX_with_PEC[8+i*8] = DataBufferSPI_TX[4+i*6];
+        DataBufferSPI_TX_with_PEC[9+i*8] = DataBufferSPI_TX[5+i*6];
     }
 
+    /* Calculate PEC of all data (1 PEC value for 6 bytes) directly in the transmit buffer */
+    LTC_pec15_fillChain(&DataBufferSPI_TX_with_PEC[4], LTC_N_LTC);
+
     statusSPI = LTC_SendData(DataBufferSPI_TX_with_PEC);
 
     if (statusSPI != E_OK) {
@@ -3794,7 +4326,10 @@ static LTC_RETURN_TYPE_e LTC_CheckStateRequest(LTC_STATE_REQUEST_e statereq) {
     if (ltc_state.statereq == LTC_STATE_NO_REQUEST) {
         /* init only allowed from the uninitialized state */
         if (statereq == LTC_STATE_INIT_REQUEST) {
-            if (ltc_state.state == LTC_STATEMACH_UNINITIALIZED) {
+            if (ltc_measurement_plan.nr_of_entries > LTC_PLAN_MAX_ENTRIES) {
+                /* the pending entries of the measurement plan are kept in a 32 bit mask */
+                return LTC_INIT_ERROR;
+            } else if (ltc_state.state == LTC_STATEMACH_UNINITIALIZED) {
                 return LTC_OK;
             } else {
                 return LTC_ALREADY_INITIALIZED;
@@ -72,6 +72,24 @@ typedef struct {
     uint8_t mux3;                               /*!<    */
 } LTC_ERRORTABLE_s;
 
+/**
+ * duration of a recurring LTC operation in microseconds
+ */
+typedef struct {
+    uint32_t last;      /*!< duration of the last operation  */
+    uint32_t min;       /*!< shortest duration               */
+    uint32_t max;       /*!< longest duration                */
+} LTC_TIMING_s;
+
+/**
+ * cycle time statistics of the cell voltage measurement
+ */
+typedef struct {
+    LTC_TIMING_s voltage;       /*!< start of the voltage conversion until all voltage registers are read */
+    LTC_TIMING_s period;        /*!< time between the start of two voltage measurements                  */
+    uint32_t nr_of_cycles;      /*!< number of completed voltage measurements                            */
+} LTC_CYCLETIME_s;
+
 
 /*================== Constant and Variable Definitions ====================*/
 
@@ -81,7 +99,8 @@ typedef struct {
  * @brief   trigger function for the LTC driver state machine.
  *
  * This function contains the sequence of events in the LTC state machine.
- * It must be called time-triggered, every 1ms.
+ * It must be called time-triggered, every 1ms. With LTC_EVENT_DRIVEN_SCHEDULING,
+ * it is called in a loop with LTC_WaitForEvent() instead.
  */
 extern void LTC_Trigger(void);
 
@@ -115,6 +134,40 @@ extern void LTC_SaveAllGPIOMeasurement(void);
 extern LTC_STATE_REQUEST_e LTC_GetStateRequest(void);
 extern LTC_STATEMACH_e LTC_GetState(void);
 
+/**
+ * @brief   copies the cycle time statistics of the cell voltage measurement.
+ *
+ * @param   cycletime   pointer where the statistics are copied to
+ */
+extern void LTC_GetCycleTime(LTC_CYCLETIME_s *cycletime);
+
+/**
+ * @brief   resets the cycle time statistics of the cell voltage measurement.
+ */
+extern void LTC_ResetCycleTime(void);
+
+#if LTC_EVENT_DRIVEN_SCHEDULING == TRUE
+/**
+ * @brief   sets up the event driven scheduling of the LTC state machine.
+ *
+ * The task is notified by the SPI driver every time a transmission to the
+ * daisy-chain has finished. Must be called before the scheduler is started.
+ *
+ * @param   task    handle of the task that calls LTC_Trigger() and LTC_WaitForEvent()
+ */
+extern void LTC_InitEventDrivenScheduling(TaskHandle_t task);
+
+/**
+ * @brief   blocks the calling task until the LTC state machine has to be triggered again.
+ *
+ * The function returns as soon as the SPI transmission the state machine waits for
+ * has finished, or when the waiting time set by the state machine has elapsed.
+ * If no waiting time is set, it returns immediately after a state change, otherwise
+ * after one OS tick.
+ */
+extern void LTC_WaitForEvent(void);
+#endif
+
 #if defined(ENABLE_THIRD_PARTY)
 	extern uint32_t LTC_ThirdParty_Set_Get_Property(char* prop, void* iParam1, void* iParam2, void* oParam1, void* oParam2);
 #endif
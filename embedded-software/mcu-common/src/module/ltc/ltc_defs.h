@@ -189,6 +189,8 @@ typedef enum {
     LTC_READ_AUXILIARY_REGISTER_C_RDAUXC  = 9,    /*!<    */
     LTC_READ_AUXILIARY_REGISTER_D_RDAUXD  = 10,   /*!<    */
     LTC_EXIT_READAUXILIARY_ALLGPIOS                   = 11,   /*!<    */
+    LTC_START_AUX_MEASUREMENT_READVOLTAGE           = 12,   /*!< pipelined measurement: start the GPIO conversion before reading the cell voltages */
+    LTC_START_VOLTAGE_MEASUREMENT_READALLGPIO       = 13,   /*!< pipelined measurement: start the cell voltage conversion before reading all GPIOs */
 } LTC_STATEMACH_READVOLTAGE_SUB_e;
 
 /**
@@ -217,6 +219,7 @@ typedef enum {
     LTC_STATEMACH_MUXMEASUREMENT_CONFIG = 9,    /*!< Configuration of the multiplexers              */
     LTC_STATEMACH_READMUXMEASUREMENT    = 11,   /*!<    */
     LTC_STATEMACH_STOREMUXMEASUREMENT   = 12,   /*!<    */
+    LTC_STATEMACH_STARTVOLTAGE_PIPELINED = 13,  /*!< pipelined measurement: start the next cell voltage conversion before reading the GPIOs */
 } LTC_STATEMACH_BALANCECONTROL_SUB;
 
 /**
@@ -437,6 +440,44 @@ typedef struct {
     LTC_MUX_CH_CFG_s *seqptr;   /*!< pointer to the multiplexer sequence   */
 } LTC_MUX_SEQUENZ_s;
 
+/**
+ * Measurements scheduled by the measurement plan in addition to the cell voltages
+ */
+typedef enum {
+    LTC_PLAN_MUXMEASUREMENT     = 0,    /*!< next step of the multiplexer sequence, made after the cell voltages */
+    LTC_PLAN_ALLGPIOMEASUREMENT = 1,    /*!< measurement of all GPIOs                                             */
+    LTC_PLAN_BALANCECONTROL     = 2,    /*!< transfer of the balancing configuration                              */
+    LTC_PLAN_OPENWIRE_CHECK     = 3,    /*!< open-wire check                                                      */
+} LTC_PLAN_MEASUREMENT_e;
+
+typedef struct {
+    LTC_PLAN_MEASUREMENT_e measurement; /*!< scheduled measurement                                                        */
+    uint16_t divider;                   /*!< made every divider-th cell voltage measurement cycle, 0: only on request    */
+    uint16_t offset;                    /*!< cycle (0 ... divider-1) in which the measurement is made                    */
+} LTC_PLAN_ENTRY_s;
+
+/**
+ * Maximum number of entries of the measurement plan, one bit per entry is kept for pending measurements
+ */
+#define LTC_PLAN_MAX_ENTRIES    32
+
+typedef struct {
+    uint8_t nr_of_entries;              /*!< number of entries in the measurement plan (max. LTC_PLAN_MAX_ENTRIES) */
+    const LTC_PLAN_ENTRY_s *entries;    /*!< pointer to the measurement plan                      */
+} LTC_PLAN_s;
+
+/**
+ * Minimum, maximum and sum of the values of one module, updated with each stored value
+ */
+typedef struct {
+    int32_t sum;                /*!< sum of the values                          */
+    int16_t min;                /*!< minimum value                              */
+    int16_t max;                /*!< maximum value                              */
+    uint8_t index_min;          /*!< index of the minimum value in the module   */
+    uint8_t index_max;          /*!< index of the maximum value in the module   */
+    uint8_t nr_of_values;       /*!< number of values since the last reset      */
+} LTC_STATS_s;
+
 /**
  * This struct contains pointer to used data buffers
  */
@@ -554,6 +595,11 @@ typedef struct {
     STD_RETURN_TYPE_e check_spi_flag;         /*!< indicates if interrupt flag or timer must be considered */
     STD_RETURN_TYPE_e balance_control_done;   /*!< indicates if balance control was done */
     uint8_t resendCommandCounter;             /*!< counter if commandy should be send multiple times e.g. ADOW command */
+    uint8_t pipeline_mux_configured;          /*!< pipelined measurement: multiplexer of the current sequence step is configured               */
+    uint8_t pipeline_voltage_started;         /*!< pipelined measurement: cell voltage conversion was already started                          */
+    uint8_t pipeline_aux_started;             /*!< pipelined measurement: GPIO conversion runs during the cell voltage readout                 */
+    uint32_t pipeline_voltage_endtime;        /*!< pipelined measurement: OS tick at which the cell voltage conversion is finished             */
+    uint32_t pipeline_aux_endtime;            /*!< pipelined measurement: OS tick at which the GPIO conversion is finished                     */
 } LTC_STATE_s;
 
 /*================== Function Prototypes ==================================*/
@@ -53,41 +53,186 @@ ongoing work.
 Copyright 2013 Linear Technology Corp. (LTC)
 ***********************************************************/
 
-/*!**********************************************************
- \brief calaculates  and returns the CRC15
-  
-  @param[in] uint8_t len: the length of the data array being passed to the function
-               
-  @param[in] uint8_t data[] : the array of data that the PEC will be generated from
-  
-
-  @returns The calculated pec15 as an unsigned int
-***********************************************************/
-
 /*================== Includes =============================================*/
 #include "ltc_pec.h"
 
+/*================== Macros and Definitions ===============================*/
+/**
+ * initial value of the PEC, 16 as 15 bit value shifted left by one
+ */
+#define LTC_PEC15_SEED          0x0020
+
 /*================== Constant and Variable Definitions ====================*/
+/*
+ * Precomputed CRC15 tables for slicing-by-4, polynomial 0x4599.
+ *
+ * The 15 bit remainder is kept shifted left by one bit, so the PEC is the
+ * remainder without the final multiplication by 2 and the tables use
+ * the polynomial 0x8B32. ltc_crc15Table[0] is the table of the generator in
+ * ltc_pec.h shifted left by one bit. ltc_crc15Table[k] contains the
+ * remainder of a byte followed by k zero bytes:
+ *
+ *     ltc_crc15Table[k][i] = (ltc_crc15Table[k-1][i] << 8) ^ ltc_crc15Table[0][ltc_crc15Table[k-1][i] >> 8]
+ */
+static const uint16_t ltc_crc15Table[LTC_PEC15_SLICES][256] = {
+    {  /* one byte */
+        0x0000, 0x8B32, 0x9D56, 0x1664, 0xB19E, 0x3AAC, 0x2CC8, 0xA7FA, 0xE80E, 0x633C, 0x7558, 0xFE6A,
+        0x5990, 0xD2A2, 0xC4C6, 0x4FF4, 0x5B2E, 0xD01C, 0xC678, 0x4D4A, 0xEAB0, 0x6182, 0x77E6, 0xFCD4,
+        0xB320, 0x3812, 0x2E76, 0xA544, 0x02BE, 0x898C, 0x9FE8, 0x14DA, 0xB65C, 0x3D6E, 0x2B0A, 0xA038,
+        0x07C2, 0x8CF0, 0x9A94, 0x11A6, 0x5E52, 0xD560, 0xC304, 0x4836, 0xEFCC, 0x64FE, 0x729A, 0xF9A8,
+        0xED72, 0x6640, 0x7024, 0xFB16, 0x5CEC, 0xD7DE, 0xC1BA, 0x4A88, 0x057C, 0x8E4E, 0x982A, 0x1318,
+        0xB4E2, 0x3FD0, 0x29B4, 0xA286, 0xE78A, 0x6CB8, 0x7ADC, 0xF1EE, 0x5614, 0xDD26, 0xCB42, 0x4070,
+        0x0F84, 0x84B6, 0x92D2, 0x19E0, 0xBE1A, 0x3528, 0x234C, 0xA87E, 0xBCA4, 0x3796, 0x21F2, 0xAAC0,
+        0x0D3A, 0x8608, 0x906C, 0x1B5E, 0x54AA, 0xDF98, 0xC9FC, 0x42CE, 0xE534, 0x6E06, 0x7862, 0xF350,
+        0x51D6, 0xDAE4, 0xCC80, 0x47B2, 0xE048, 0x6B7A, 0x7D1E, 0xF62C, 0xB9D8, 0x32EA, 0x248E, 0xAFBC,
+        0x0846, 0x8374, 0x9510, 0x1E22, 0x0AF8, 0x81CA, 0x97AE, 0x1C9C, 0xBB66, 0x3054, 0x2630, 0xAD02,
+        0xE2F6, 0x69C4, 0x7FA0, 0xF492, 0x5368, 0xD85A, 0xCE3E, 0x450C, 0x4426, 0xCF14, 0xD970, 0x5242,
+        0xF5B8, 0x7E8A, 0x68EE, 0xE3DC, 0xAC28, 0x271A, 0x317E, 0xBA4C, 0x1DB6, 0x9684, 0x80E0, 0x0BD2,
+        0x1F08, 0x943A, 0x825E, 0x096C, 0xAE96, 0x25A4, 0x33C0, 0xB8F2, 0xF706, 0x7C34, 0x6A50, 0xE162,
+        0x4698, 0xCDAA, 0xDBCE, 0x50FC, 0xF27A, 0x7948, 0x6F2C, 0xE41E, 0x43E4, 0xC8D6, 0xDEB2, 0x5580,
+        0x1A74, 0x9146, 0x8722, 0x0C10, 0xABEA, 0x20D8, 0x36BC, 0xBD8E, 0xA954, 0x2266, 0x3402, 0xBF30,
+        0x18CA, 0x93F8, 0x859C, 0x0EAE, 0x415A, 0xCA68, 0xDC0C, 0x573E, 0xF0C4, 0x7BF6, 0x6D92, 0xE6A0,
+        0xA3AC, 0x289E, 0x3EFA, 0xB5C8, 0x1232, 0x9900, 0x8F64, 0x0456, 0x4BA2, 0xC090, 0xD6F4, 0x5DC6,
+        0xFA3C, 0x710E, 0x676A, 0xEC58, 0xF882, 0x73B0, 0x65D4, 0xEEE6, 0x491C, 0xC22E, 0xD44A, 0x5F78,
+        0x108C, 0x9BBE, 0x8DDA, 0x06E8, 0xA112, 0x2A20, 0x3C44, 0xB776, 0x15F0, 0x9EC2, 0x88A6, 0x0394,
+        0xA46E, 0x2F5C, 0x3938, 0xB20A, 0xFDFE, 0x76CC, 0x60A8, 0xEB9A, 0x4C60, 0xC752, 0xD136, 0x5A04,
+        0x4EDE, 0xC5EC, 0xD388, 0x58BA, 0xFF40, 0x7472, 0x6216, 0xE924, 0xA6D0, 0x2DE2, 0x3B86, 0xB0B4,
+        0x174E, 0x9C7C, 0x8A18, 0x012A
+    },
+    {  /* byte followed by 1 zero byte */
+        0x0000, 0x884C, 0x9BAA, 0x13E6, 0xBC66, 0x342A, 0x27CC, 0xAF80, 0xF3FE, 0x7BB2, 0x6854, 0xE018,
+        0x4F98, 0xC7D4, 0xD432, 0x5C7E, 0x6CCE, 0xE482, 0xF764, 0x7F28, 0xD0A8, 0x58E4, 0x4B02, 0xC34E,
+        0x9F30, 0x177C, 0x049A, 0x8CD6, 0x2356, 0xAB1A, 0xB8FC, 0x30B0, 0xD99C, 0x51D0, 0x4236, 0xCA7A,
+        0x65FA, 0xEDB6, 0xFE50, 0x761C, 0x2A62, 0xA22E, 0xB1C8, 0x3984, 0x9604, 0x1E48, 0x0DAE, 0x85E2,
+        0xB552, 0x3D1E, 0x2EF8, 0xA6B4, 0x0934, 0x8178, 0x929E, 0x1AD2, 0x46AC, 0xCEE0, 0xDD06, 0x554A,
+        0xFACA, 0x7286, 0x6160, 0xE92C, 0x380A, 0xB046, 0xA3A0, 0x2BEC, 0x846C, 0x0C20, 0x1FC6, 0x978A,
+        0xCBF4, 0x43B8, 0x505E, 0xD812, 0x7792, 0xFFDE, 0xEC38, 0x6474, 0x54C4, 0xDC88, 0xCF6E, 0x4722,
+        0xE8A2, 0x60EE, 0x7308, 0xFB44, 0xA73A, 0x2F76, 0x3C90, 0xB4DC, 0x1B5C, 0x9310, 0x80F6, 0x08BA,
+        0xE196, 0x69DA, 0x7A3C, 0xF270, 0x5DF0, 0xD5BC, 0xC65A, 0x4E16, 0x1268, 0x9A24, 0x89C2, 0x018E,
+        0xAE0E, 0x2642, 0x35A4, 0xBDE8, 0x8D58, 0x0514, 0x16F2, 0x9EBE, 0x313E, 0xB972, 0xAA94, 0x22D8,
+        0x7EA6, 0xF6EA, 0xE50C, 0x6D40, 0xC2C0, 0x4A8C, 0x596A, 0xD126, 0x7014, 0xF858, 0xEBBE, 0x63F2,
+        0xCC72, 0x443E, 0x57D8, 0xDF94, 0x83EA, 0x0BA6, 0x1840, 0x900C, 0x3F8C, 0xB7C0, 0xA426, 0x2C6A,
+        0x1CDA, 0x9496, 0x8770, 0x0F3C, 0xA0BC, 0x28F0, 0x3B16, 0xB35A, 0xEF24, 0x6768, 0x748E, 0xFCC2,
+        0x5342, 0xDB0E, 0xC8E8, 0x40A4, 0xA988, 0x21C4, 0x3222, 0xBA6E, 0x15EE, 0x9DA2, 0x8E44, 0x0608,
+        0x5A76, 0xD23A, 0xC1DC, 0x4990, 0xE610, 0x6E5C, 0x7DBA, 0xF5F6, 0xC546, 0x4D0A, 0x5EEC, 0xD6A0,
+        0x7920, 0xF16C, 0xE28A, 0x6AC6, 0x36B8, 0xBEF4, 0xAD12, 0x255E, 0x8ADE, 0x0292, 0x1174, 0x9938,
+        0x481E, 0xC052, 0xD3B4, 0x5BF8, 0xF478, 0x7C34, 0x6FD2, 0xE79E, 0xBBE0, 0x33AC, 0x204A, 0xA806,
+        0x0786, 0x8FCA, 0x9C2C, 0x1460, 0x24D0, 0xAC9C, 0xBF7A, 0x3736, 0x98B6, 0x10FA, 0x031C, 0x8B50,
+        0xD72E, 0x5F62, 0x4C84, 0xC4C8, 0x6B48, 0xE304, 0xF0E2, 0x78AE, 0x9182, 0x19CE, 0x0A28, 0x8264,
+        0x2DE4, 0xA5A8, 0xB64E, 0x3E02, 0x627C, 0xEA30, 0xF9D6, 0x719A, 0xDE1A, 0x5656, 0x45B0, 0xCDFC,
+        0xFD4C, 0x7500, 0x66E6, 0xEEAA, 0x412A, 0xC966, 0xDA80, 0x52CC, 0x0EB2, 0x86FE, 0x9518, 0x1D54,
+        0xB2D4, 0x3A98, 0x297E, 0xA132
+    },
+    {  /* byte followed by 2 zero bytes */
+        0x0000, 0xE028, 0x4B62, 0xAB4A, 0x96C4, 0x76EC, 0xDDA6, 0x3D8E, 0xA6BA, 0x4692, 0xEDD8, 0x0DF0,
+        0x307E, 0xD056, 0x7B1C, 0x9B34, 0xC646, 0x266E, 0x8D24, 0x6D0C, 0x5082, 0xB0AA, 0x1BE0, 0xFBC8,
+        0x60FC, 0x80D4, 0x2B9E, 0xCBB6, 0xF638, 0x1610, 0xBD5A, 0x5D72, 0x07BE, 0xE796, 0x4CDC, 0xACF4,
+        0x917A, 0x7152, 0xDA18, 0x3A30, 0xA104, 0x412C, 0xEA66, 0x0A4E, 0x37C0, 0xD7E8, 0x7CA2, 0x9C8A,
+        0xC1F8, 0x21D0, 0x8A9A, 0x6AB2, 0x573C, 0xB714, 0x1C5E, 0xFC76, 0x6742, 0x876A, 0x2C20, 0xCC08,
+        0xF186, 0x11AE, 0xBAE4, 0x5ACC, 0x0F7C, 0xEF54, 0x441E, 0xA436, 0x99B8, 0x7990, 0xD2DA, 0x32F2,
+        0xA9C6, 0x49EE, 0xE2A4, 0x028C, 0x3F02, 0xDF2A, 0x7460, 0x9448, 0xC93A, 0x2912, 0x8258, 0x6270,
+        0x5FFE, 0xBFD6, 0x149C, 0xF4B4, 0x6F80, 0x8FA8, 0x24E2, 0xC4CA, 0xF944, 0x196C, 0xB226, 0x520E,
+        0x08C2, 0xE8EA, 0x43A0, 0xA388, 0x9E06, 0x7E2E, 0xD564, 0x354C, 0xAE78, 0x4E50, 0xE51A, 0x0532,
+        0x38BC, 0xD894, 0x73DE, 0x93F6, 0xCE84, 0x2EAC, 0x85E6, 0x65CE, 0x5840, 0xB868, 0x1322, 0xF30A,
+        0x683E, 0x8816, 0x235C, 0xC374, 0xFEFA, 0x1ED2, 0xB598, 0x55B0, 0x1EF8, 0xFED0, 0x559A, 0xB5B2,
+        0x883C, 0x6814, 0xC35E, 0x2376, 0xB842, 0x586A, 0xF320, 0x1308, 0x2E86, 0xCEAE, 0x65E4, 0x85CC,
+        0xD8BE, 0x3896, 0x93DC, 0x73F4, 0x4E7A, 0xAE52, 0x0518, 0xE530, 0x7E04, 0x9E2C, 0x3566, 0xD54E,
+        0xE8C0, 0x08E8, 0xA3A2, 0x438A, 0x1946, 0xF96E, 0x5224, 0xB20C, 0x8F82, 0x6FAA, 0xC4E0, 0x24C8,
+        0xBFFC, 0x5FD4, 0xF49E, 0x14B6, 0x2938, 0xC910, 0x625A, 0x8272, 0xDF00, 0x3F28, 0x9462, 0x744A,
+        0x49C4, 0xA9EC, 0x02A6, 0xE28E, 0x79BA, 0x9992, 0x32D8, 0xD2F0, 0xEF7E, 0x0F56, 0xA41C, 0x4434,
+        0x1184, 0xF1AC, 0x5AE6, 0xBACE, 0x8740, 0x6768, 0xCC22, 0x2C0A, 0xB73E, 0x5716, 0xFC5C, 0x1C74,
+        0x21FA, 0xC1D2, 0x6A98, 0x8AB0, 0xD7C2, 0x37EA, 0x9CA0, 0x7C88, 0x4106, 0xA12E, 0x0A64, 0xEA4C,
+        0x7178, 0x9150, 0x3A1A, 0xDA32, 0xE7BC, 0x0794, 0xACDE, 0x4CF6, 0x163A, 0xF612, 0x5D58, 0xBD70,
+        0x80FE, 0x60D6, 0xCB9C, 0x2BB4, 0xB080, 0x50A8, 0xFBE2, 0x1BCA, 0x2644, 0xC66C, 0x6D26, 0x8D0E,
+        0xD07C, 0x3054, 0x9B1E, 0x7B36, 0x46B8, 0xA690, 0x0DDA, 0xEDF2, 0x76C6, 0x96EE, 0x3DA4, 0xDD8C,
+        0xE002, 0x002A, 0xAB60, 0x4B48
+    },
+    {  /* byte followed by 3 zero bytes */
+        0x0000, 0x3DF0, 0x7BE0, 0x4610, 0xF7C0, 0xCA30, 0x8C20, 0xB1D0, 0x64B2, 0x5942, 0x1F52, 0x22A2,
+        0x9372, 0xAE82, 0xE892, 0xD562, 0xC964, 0xF494, 0xB284, 0x8F74, 0x3EA4, 0x0354, 0x4544, 0x78B4,
+        0xADD6, 0x9026, 0xD636, 0xEBC6, 0x5A16, 0x67E6, 0x21F6, 0x1C06, 0x19FA, 0x240A, 0x621A, 0x5FEA,
+        0xEE3A, 0xD3CA, 0x95DA, 0xA82A, 0x7D48, 0x40B8, 0x06A8, 0x3B58, 0x8A88, 0xB778, 0xF168, 0xCC98,
+        0xD09E, 0xED6E, 0xAB7E, 0x968E, 0x275E, 0x1AAE, 0x5CBE, 0x614E, 0xB42C, 0x89DC, 0xCFCC, 0xF23C,
+        0x43EC, 0x7E1C, 0x380C, 0x05FC, 0x33F4, 0x0E04, 0x4814, 0x75E4, 0xC434, 0xF9C4, 0xBFD4, 0x8224,
+        0x5746, 0x6AB6, 0x2CA6, 0x1156, 0xA086, 0x9D76, 0xDB66, 0xE696, 0xFA90, 0xC760, 0x8170, 0xBC80,
+        0x0D50, 0x30A0, 0x76B0, 0x4B40, 0x9E22, 0xA3D2, 0xE5C2, 0xD832, 0x69E2, 0x5412, 0x1202, 0x2FF2,
+        0x2A0E, 0x17FE, 0x51EE, 0x6C1E, 0xDDCE, 0xE03E, 0xA62E, 0x9BDE, 0x4EBC, 0x734C, 0x355C, 0x08AC,
+        0xB97C, 0x848C, 0xC29C, 0xFF6C, 0xE36A, 0xDE9A, 0x988A, 0xA57A, 0x14AA, 0x295A, 0x6F4A, 0x52BA,
+        0x87D8, 0xBA28, 0xFC38, 0xC1C8, 0x7018, 0x4DE8, 0x0BF8, 0x3608, 0x67E8, 0x5A18, 0x1C08, 0x21F8,
+        0x9028, 0xADD8, 0xEBC8, 0xD638, 0x035A, 0x3EAA, 0x78BA, 0x454A, 0xF49A, 0xC96A, 0x8F7A, 0xB28A,
+        0xAE8C, 0x937C, 0xD56C, 0xE89C, 0x594C, 0x64BC, 0x22AC, 0x1F5C, 0xCA3E, 0xF7CE, 0xB1DE, 0x8C2E,
+        0x3DFE, 0x000E, 0x461E, 0x7BEE, 0x7E12, 0x43E2, 0x05F2, 0x3802, 0x89D2, 0xB422, 0xF232, 0xCFC2,
+        0x1AA0, 0x2750, 0x6140, 0x5CB0, 0xED60, 0xD090, 0x9680, 0xAB70, 0xB776, 0x8A86, 0xCC96, 0xF166,
+        0x40B6, 0x7D46, 0x3B56, 0x06A6, 0xD3C4, 0xEE34, 0xA824, 0x95D4, 0x2404, 0x19F4, 0x5FE4, 0x6214,
+        0x541C, 0x69EC, 0x2FFC, 0x120C, 0xA3DC, 0x9E2C, 0xD83C, 0xE5CC, 0x30AE, 0x0D5E, 0x4B4E, 0x76BE,
+        0xC76E, 0xFA9E, 0xBC8E, 0x817E, 0x9D78, 0xA088, 0xE698, 0xDB68, 0x6AB8, 0x5748, 0x1158, 0x2CA8,
+        0xF9CA, 0xC43A, 0x822A, 0xBFDA, 0x0E0A, 0x33FA, 0x75EA, 0x481A, 0x4DE6, 0x7016, 0x3606, 0x0BF6,
+        0xBA26, 0x87D6, 0xC1C6, 0xFC36, 0x2954, 0x14A4, 0x52B4, 0x6F44, 0xDE94, 0xE364, 0xA574, 0x9884,
+        0x8482, 0xB972, 0xFF62, 0xC292, 0x7342, 0x4EB2, 0x08A2, 0x3552, 0xE030, 0xDDC0, 0x9BD0, 0xA620,
+        0x17F0, 0x2A00, 0x6C10, 0x51E0
+    }
+};
 
 /*================== Function Prototypes ==================================*/
 
 /*================== Function Implementations =============================*/
 
+/*================== Public functions =====================================*/
 uint16_t LTC_pec15_calc(uint8_t len, uint8_t *data) {
-    uint16_t remainder = 0;
-    uint16_t addr = 0;
+    uint16_t remainder = LTC_PEC15_SEED;  /* initialize the PEC */
+    uint8_t i = 0;
+
+    /* four bytes per step, the table lookups do not depend on each other */
+    for (i = 0; (uint8_t)(len - i) >= LTC_PEC15_SLICES; i += LTC_PEC15_SLICES) {
+        remainder = ltc_crc15Table[3][((remainder >> 8) ^ data[i]) & 0xFF] ^
+                    ltc_crc15Table[2][(remainder ^ data[i+1]) & 0xFF] ^
+                    ltc_crc15Table[1][data[i+2]] ^
+                    ltc_crc15Table[0][data[i+3]];
+    }
+
+    /* remaining bytes one by one */
+    for (; i < len; i++) {
+        remainder = (uint16_t)(remainder << 8) ^ ltc_crc15Table[0][((remainder >> 8) ^ data[i]) & 0xFF];
+    }
+
+    return remainder;  /* The CRC15 has a 0 in the LSB */
+}
 
-    remainder = 16;  /* initialize the PEC */
-    for (uint8_t i = 0; i < len; i++) {  /* loops for each byte in data array */
 
-        addr = ((remainder>>7)^data[i])&0xff;  /* calculate PEC table address */
-        remainder = (remainder<<8)^crc15Table[addr];
+void LTC_pec15_fillChain(uint8_t *frames, uint16_t nr_of_frames) {
+    uint16_t PEC_result = 0;
+    uint8_t *frame = frames;
+
+    for (uint16_t i = 0; i < nr_of_frames; i++) {
+        PEC_result = LTC_pec15_calc(LTC_PEC_DATA_LENGTH, frame);
+        frame[LTC_PEC_DATA_LENGTH] = (uint8_t)((PEC_result >> 8) & 0xFF);
+        frame[LTC_PEC_DATA_LENGTH + 1] = (uint8_t)(PEC_result & 0xFF);
+        frame += LTC_PEC_FRAME_LENGTH;
     }
-    return(remainder*2);  /* The CRC15 has a 0 in the LSB so the remainder must be multiplied by 2 */
 }
 
-/*================== Public functions =====================================*/
 
-/*================== Static functions =====================================*/
+uint16_t LTC_pec15_checkChain(uint8_t *frames, uint16_t nr_of_frames, uint32_t *pecErrors) {
+    uint16_t PEC_result = 0;
+    uint16_t nr_of_errors = 0;
+    uint8_t *frame = frames;
 
+    for (uint16_t i = 0; i < LTC_PEC_BITMAP_WORDS(nr_of_frames); i++) {
+        pecErrors[i] = 0;
+    }
 
+    for (uint16_t i = 0; i < nr_of_frames; i++) {
+        PEC_result = LTC_pec15_calc(LTC_PEC_DATA_LENGTH, frame);
+        /* if calculated PEC not equal to received PEC */
+        if ((frame[LTC_PEC_DATA_LENGTH] != (uint8_t)((PEC_result >> 8) & 0xFF)) ||
+                (frame[LTC_PEC_DATA_LENGTH + 1] != (uint8_t)(PEC_result & 0xFF))) {
+            pecErrors[i / 32] |= (uint32_t)1 << (i % 32);
+            nr_of_errors++;
+        }
+        frame += LTC_PEC_FRAME_LENGTH;
+    }
+
+    return nr_of_errors;
+}
+
+/*================== Static functions =====================================*/
@@ -55,13 +55,20 @@
 /*================== Includes =============================================*/
 #include "algo.h"
 
+#include "database.h"
+#include "mcu.h"
 #include "os.h"
 
 /*================== Macros and Definitions ===============================*/
 
 /*================== Constant and Variable Definitions ====================*/
+static uint32_t algo_stepStartCycles = 0;
+static uint32_t algo_stepBudgetCycles = 0;
+static uint32_t algo_runCycles[DATA_MAX_ALGO_STATISTICS];
+static DATA_BLOCK_ALGO_STATISTICS_s algo_statistics;
 
 /*================== Function Prototypes ==================================*/
+static void ALGO_RecordStep(uint16_t algoIdx, uint32_t stepCycles);
 
 /*================== Function Implementations =============================*/
 void ALGO_Init(void) {
@@ -73,43 +80,184 @@ void ALGO_Init(void) {
 
 void ALGO_MainFunction(void) {
     static uint32_t counter_ticks = 0;
+    uint32_t tickStartCycles = MCU_GetCycleCounter();
+    uint32_t tickBudgetCycles = MCU_MicrosecondsToCycles(ALGO_TICK_BUDGET_US);
+    uint32_t elapsedCycles = 0;
+    uint8_t newRun = FALSE;
+    uint8_t stepsDone = FALSE;
 
     for (uint16_t i = 0; i < algo_length; i++) {
+        newRun = FALSE;
         if (counter_ticks % algo_algorithms[i].cycleTime_ms == 0) {
             /* Cycle time elapsed -> call function */
-            if (algo_algorithms[i].state == ALGO_READY) {
-                /* Set state to running -> reset to READY before leaving algo function */
-                algo_algorithms[i].state = ALGO_RUNNING;
-                algo_algorithms[i].startTime = OS_getOSSysTick();
-                algo_algorithms[i].func(i);
+            if ((algo_algorithms[i].state == ALGO_READY) || (algo_algorithms[i].state == ALGO_EXECUTE_ASAP)) {
+                newRun = TRUE;
             } else if (algo_algorithms[i].state == ALGO_WAIT_FOR_OTHER) {
                 algo_algorithms[i].state = ALGO_RDY_BUT_WAITING;
             } else {
-                /* TODO: explain why empty else */
+                /* still running (ALGO_RESUME) or blocked, the cycle is skipped */
             }
         } else if (algo_algorithms[i].state == ALGO_EXECUTE_ASAP) {
-            /* Waited for other algo to finish -> can now be executed */
-            /* Set state to running -> reset to READY before leaving algo function */
-            algo_algorithms[i].state = ALGO_RUNNING;
-            algo_algorithms[i].startTime = OS_getOSSysTick();
-            algo_algorithms[i].func(i);
+            /* Waited for other algo or for the tick budget -> can now be executed */
+            newRun = TRUE;
+        }
+
+        if ((newRun == TRUE) || (algo_algorithms[i].state == ALGO_RESUME)) {
+            elapsedCycles = MCU_GetCycleCounter() - tickStartCycles;
+            if (elapsedCycles >= tickBudgetCycles) {
+                /* no time left in this tick -> start respectively continue in the next tick */
+                if (newRun == TRUE) {
+                    algo_algorithms[i].state = ALGO_EXECUTE_ASAP;
+                }
+                algo_statistics.algorithm[i].deferrals++;
+            } else {
+                if (newRun == TRUE) {
+                    algo_algorithms[i].startTime = OS_getOSSysTick();
+                    algo_runCycles[i] = 0;
+                }
+                /* the step may use its own budget, but not more than left in the tick */
+                algo_stepBudgetCycles = MCU_MicrosecondsToCycles(algo_algorithms[i].budget_us);
+                if (algo_stepBudgetCycles > (tickBudgetCycles - elapsedCycles)) {
+                    algo_stepBudgetCycles = tickBudgetCycles - elapsedCycles;
+                }
+                /* Set state to running -> reset to READY (done) or RESUME (work left) before leaving algo function */
+                algo_stepStartCycles = MCU_GetCycleCounter();
+                algo_algorithms[i].state = ALGO_RUNNING;
+                algo_algorithms[i].func(i);
+                ALGO_RecordStep(i, MCU_GetCycleCounter() - algo_stepStartCycles);
+                stepsDone = TRUE;
+            }
+        }
+    }
+
+    if (stepsDone == TRUE) {
+        algo_statistics.tick_last_us = MCU_CyclesToMicroseconds(MCU_GetCycleCounter() - tickStartCycles);
+        if (algo_statistics.tick_last_us > algo_statistics.tick_max_us) {
+            algo_statistics.tick_max_us = algo_statistics.tick_last_us;
         }
+        DB_WriteBlock(&algo_statistics, DATA_BLOCK_ID_ALGO_STATISTICS);
     }
 
     counter_ticks += ALGO_TICK_MS;
 }
 
 
+uint8_t ALGO_BudgetLeft(uint32_t algoIdx) {
+    uint8_t retVal = FALSE;
+
+    /* a blocked algorithm has no time left */
+    if ((algo_algorithms[algoIdx].state == ALGO_RUNNING) &&
+            ((MCU_GetCycleCounter() - algo_stepStartCycles) < algo_stepBudgetCycles)) {
+        retVal = TRUE;
+    }
+    return retVal;
+}
+
+
+/**
+ * @brief    updates the runtime statistics of an algorithm after a step
+ *
+ * @param    algoIdx:     index of the algorithm in algo_algorithms[]
+ * @param    stepCycles:  CPU cycles of the step
+ */
+static void ALGO_RecordStep(uint16_t algoIdx, uint32_t stepCycles) {
+    DATA_ALGO_RUNTIME_s *runtime = &algo_statistics.algorithm[algoIdx];
+
+    runtime->steps++;
+    runtime->step_last_us = MCU_CyclesToMicroseconds(stepCycles);
+    if (runtime->step_last_us > runtime->step_max_us) {
+        runtime->step_max_us = runtime->step_last_us;
+    }
+    if (stepCycles > algo_stepBudgetCycles) {
+        runtime->overruns++;
+    }
+
+    algo_runCycles[algoIdx] += stepCycles;
+    if (algo_algorithms[algoIdx].state == ALGO_RESUME) {
+        runtime->carryovers++;
+    } else {
+        runtime->runs++;
+        runtime->run_last_us = MCU_CyclesToMicroseconds(algo_runCycles[algoIdx]);
+        if (runtime->run_last_us > runtime->run_max_us) {
+            runtime->run_max_us = runtime->run_last_us;
+        }
+    }
+}
+
+
 void ALGO_MonitorExecutionTime(void) {
-    uint32_t timestamp = OS_getOSSysTick();
+    ALGO_STATE_e state = ALGO_READY;
+    uint32_t activeCycles = 0;
 
     for (uint16_t i = 0; i < algo_length; i++) {
-        if ((algo_algorithms[i].startTime != 0) && algo_algorithms[i].state == ALGO_RUNNING &&
-                ((algo_algorithms[i].startTime + algo_algorithms[i].maxCalcDuration_ms) < timestamp)) {
-            /* Block task from further execution because of runtime violation, but task will finish its execution */
-            algo_algorithms[i].state = ALGO_BLOCKED;
+        /* Only the CPU time of the steps of a run counts. Ticks the run waited
+         * for the tick budget or for its next step are not taken into account */
+        state = algo_algorithms[i].state;
+        if ((state == ALGO_RUNNING) || (state == ALGO_RESUME)) {
+            activeCycles = algo_runCycles[i];
+            if (state == ALGO_RUNNING) {
+                /* add the step that is currently executed */
+                activeCycles += MCU_GetCycleCounter() - algo_stepStartCycles;
+            }
+            if (MCU_CyclesToMicroseconds(activeCycles) > (algo_algorithms[i].maxCalcDuration_ms * 1000u)) {
+                /* Block task from further execution because of runtime violation, but task will finish its execution */
+                algo_algorithms[i].state = ALGO_BLOCKED;
+
+                /* TODO: Add diag call to notify error in algorithm module */
+            }
+        }
+    }
+}
+
 
-            /* TODO: Add diag call to notify error in algorithm module */
+void ALGO_PrefixSumInit(ALGO_PREFIX_SUM_RING_s *ring, uint64_t *buffer, uint32_t length, float scale) {
+    ring->prefix = buffer;
+    ring->length = length;
+    ring->newest = 0;
+    ring->count = 0;
+    ring->scale = scale;
+    ring->prefix[0] = 0;
+}
+
+
+void ALGO_PrefixSumAdd(ALGO_PREFIX_SUM_RING_s *ring, float value) {
+    int64_t fixedPoint = 0;
+    uint32_t next = ring->newest + 1;
+
+    if (next >= ring->length) {
+        next = 0;
+    }
+    /* round to the nearest fixed-point value */
+    if (value >= 0.0f) {
+        fixedPoint = (int64_t)(value * ring->scale + 0.5f);
+    } else {
+        fixedPoint = (int64_t)(value * ring->scale - 0.5f);
+    }
+    ring->prefix[next] = ring->prefix[ring->newest] + (uint64_t)fixedPoint;
+    ring->newest = next;
+    if (ring->count < (ring->length - 1)) {
+        ring->count++;
+    }
+}
+
+
+float ALGO_PrefixSumMean(const ALGO_PREFIX_SUM_RING_s *ring, uint32_t nrOfSamples) {
+    uint32_t oldest = 0;
+    int64_t sum = 0;
+    float mean = 0.0f;
+
+    if (nrOfSamples > ring->count) {
+        nrOfSamples = ring->count;
+    }
+    if (nrOfSamples > 0) {
+        /* prefix sum before the oldest sample of the window */
+        if (ring->newest >= nrOfSamples) {
+            oldest = ring->newest - nrOfSamples;
+        } else {
+            oldest = ring->newest + ring->length - nrOfSamples;
         }
+        sum = (int64_t)(ring->prefix[ring->newest] - ring->prefix[oldest]);
+        mean = ((float)(sum / (int64_t)nrOfSamples) + (float)(sum % (int64_t)nrOfSamples) / (float)nrOfSamples) / ring->scale;
     }
+    return mean;
 }
@@ -60,6 +60,19 @@
 #include "algo_cfg.h"
 
 /*================== Macros and Definitions ===============================*/
+/**
+ * ring buffer of the prefix sums of a sampled value in fixed-point. The mean
+ * over the last n samples is the difference of two prefix sums divided by n,
+ * for every n up to length - 1. The sums wrap modulo 2^64, their differences
+ * stay exact as long as the sum over the longest window fits into 63 bit.
+ */
+typedef struct {
+    uint64_t *prefix;       /*!< ring of prefix sums of the samples in fixed-point      */
+    uint32_t length;        /*!< number of prefix sums in the ring                      */
+    uint32_t newest;        /*!< index of the prefix sum including the newest sample    */
+    uint32_t count;         /*!< number of samples in the ring, at most length - 1      */
+    float scale;            /*!< fixed-point units per unit of the sampled value        */
+} ALGO_PREFIX_SUM_RING_s;
 
 /*================== Constant and Variable Definitions ====================*/
 
@@ -80,6 +93,49 @@ extern void ALGO_MainFunction(void);
  */
 extern void ALGO_MonitorExecutionTime(void);
 
+/**
+ * @brief    checks if the running step of an algorithm has time left
+ *
+ * An algorithm that can be split into steps checks this between two parts of its work.
+ * If no time is left, it sets its state to ALGO_RESUME and returns, it is called again
+ * in the next tick to continue. When the work is done, it sets its state to ALGO_READY.
+ *
+ * @param    algoIdx:  index of the algorithm in algo_algorithms[]
+ *
+ * @return   TRUE if the step budget of the algorithm and the tick budget are not used up
+ */
+extern uint8_t ALGO_BudgetLeft(uint32_t algoIdx);
+
+/**
+ * @brief    initializes a ring of prefix sums without samples
+ *
+ * @param    ring:    ring to initialize
+ * @param    buffer:  memory of the prefix sums, one more element than the longest window
+ * @param    length:  number of elements of buffer
+ * @param    scale:   fixed-point units per unit of the sampled value, e.g. 1000 for a resolution of 0.001
+ */
+extern void ALGO_PrefixSumInit(ALGO_PREFIX_SUM_RING_s *ring, uint64_t *buffer, uint32_t length, float scale);
+
+/**
+ * @brief    adds a sample to a ring of prefix sums, the oldest sample is dropped when the ring is full
+ *
+ * @param    ring:   ring of prefix sums
+ * @param    value:  sample
+ */
+extern void ALGO_PrefixSumAdd(ALGO_PREFIX_SUM_RING_s *ring, float value);
+
+/**
+ * @brief    gets the mean of the newest samples of a ring of prefix sums
+ *
+ * As long as fewer samples were added, the mean is taken over all samples in the ring.
+ *
+ * @param    ring:          ring of prefix sums
+ * @param    nrOfSamples:   number of samples to average, at most the length of the ring - 1
+ *
+ * @return   mean of the samples, 0 without samples
+ */
+extern float ALGO_PrefixSumMean(const ALGO_PREFIX_SUM_RING_s *ring, uint32_t nrOfSamples);
+
 
 /*================== Function Implementations =============================*/
 
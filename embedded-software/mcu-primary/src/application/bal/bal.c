@@ -72,6 +72,8 @@
 static DATA_BLOCK_MINMAX_s bal_minmax;
 static DATA_BLOCK_BALANCING_CONTROL_s bal_balancing;
 static DATA_BLOCK_CELLVOLTAGE_s bal_cellvoltage;
+static uint32_t bal_cellvoltage_version = 0;
+static float bal_soc[BS_NR_OF_BAT_CELLS];
 DATA_BLOCK_STATEREQUEST_s bal_request;
 
 /**
@@ -147,11 +149,13 @@ static uint8_t BAL_Activate_Balancing_Voltage(void) {
     uint8_t finished = TRUE;
 
     DB_ReadBlock(&bal_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
-    DB_ReadBlock(&bal_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
-    DB_ReadBlock(&bal_minmax, DATA_BLOCK_ID_MINMAX);
-
+    /* cell voltages are only copied again if new ones were measured */
+    if (DATA_HasBlockChanged(DATA_BLOCK_ID_CELLVOLTAGE, &bal_cellvoltage_version) == TRUE) {
+        DB_ReadBlock(&bal_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
+    }
 
-    min = bal_minmax.voltage_min;
+    /* the minimum of the same measurement as the voltages */
+    min = bal_cellvoltage.voltage_min;
 
     for (i=0; i < BS_NR_OF_BAT_CELLS; i++) {
         if (bal_cellvoltage.voltage[i] > min+bal_state.balancing_threshold) {
@@ -193,32 +197,30 @@ static void BAL_Compute_Imbalances(void) {
     uint16_t i = 0;
     uint16_t voltageMin = 0;
     uint16_t minVoltageIndex = 0;
-    float SOC = 0.0;
     uint32_t DOD = 0.0;
     uint32_t maxDOD = 0.0;
 
     DB_ReadBlock(&bal_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
-    DB_ReadBlock(&bal_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
+    /* cell voltages are only copied again if new ones were measured */
+    if (DATA_HasBlockChanged(DATA_BLOCK_ID_CELLVOLTAGE, &bal_cellvoltage_version) == TRUE) {
+        DB_ReadBlock(&bal_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
+    }
 
-    voltageMin = bal_cellvoltage.voltage[0];
-    minVoltageIndex = 0;
+    /* the minimum cell voltage is already determined by the measurement and written with the voltages */
+    minVoltageIndex = bal_cellvoltage.voltage_min_index;
+    voltageMin = bal_cellvoltage.voltage_min;
+    DB_ReadBlock(&bal_minmax, DATA_BLOCK_ID_MINMAX);
 
-    for (i=0; i < BS_NR_OF_BAT_CELLS; i++) {
-        if (bal_cellvoltage.voltage[i] <= voltageMin) {
-            voltageMin = bal_cellvoltage.voltage[i];
-            minVoltageIndex = i;
-        }
-    }
+    /* the OCV curves are selected once for all cells */
+    SOC_GetFromVoltageBatch(bal_cellvoltage.voltage, bal_minmax.temperature_mean, bal_soc, BS_NR_OF_BAT_CELLS);
 
-    SOC = SOC_GetFromVoltage(((float)(bal_cellvoltage.voltage[minVoltageIndex]))/1000.0);
-    maxDOD = BC_CAPACITY * (uint32_t)((1.0 - SOC) * 3600.0);
+    maxDOD = BC_CAPACITY * (uint32_t)((1.0 - bal_soc[minVoltageIndex]/100.0) * 3600.0);
     bal_balancing.delta_charge[minVoltageIndex] = 0;
 
     for (i=0; i < BS_NR_OF_BAT_CELLS; i++) {
         if (i != minVoltageIndex) {
             if (bal_cellvoltage.voltage[i] >= voltageMin + bal_state.balancing_threshold) {
-                SOC = SOC_GetFromVoltage(((float)(bal_cellvoltage.voltage[i]))/1000.0);
-                DOD = BC_CAPACITY * (uint32_t)((1.0 - SOC) * 3600.0);
+                DOD = BC_CAPACITY * (uint32_t)((1.0 - bal_soc[i]/100.0) * 3600.0);
                 bal_balancing.delta_charge[i] = (maxDOD - DOD);
             }
         }
@@ -233,7 +235,10 @@ static void BAL_Activate_Balancing_History(void) {
     uint32_t difference;
 
     DB_ReadBlock(&bal_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
-    DB_ReadBlock(&bal_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
+    /* cell voltages are only copied again if new ones were measured */
+    if (DATA_HasBlockChanged(DATA_BLOCK_ID_CELLVOLTAGE, &bal_cellvoltage_version) == TRUE) {
+        DB_ReadBlock(&bal_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
+    }
 
     for (i=0; i < BS_NR_OF_BAT_CELLS; i++) {
         if (bal_state.balancing_allowed == FALSE) {
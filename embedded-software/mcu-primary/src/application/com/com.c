@@ -59,7 +59,10 @@
 #include "com.h"
 
 #if BUILD_MODULE_ENABLE_COM == 1
+#include "can.h"
 #include "contactor.h"
+#include "database.h"
+#include "ltc.h"
 #include "mcu.h"
 #include "nvram_cfg.h"
 #include "os.h"
@@ -72,11 +75,18 @@
 /*================== Macros and Definitions ===============================*/
 #define TESTMODE_TIMEOUT 30000
 
+/**
+ * number of data blocks printed per call of COM_printDatabaseStatistics()
+ * to not overflow the UART transmit buffer
+ */
+#define COM_DATABASE_STATISTICS_BLOCKS_PER_CALL     4
+
 #define com_receivedbyte     uart_com_receivedbyte
 #define com_receive_slot     uart_com_receive_slot
 
 /*================== Constant and Variable Definitions ====================*/
 uint8_t printHelp = 0;
+static uint8_t com_printDatabaseStatistics = 0;
 
 static uint8_t com_testmode_enabled = 0;
 static uint32_t com_tickcount = 0;
@@ -163,6 +173,12 @@ void COM_printHelpCommand(void) {
         case 2:
             DEBUG_PRINTF(("printdiaginfo         get diagnosis entries of DIAG module (entries can only be printed once)\r\n"));
             DEBUG_PRINTF(("printcontactorinfo    get contactor information (number of switches/hard switches) (entries can only be printed once)\r\n"));
+            DEBUG_PRINTF(("printdbstats          get access statistics of database blocks (latency in OS ticks, dropped writes, contention)\r\n"));
+            DEBUG_PRINTF(("resetdbstats          reset access statistics of database blocks\r\n"));
+            DEBUG_PRINTF(("printltccycle         get cycle time of the LTC cell voltage measurement (in us)\r\n"));
+            DEBUG_PRINTF(("printcantx            get transmit statistics of the CAN nodes (frames/s, buffer high-water mark)\r\n"));
+            DEBUG_PRINTF(("printcanbus           get bus statistics of the CAN nodes (bus load, error rate, queueing delay histogram in us)\r\n"));
+            DEBUG_PRINTF(("printsoccells         get minimum and maximum cell SOC of the cell SOC estimation and its runtime (in us)\r\n"));
             DEBUG_PRINTF(("teston                enable testmode, testmode will be disabled after a predefined timeout of 30s when no new command is sent\r\n"));
             break;
 
@@ -213,6 +229,38 @@ void COM_printHelpCommand(void) {
 }
 
 
+void COM_printDatabaseStatistics(void) {
+    static uint8_t blockID = 0;
+    DATA_ACCESS_STATISTICS_s statistics;
+
+    if (com_printDatabaseStatistics == 0) {
+        return;
+    }
+
+    if (blockID == 0) {
+        DEBUG_PRINTF(("Block  Reads      p50 p99 max   Writes     p50 p99 max   Dropped  Contention Retries  Locked\r\n"));
+    }
+
+    for (uint8_t i = 0; (i < COM_DATABASE_STATISTICS_BLOCKS_PER_CALL) && (blockID < DATA_MAX_BLOCK_NR); i++) {
+        if (DATA_GetAccessStatistics((DATA_BLOCK_ID_TYPE_e)blockID, &statistics) == E_OK) {
+            DEBUG_PRINTF(("%02u     %-10lu %-3lu %-3lu %-5lu %-10lu %-3lu %-3lu %-5lu %-8lu %-10lu %-8lu %lu\r\n", blockID,
+                statistics.read.nr_of_accesses, DATA_GetLatencyPercentile(&statistics.read, 50),
+                DATA_GetLatencyPercentile(&statistics.read, 99), statistics.read.max,
+                statistics.write.nr_of_accesses, DATA_GetLatencyPercentile(&statistics.write, 50),
+                DATA_GetLatencyPercentile(&statistics.write, 99), statistics.write.max,
+                statistics.dropped_writes, statistics.write_contention,
+                statistics.read_retries, statistics.read_locked));
+        }
+        blockID++;
+    }
+
+    if (blockID >= DATA_MAX_BLOCK_NR) {
+        com_printDatabaseStatistics = 0;
+        blockID = 0;
+    }
+}
+
+
 void COM_Decoder(void) {
     /* Command Received - Replace Carrier Return with null character */
     if (com_receivedbyte[com_receive_slot - 1] == '\r') {
@@ -288,6 +336,150 @@ void COM_Decoder(void) {
             return;
         }
 
+        /* PRINT DATABASE STATISTICS */
+        if (strcmp(com_receivedbyte, "printdbstats") == 0) {
+            /* Statistics are printed block by block in COM_printDatabaseStatistics() */
+            com_printDatabaseStatistics = 1;
+
+            /* Clear received command */
+            memset(com_receivedbyte, 0, sizeof(com_receivedbyte));
+            com_receive_slot = 0;
+
+            /* Reset timeout to TESTMODE_TIMEOUT */
+            com_tickcount = OS_getOSSysTick();
+
+            return;
+        }
+
+        /* RESET DATABASE STATISTICS */
+        if (strcmp(com_receivedbyte, "resetdbstats") == 0) {
+            DATA_ResetAccessStatistics();
+            DEBUG_PRINTF(("Database statistics reset!\r\n"));
+
+            /* Clear received command */
+            memset(com_receivedbyte, 0, sizeof(com_receivedbyte));
+            com_receive_slot = 0;
+
+            /* Reset timeout to TESTMODE_TIMEOUT */
+            com_tickcount = OS_getOSSysTick();
+
+            return;
+        }
+
+        /* PRINT LTC CYCLE TIME */
+        if (strcmp(com_receivedbyte, "printltccycle") == 0) {
+            LTC_CYCLETIME_s cycletime;
+
+            LTC_GetCycleTime(&cycletime);
+            if (cycletime.nr_of_cycles == 0) {
+                DEBUG_PRINTF(("No LTC voltage measurement completed yet\r\n"));
+            } else {
+                DEBUG_PRINTF(("LTC voltage measurements: %lu\r\n", (unsigned long)cycletime.nr_of_cycles));
+                DEBUG_PRINTF(("voltage cycle [us]  last: %lu  min: %lu  max: %lu\r\n",
+                        (unsigned long)cycletime.voltage.last, (unsigned long)cycletime.voltage.min, (unsigned long)cycletime.voltage.max));
+                if (cycletime.nr_of_cycles > 1) {
+                    DEBUG_PRINTF(("period        [us]  last: %lu  min: %lu  max: %lu\r\n",
+                            (unsigned long)cycletime.period.last, (unsigned long)cycletime.period.min, (unsigned long)cycletime.period.max));
+                }
+            }
+
+            /* Clear received command */
+            memset(com_receivedbyte, 0, sizeof(com_receivedbyte));
+            com_receive_slot = 0;
+
+            /* Reset timeout to TESTMODE_TIMEOUT */
+            com_tickcount = OS_getOSSysTick();
+
+            return;
+        }
+
+        if (strcmp(com_receivedbyte, "printcantx") == 0) {
+            CAN_NodeTypeDef_e nodes[2] = {CAN_NODE0, CAN_NODE1};
+            CAN_TX_STATISTICS_s txstatistics;
+            STD_RETURN_TYPE_e result = E_NOT_OK;
+
+            for (uint8_t i = 0; i < 2; i++) {
+                OS_TaskEnter_Critical();
+                result = CAN_GetTxStatistics(nodes[i], &txstatistics);
+                OS_TaskExit_Critical();
+                if (result == E_OK) {
+                    DEBUG_PRINTF(("CAN%u: %u frames/s  transmitted: %lu  failed: %lu  dropped: %lu  buffer high-water mark: %u\r\n",
+                            i, txstatistics.frames_per_second,
+                            (unsigned long)txstatistics.nr_of_frames, (unsigned long)txstatistics.nr_of_failed_frames,
+                            (unsigned long)txstatistics.nr_of_dropped_frames, txstatistics.buffer_highwatermark));
+                }
+            }
+
+            /* Clear received command */
+            memset(com_receivedbyte, 0, sizeof(com_receivedbyte));
+            com_receive_slot = 0;
+
+            /* Reset timeout to TESTMODE_TIMEOUT */
+            com_tickcount = OS_getOSSysTick();
+
+            return;
+        }
+
+        if (strcmp(com_receivedbyte, "printcanbus") == 0) {
+            CAN_NodeTypeDef_e nodes[2] = {CAN_NODE0, CAN_NODE1};
+            CAN_BUS_STATISTICS_s busstatistics;
+            STD_RETURN_TYPE_e result = E_NOT_OK;
+
+            for (uint8_t i = 0; i < 2; i++) {
+                OS_TaskEnter_Critical();
+                result = CAN_GetBusStatistics(nodes[i], &busstatistics);
+                OS_TaskExit_Critical();
+                if (result == E_OK) {
+                    DEBUG_PRINTF(("CAN%u: bus load: %u.%u %%  errors/s: %u  TEC: %u  REC: %u\r\n",
+                            i, busstatistics.busload_permille / 10, busstatistics.busload_permille % 10,
+                            busstatistics.errors_per_second, busstatistics.tx_error_counter, busstatistics.rx_error_counter));
+                    DEBUG_PRINTF(("queueing delay [us]  last: %lu  max: %lu  max of last window: %lu  latency [us]  last: %lu  max: %lu\r\n",
+                            (unsigned long)busstatistics.tx_delay_last_us, (unsigned long)busstatistics.tx_delay_max_us,
+                            (unsigned long)busstatistics.tx_delay_window_max_us,
+                            (unsigned long)busstatistics.tx_latency_last_us, (unsigned long)busstatistics.tx_latency_max_us));
+                    DEBUG_PRINTF(("queueing delay histogram  <=250: %lu  <=500: %lu  <=1000: %lu  <=2000: %lu  <=5000: %lu  <=10000: %lu  <=20000: %lu  >20000: %lu\r\n",
+                            (unsigned long)busstatistics.tx_delay_histogram[0], (unsigned long)busstatistics.tx_delay_histogram[1],
+                            (unsigned long)busstatistics.tx_delay_histogram[2], (unsigned long)busstatistics.tx_delay_histogram[3],
+                            (unsigned long)busstatistics.tx_delay_histogram[4], (unsigned long)busstatistics.tx_delay_histogram[5],
+                            (unsigned long)busstatistics.tx_delay_histogram[6], (unsigned long)busstatistics.tx_delay_histogram[7]));
+                }
+            }
+
+            /* Clear received command */
+            memset(com_receivedbyte, 0, sizeof(com_receivedbyte));
+            com_receive_slot = 0;
+
+            /* Reset timeout to TESTMODE_TIMEOUT */
+            com_tickcount = OS_getOSSysTick();
+
+            return;
+        }
+
+        if (strcmp(com_receivedbyte, "printsoccells") == 0) {
+            SOC_CELL_ESTIMATION_s estimation;
+
+            if (SOC_GetCellEstimation(&estimation) == E_OK) {
+                DEBUG_PRINTF(("cell SOC  min: %u.%02u %% (cell %u)  max: %u.%02u %% (cell %u)\r\n",
+                        (uint16_t)estimation.soc_min, (uint16_t)(estimation.soc_min * 100.0) % 100, estimation.cell_min,
+                        (uint16_t)estimation.soc_max, (uint16_t)(estimation.soc_max * 100.0) % 100, estimation.cell_max));
+                DEBUG_PRINTF(("estimation steps: %lu  runtime [us]  last: %lu  max: %lu\r\n",
+                        (unsigned long)estimation.updates,
+                        (unsigned long)MCU_CyclesToMicroseconds(estimation.cycles_last),
+                        (unsigned long)MCU_CyclesToMicroseconds(estimation.cycles_max)));
+            } else {
+                DEBUG_PRINTF(("cell SOC estimation not available\r\n"));
+            }
+
+            /* Clear received command */
+            memset(com_receivedbyte, 0, sizeof(com_receivedbyte));
+            com_receive_slot = 0;
+
+            /* Reset timeout to TESTMODE_TIMEOUT */
+            com_tickcount = OS_getOSSysTick();
+
+            return;
+        }
+
         /* GETTIME */
         if (strcmp(com_receivedbyte, "gettime") == 0) {
             /* Print time and date */
@@ -54,6 +54,8 @@
  * teston                     -- Enables testmode
  * printcontactorinfo         -- prints the contactor info (number of switches and the contactor hard switch entries
  * printdiaginfo              -- prints the diagnosis info
+ * printdbstats               -- prints the access statistics of the database
+ * resetdbstats               -- resets the access statistics of the database
  * gettime                    -- prints mcu time and date
  * getruntime                 -- get runtime since last reset
  * getoperatingtime           -- get total operating time
@@ -122,6 +124,12 @@ extern void COM_printTimeAndDate(void);
  */
 extern void COM_printHelpCommand(void);
 
+/**
+ * Prints the access statistics of the database block by block on serial
+ * interface after the command "printdbstats" was received
+ */
+extern void COM_printDatabaseStatistics(void);
+
 
 /**
  * @brief UART_vWrite provides an interface to send data.
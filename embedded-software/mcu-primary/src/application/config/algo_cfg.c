@@ -53,7 +53,10 @@
 /*================== Includes =============================================*/
 #include "algo_cfg.h"
 
+#include "algo.h"
+#include "batterysystem_cfg.h"
 #include "database.h"
+#include "sox.h"
 
 /*================== Macros and Definitions ===============================*/
 #if ALGO_TICK_MS > ISA_CURRENT_CYCLE_TIME_MS
@@ -88,29 +91,43 @@
 #define NMBR_AVERAGES_POW_cfg          MOVING_AVERAGE_DURATION_POWER_CONFIG_MS/ISA_POWER_CYCLE_TIME_MS
 #endif
 
+/**
+ * resolution of the prefix sums in fixed-point units per mA respectively W
+ */
+#define ALGO_MOVING_AVERAGE_SCALE       1000.0f
+
+/**
+ * moving average over a window of the newest samples of a ring of prefix sums
+ */
+typedef struct {
+    ALGO_PREFIX_SUM_RING_s *ring;   /*!< ring with the samples                  */
+    uint32_t nrOfSamples;           /*!< length of the window in samples        */
+    float *average;                 /*!< moving average in the database block   */
+} ALGO_MOVING_AVERAGE_s;
+
 /*================== Constant and Variable Definitions ====================*/
 
-/* Arrays in extern SDRAM to calculate moving mean current and power */
+/* Rings of prefix sums in extern SDRAM to calculate moving mean current and power, one element more than the longest window */
 
 /* Check if minimum algo cycle time > current sensor sample time */
 #if ALGO_TICK_MS > ISA_CURRENT_CYCLE_TIME_MS
 #if MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS/ALGO_TICK_MS > 60000/ALGO_TICK_MS
 /* If array length of configured time > 60s array take this array size */
-static float MEM_EXT_SDRAM curValues[(MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS/ALGO_TICK_MS)+1] = {};
+static uint64_t MEM_EXT_SDRAM curValues[(MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS/ALGO_TICK_MS)+1];
 static uint32_t movMeanCurLength = (MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS/ALGO_TICK_MS)+1;
 #else
 /* Take array size of 60s moving average */
-static float MEM_EXT_SDRAM curValues[(60000/ALGO_TICK_MS)+1] = {};
+static uint64_t MEM_EXT_SDRAM curValues[(60000/ALGO_TICK_MS)+1];
 static uint32_t movMeanCurLength = (60000/ALGO_TICK_MS)+1;
 #endif
 #else
 /* If array length of configured time > 60s array take this array size */
 #if MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS/ISA_CURRENT_CYCLE_TIME_MS > 60000/ISA_CURRENT_CYCLE_TIME_MS
-static float MEM_EXT_SDRAM curValues[(MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS/ISA_CURRENT_CYCLE_TIME_MS)+1] = {};
+static uint64_t MEM_EXT_SDRAM curValues[(MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS/ISA_CURRENT_CYCLE_TIME_MS)+1];
 static uint32_t movMeanCurLength = (MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS/ISA_CURRENT_CYCLE_TIME_MS)+1;
 #else
 /* Take array size of 60s moving average */
-static float MEM_EXT_SDRAM curValues[(60000/ISA_CURRENT_CYCLE_TIME_MS)+1] = {};
+static uint64_t MEM_EXT_SDRAM curValues[(60000/ISA_CURRENT_CYCLE_TIME_MS)+1];
 static uint32_t movMeanCurLength = (60000/ISA_CURRENT_CYCLE_TIME_MS)+1;
 #endif
 #endif
@@ -119,68 +136,83 @@ static uint32_t movMeanCurLength = (60000/ISA_CURRENT_CYCLE_TIME_MS)+1;
 #if ALGO_TICK_MS > ISA_POWER_CYCLE_TIME_MS
 #if MOVING_AVERAGE_DURATION_POWER_CONFIG_MS/ALGO_TICK_MS > 60000/ALGO_TICK_MS
 /* If array length of configured time > 60s array take this array size */
-static float MEM_EXT_SDRAM powValues[(MOVING_AVERAGE_DURATION_POWER_CONFIG_MS/ALGO_TICK_MS)+1] = {};
+static uint64_t MEM_EXT_SDRAM powValues[(MOVING_AVERAGE_DURATION_POWER_CONFIG_MS/ALGO_TICK_MS)+1];
 static uint32_t movMeanPowLength = (MOVING_AVERAGE_DURATION_POWER_CONFIG_MS/ALGO_TICK_MS)+1;
 #else
 /* Take array size of 60s moving average */
-static float MEM_EXT_SDRAM powValues[(60000/ALGO_TICK_MS)+1] = {};
+static uint64_t MEM_EXT_SDRAM powValues[(60000/ALGO_TICK_MS)+1];
 static uint32_t movMeanPowLength = (60000/ALGO_TICK_MS)+1;
 #endif
 #else
 #if MOVING_AVERAGE_DURATION_POWER_CONFIG_MS/ISA_POWER_CYCLE_TIME_MS > 60000/ISA_POWER_CYCLE_TIME_MS
 /* If array length of configured time > 60s array take this array size */
-static float MEM_EXT_SDRAM powValues[(MOVING_AVERAGE_DURATION_POWER_CONFIG_MS/ISA_POWER_CYCLE_TIME_MS)+1] = {};
+static uint64_t MEM_EXT_SDRAM powValues[(MOVING_AVERAGE_DURATION_POWER_CONFIG_MS/ISA_POWER_CYCLE_TIME_MS)+1];
 static uint32_t movMeanPowLength = (MOVING_AVERAGE_DURATION_POWER_CONFIG_MS/ISA_POWER_CYCLE_TIME_MS)+1;
 #else
 /* Take array size of 60s moving average */
-static float MEM_EXT_SDRAM powValues[(60000/ISA_POWER_CYCLE_TIME_MS)+1] = {};
+static uint64_t MEM_EXT_SDRAM powValues[(60000/ISA_POWER_CYCLE_TIME_MS)+1];
 static uint32_t movMeanPowLength = (60000/ISA_POWER_CYCLE_TIME_MS)+1;
 #endif
 #endif
 
+static ALGO_PREFIX_SUM_RING_s algo_curRing;
+static ALGO_PREFIX_SUM_RING_s algo_powRing;
+static DATA_BLOCK_MOVING_AVERAGE_s algo_movMean_tab;
 
-/* Pointer for current moving mean calculation */
-static float *ptrMovMeanCur_new = &curValues[0];
-static float *ptrMovMeanCur_1s = &curValues[0];
-static float *ptrMovMeanCur_5s = &curValues[0];
-static float *ptrMovMeanCur_10s = &curValues[0];
-static float *ptrMovMeanCur_30s = &curValues[0];
-static float *ptrMovMeanCur_60s = &curValues[0];
-static float *ptrMovMeanCur_cfg = &curValues[0];
-
-/* Pointer for power moving mean calculation */
-static float *ptrMovMeanPow_new = &powValues[0];
-static float *ptrMovMeanPow_1s = &powValues[0];
-static float *ptrMovMeanPow_5s = &powValues[0];
-static float *ptrMovMeanPow_10s = &powValues[0];
-static float *ptrMovMeanPow_30s = &powValues[0];
-static float *ptrMovMeanPow_60s = &powValues[0];
-static float *ptrMovMeanPow_cfg = &powValues[0];
+/**
+ * moving averages calculated from the rings, a window is added with a new line
+ */
+static const ALGO_MOVING_AVERAGE_s algo_movAverages[] = {
+    { &algo_curRing, NMBR_AVERAGES_CUR_1s,  &algo_movMean_tab.movAverage_current_1s },
+    { &algo_curRing, NMBR_AVERAGES_CUR_5s,  &algo_movMean_tab.movAverage_current_5s },
+    { &algo_curRing, NMBR_AVERAGES_CUR_10s, &algo_movMean_tab.movAverage_current_10s },
+    { &algo_curRing, NMBR_AVERAGES_CUR_30s, &algo_movMean_tab.movAverage_current_30s },
+    { &algo_curRing, NMBR_AVERAGES_CUR_60s, &algo_movMean_tab.movAverage_current_60s },
+    { &algo_curRing, NMBR_AVERAGES_CUR_cfg, &algo_movMean_tab.movAverage_current_config },
+    { &algo_powRing, NMBR_AVERAGES_POW_1s,  &algo_movMean_tab.movAverage_power_1s },
+    { &algo_powRing, NMBR_AVERAGES_POW_5s,  &algo_movMean_tab.movAverage_power_5s },
+    { &algo_powRing, NMBR_AVERAGES_POW_10s, &algo_movMean_tab.movAverage_power_10s },
+    { &algo_powRing, NMBR_AVERAGES_POW_30s, &algo_movMean_tab.movAverage_power_30s },
+    { &algo_powRing, NMBR_AVERAGES_POW_60s, &algo_movMean_tab.movAverage_power_60s },
+    { &algo_powRing, NMBR_AVERAGES_POW_cfg, &algo_movMean_tab.movAverage_power_config },
+};
 
 /*================== Function Prototypes ==================================*/
 static void algo_movAverage(uint32_t algoIdx);
+#if SOX_CELL_SOC_ESTIMATION == TRUE
+static void algo_cellSocEstimation(uint32_t algoIdx);
+#endif
 
 /*================== Function Implementations =============================*/
 
 ALGO_TASKS_s algo_algorithms[] = {
-    {ALGO_READY, 100, 1000, 0, &algo_movAverage },
+    {ALGO_READY, 100, 1000, 1000, 0, &algo_movAverage },
+#if SOX_CELL_SOC_ESTIMATION == TRUE
+    {ALGO_READY, 100, 1000, 2000, 0, &algo_cellSocEstimation },
+#endif
 };
 
 const uint16_t algo_length = sizeof(algo_algorithms)/sizeof(algo_algorithms[0]);
 
+/* the build fails with a negative array size if an algorithm has no entry in the runtime statistics */
+typedef uint8_t ALGO_STATISTICS_SIZE_CHECK[((sizeof(algo_algorithms)/sizeof(algo_algorithms[0])) <= DATA_MAX_ALGO_STATISTICS) ? 1 : -1];
+
 
 static void algo_movAverage(uint32_t algoIdx) {
     static uint8_t curCounter = 0;
     static uint8_t powCounter = 0;
+    static uint8_t ringsInitialized = FALSE;
     static DATA_BLOCK_CURRENT_SENSOR_s curPow_tab;
-    static DATA_BLOCK_MOVING_AVERAGE_s movMean_tab;
-    static uint8_t curInit = 0;     /* bit0: 1s, bit1: 5s, bit2: 10s, bit3: 30s, bit4: 60s, bit5: cfg */
-    static uint8_t powInit = 0;     /* bit0: 1s, bit1: 5s, bit2: 10s, bit3: 30s, bit4: 60s, bit5: cfg */
-    static uint8_t newValues = 0;
-    float divider = 0;
+    uint8_t newValues = 0;
+    uint16_t i = 0;
+
+    if (ringsInitialized == FALSE) {
+        ALGO_PrefixSumInit(&algo_curRing, curValues, movMeanCurLength, ALGO_MOVING_AVERAGE_SCALE);
+        ALGO_PrefixSumInit(&algo_powRing, powValues, movMeanPowLength, ALGO_MOVING_AVERAGE_SCALE);
+        ringsInitialized = TRUE;
+    }
 
     DB_ReadBlock(&curPow_tab, DATA_BLOCK_ID_CURRENT_SENSOR);
-    DB_ReadBlock(&movMean_tab, DATA_BLOCK_ID_MOV_AVERAGE);
 
     /* Check if new current value */
     if (curCounter != curPow_tab.newCurrent) {
@@ -188,92 +220,8 @@ static void algo_movAverage(uint32_t algoIdx) {
 
         /* Check if valid value */
         if (curPow_tab.state_current == 0) {
-            /* new Values -> Save later in database */
+            ALGO_PrefixSumAdd(&algo_curRing, curPow_tab.current);
             newValues = 1;
-
-            /* Add value to array and calculate new moving mean values */
-            *ptrMovMeanCur_new = curPow_tab.current;
-
-            /* Calculate new moving means - first add new value */
-            divider = NMBR_AVERAGES_CUR_1s;
-            movMean_tab.movAverage_current_1s += (*ptrMovMeanCur_new)/divider;
-            divider = NMBR_AVERAGES_CUR_5s;
-            movMean_tab.movAverage_current_5s += (*ptrMovMeanCur_new)/divider;
-            divider = NMBR_AVERAGES_CUR_10s;
-            movMean_tab.movAverage_current_10s += (*ptrMovMeanCur_new)/divider;
-            divider = NMBR_AVERAGES_CUR_30s;
-            movMean_tab.movAverage_current_30s += (*ptrMovMeanCur_new)/divider;
-            divider = NMBR_AVERAGES_CUR_60s;
-            movMean_tab.movAverage_current_60s += (*ptrMovMeanCur_new)/divider;
-            divider = NMBR_AVERAGES_CUR_cfg;
-            movMean_tab.movAverage_current_config += (*ptrMovMeanCur_new)/divider;
-
-            /* Then, increment pointer and substract oldest value when respective window is filled with data */
-            ptrMovMeanCur_new++;
-            if ((curInit & 0x01) == 0x01) {
-                divider = NMBR_AVERAGES_CUR_1s;
-                movMean_tab.movAverage_current_1s -= ((*ptrMovMeanCur_1s)/divider);
-                ptrMovMeanCur_1s++;
-            } else {
-                if (ptrMovMeanCur_new == &curValues[NMBR_AVERAGES_CUR_1s])
-                    curInit |= 0x01;
-            }
-            if ((curInit & 0x02) == 0x02) {
-                divider = NMBR_AVERAGES_CUR_5s;
-                movMean_tab.movAverage_current_5s -= (*ptrMovMeanCur_5s)/divider;
-                ptrMovMeanCur_5s++;
-            } else {
-                if (ptrMovMeanCur_new == &curValues[NMBR_AVERAGES_CUR_5s])
-                    curInit |= 0x02;
-            }
-            if ((curInit & 0x04) == 0x04) {
-                divider = NMBR_AVERAGES_CUR_10s;
-                movMean_tab.movAverage_current_10s -= (*ptrMovMeanCur_10s)/divider;
-                ptrMovMeanCur_10s++;
-            } else {
-                if (ptrMovMeanCur_new == &curValues[NMBR_AVERAGES_CUR_10s])
-                    curInit |= 0x04;
-            }
-            if ((curInit & 0x08) == 0x08) {
-                divider = NMBR_AVERAGES_CUR_30s;
-                movMean_tab.movAverage_current_30s -= (*ptrMovMeanCur_30s)/divider;
-                ptrMovMeanCur_30s++;
-            } else {
-                if (ptrMovMeanCur_new == &curValues[NMBR_AVERAGES_CUR_30s])
-                    curInit |= 0x08;
-            }
-            if ((curInit & 0x10) == 0x10) {
-                divider = NMBR_AVERAGES_CUR_60s;
-                movMean_tab.movAverage_current_60s -= (*ptrMovMeanCur_60s)/divider;
-                ptrMovMeanCur_60s++;
-            } else {
-                if (ptrMovMeanCur_new == &curValues[NMBR_AVERAGES_CUR_60s])
-                    curInit |= 0x10;
-            }
-            if ((curInit & 0x20) == 0x20) {
-                divider = NMBR_AVERAGES_CUR_cfg;
-                movMean_tab.movAverage_current_config -= (*ptrMovMeanCur_cfg)/divider;
-                ptrMovMeanCur_cfg++;
-            } else {
-                if (ptrMovMeanCur_new == &curValues[NMBR_AVERAGES_CUR_cfg])
-                    curInit |= 0x20;
-            }
-
-            /* Check pointer for buffer overflow */
-            if (ptrMovMeanCur_new > &curValues[movMeanCurLength-1])
-                ptrMovMeanCur_new = &curValues[0];
-            if (ptrMovMeanCur_1s > &curValues[movMeanCurLength-1])
-                ptrMovMeanCur_1s = &curValues[0];
-            if (ptrMovMeanCur_5s > &curValues[movMeanCurLength-1])
-                ptrMovMeanCur_5s = &curValues[0];
-            if (ptrMovMeanCur_10s > &curValues[movMeanCurLength-1])
-                ptrMovMeanCur_10s = &curValues[0];
-            if (ptrMovMeanCur_30s > &curValues[movMeanCurLength-1])
-                ptrMovMeanCur_30s = &curValues[0];
-            if (ptrMovMeanCur_60s > &curValues[movMeanCurLength-1])
-                ptrMovMeanCur_60s = &curValues[0];
-            if (ptrMovMeanCur_cfg > &curValues[movMeanCurLength-1])
-                ptrMovMeanCur_cfg = &curValues[0];
         }
     }
 
@@ -283,98 +231,17 @@ static void algo_movAverage(uint32_t algoIdx) {
 
         /* Check if valid value */
         if (curPow_tab.state_power == 0) {
+            ALGO_PrefixSumAdd(&algo_powRing, curPow_tab.power);
             newValues = 1;
-
-            /* Add value to array and calculate new moving mean values */
-            *ptrMovMeanPow_new = curPow_tab.power;
-
-            /* Calculate new moving means - first add new value */
-            divider = NMBR_AVERAGES_POW_1s;
-            movMean_tab.movAverage_power_1s += (*ptrMovMeanPow_new)/divider;
-            divider = NMBR_AVERAGES_POW_5s;
-            movMean_tab.movAverage_power_5s += (*ptrMovMeanPow_new)/divider;
-            divider = NMBR_AVERAGES_POW_10s;
-            movMean_tab.movAverage_power_10s += (*ptrMovMeanPow_new)/divider;
-            divider = NMBR_AVERAGES_POW_30s;
-            movMean_tab.movAverage_power_30s += (*ptrMovMeanPow_new)/divider;
-            divider = NMBR_AVERAGES_POW_60s;
-            movMean_tab.movAverage_power_60s += (*ptrMovMeanPow_new)/divider;
-            divider = NMBR_AVERAGES_POW_cfg;
-            movMean_tab.movAverage_power_config += (*ptrMovMeanPow_new)/divider;
-
-            /* Then, increment pointer and substract oldest value when respective window is filled with data */
-            ptrMovMeanPow_new++;
-            if ((powInit & 0x01) == 0x01) {
-                divider = NMBR_AVERAGES_POW_1s;
-                movMean_tab.movAverage_power_1s -= ((*ptrMovMeanPow_1s)/divider);
-                ptrMovMeanPow_1s++;
-            } else {
-                if (ptrMovMeanPow_new == &powValues[NMBR_AVERAGES_POW_1s])
-                    powInit |= 0x01;
-            }
-            if ((powInit & 0x02) == 0x02) {
-                divider = NMBR_AVERAGES_POW_5s;
-                movMean_tab.movAverage_power_5s -= ((*ptrMovMeanPow_5s)/divider);
-                ptrMovMeanPow_5s++;
-            } else {
-                if (ptrMovMeanPow_new == &powValues[NMBR_AVERAGES_POW_5s])
-                    powInit |= 0x02;
-            }
-            if ((powInit & 0x04) == 0x04) {
-                divider = NMBR_AVERAGES_POW_10s;
-                movMean_tab.movAverage_power_10s -= ((*ptrMovMeanPow_10s)/divider);
-                ptrMovMeanPow_10s++;
-            } else {
-                if (ptrMovMeanPow_new == &powValues[NMBR_AVERAGES_POW_10s])
-                    powInit |= 0x04;
-            }
-            if ((powInit & 0x08) == 0x08) {
-                divider = NMBR_AVERAGES_POW_30s;
-                movMean_tab.movAverage_power_30s -= ((*ptrMovMeanPow_30s)/divider);
-                ptrMovMeanPow_30s++;
-            } else {
-                if (ptrMovMeanPow_new == &powValues[NMBR_AVERAGES_POW_30s])
-                    powInit |= 0x08;
-            }
-            if ((powInit & 0x10) == 0x10) {
-                divider = NMBR_AVERAGES_POW_60s;
-                movMean_tab.movAverage_power_60s -= ((*ptrMovMeanPow_60s)/divider);
-                ptrMovMeanPow_60s++;
-            } else {
-                if (ptrMovMeanPow_new == &powValues[NMBR_AVERAGES_POW_60s])
-                    powInit |= 0x10;
-            }
-            if ((powInit & 0x20) == 0x20) {
-                divider = NMBR_AVERAGES_POW_cfg;
-                movMean_tab.movAverage_power_config -= ((*ptrMovMeanPow_cfg)/divider);
-                ptrMovMeanPow_cfg++;
-            } else {
-                if (ptrMovMeanPow_new == &powValues[NMBR_AVERAGES_POW_cfg])
-                    powInit |= 0x20;
-            }
-
-            /* Check pointer for buffer overflow */
-            if (ptrMovMeanPow_new > &powValues[movMeanPowLength-1])
-                ptrMovMeanPow_new = &powValues[0];
-            if (ptrMovMeanPow_1s > &powValues[movMeanPowLength-1])
-                ptrMovMeanPow_1s = &powValues[0];
-            if (ptrMovMeanPow_5s > &powValues[movMeanPowLength-1])
-                ptrMovMeanPow_5s = &powValues[0];
-            if (ptrMovMeanPow_10s > &powValues[movMeanPowLength-1])
-                ptrMovMeanPow_10s = &powValues[0];
-            if (ptrMovMeanPow_30s > &powValues[movMeanPowLength-1])
-                ptrMovMeanPow_30s = &powValues[0];
-            if (ptrMovMeanPow_60s > &powValues[movMeanPowLength-1])
-                ptrMovMeanPow_60s = &powValues[0];
-            if (ptrMovMeanPow_cfg > &powValues[movMeanPowLength-1])
-                ptrMovMeanPow_cfg = &powValues[0];
         }
     }
 
     if (newValues == 1) {
-        newValues = 0;
-
-        DB_WriteBlock(&movMean_tab, DATA_BLOCK_ID_MOV_AVERAGE);
+        /* every window costs one difference of two prefix sums, independent of its length */
+        for (i = 0; i < sizeof(algo_movAverages)/sizeof(algo_movAverages[0]); i++) {
+            *algo_movAverages[i].average = ALGO_PrefixSumMean(algo_movAverages[i].ring, algo_movAverages[i].nrOfSamples);
+        }
+        DB_WriteBlock(&algo_movMean_tab, DATA_BLOCK_ID_MOV_AVERAGE);
     }
 
     /* Only set task to ready state if it isn't blocked by the monitoring unit because of a runtime violation */
@@ -383,3 +250,28 @@ static void algo_movAverage(uint32_t algoIdx) {
     }
     return;
 }
+
+
+#if SOX_CELL_SOC_ESTIMATION == TRUE
+/**
+ * @brief   estimates the SOC of the cells module by module until the step budget is used up
+ *
+ * A pass over all cells that does not fit into the budget is continued in the next tick.
+ */
+static void algo_cellSocEstimation(uint32_t algoIdx) {
+    uint8_t finished = FALSE;
+
+    do {
+        finished = SOC_EstimateCellsStep(BS_NR_OF_BAT_CELLS_PER_MODULE);
+    } while ((finished == FALSE) && (ALGO_BudgetLeft(algoIdx) == TRUE));
+
+    /* Only set task to ready or resume state if it isn't blocked by the monitoring unit because of a runtime violation */
+    if (algo_algorithms[algoIdx].state != ALGO_BLOCKED) {
+        if (finished == TRUE) {
+            algo_algorithms[algoIdx].state = ALGO_READY;
+        } else {
+            algo_algorithms[algoIdx].state = ALGO_RESUME;
+        }
+    }
+}
+#endif
@@ -76,6 +76,19 @@
 /* #define ALGO_TICK_MS 10 */
 #define ALGO_TICK_MS 100
 
+/**
+ * @ingroup CONFIG_ALGO
+ * CPU time per tick for the steps of all algorithms. Algorithms that are due
+ * when the time is used up are started or continued in the next tick.
+ * \par Type:
+ * int
+ * \par Unit:
+ * us
+ * \par Default:
+ * 5000
+*/
+#define ALGO_TICK_BUDGET_US 5000
+
 
 typedef enum ALGO_STATE {
     ALGO_READY           = 0,
@@ -84,12 +97,14 @@ typedef enum ALGO_STATE {
     ALGO_RDY_BUT_WAITING = 3,
     ALGO_EXECUTE_ASAP    = 4,
     ALGO_BLOCKED         = 5,
+    ALGO_RESUME          = 6,
 } ALGO_STATE_e;
 
 typedef struct ALGO_TASKS {
     ALGO_STATE_e state;              /* !< current execution state */
     uint32_t cycleTime_ms;           /* !< cycle time of algorithm */
     uint32_t maxCalcDuration_ms;     /* !< maximum allowed calculation duration for task */
+    uint32_t budget_us;              /* !< CPU time for one step of the algorithm in a tick */
     uint32_t startTime;              /* !< start time when executing algorithm */
     void (*func)(uint32_t algoIdx);  /*!< callback function */
 } ALGO_TASKS_s;
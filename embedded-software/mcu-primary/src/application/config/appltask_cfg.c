@@ -125,6 +125,7 @@ void APPL_Cyclic_100ms(void) {
 
 #if BUILD_MODULE_ENABLE_COM
         COM_printHelpCommand();
+        COM_printDatabaseStatistics();
 #endif
 
     if (first_cycle < 10) {
@@ -114,6 +114,67 @@
 */
 #define SOX_CELL_CAPACITY               20000.0
 
+/**
+ * @ingroup CONFIG_SOX
+ * maximum time between two current measurements. A longer time is counted as
+ * gap of the Coulomb counter, the charge over the gap is still integrated
+ * from the two measurements around it.
+ * \par Type:
+ * int
+ * \par Unit:
+ * ms
+ * \par Default:
+ * 100
+*/
+#define SOX_CC_MAX_SAMPLE_GAP_MS        100
+
+/**
+ * @ingroup CONFIG_SOX
+ * If set to TRUE, the SOC of every cell is estimated by an extended Kalman
+ * filter on a first order equivalent circuit model of the cell (series
+ * resistance R0, RC element R1 C1) with every new cell voltage measurement.
+ * The minimum and maximum cell SOC of the estimation replace soc_min and
+ * soc_max of the Coulomb counter.
+ * \par Type:
+ * toggle
+ * \par Default:
+ * FALSE
+*/
+/* #define SOX_CELL_SOC_ESTIMATION         TRUE */
+#define SOX_CELL_SOC_ESTIMATION         FALSE
+
+/**
+ * @ingroup CONFIG_SOX
+ * parameters of the equivalent circuit model of the cell: series resistance
+ * R0, resistance R1 and time constant R1*C1 of the RC element
+ * \par Type:
+ * float
+ * \par Unit:
+ * mOhm, mOhm, s
+ * \par Default:
+ * 1.5, 1.0, 30.0
+*/
+#define SOX_CELL_R0_MOHM                1.5f
+#define SOX_CELL_R1_MOHM                1.0f
+#define SOX_CELL_TAU_S                  30.0f
+
+/**
+ * @ingroup CONFIG_SOX
+ * noise variances of the cell SOC estimation: process noise of the SOC and of
+ * the voltage over the RC element per update, noise of the cell voltage
+ * measurement and initial uncertainty of the SOC
+ * \par Type:
+ * float
+ * \par Unit:
+ * %^2, mV^2, mV^2, %^2
+ * \par Default:
+ * 0.0001, 0.1, 4.0, 25.0
+*/
+#define SOX_CELL_EKF_Q_SOC              0.0001f
+#define SOX_CELL_EKF_Q_VRC              0.1f
+#define SOX_CELL_EKF_R_VOLTAGE          4.0f
+#define SOX_CELL_EKF_P0_SOC             25.0f
+
 /**
  * @ingroup CONFIG_SOX
  * the maximum current in charge direction that the battery pack can sustain.
@@ -58,9 +58,41 @@
 #include "database.h"
 #include "batterycell_cfg.h"
 #include "batterysystem_cfg.h"
+#include "foxmath.h"
+#include "mcu.h"
 #include "nvramhandler.h"
+#include "os.h"
+#include <math.h>
 
 /*================== Macros and Definitions ===============================*/
+/**
+ * state of the SOC estimation of all cells, stored as one array per state
+ * variable so that the estimation step runs through contiguous memory
+ */
+typedef struct {
+    float soc[BS_NR_OF_BAT_CELLS];  /*!< SOC in %                                           */
+    float vrc[BS_NR_OF_BAT_CELLS];  /*!< voltage over the RC element in mV                  */
+    float p00[BS_NR_OF_BAT_CELLS];  /*!< covariance of the SOC in %^2                       */
+    float p01[BS_NR_OF_BAT_CELLS];  /*!< covariance of SOC and RC voltage in % mV           */
+    float p11[BS_NR_OF_BAT_CELLS];  /*!< covariance of the RC voltage in mV^2               */
+} SOC_CELL_STATE_s;
+
+/**
+ * estimation pass over all cells with one cell voltage measurement, done in steps
+ */
+typedef struct {
+    uint8_t active;         /*!< TRUE while the pass is not finished                    */
+    uint16_t nextCell;      /*!< first cell of the next step                            */
+    float decay;            /*!< decay of the RC voltage since the last measurement     */
+    float deltaSOC;         /*!< counted SOC change since the last measurement in %     */
+    float vrcInput;         /*!< RC voltage caused by the current in mV                 */
+    float r0Drop;           /*!< voltage drop over R0 in mV                             */
+    float soc_min;          /*!< minimum SOC of the cells passed so far in %            */
+    float soc_max;          /*!< maximum SOC of the cells passed so far in %            */
+    uint16_t cell_min;      /*!< cell with the minimum SOC                              */
+    uint16_t cell_max;      /*!< cell with the maximum SOC                              */
+    uint32_t cycles;        /*!< CPU cycles of the steps of the pass so far             */
+} SOC_CELL_PASS_s;
 
 /*================== Constant and Variable Definitions ====================*/
 static SOX_STATE_s sox_state = {
@@ -77,6 +109,19 @@ static DATA_BLOCK_CONTFEEDBACK_s contfeedbacktab;
 
 static uint32_t soc_previous_current_timestamp = 0;
 static uint32_t soc_previous_current_timestamp_cc = 0;
+static uint32_t soc_current_sensor_version = 0;
+static uint32_t sof_minmax_version = 0;
+static uint32_t sof_sox_version = 0;
+static uint32_t sof_contfeedback_version = 0;
+
+/** @{
+ * Coulomb counter and the SOC at a reference charge of the counter, from which the SOC
+ * is calculated if the current sensor has no Coulomb counter
+ */
+static SOC_COULOMB_COUNTER_s soc_coulomb_counter;
+static SOX_SOC_s soc_reference = {50.0, 50.0, 50.0};
+static int64_t soc_reference_charge = 0;
+/** @} */
 
 
 /** @{
@@ -92,6 +137,35 @@ static SOX_SOF_s sof_mol_Level;
 static SOX_SOF_s sof_rsl_Level;
 static SOX_SOF_s sof_msl_Level;
 
+static SOC_OCV_INDEX_s soc_ocv_index[BC_OCV_NR_OF_TEMPERATURES];
+static float soc_ocv_slope[BC_OCV_NR_OF_TEMPERATURES][BC_OCV_NR_OF_SOC_POINTS - 1];
+static uint8_t soc_ocv_index_valid = FALSE;
+/** @} */
+
+/** @{
+ * OCV curves of the battery cell from batterycell_cfg.h
+ */
+static const float soc_ocv_temperatures[BC_OCV_NR_OF_TEMPERATURES] = BC_OCV_TEMPERATURES;
+static const float soc_ocv_soc_points[BC_OCV_NR_OF_SOC_POINTS] = BC_OCV_SOC_POINTS;
+static const float soc_ocv_curves[BC_OCV_NR_OF_TEMPERATURES][BC_OCV_NR_OF_SOC_POINTS] = BC_OCV_CURVES;
+/** @} */
+
+#if SOX_CELL_SOC_ESTIMATION == TRUE
+/** @{
+ * SOC estimation of the cells, the per cell data is placed in the external SDRAM
+ */
+static SOC_CELL_STATE_s MEM_EXT_SDRAM soc_cell_state;
+static DATA_BLOCK_CELLVOLTAGE_s MEM_EXT_SDRAM soc_cellvoltage;
+static uint32_t soc_cellvoltage_version = 0;
+static uint32_t soc_cellvoltage_timestamp = 0;
+static SOC_CELL_ESTIMATION_s soc_cell_estimation;
+static SOC_CELL_PASS_s soc_cell_pass;
+static SOC_OCV_INDEX_s soc_soc_points_index;
+static float soc_cell_ocv[BC_OCV_NR_OF_SOC_POINTS];
+static float soc_cell_ocv_slope[BC_OCV_NR_OF_SOC_POINTS - 1];
+/** @} */
+#endif
+
 /*================== Function Prototypes ==================================*/
 static void SOF_CalculateCurves(const SOX_SOF_CONFIG_s *configLimitValues, SOF_curve_s* calcCurveValues);
 static void SOF_Calculate(int16_t maxtemp, int16_t mintemp, uint16_t maxvolt, uint16_t minvolt, uint16_t maxsoc, uint16_t minsoc);
@@ -100,7 +174,17 @@ static void SOF_CalculateSocBased(float MinSoc, float MaxSoc, SOX_SOF_s *ResultV
 static void SOF_CalculateTemperatureBased(float MinTemp, float MaxTemp, SOX_SOF_s *ResultValues, const SOX_SOF_CONFIG_s *configLimitValues, SOF_curve_s* calcCurveValues);
 static void SOF_MinimumOfThreeSofValues(SOX_SOF_s Ubased, SOX_SOF_s Sbased, SOX_SOF_s Tbased, SOX_SOF_s *resultValues);
 static float SOF_MinimumOfThreeValues(float value1, float value2, float value3);
-static float SOC_GetFromVoltage(float voltage);
+static void SOC_InitOcvIndex(void);
+static void SOC_SelectOcvCurves(float temperature, uint8_t *lowerCurve, uint8_t *upperCurve);
+static float SOC_LookupOcvCurve(uint8_t curve, float voltage);
+static float SOC_GetTemperatureWeight(uint8_t lowerCurve, uint8_t upperCurve, float temperature);
+static void SOC_BuildIndex(const float breakpoints[], SOC_OCV_INDEX_s *index);
+static uint8_t SOC_FindSegment(const float breakpoints[], const SOC_OCV_INDEX_s *index, float value);
+static void SOC_SetReference(const SOX_SOC_s *soc);
+#if SOX_CELL_SOC_ESTIMATION == TRUE
+static void SOC_InitCellEstimation(float soc);
+static void SOC_ApplyCellEstimation(SOX_SOC_s *soc);
+#endif
 
 /*================== Function Implementations =============================*/
 
@@ -108,6 +192,7 @@ void SOC_Init(uint8_t cc_present) {
     SOX_SOC_s soc = {50.0, 50.0, 50.0};
     DATA_BLOCK_ERRORSTATE_s error_flags;
 
+    SOC_InitOcvIndex();
 
     DB_ReadBlock(&error_flags, DATA_BLOCK_ID_ERRORSTATE);
     DB_ReadBlock(&sox_current_tab, DATA_BLOCK_ID_CURRENT_SENSOR);
@@ -143,7 +228,11 @@ void SOC_Init(uint8_t cc_present) {
         soc_previous_current_timestamp = sox_current_tab.timestamp_cur;
         error_flags.can_cc_used = 0;
         sox_state.sensor_cc_used = FALSE;
+        SOC_SetReference(&soc);
     }
+#if SOX_CELL_SOC_ESTIMATION == TRUE
+    SOC_InitCellEstimation(soc.mean);
+#endif
     DB_WriteBlock(&error_flags, DATA_BLOCK_ID_ERRORSTATE);
     DB_WriteBlock(&sox, DATA_BLOCK_ID_SOX);
 }
@@ -172,11 +261,16 @@ void SOC_SetValue(float soc_value_min, float soc_value_max, float soc_value_mean
         soc_value_mean = 100.0;
     }
 
+#if SOX_CELL_SOC_ESTIMATION == TRUE
+    SOC_InitCellEstimation(soc_value_mean);
+#endif
+
     if (sox_state.sensor_cc_used == FALSE) {
         soc.mean = soc_value_mean;
         soc.min = soc_value_min;
         soc.max = soc_value_max;
         NVM_setSOC(&soc);
+        SOC_SetReference(&soc);
 
         sox.soc_mean = soc.mean;
         sox.soc_min = soc.min;
@@ -222,9 +316,9 @@ void SOC_Set_Lookup_Table(void) {
     DB_ReadBlock(&cellminmax, DATA_BLOCK_ID_MINMAX);
     DB_ReadBlock(&sox_current_tab, DATA_BLOCK_ID_CURRENT_SENSOR);
 
-    soc_mean = SOC_GetFromVoltage((float)(cellminmax.voltage_mean));
-    soc_min = SOC_GetFromVoltage((float)(cellminmax.voltage_min));
-    soc_max = SOC_GetFromVoltage((float)(cellminmax.voltage_max));
+    soc_mean = SOC_GetFromVoltage((float)(cellminmax.voltage_mean), cellminmax.temperature_mean);
+    soc_min = SOC_GetFromVoltage((float)(cellminmax.voltage_min), cellminmax.temperature_mean);
+    soc_max = SOC_GetFromVoltage((float)(cellminmax.voltage_max), cellminmax.temperature_mean);
 
     SOC_SetValue(soc_min, soc_max, soc_mean);
 }
@@ -242,6 +336,12 @@ void SOC_Calculation(void) {
     DATA_BLOCK_CURRENT_SENSOR_s cans_current_tab;
     SOX_SOC_s soc = {50.0, 50.0, 50.0};
     float deltaSOC = 0.0;
+    int64_t charge = 0;
+
+    /* nothing to do if no new current sensor data was stored */
+    if (DATA_HasBlockChanged(DATA_BLOCK_ID_CURRENT_SENSOR, &soc_current_sensor_version) == FALSE) {
+        return;
+    }
 
     if (sox_state.sensor_cc_used == FALSE) {
         DB_ReadBlock(&sox_current_tab, DATA_BLOCK_ID_CURRENT_SENSOR);
@@ -252,28 +352,37 @@ void SOC_Calculation(void) {
         if (soc_previous_current_timestamp != timestamp) {  /* check if current measurement has been updated */
             timestep = timestamp - previous_timestamp;
             if (timestep > 0) {
-                NVM_getSOC(&soc);
+                /* the SOC follows from the charge since the reference, so no rounding error accumulates */
                 /* Current in charge direction negative means SOC increasing --> BAT naming, not ROB */
-                /* soc_mean = soc_mean - (sox_current_tab.current *mA* /(float)SOX_CELL_CAPACITY (*mAh*)) * (float)(timestep) * (10.0/3600.0); */ /*milliseconds*/
-
+                charge = soc_coulomb_counter.charge;
                 if (POSITIVE_DISCHARGE_CURRENT == TRUE) {
-                    deltaSOC = (((sox_current_tab.current)*(float)(timestep)/10))/(3600.0*SOX_CELL_CAPACITY); /* ((mA *ms *(1s/1000ms)) / (3600(s/h) *mAh)) *100% */
+                    deltaSOC = (float)(charge - soc_reference_charge)/(2.0*36000.0*SOX_CELL_CAPACITY); /* ((mA *ms *(1h/3600000ms)) / mAh) *100%, charge is doubled */
                 } else {
-                    deltaSOC = -(((sox_current_tab.current)*(float)(timestep)/10))/(3600.0*SOX_CELL_CAPACITY); /* ((mA *ms *(1s/1000ms)) / (3600(s/h) *mAh)) *100% */
+                    deltaSOC = -(float)(charge - soc_reference_charge)/(2.0*36000.0*SOX_CELL_CAPACITY); /* ((mA *ms *(1h/3600000ms)) / mAh) *100%, charge is doubled */
+                }
+                soc.mean = soc_reference.mean - deltaSOC;
+                soc.min = soc_reference.min - deltaSOC;
+                soc.max = soc_reference.max - deltaSOC;
+                if ((soc.mean > 100.0) || (soc.mean < 0.0) || (soc.min > 100.0) || (soc.min < 0.0) || (soc.max > 100.0) || (soc.max < 0.0)) {
+                    if (soc.mean > 100.0) { soc.mean = 100.0; }
+                    if (soc.mean < 0.0)   { soc.mean = 0.0;   }
+                    if (soc.min > 100.0)  { soc.min = 100.0;  }
+                    if (soc.min < 0.0)    { soc.min = 0.0;    }
+                    if (soc.max > 100.0)  { soc.max = 100.0;  }
+                    if (soc.max < 0.0)    { soc.max = 0.0;    }
+                    /* the charge beyond the limits is not counted */
+                    soc_reference = soc;
+                    soc_reference_charge = charge;
                 }
-                soc.mean = soc.mean - deltaSOC;
-                soc.min = soc.min - deltaSOC;
-                soc.max = soc.max - deltaSOC;
-                if (soc.mean > 100.0) { soc.mean = 100.0; }
-                if (soc.mean < 0.0)   { soc.mean = 0.0;   }
-                if (soc.min > 100.0)  { soc.min = 100.0;  }
-                if (soc.min < 0.0)    { soc.min = 0.0;    }
-                if (soc.max > 100.0)  { soc.max = 100.0;  }
-                if (soc.max < 0.0)    { soc.max = 0.0;    }
+#if SOX_CELL_SOC_ESTIMATION == TRUE
+                SOC_ApplyCellEstimation(&soc);
+#endif
 
                 sox.soc_mean = soc.mean;
                 sox.soc_min = soc.min;
                 sox.soc_max = soc.max;
+                sox.charge_counter = soc_coulomb_counter.charge / 2;
+                sox.charge_counter_gaps = soc_coulomb_counter.gaps;
 
                 NVM_setSOC(&soc);
                 sox.state++;
@@ -303,12 +412,19 @@ void SOC_Calculation(void) {
             soc.mean = sox.soc_mean;
             soc.min = sox.soc_min;
             soc.max = sox.soc_max;
+#if SOX_CELL_SOC_ESTIMATION == TRUE
+            SOC_ApplyCellEstimation(&soc);
+            sox.soc_min = soc.min;
+            sox.soc_max = soc.max;
+#endif
             if (sox.soc_mean > 100.0) { sox.soc_mean = 100.0; }
             if (sox.soc_mean < 0.0)   { sox.soc_mean = 0.0;   }
             if (sox.soc_min > 100.0)  { sox.soc_min = 100.0;  }
             if (sox.soc_min < 0.0)    { sox.soc_min = 0.0;    }
             if (sox.soc_max > 100.0)  { sox.soc_max = 100.0;  }
             if (sox.soc_max < 0.0)    { sox.soc_max = 0.0;    }
+            sox.charge_counter = soc_coulomb_counter.charge / 2;
+            sox.charge_counter_gaps = soc_coulomb_counter.gaps;
             NVM_setSOC(&soc);
             sox.state++;
             DB_WriteBlock(&sox, DATA_BLOCK_ID_SOX);
@@ -317,6 +433,237 @@ void SOC_Calculation(void) {
     }
 }
 
+void SOC_IntegrateCurrent(int32_t current, uint32_t timestamp) {
+    uint32_t timestep = 0;
+
+    if (soc_coulomb_counter.started == TRUE) {
+        timestep = timestamp - soc_coulomb_counter.timestamp;
+        if (timestep > SOX_CC_MAX_SAMPLE_GAP_MS) {
+            soc_coulomb_counter.gaps++;
+        }
+        /* trapezoidal rule, the factor 1/2 is kept in the counter to stay exact */
+        soc_coulomb_counter.charge += ((int64_t)current + (int64_t)soc_coulomb_counter.current) * (int64_t)timestep;
+    }
+    soc_coulomb_counter.current = current;
+    soc_coulomb_counter.timestamp = timestamp;
+    soc_coulomb_counter.started = TRUE;
+}
+
+
+/**
+ * @brief   sets the SOC at the present charge of the Coulomb counter
+ *
+ * @param   soc:  SOC at the present charge
+ */
+static void SOC_SetReference(const SOX_SOC_s *soc) {
+    soc_reference = *soc;
+    /* the counter is updated by the CAN signal task */
+    OS_TaskEnter_Critical();
+    soc_reference_charge = soc_coulomb_counter.charge;
+    OS_TaskExit_Critical();
+}
+
+
+STD_RETURN_TYPE_e SOC_GetCellEstimation(SOC_CELL_ESTIMATION_s *estimation) {
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
+
+#if SOX_CELL_SOC_ESTIMATION == TRUE
+    OS_TaskEnter_Critical();
+    if ((estimation != NULL_PTR) && (soc_cell_estimation.updates > 0)) {
+        *estimation = soc_cell_estimation;
+        retVal = E_OK;
+    }
+    OS_TaskExit_Critical();
+#endif
+    return retVal;
+}
+
+#if SOX_CELL_SOC_ESTIMATION == TRUE
+/**
+ * @brief   starts the SOC estimation of all cells from one SOC
+ *
+ * @param   soc:  initial SOC of all cells in %
+ */
+static void SOC_InitCellEstimation(float soc) {
+    uint16_t i = 0;
+
+    if (soc < 0.0f) {
+        soc = 0.0f;
+    }
+    if (soc > 100.0f) {
+        soc = 100.0f;
+    }
+    SOC_BuildIndex(soc_ocv_soc_points, &soc_soc_points_index);
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        soc_cell_state.soc[i] = soc;
+        soc_cell_state.vrc[i] = 0.0f;
+        soc_cell_state.p00[i] = SOX_CELL_EKF_P0_SOC;
+        soc_cell_state.p01[i] = 0.0f;
+        soc_cell_state.p11[i] = SOX_CELL_EKF_R_VOLTAGE;
+    }
+    soc_cellvoltage_timestamp = 0;
+    soc_cell_pass.active = FALSE;
+}
+
+
+uint8_t SOC_EstimateCellsStep(uint16_t nrOfCells) {
+    DATA_BLOCK_CURRENT_SENSOR_s current_tab;
+    uint32_t startcycles = MCU_GetCycleCounter();
+    float dt = 0.0f;
+    float current = 0.0f;
+    float soc = 0.0f;
+    float vrc = 0.0f;
+    float p00 = 0.0f;
+    float p01 = 0.0f;
+    float p11 = 0.0f;
+    float h = 0.0f;
+    float innovation = 0.0f;
+    float g0 = 0.0f;
+    float g1 = 0.0f;
+    float k0 = 0.0f;
+    float k1 = 0.0f;
+    float invS = 0.0f;
+    uint16_t i = 0;
+    uint16_t lastCell = 0;
+    uint8_t segment = 0;
+    uint8_t lowerCurve = 0;
+    uint8_t upperCurve = 0;
+
+    if (soc_cell_pass.active == FALSE) {
+        if (DATA_HasBlockChanged(DATA_BLOCK_ID_CELLVOLTAGE, &soc_cellvoltage_version) == FALSE) {
+            return TRUE;
+        }
+
+        DB_ReadBlock(&soc_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
+        DB_ReadBlock(&current_tab, DATA_BLOCK_ID_CURRENT_SENSOR);
+        DB_ReadBlock(&cellminmax, DATA_BLOCK_ID_MINMAX);
+
+        /* the first measurement only gives the time base */
+        if (soc_cellvoltage_timestamp == 0) {
+            soc_cellvoltage_timestamp = soc_cellvoltage.timestamp;
+            return TRUE;
+        }
+        dt = (float)(soc_cellvoltage.timestamp - soc_cellvoltage_timestamp) / 1000.0f;
+        soc_cellvoltage_timestamp = soc_cellvoltage.timestamp;
+
+        /* model terms for all cells, current positive in discharge direction */
+        if (POSITIVE_DISCHARGE_CURRENT == TRUE) {
+            current = current_tab.current;
+        } else {
+            current = -current_tab.current;
+        }
+        soc_cell_pass.decay = expf(-dt / SOX_CELL_TAU_S);
+        soc_cell_pass.deltaSOC = current * dt / (36.0f * SOX_CELL_CAPACITY);     /* (mA * s) / (3600(s/h) * mAh) * 100% */
+        soc_cell_pass.vrcInput = (1.0f - soc_cell_pass.decay) * SOX_CELL_R1_MOHM * current / 1000.0f;
+        soc_cell_pass.r0Drop = SOX_CELL_R0_MOHM * current / 1000.0f;
+
+        /* OCV curve and its slope at the mean cell temperature */
+        SOC_SelectOcvCurves(cellminmax.temperature_mean, &lowerCurve, &upperCurve);
+        for (i = 0; i < BC_OCV_NR_OF_SOC_POINTS; i++) {
+            soc_cell_ocv[i] = MATH_linearInterpolation(soc_ocv_temperatures[lowerCurve], soc_ocv_curves[lowerCurve][i],
+                    soc_ocv_temperatures[upperCurve], soc_ocv_curves[upperCurve][i], cellminmax.temperature_mean);
+        }
+        for (i = 0; i < (BC_OCV_NR_OF_SOC_POINTS - 1); i++) {
+            soc_cell_ocv_slope[i] = (soc_cell_ocv[i + 1] - soc_cell_ocv[i]) / (soc_ocv_soc_points[i + 1] - soc_ocv_soc_points[i]);
+        }
+
+        soc_cell_pass.nextCell = 0;
+        soc_cell_pass.cycles = 0;
+        soc_cell_pass.active = TRUE;
+    }
+
+    lastCell = soc_cell_pass.nextCell + nrOfCells;
+    if ((nrOfCells == 0) || (lastCell > BS_NR_OF_BAT_CELLS)) {
+        lastCell = BS_NR_OF_BAT_CELLS;
+    }
+    for (i = soc_cell_pass.nextCell; i < lastCell; i++) {
+        /* prediction */
+        soc = soc_cell_state.soc[i] - soc_cell_pass.deltaSOC;
+        vrc = soc_cell_pass.decay * soc_cell_state.vrc[i] + soc_cell_pass.vrcInput;
+        p00 = soc_cell_state.p00[i] + SOX_CELL_EKF_Q_SOC;
+        p01 = soc_cell_pass.decay * soc_cell_state.p01[i];
+        p11 = soc_cell_pass.decay * soc_cell_pass.decay * soc_cell_state.p11[i] + SOX_CELL_EKF_Q_VRC;
+
+        /* correction with the measured voltage: v = OCV(soc) - vrc - R0 * I */
+        if (((soc_cellvoltage.valid_voltPECs[i / BS_NR_OF_BAT_CELLS_PER_MODULE] >> (i % BS_NR_OF_BAT_CELLS_PER_MODULE)) & 0x01) == 0) {
+            segment = SOC_FindSegment(soc_ocv_soc_points, &soc_soc_points_index, soc);
+            h = soc_cell_ocv_slope[segment];
+            innovation = (float)soc_cellvoltage.voltage[i] -
+                    (soc_cell_ocv[segment] + h * (soc - soc_ocv_soc_points[segment]) - vrc - soc_cell_pass.r0Drop);
+            g0 = h * p00 - p01;
+            g1 = h * p01 - p11;
+            invS = 1.0f / (h * g0 - g1 + SOX_CELL_EKF_R_VOLTAGE);
+            k0 = g0 * invS;
+            k1 = g1 * invS;
+            soc = soc + k0 * innovation;
+            vrc = vrc + k1 * innovation;
+            p00 = p00 - k0 * g0;
+            p01 = p01 - k0 * g1;
+            p11 = p11 - k1 * g1;
+        }
+
+        if (soc < 0.0f) {
+            soc = 0.0f;
+        }
+        if (soc > 100.0f) {
+            soc = 100.0f;
+        }
+        soc_cell_state.soc[i] = soc;
+        soc_cell_state.vrc[i] = vrc;
+        soc_cell_state.p00[i] = p00;
+        soc_cell_state.p01[i] = p01;
+        soc_cell_state.p11[i] = p11;
+
+        if ((i == 0) || (soc < soc_cell_pass.soc_min)) {
+            soc_cell_pass.soc_min = soc;
+            soc_cell_pass.cell_min = i;
+        }
+        if ((i == 0) || (soc > soc_cell_pass.soc_max)) {
+            soc_cell_pass.soc_max = soc;
+            soc_cell_pass.cell_max = i;
+        }
+    }
+    soc_cell_pass.nextCell = lastCell;
+    soc_cell_pass.cycles += MCU_GetCycleCounter() - startcycles;
+
+    if (soc_cell_pass.nextCell < BS_NR_OF_BAT_CELLS) {
+        return FALSE;
+    }
+
+    /* publish the result of the complete pass, it is read by the task of SOC_Calculation() */
+    OS_TaskEnter_Critical();
+    soc_cell_estimation.soc_min = soc_cell_pass.soc_min;
+    soc_cell_estimation.soc_max = soc_cell_pass.soc_max;
+    soc_cell_estimation.cell_min = soc_cell_pass.cell_min;
+    soc_cell_estimation.cell_max = soc_cell_pass.cell_max;
+    soc_cell_estimation.updates++;
+    soc_cell_estimation.cycles_last = soc_cell_pass.cycles;
+    if (soc_cell_estimation.cycles_last > soc_cell_estimation.cycles_max) {
+        soc_cell_estimation.cycles_max = soc_cell_estimation.cycles_last;
+    }
+    OS_TaskExit_Critical();
+    soc_cell_pass.active = FALSE;
+    return TRUE;
+}
+
+
+/**
+ * @brief   replaces the minimum and maximum SOC by the cell SOC estimation
+ *
+ * Nothing is replaced until the estimation has made its first step.
+ *
+ * @param   soc:  SOC to update
+ */
+static void SOC_ApplyCellEstimation(SOX_SOC_s *soc) {
+    OS_TaskEnter_Critical();
+    if (soc_cell_estimation.updates > 0) {
+        soc->min = soc_cell_estimation.soc_min;
+        soc->max = soc_cell_estimation.soc_max;
+    }
+    OS_TaskExit_Critical();
+}
+#endif
+
 void SOF_Init(void) {
     /* Calculating SOF curve for the recommended operating current */
     SOF_CalculateCurves(&sox_sof_config_maxAllowedCurrent, &sofCurveRecOperatingCurrent);
@@ -362,10 +709,21 @@ static void SOF_CalculateCurves(const SOX_SOF_CONFIG_s *configLimitValues, SOF_c
 
 
 void SOF_Calculation(void) {
-    DB_ReadBlock(&cellminmax, DATA_BLOCK_ID_MINMAX);
-    DB_ReadBlock(&sox, DATA_BLOCK_ID_SOX);
+    uint8_t changed = FALSE;
+
+    /* recalculate only if one of the inputs changed, all three versions have to be updated */
+    changed |= DATA_HasBlockChanged(DATA_BLOCK_ID_MINMAX, &sof_minmax_version);
+    changed |= DATA_HasBlockChanged(DATA_BLOCK_ID_SOX, &sof_sox_version);
+    changed |= DATA_HasBlockChanged(DATA_BLOCK_ID_CONTFEEDBACK, &sof_contfeedback_version);
+    if (changed == FALSE) {
+        return;
+    }
+
+    /* Only the minimum and maximum values are needed, read them with one consistent copy each */
+    DB_ReadFieldRange(&cellminmax.voltage_min, DATA_BLOCK_ID_MINMAX, DATA_BLOCK_MINMAX_s, voltage_min, temperature_max);
+    DB_ReadFieldRange(&sox.soc_min, DATA_BLOCK_ID_SOX, DATA_BLOCK_SOX_s, soc_min, soc_max);
     DB_ReadBlock(&sof, DATA_BLOCK_ID_SOF);
-    DB_ReadBlock(&contfeedbacktab, DATA_BLOCK_ID_CONTFEEDBACK);
+    DB_ReadField(&contfeedbacktab.contactor_feedback, DATA_BLOCK_ID_CONTFEEDBACK, DATA_BLOCK_CONTFEEDBACK_s, contactor_feedback);
 
     /* Calculate SOF limits */
     SOF_Calculate(cellminmax.temperature_max, cellminmax.temperature_min, cellminmax.voltage_max, cellminmax.voltage_min, (uint16_t)(100.0*sox.soc_max), (uint16_t)(100.0*sox.soc_min));
@@ -399,18 +757,195 @@ void SOF_Calculation(void) {
     DB_WriteBlock(&sof, DATA_BLOCK_ID_SOF);
 }
 
+float SOC_GetFromVoltage(float voltage, float temperature) {
+    uint8_t lowerCurve = 0;
+    uint8_t upperCurve = 0;
+    float weight = 0.0;
+    float soc = 0.0;
+
+    SOC_SelectOcvCurves(temperature, &lowerCurve, &upperCurve);
+    soc = SOC_LookupOcvCurve(lowerCurve, voltage);
+    if (upperCurve != lowerCurve) {
+        weight = SOC_GetTemperatureWeight(lowerCurve, upperCurve, temperature);
+        soc += weight * (SOC_LookupOcvCurve(upperCurve, voltage) - soc);
+    }
+    return soc;
+}
+
+
+void SOC_GetFromVoltageBatch(const uint16_t voltage[], float temperature, float soc[], uint16_t nrOfCells) {
+    uint8_t lowerCurve = 0;
+    uint8_t upperCurve = 0;
+    float weight = 0.0;
+    float socLower = 0.0;
+    uint16_t i = 0;
+
+    if (voltage != NULL_PTR && soc != NULL_PTR) {
+        SOC_SelectOcvCurves(temperature, &lowerCurve, &upperCurve);
+        if (upperCurve != lowerCurve) {
+            weight = SOC_GetTemperatureWeight(lowerCurve, upperCurve, temperature);
+            for (i = 0; i < nrOfCells; i++) {
+                socLower = SOC_LookupOcvCurve(lowerCurve, (float)voltage[i]);
+                soc[i] = socLower + (weight * (SOC_LookupOcvCurve(upperCurve, (float)voltage[i]) - socLower));
+            }
+        } else {
+            for (i = 0; i < nrOfCells; i++) {
+                soc[i] = SOC_LookupOcvCurve(lowerCurve, (float)voltage[i]);
+            }
+        }
+    }
+}
+
+
+/**
+ * @brief   calculates the index over the voltage range and the slope of the segments of every OCV curve
+ *
+ * Done once, before the first lookup, to avoid a search over the whole curve and
+ * divisions at runtime.
+ */
+static void SOC_InitOcvIndex(void) {
+    uint8_t c = 0;
+    uint8_t i = 0;
+
+    for (c = 0; c < BC_OCV_NR_OF_TEMPERATURES; c++) {
+        SOC_BuildIndex(soc_ocv_curves[c], &soc_ocv_index[c]);
+        for (i = 0; i < (BC_OCV_NR_OF_SOC_POINTS - 1); i++) {
+            soc_ocv_slope[c][i] = (soc_ocv_soc_points[i + 1] - soc_ocv_soc_points[i]) /
+                    (soc_ocv_curves[c][i + 1] - soc_ocv_curves[c][i]);
+        }
+    }
+    soc_ocv_index_valid = TRUE;
+}
+
+
+/**
+ * @brief   calculates the index over the range of BC_OCV_NR_OF_SOC_POINTS ascending breakpoints
+ *
+ * @param   breakpoints:  ascending breakpoints, e.g., the voltages of an OCV curve
+ * @param   index:        index to calculate
+ */
+static void SOC_BuildIndex(const float breakpoints[], SOC_OCV_INDEX_s *index) {
+    float step = 0.0;
+    float lowerEnd = 0.0;
+    uint8_t segment = 0;
+    uint8_t i = 0;
+
+    step = (breakpoints[BC_OCV_NR_OF_SOC_POINTS - 1] - breakpoints[0]) / (float)SOC_OCV_INDEX_LENGTH;
+    index->start = breakpoints[0];
+    index->invstep = 1.0f / step;
+    for (i = 0; i < SOC_OCV_INDEX_LENGTH; i++) {
+        lowerEnd = breakpoints[0] + (float)i * step;
+        while ((segment < (BC_OCV_NR_OF_SOC_POINTS - 2)) && (lowerEnd >= breakpoints[segment + 1])) {
+            segment++;
+        }
+        index->segment[i] = segment;
+    }
+}
+
+
+/**
+ * @brief   finds the segment of the breakpoints that contains a value
+ *
+ * The index gives the segment at the lower end of the interval of the value, from
+ * there only the breakpoints within the interval are passed. Values outside of the
+ * breakpoints are assigned to the first respectively the last segment.
+ *
+ * @param   breakpoints:  ascending breakpoints the index was calculated for
+ * @param   index:        index over the breakpoints
+ * @param   value:        value to find
+ *
+ * @return  segment, the value is between breakpoints[segment] and breakpoints[segment + 1]
+ */
+static uint8_t SOC_FindSegment(const float breakpoints[], const SOC_OCV_INDEX_s *index, float value) {
+    uint32_t interval = 0;
+    uint8_t segment = 0;
+
+    if (value >= breakpoints[BC_OCV_NR_OF_SOC_POINTS - 1]) {
+        segment = BC_OCV_NR_OF_SOC_POINTS - 2;
+    } else if (value > breakpoints[0]) {
+        interval = (uint32_t)((value - index->start) * index->invstep);
+        if (interval >= SOC_OCV_INDEX_LENGTH) {
+            interval = SOC_OCV_INDEX_LENGTH - 1;
+        }
+        segment = index->segment[interval];
+        while ((segment < (BC_OCV_NR_OF_SOC_POINTS - 2)) && (value > breakpoints[segment + 1])) {
+            segment++;
+        }
+    }
+    return segment;
+}
+
+
+/**
+ * @brief   selects the OCV curves next to a temperature
+ *
+ * Below the first and above the last temperature of the curves, both curves are the
+ * first respectively the last curve.
+ *
+ * @param   temperature:  cell temperature in &deg;C
+ * @param   lowerCurve:   curve at or below the temperature
+ * @param   upperCurve:   curve above the temperature
+ */
+static void SOC_SelectOcvCurves(float temperature, uint8_t *lowerCurve, uint8_t *upperCurve) {
+    uint8_t c = 0;
+
+    if (soc_ocv_index_valid == FALSE) {
+        SOC_InitOcvIndex();
+    }
+
+    if (temperature <= soc_ocv_temperatures[0]) {
+        *lowerCurve = 0;
+        *upperCurve = 0;
+    } else if (temperature >= soc_ocv_temperatures[BC_OCV_NR_OF_TEMPERATURES - 1]) {
+        *lowerCurve = BC_OCV_NR_OF_TEMPERATURES - 1;
+        *upperCurve = BC_OCV_NR_OF_TEMPERATURES - 1;
+    } else {
+        while (temperature >= soc_ocv_temperatures[c + 1]) {
+            c++;
+        }
+        *lowerCurve = c;
+        *upperCurve = c + 1;
+    }
+}
+
+
 /**
- * @brief   look-up table for SOC initialization (mean, min and max).
+ * @brief   interpolates the SOC in one OCV curve
  *
- * @param   voltage: voltage of battery cell
+ * @param   curve:    number of the OCV curve
+ * @param   voltage:  cell voltage in mV
  *
- * @return  SOC value
+ * @return  SOC in %
  */
+static float SOC_LookupOcvCurve(uint8_t curve, float voltage) {
+    const float *ocv = soc_ocv_curves[curve];
+    uint8_t segment = 0;
+    float soc = 0.0;
+
+    if (voltage <= ocv[0]) {
+        soc = soc_ocv_soc_points[0];
+    } else if (voltage >= ocv[BC_OCV_NR_OF_SOC_POINTS - 1]) {
+        soc = soc_ocv_soc_points[BC_OCV_NR_OF_SOC_POINTS - 1];
+    } else {
+        segment = SOC_FindSegment(ocv, &soc_ocv_index[curve], voltage);
+        soc = soc_ocv_soc_points[segment] + (soc_ocv_slope[curve][segment] * (voltage - ocv[segment]));
+    }
+    return soc;
+}
 
-float SOC_GetFromVoltage(float voltage) {
-    float SOC = 0.50;
 
-    return SOC;
+/**
+ * @brief   calculates the weight of the upper of two OCV curves for a temperature between them
+ *
+ * @param   lowerCurve:   curve below the temperature
+ * @param   upperCurve:   curve above the temperature
+ * @param   temperature:  cell temperature in &deg;C
+ *
+ * @return  weight of upperCurve, 0.0 at the temperature of lowerCurve, 1.0 at the one of upperCurve
+ */
+static float SOC_GetTemperatureWeight(uint8_t lowerCurve, uint8_t upperCurve, float temperature) {
+    return MATH_linearInterpolation(soc_ocv_temperatures[lowerCurve], 0.0f,
+            soc_ocv_temperatures[upperCurve], 1.0f, temperature);
 }
 
 
@@ -57,6 +57,11 @@
 #include "sox_cfg.h"
 
 /*================== Macros and Definitions ===============================*/
+/**
+ * number of voltage intervals of the index over an OCV curve
+ */
+#define SOC_OCV_INDEX_LENGTH    64
+
 /**
  * This structure contains all the variables relevant for the SOX.
  *
@@ -118,6 +123,43 @@ typedef struct {
     float Offset_VoltageCharge;
 }SOF_curve_s;
 
+/**
+ * index over the range of the ascending breakpoints of an OCV curve, i.e. its
+ * voltages or its SOC points. The range from the first to the last breakpoint is
+ * split into SOC_OCV_INDEX_LENGTH intervals of equal length, segment[i] is the
+ * curve segment that contains the lower end of interval i. A value is thus found
+ * in the curve in constant time.
+ */
+typedef struct {
+    float start;                            /*!< first breakpoint                                   */
+    float invstep;                          /*!< inverse of the length of an interval               */
+    uint8_t segment[SOC_OCV_INDEX_LENGTH];  /*!< curve segment at the lower end of each interval    */
+} SOC_OCV_INDEX_s;
+
+/**
+ * Coulomb counter of the measured current, integrated with the trapezoidal rule
+ */
+typedef struct {
+    int64_t charge;             /*!< twice the integral of the current in mA.ms         */
+    int32_t current;            /*!< last current measurement in mA                     */
+    uint32_t timestamp;         /*!< time of the last current measurement in ms         */
+    uint32_t gaps;              /*!< number of gaps between two current measurements    */
+    uint8_t started;            /*!< TRUE after the first current measurement           */
+} SOC_COULOMB_COUNTER_s;
+
+/**
+ * result and runtime of the SOC estimation of the cells
+ */
+typedef struct {
+    float soc_min;              /*!< minimum cell SOC in %                                  */
+    float soc_max;              /*!< maximum cell SOC in %                                  */
+    uint16_t cell_min;          /*!< number of the cell with the minimum SOC                */
+    uint16_t cell_max;          /*!< number of the cell with the maximum SOC                */
+    uint32_t updates;           /*!< number of estimation steps since startup               */
+    uint32_t cycles_last;       /*!< CPU cycles of the last estimation step                 */
+    uint32_t cycles_max;        /*!< maximum CPU cycles of an estimation step               */
+} SOC_CELL_ESTIMATION_s;
+
 /*================== Constant and Variable Definitions ====================*/
 
 
@@ -152,6 +194,71 @@ extern void SOC_SetValue(float soc_value_min, float soc_value_max, float soc_val
  */
 extern void SOC_Set_Lookup_Table(void);
 
+/**
+ * @brief   gets the SOC of a cell at rest from its voltage
+ *
+ * The SOC is interpolated in the OCV curves of batterycell_cfg.h and, between
+ * the curves, linearly in the temperature. Voltages and temperatures outside of
+ * the curves are limited to them.
+ *
+ * @param   voltage:      cell voltage in mV
+ * @param   temperature:  cell temperature in &deg;C
+ *
+ * @return  SOC in % (0.0 to 100.0)
+ */
+extern float SOC_GetFromVoltage(float voltage, float temperature);
+
+/**
+ * @brief   gets the SOC of several cells at rest from their voltages
+ *
+ * Same as SOC_GetFromVoltage() for all cells at one temperature, the OCV curves
+ * are selected only once.
+ *
+ * @param   voltage:      cell voltages in mV
+ * @param   temperature:  cell temperature in &deg;C
+ * @param   soc:          SOC of the cells in % (0.0 to 100.0)
+ * @param   nrOfCells:    number of cells
+ */
+extern void SOC_GetFromVoltageBatch(const uint16_t voltage[], float temperature, float soc[], uint16_t nrOfCells);
+
+/**
+ * @brief   estimates the SOC of the next cells with the last cell voltage measurement
+ *
+ * Extended Kalman filter with the state SOC and voltage over the RC element per cell.
+ * A pass over all cells starts with a new cell voltage measurement, the current and
+ * the OCV curve at the mean cell temperature are then prepared once for all cells.
+ * Every call continues the pass with the next cells, so that the pass can be spread
+ * over several calls. Cells with a PEC error are only predicted. The result is
+ * published when the pass is finished. Only available if SOX_CELL_SOC_ESTIMATION is TRUE.
+ *
+ * @param   nrOfCells:  maximum number of cells to estimate, 0 for all remaining cells
+ *
+ * @return  TRUE if the pass is finished or no new cell voltages were measured, FALSE if cells are left
+ */
+extern uint8_t SOC_EstimateCellsStep(uint16_t nrOfCells);
+
+/**
+ * @brief   gets the result and the runtime of the SOC estimation of the cells
+ *
+ * @param   estimation:  copy of the result of the last estimation step
+ *
+ * @return  E_OK if the estimation is enabled and has made a step, otherwise E_NOT_OK
+ */
+extern STD_RETURN_TYPE_e SOC_GetCellEstimation(SOC_CELL_ESTIMATION_s *estimation);
+
+/**
+ * @brief   integrates a new current measurement into the Coulomb counter
+ *
+ * To be called for every current measurement. The charge since the last measurement
+ * is integrated with the trapezoidal rule in integer arithmetic, so that no charge
+ * is lost by rounding, regardless of the uptime. A time of more than
+ * SOX_CC_MAX_SAMPLE_GAP_MS between two measurements is counted as gap.
+ *
+ * @param   current:    measured current in mA
+ * @param   timestamp:  time of the measurement in ms
+ */
+extern void SOC_IntegrateCurrent(int32_t current, uint32_t timestamp);
+
 /**
  * @brief   integrates current over time to calculate SOC.
  */
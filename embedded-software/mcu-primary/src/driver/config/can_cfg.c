@@ -55,11 +55,18 @@
 
 /*================== Includes =============================================*/
 #include "can_cfg.h"
-#include "rcc_cfg.h"
+
+#include "batterysystem_cfg.h"
+#include "cansignal_gen_cfg.h"
 #include "mcu.h"
+#include "rcc_cfg.h"
 
 /*================== Macros and Definitions ===============================*/
 
+#if CANS_GEN_NR_OF_MODULES != BS_NR_OF_MODULES
+#error "cansignal_gen_cfg.h was generated for another number of modules than BS_NR_OF_MODULES, run tools/dbc/cansignal_gen.py again!"
+#endif
+
 /*================== Constant and Variable Definitions ====================*/
 
 /*================== Function Prototypes ==================================*/
@@ -340,89 +347,12 @@ const CAN_MSG_TX_TYPE_s can_CAN0_messages_tx[] = {
         { 0x1E2, 8, 1000, 40, NULL_PTR },  /*!< Running average current 2 */
 
         { 0x1F0, 8, 1000, 40, NULL_PTR },  /*!< Pack voltage */
+        { 0x1B0, 8, 1000, 40, NULL_PTR },  /*!< CAN bus statistics */
 
-        { 0x200, 8, 200, 20, NULL_PTR },  /*!< Cell voltages module 0 cells 0 1 2 */
-        { 0x201, 8, 200, 20, NULL_PTR },  /*!< Cell voltages module 0 cells 3 4 5 */
-        { 0x202, 8, 200, 20, NULL_PTR },  /*!< Cell voltages module 0 cells 6 7 8 */
-        { 0x203, 8, 200, 20, NULL_PTR },  /*!< Cell voltages module 0 cells 9 10 11 */
-
-        { 0x210, 8, 200, 30, NULL_PTR },  /*!< Cell temperatures module 0 cells 0 1 2 */
-        { 0x211, 8, 200, 30, NULL_PTR },  /*!< Cell temperatures module 0 cells 3 4 5 */
-        { 0x212, 8, 200, 30, NULL_PTR },  /*!< Cell temperatures module 0 cells 6 7 8 */
-        { 0x213, 8, 200, 30, NULL_PTR },  /*!< Cell temperatures module 0 cells 9 10 11 */
-
-        { 0x220, 8, 200, 40, NULL_PTR },  /*!< Cell voltages module 1 cells 0 1 2 */
-        { 0x221, 8, 200, 40, NULL_PTR },  /*!< Cell voltages module 1 cells 3 4 5 */
-        { 0x222, 8, 200, 40, NULL_PTR },  /*!< Cell voltages module 1 cells 6 7 8 */
-        { 0x223, 8, 200, 40, NULL_PTR },  /*!< Cell voltages module 1 cells 9 10 11 */
-
-        { 0x230, 8, 200, 50, NULL_PTR },  /*!< Cell temperatures module 1 cells 0 1 2 */
-        { 0x231, 8, 200, 50, NULL_PTR },  /*!< Cell temperatures module 1 cells 3 4 5 */
-        { 0x232, 8, 200, 50, NULL_PTR },  /*!< Cell temperatures module 1 cells 6 7 8 */
-        { 0x233, 8, 200, 50, NULL_PTR },  /*!< Cell temperatures module 1 cells 9 10 11 */
-
-        { 0x240, 8, 200, 60, NULL_PTR },  /*!< Cell voltages module 2 cells 0 1 2 */
-        { 0x241, 8, 200, 60, NULL_PTR },  /*!< Cell voltages module 2 cells 3 4 5 */
-        { 0x242, 8, 200, 60, NULL_PTR },  /*!< Cell voltages module 2 cells 6 7 8 */
-        { 0x243, 8, 200, 60, NULL_PTR },  /*!< Cell voltages module 2 cells 9 10 11 */
-
-        { 0x250, 8, 200, 70, NULL_PTR },  /*!< Cell temperatures module 2 cells 0 1 2 */
-        { 0x251, 8, 200, 70, NULL_PTR },  /*!< Cell temperatures module 2 cells 3 4 5 */
-        { 0x252, 8, 200, 70, NULL_PTR },  /*!< Cell temperatures module 2 cells 6 7 8 */
-        { 0x253, 8, 200, 70, NULL_PTR },  /*!< Cell temperatures module 2 cells 9 10 11 */
-
-        { 0x260, 8, 200, 80, NULL_PTR },  /*!< Cell voltages module 3 cells 0 1 2 */
-        { 0x261, 8, 200, 80, NULL_PTR },  /*!< Cell voltages module 3 cells 3 4 5 */
-        { 0x262, 8, 200, 80, NULL_PTR },  /*!< Cell voltages module 3 cells 6 7 8 */
-        { 0x263, 8, 200, 80, NULL_PTR },  /*!< Cell voltages module 3 cells 9 10 11 */
-
-        { 0x270, 8, 200, 90, NULL_PTR },  /*!< Cell temperatures module 3 cells 0 1 2 */
-        { 0x271, 8, 200, 90, NULL_PTR },  /*!< Cell temperatures module 3 cells 3 4 5 */
-        { 0x272, 8, 200, 90, NULL_PTR },  /*!< Cell temperatures module 3 cells 6 7 8 */
-        { 0x273, 8, 200, 90, NULL_PTR },  /*!< Cell temperatures module 3 cells 9 10 11 */
-
-        { 0x280, 8, 200, 100, NULL_PTR },  /*!< Cell voltages module 4 cells 0 1 2 */
-        { 0x281, 8, 200, 100, NULL_PTR },  /*!< Cell voltages module 4 cells 3 4 5 */
-        { 0x282, 8, 200, 100, NULL_PTR },  /*!< Cell voltages module 4 cells 6 7 8 */
-        { 0x283, 8, 200, 100, NULL_PTR },  /*!< Cell voltages module 4 cells 9 10 11 */
-
-        { 0x290, 8, 200, 110, NULL_PTR },  /*!< Cell temperatures module 4 cells 0 1 2 */
-        { 0x291, 8, 200, 110, NULL_PTR },  /*!< Cell temperatures module 4 cells 3 4 5 */
-        { 0x292, 8, 200, 110, NULL_PTR },  /*!< Cell temperatures module 4 cells 6 7 8 */
-        { 0x293, 8, 200, 110, NULL_PTR },  /*!< Cell temperatures module 4 cells 9 10 11 */
-
-        { 0x2A0, 8, 200, 120, NULL_PTR },  /*!< Cell voltages module 5 cells 0 1 2 */
-        { 0x2A1, 8, 200, 120, NULL_PTR },  /*!< Cell voltages module 5 cells 3 4 5 */
-        { 0x2A2, 8, 200, 120, NULL_PTR },  /*!< Cell voltages module 5 cells 6 7 8 */
-        { 0x2A3, 8, 200, 120, NULL_PTR },  /*!< Cell voltages module 5 cells 9 10 11 */
-
-        { 0x2B0, 8, 200, 130, NULL_PTR },  /*!< Cell temperatures module 5 cells 0 1 2 */
-        { 0x2B1, 8, 200, 130, NULL_PTR },  /*!< Cell temperatures module 5 cells 3 4 5 */
-        { 0x2B2, 8, 200, 130, NULL_PTR },  /*!< Cell temperatures module 5 cells 6 7 8 */
-        { 0x2B3, 8, 200, 130, NULL_PTR },  /*!< Cell temperatures module 5 cells 9 10 11 */
-
-        { 0x2C0, 8, 200, 140, NULL_PTR },  /*!< Cell voltages module 6 cells 0 1 2 */
-        { 0x2C1, 8, 200, 140, NULL_PTR },  /*!< Cell voltages module 6 cells 3 4 5 */
-        { 0x2C2, 8, 200, 140, NULL_PTR },  /*!< Cell voltages module 6 cells 6 7 8 */
-        { 0x2C3, 8, 200, 140, NULL_PTR },  /*!< Cell voltages module 6 cells 9 10 11 */
-
-        { 0x2D0, 8, 200, 150, NULL_PTR },  /*!< Cell temperatures module 6 cells 0 1 2 */
-        { 0x2D1, 8, 200, 150, NULL_PTR },  /*!< Cell temperatures module 6 cells 3 4 5 */
-        { 0x2D2, 8, 200, 150, NULL_PTR },  /*!< Cell temperatures module 6 cells 6 7 8 */
-        { 0x2D3, 8, 200, 150, NULL_PTR },  /*!< Cell temperatures module 6 cells 9 10 11 */
-
-        { 0x2E0, 8, 200, 160, NULL_PTR },  /*!< Cell voltages module 7 cells 0 1 2 */
-        { 0x2E1, 8, 200, 160, NULL_PTR },  /*!< Cell voltages module 7 cells 3 4 5 */
-        { 0x2E2, 8, 200, 160, NULL_PTR },  /*!< Cell voltages module 7 cells 6 7 8 */
-        { 0x2E3, 8, 200, 160, NULL_PTR },  /*!< Cell voltages module 7 cells 9 10 11 */
-
-        { 0x2F0, 8, 200, 170, NULL_PTR },  /*!< Cell temperatures module 7 cells 0 1 2 */
-        { 0x2F1, 8, 200, 170, NULL_PTR },  /*!< Cell temperatures module 7 cells 3 4 5 */
-        { 0x2F2, 8, 200, 170, NULL_PTR },  /*!< Cell temperatures module 7 cells 6 7 8 */
-        { 0x2F3, 8, 200, 170, NULL_PTR },  /*!< Cell temperatures module 7 cells 9 10 11 */
+        CANS_GEN_CAN0_CELL_MESSAGES_TX_CFG(200)  /* cell voltages and temperatures of all modules */
 
 #ifdef CAN_ISABELLENHUETTE_TRIGGERED
-        , { 0x35B, 8, 100, 20, NULL_PTR }  /*!< Current Sensor Trigger */
+        { 0x35B, 8, 100, 20, NULL_PTR },  /*!< Current Sensor Trigger */
 #endif
 };
 #endif // ITRI_MOD_5
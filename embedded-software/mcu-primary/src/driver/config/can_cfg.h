@@ -271,6 +271,32 @@
 */
 #define CAN1_BUFFER_BYPASS_NUMBER_OF_IDs 0
 
+/* Received messages are dispatched by a binary search over a table of the
+ * configured receive IDs, which is sorted in CAN_Init(). */
+/**
+ * @ingroup CONFIG_CAN
+ * Defines the maximum number of RX messages in can0_RxMsgs[] that can be looked up
+ * \par Type:
+ * int
+ * \par Range:
+ * can_CAN0_rx_length <= x <= 255
+ * \par Default:
+ * 32
+*/
+#define CAN0_RX_LOOKUP_LENGTH            32
+
+/**
+ * @ingroup CONFIG_CAN
+ * Defines the maximum number of RX messages in can1_RxMsgs[] that can be looked up
+ * \par Type:
+ * int
+ * \par Range:
+ * can_CAN1_rx_length <= x <= 255
+ * \par Default:
+ * 32
+*/
+#define CAN1_RX_LOOKUP_LENGTH            32
+
 /**
  * @ingroup CONFIG_CAN
  * defines if the Isabellenhuette current sensor is used in cyclic or triggered mode
@@ -301,6 +327,19 @@
 /* #define CAN_SW_RESET_WITH_DEVICE_ID        1 */
 #define CAN_SW_RESET_WITH_DEVICE_ID        0
 
+/**
+ * @ingroup CONFIG_CAN
+ * When TRUE, the cell voltages are transmitted in the multiplexed message 0x1F8 instead of
+ * the cell voltage messages of each module. Every frame holds the multiplexer byte and four
+ * 13 bit cell voltages, three frames per module (see tools/dbc/cansignal_gen.yml).
+ * \par Type:
+ * toggle
+ * \par Default:
+ * FALSE
+*/
+/* #define CAN_CELLVOLT_MULTIPLEXED        TRUE */
+#define CAN_CELLVOLT_MULTIPLEXED        FALSE
+
 
 /* Hardware settings*/
 /**
@@ -345,6 +384,7 @@ typedef struct CanPdu {
     uint8_t sdu[8];
     uint32_t id;
     uint8_t dlc;
+    uint32_t timestamp;     /*!< OS tick in ms at the reception of the message */
 } Can_PduType;
 
 
@@ -185,6 +185,11 @@ DATA_BLOCK_ALLGPIOVOLTAGE_s data_block_ltc_allgpiovoltages[DOUBLE_BUFFERING];
  */
 DATA_BLOCK_CONT_SOH_s data_block_contactor_soh[DOUBLE_BUFFERING];
 
+/**
+ * data block: runtime statistics of the algo module
+ */
+DATA_BLOCK_ALGO_STATISTICS_s data_block_algo_statistics[SINGLE_BUFFERING];
+
 /**
  * @brief channel configuration of database (data blocks)
  *
@@ -317,6 +322,11 @@ DATA_BASE_HEADER_s  data_base_header[] = {
             sizeof(DATA_BLOCK_CONT_SOH_s),
             DOUBLE_BUFFERING,
     },
+    {
+            (void*)(&data_block_algo_statistics[0]),
+            sizeof(DATA_BLOCK_ALGO_STATISTICS_s),
+            SINGLE_BUFFERING,
+    },
 };
 
 /**
@@ -67,7 +67,33 @@
  *
  * this value is extendible but limitation is done due to RAM consumption and performance
  */
-#define DATA_MAX_BLOCK_NR                25        /* max 25 Blocks currently supported*/
+#define DATA_MAX_BLOCK_NR                26        /* max 26 Blocks currently supported*/
+
+/**
+ * @brief enables the access statistics of the database
+ *
+ * If enabled, the database records for every data block the latency of
+ * read and write accesses, dropped writes and contention between accesses.
+ * The statistics can be printed with the command "printdbstats".
+ */
+#define DATA_ENABLE_ACCESS_STATISTICS       1
+/* #define DATA_ENABLE_ACCESS_STATISTICS       0 */
+
+/**
+ * @brief number of bins of the access latency histogram
+ *
+ * bin i counts the accesses that took i OS ticks, the last bin counts all
+ * accesses that took longer
+ */
+#define DATA_LATENCY_HISTOGRAM_BINS         16
+
+/**
+ * @brief maximum number of subscriptions to data blocks
+ *
+ * A subscribed task gets a task notification whenever new data of the data
+ * block is stored, see DATA_Subscribe()
+ */
+#define DATA_MAX_SUBSCRIPTIONS              8
 
 /**
  * @brief data block identification number
@@ -98,6 +124,7 @@ typedef enum {
     DATA_BLOCK_22       = 22,
     DATA_BLOCK_23       = 23,
     DATA_BLOCK_24       = 24,
+    DATA_BLOCK_25       = 25,
     DATA_BLOCK_MAX      = DATA_MAX_BLOCK_NR,
 } DATA_BLOCK_ID_TYPE_e;
 
@@ -170,6 +197,7 @@ typedef struct {
 #define     DATA_BLOCK_ID_SOF                           DATA_BLOCK_22
 #define     DATA_BLOCK_ID_ALLGPIOVOLTAGE                DATA_BLOCK_23
 #define     DATA_BLOCK_ID_CONT_SOH                       DATA_BLOCK_24
+#define     DATA_BLOCK_ID_ALGO_STATISTICS               DATA_BLOCK_25
 
 /**
  * data block struct of cell voltage
@@ -182,6 +210,8 @@ typedef struct {
     uint32_t valid_voltPECs[BS_NR_OF_MODULES];  /*!< bitmask if PEC was okay. 0->ok, 1->error   */
     uint32_t sumOfCells[BS_NR_OF_MODULES];      /*!< unit: mV                                   */
     uint8_t valid_socPECs[BS_NR_OF_MODULES];   /*!< 0 -> if PEC okay; 1 -> PEC error           */
+    uint16_t voltage_min;                       /*!< unit: mV, minimum of voltage[]             */
+    uint16_t voltage_min_index;                 /*!< index of voltage_min in voltage[]          */
     uint8_t state;                              /*!< for future use                             */
 } DATA_BLOCK_CELLVOLTAGE_s;
 
@@ -218,6 +248,8 @@ typedef struct {
     float soc_mean;                     /*!< 0.0 <= soc_mean <= 100.0           */
     float soc_min;                      /*!< 0.0 <= soc_min <= 100.0            */
     float soc_max;                      /*!< 0.0 <= soc_max <= 100.0            */
+    int64_t charge_counter;             /*!< unit: mA.ms, integral of the current since startup */
+    uint32_t charge_counter_gaps;       /*!< number of gaps between two current measurements    */
     uint8_t state;                      /*!<                                    */
 } DATA_BLOCK_SOX_s;
 
@@ -375,6 +407,11 @@ typedef struct {
     int16_t temperature_max;
     uint16_t temperature_module_number_max;
     uint16_t temperature_sensor_number_max;
+    uint32_t voltage_module_sum[BS_NR_OF_MODULES];          /*!< sum of the cell voltages of each module in mV  */
+    uint16_t voltage_module_min[BS_NR_OF_MODULES];          /*!< minimum cell voltage of each module in mV      */
+    uint16_t voltage_module_max[BS_NR_OF_MODULES];          /*!< maximum cell voltage of each module in mV      */
+    int16_t temperature_module_min[BS_NR_OF_MODULES];       /*!< minimum temperature of each module             */
+    int16_t temperature_module_max[BS_NR_OF_MODULES];       /*!< maximum temperature of each module             */
     uint8_t state;
 } DATA_BLOCK_MINMAX_s;
 
@@ -565,6 +602,7 @@ typedef struct {
     uint32_t timestamp;                                                       /*!< timestamp of database entry                */
     uint32_t previous_timestamp;                                              /*!< timestamp of last database entry           */
     uint16_t gpiovoltage[BS_NR_OF_MODULES * BS_NR_OF_GPIOS_PER_MODULE];       /*!< unit: mV                                   */
+    uint16_t valid_gpioPECs[BS_NR_OF_MODULES];                                /*!< bitmask if PEC was okay. 0->ok, 1->error   */
     uint8_t state;                                                            /*!< for future use                             */
 #if defined(ITRI_MOD_2)
     uint16_t gpio_ref_vol[BS_NR_OF_MODULES];
@@ -581,6 +619,39 @@ typedef struct {
     float contactor_soh[BS_NR_OF_CONTACTORS];  /*!< SOH of contactors */
 } DATA_BLOCK_CONT_SOH_s;
 
+/**
+ * maximum number of algorithms of the algo module, every algorithm in
+ * algo_algorithms[] has runtime statistics (checked at compile time in algo_cfg.c)
+ */
+#define DATA_MAX_ALGO_STATISTICS        4
+
+/**
+ * runtime statistics of an algorithm of the algo module
+ */
+typedef struct {
+    uint32_t runs;              /*!< number of finished runs                                        */
+    uint32_t steps;             /*!< number of steps, a run takes one or more steps                 */
+    uint32_t carryovers;        /*!< number of steps after which work was left for the next tick    */
+    uint32_t deferrals;         /*!< number of ticks the algorithm waited for the tick budget       */
+    uint32_t overruns;          /*!< number of steps longer than the step budget                    */
+    uint32_t step_last_us;      /*!< runtime of the last step                                       */
+    uint32_t step_max_us;       /*!< maximum runtime of a step                                      */
+    uint32_t run_last_us;       /*!< summed runtime of the steps of the last run                    */
+    uint32_t run_max_us;        /*!< maximum summed runtime of the steps of a run                   */
+} DATA_ALGO_RUNTIME_s;
+
+/**
+ * data block struct of the runtime statistics of the algo module
+ */
+typedef struct {
+    /* Timestamp info needs to be at the beginning. Automatically written on DB_WriteBlock */
+    uint32_t timestamp;                                     /*!< timestamp of database entry        */
+    uint32_t previous_timestamp;                            /*!< timestamp of last database entry   */
+    uint32_t tick_last_us;                                  /*!< runtime of all steps of the last tick  */
+    uint32_t tick_max_us;                                   /*!< maximum runtime of all steps of a tick */
+    DATA_ALGO_RUNTIME_s algorithm[DATA_MAX_ALGO_STATISTICS];   /*!< statistics in the order of algo_algorithms[] */
+} DATA_BLOCK_ALGO_STATISTICS_s;
+
 /*================== Constant and Variable Definitions ====================*/
 
 /**
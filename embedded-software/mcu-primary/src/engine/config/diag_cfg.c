@@ -785,6 +785,7 @@ DIAG_CH_CFG_s  diag_ch_cfg[] = {
     {DIAG_CH_CAN_TIMING,                                "CAN_TIMING",                           DIAG_GENERAL_TYPE, DIAG_ERROR_CAN_TIMING_SENSITIVITY,        DIAG_RECORDING_ENABLED, DIAG_CAN_TIMING, DIAG_error_cantiming},
     {DIAG_CH_CAN_CC_RESPONDING,                         "CAN_CC_RESPONDING",                    DIAG_GENERAL_TYPE, DIAG_ERROR_CAN_TIMING_CC_SENSITIVITY,     DIAG_RECORDING_ENABLED, DIAG_CAN_SENSOR_PRESENT, DIAG_error_cantiming_cc},
     {DIAG_CH_CURRENT_SENSOR_RESPONDING,                 "CURRENT_SENSOR_RESPONDING",            DIAG_GENERAL_TYPE, DIAG_ERROR_CAN_SENSOR_SENSITIVITY,        DIAG_RECORDING_ENABLED, DIAG_CAN_SENSOR_PRESENT, DIAG_error_cancurrentsensor},
+    {DIAG_CH_CAN_RX_OVERFLOW,                           "CAN_RX_OVERFLOW",                      DIAG_GENERAL_TYPE, DIAG_ERROR_CAN_RX_OVERFLOW_SENSITIVITY,   DIAG_RECORDING_ENABLED, DIAG_ENABLED, dummyfu},
 
 #if BUILD_MODULE_ENABLE_CONTACTOR == 1
     /* Contactor Damage Error */
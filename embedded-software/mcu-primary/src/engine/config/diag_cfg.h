@@ -91,6 +91,7 @@
 #define DIAG_ERROR_CAN_TIMING_SENSITIVITY       (100)
 #define DIAG_ERROR_CAN_TIMING_CC_SENSITIVITY    (100)
 #define DIAG_ERROR_CAN_SENSOR_SENSITIVITY       (100)
+#define DIAG_ERROR_CAN_RX_OVERFLOW_SENSITIVITY  (0)
 
 #define DIAG_ERROR_MAIN_PLUS_SENSITIVITY        (50)
 #define DIAG_ERROR_MAIN_MINUS_SENSITIVITY       (50)
@@ -227,6 +228,10 @@
  *  Current sensor not responding anymore
  */
 #define DIAG_CH_CURRENT_SENSOR_RESPONDING                  DIAG_ID_68
+/**
+ *  CAN receive buffer full, received messages have been dropped
+ */
+#define DIAG_CH_CAN_RX_OVERFLOW                            DIAG_ID_93
 
 
 /* Contactor events: 64-79*/
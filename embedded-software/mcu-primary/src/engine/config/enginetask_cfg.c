@@ -79,6 +79,7 @@ OS_Task_Definition_s eng_tskdef_cyclic_10ms  = { 2,     10,  OS_PRIORITY_HIGH,
 OS_Task_Definition_s eng_tskdef_cyclic_100ms = { 56,    100,  OS_PRIORITY_ABOVE_NORMAL,     1024/4 };
 OS_Task_Definition_s eng_tskdef_eventhandler = { 0,      1,  OS_PRIORITY_VERY_HIGH,         1024/4 };
 OS_Task_Definition_s eng_tskdef_diagnosis    = { 0,      1,  OS_PRIORITY_BELOW_REALTIME,    1024/4 };
+OS_Task_Definition_s eng_tskdef_ltc          = { 0,      1,  OS_PRIORITY_ABOVE_HIGH,        1024/4 };
 
 /*================== Function Prototypes ==================================*/
 
@@ -104,6 +105,7 @@ void ENG_PostOSInit(void) {
     if (retErrorCode != 0) {
         DIAG_Handler(DIAG_CH_CAN_INIT_FAILURE, DIAG_EVENT_NOK, retErrorCode, NULL);   /* error event in eeprom driver */
     }
+    CANS_Init();
 
     os_boot = OS_EEPR_INIT;
 
@@ -193,7 +195,9 @@ void ENG_Init(void) {
 
 void ENG_Cyclic_1ms(void) {
     MEAS_Ctrl();
+#if LTC_EVENT_DRIVEN_SCHEDULING == FALSE
     LTC_Trigger();
+#endif
     EEPR_Trigger();
 }
 
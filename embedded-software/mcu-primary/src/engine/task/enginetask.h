@@ -149,6 +149,17 @@ extern void ENG_TSK_EventHandler(void);
  */
 extern void ENG_TSK_Diagnosis(void);
 
+/**
+ * @brief   event driven LTC task.
+ *
+ * @details Only created with LTC_EVENT_DRIVEN_SCHEDULING. The task runs the LTC
+ *          state machine and blocks in LTC_WaitForEvent() until the next SPI
+ *          transmission has finished or the waiting time of the state machine
+ *          has elapsed.
+ *
+ */
+extern void ENG_TSK_LTC(void);
+
 /*================== Function Implementations =============================*/
 
 #endif /* ENGINETASK_H_ */
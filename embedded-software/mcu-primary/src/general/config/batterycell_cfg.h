@@ -235,6 +235,43 @@
  * @group
  */
 #define BC_CAPACITY 3500
+
+/**
+ * @ingroup CONFIG_BATTERYCELL
+ * open circuit voltage (OCV) curves of the cell, used to derive the SOC from
+ * the cell voltage at rest. Every curve gives the OCV at the SOC breakpoints
+ * BC_OCV_SOC_POINTS for one of the temperatures BC_OCV_TEMPERATURES. The
+ * voltages of a curve must rise strictly with the SOC, the temperatures must
+ * be in ascending order.
+ * \par Type:
+ * float (temperature, SOC), int (voltage)
+ * \par Unit:
+ * &deg;C, %, mV
+*/
+#define BC_OCV_NR_OF_TEMPERATURES   3
+#define BC_OCV_NR_OF_SOC_POINTS     21
+
+#define BC_OCV_TEMPERATURES     { -10.0f, 25.0f, 45.0f }
+
+#define BC_OCV_SOC_POINTS       {   0.0f,   5.0f,  10.0f,  15.0f,  20.0f,  25.0f,  30.0f,  35.0f,  40.0f,  45.0f, \
+                                   50.0f,  55.0f,  60.0f,  65.0f,  70.0f,  75.0f,  80.0f,  85.0f,  90.0f,  95.0f, \
+                                  100.0f }
+
+#if defined(ITRI_MOD_13)
+/* NMC cell */
+#define BC_OCV_CURVES   { \
+    { 2975, 3276, 3397, 3478, 3529, 3565, 3591, 3612, 3633, 3659, 3685, 3721, 3762, 3803, 3844, 3890, 3936, 3987, 4038, 4094, 4175 }, \
+    { 3000, 3300, 3420, 3500, 3550, 3585, 3610, 3630, 3650, 3675, 3700, 3735, 3775, 3815, 3855, 3900, 3945, 3995, 4045, 4100, 4180 }, \
+    { 3010, 3310, 3429, 3509, 3558, 3593, 3618, 3637, 3657, 3681, 3706, 3741, 3780, 3820, 3859, 3904, 3949, 3998, 4048, 4102, 4182 }, \
+}
+#else
+/* LTO cell */
+#define BC_OCV_CURVES   { \
+    { 1775, 2056, 2137, 2178, 2204, 2225, 2241, 2257, 2273, 2289, 2305, 2321, 2337, 2353, 2374, 2395, 2421, 2452, 2493, 2554, 2695 }, \
+    { 1800, 2080, 2160, 2200, 2225, 2245, 2260, 2275, 2290, 2305, 2320, 2335, 2350, 2365, 2385, 2405, 2430, 2460, 2500, 2560, 2700 }, \
+    { 1810, 2090, 2169, 2209, 2233, 2253, 2268, 2282, 2297, 2311, 2326, 2341, 2355, 2370, 2389, 2409, 2434, 2463, 2503, 2562, 2702 }, \
+}
+#endif
 #endif
 
 #endif /* BATTERYCELL_CFG_H_ */
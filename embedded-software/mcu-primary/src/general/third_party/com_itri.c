@@ -105,9 +105,20 @@ uint32_t rb_cmd_cur_cali(char* params) {
 #endif
 
 #if defined(ITRI_MOD_11)
-extern void cans_send_heartbeat_pulse();
+#include "cansignal.h"
 uint32_t rb_cmd_send_heartbeat_pulse(char* params) {
-	cans_send_heartbeat_pulse();
+	CANS_ReceiveHeartbeat(CANS_HEARTBEAT_EBM_CONTROLLER);
+	return 0;
+}
+
+uint32_t rb_cmd_get_heartbeat(char* params) {
+	CANS_HEARTBEAT_s heartbeat;
+
+	if (CANS_GetHeartbeat(CANS_HEARTBEAT_EBM_CONTROLLER, &heartbeat) == E_OK) {
+		DEBUG_PRINTF(("alive=%u heartbeats=%lu timeouts=%lu interval last/min/max=%lu/%lu/%lu ms\r\n",
+				heartbeat.alive, heartbeat.nr_of_heartbeats, heartbeat.nr_of_timeouts,
+				heartbeat.interval_last, heartbeat.interval_min, heartbeat.interval_max));
+	}
 	return 0;
 }
 #endif
@@ -143,6 +154,7 @@ RB_CMD_s rb_cmds[] = {
 #endif
 #if defined(ITRI_MOD_11)
 	{"send_heartbeat_pulse",				"test heartbeat func.",					&rb_cmd_send_heartbeat_pulse},
+	{"get_heartbeat",						"heartbeat statistics",					&rb_cmd_get_heartbeat},
 #endif
 #if defined(ITRI_MOD_13)
 	{"is_all_disabled",						"test is_all_disabled func.",			&rb_cmd_is_all_disabled},
@@ -184,10 +196,4 @@ uint8_t COM_ThirdParty_Decoder(char* com_receivedbyte)
 
 	return 1;
 }
-
-double COM_GetTimeStamp()
-{
-	return (double)os_timer.Timer_d*24.0*3600.0 + (double)os_timer.Timer_h*3600.0 + (double)os_timer.Timer_min*60.0 + (double)os_timer.Timer_sec +
-		   (double)os_timer.Timer_100ms*0.1 + (double)os_timer.Timer_10ms*0.01 + (double)os_timer.Timer_1ms*0.001;
-}
 #endif // ITRI_MOD
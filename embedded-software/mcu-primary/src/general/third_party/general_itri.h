@@ -31,10 +31,6 @@
 	// public functions
 	extern char* float_to_string(double v);
 
-#if defined(ITRI_MOD_6)
-	extern double COM_GetTimeStamp();
-#endif
-
 #endif // ITRI_MOD
 
 
@@ -54,6 +54,7 @@
 #include "cansignal_cfg.h"
 
 #include "bal.h"
+#include "cansignal.h"
 #include "database.h"
 #include "sox.h"
 #include "sys.h"
@@ -68,20 +69,28 @@
 static float cans_checkLimits(float value, uint32_t sigIdx);
 
 /* TX/Getter functions */
-static uint32_t cans_getvolt(uint32_t, void *);
 static uint32_t cans_gettempering(uint32_t, void *);
 static uint32_t cans_getcanerr(uint32_t, void *);
-static uint32_t cans_gettemp(uint32_t, void *);
 static uint32_t cans_getsoc(uint32_t, void *);
 static uint32_t cans_getRecommendedOperatingCurrent(uint32_t, void *);
 static uint32_t cans_getMaxAllowedPower(uint32_t, void *);
 static uint32_t cans_getpower(uint32_t, void *);
 static uint32_t cans_getcurr(uint32_t, void *);
 static uint32_t cans_getPackVoltage(uint32_t, void *);
+static uint32_t cans_getcanbusstatistics(uint32_t, void *);
 static uint32_t cans_getminmaxvolt(uint32_t, void *);
 static uint32_t cans_getminmaxtemp(uint32_t, void *);
 static uint32_t cans_getisoguard(uint32_t, void *);
 
+static uint32_t cans_readcellvoltages(uint32_t modIdx, uint32_t firstCell, uint32_t nrOfValues, uint16_t voltage[]);
+static uint64_t cans_composecellvolt(uint32_t modIdx, uint32_t message);
+#if CAN_CELLVOLT_MULTIPLEXED == TRUE
+static uint64_t cans_composecellvoltmux(uint32_t mux);
+#endif
+static uint64_t cans_composecelltemp(uint32_t modIdx, uint32_t message);
+#if CANS_TX_ON_DELTA == TRUE
+static uint8_t cans_celldata_changed(CANS_messagesTx_e msgIdx, uint64_t lastData, uint64_t data);
+#endif
 
 /* RX/Setter functions */
 static uint32_t cans_setcurr(uint32_t, void *);
@@ -95,13 +104,9 @@ static uint32_t cans_gettriggercurrent(uint32_t sigIdx, void *value);
 #endif
 
 #if defined(ITRI_MOD_11)
-#define HEARTBEAT_MAX_WAIT_TIME	(2.1)		// unit: second
-typedef struct {
-	uint8_t		is_connect_can_dev;
-	uint32_t	timestamp;
-} CAN_HEARTBEAT_s;
-static CAN_HEARTBEAT_s cans_heartbeat = {0, 0};
-static uint32_t can_heartbeat_max_diff = 0;	// for debug
+#define HEARTBEAT_MAX_WAIT_TIME_MS	(2100)
+
+static void cans_heartbeat_lost(CANS_heartbeatPeer_e peer);
 
 #if defined(ITRI_MOD_13)
 extern uint8_t LTC_ThirdParty_is_all_disabled();
@@ -128,35 +133,15 @@ void cans_ebm_all_disable() {
 	LTC_ThirdParty_Set_Get_Property("set_ebm_eb_col_state", (void*)configBuf, (void*)colConfigBuf, NULL, NULL);
 }
 
-void cans_check_heartbeat() {
-	if (cans_heartbeat.is_connect_can_dev == 1) {
-		uint32_t diff = COM_GetTimeStamp() - cans_heartbeat.timestamp;
-		if (diff > HEARTBEAT_MAX_WAIT_TIME) {
-			DEBUG_PRINTF(("[%s:%d]heartbeat losss -> all disable (time diff:%s)\r\n", __func__, __LINE__, float_to_string(diff)));
-			cans_ebm_all_disable();
-
-			cans_heartbeat.is_connect_can_dev = 0;
-		}
-		if (diff > can_heartbeat_max_diff) {
-			can_heartbeat_max_diff = diff;
-			//DEBUG_PRINTF_EX("[%s:%d]max heartbeat diff. time:%u ms\r\n", __FILE__, __LINE__, can_heartbeat_max_diff);
-		}
-	} else {
-		can_heartbeat_max_diff = 0;
-	}
-}
-
-void cans_send_heartbeat_pulse() {
-	cans_heartbeat.is_connect_can_dev = 1;
-	cans_heartbeat.timestamp = COM_GetTimeStamp();
+static void cans_heartbeat_lost(CANS_heartbeatPeer_e peer) {
+	DEBUG_PRINTF(("[%s:%d]heartbeat loss -> all disable\r\n", __func__, __LINE__));
+	cans_ebm_all_disable();
 }
 
 #endif // ITRI_MOD_11
 /*================== Macros and Definitions ===============================*/
 static DATA_BLOCK_CURRENT_SENSOR_s cans_current_tab;
 
-#define CANS_MODULSIGNALS_VOLT      (CAN0_SIG_Mod0_temp_valid_0_2 - CAN0_SIG_Mod0_volt_valid_0_2)
-#define CANS_MODULSIGNALS_TEMP      (CAN0_SIG_Mod1_volt_valid_0_2 - CAN0_SIG_Mod0_temp_valid_0_2)
 
 
 /*================== Constant and Variable Definitions ====================*/
@@ -249,911 +234,16 @@ const CANS_signal_s cans_CAN0_signals_tx[] = {
         { {CAN0_MSG_PackVoltage}, 0, 32, 0, UINT32_MAX, 1, 0, NULL_PTR, &cans_getPackVoltage },  /*!< CAN0_SIG_PackVolt_Battery */
         { {CAN0_MSG_PackVoltage}, 32, 32, 0, UINT32_MAX, 1, 0, NULL_PTR, &cans_getPackVoltage },  /*!< CAN0_SIG_PackVolt_PowerNet */
 
-        /* Module 0 cell voltages */
-        { {CAN0_MSG_Mod0_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod0_volt_valid_0_2 */
-        { {CAN0_MSG_Mod0_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod0_volt_0 */
-        { {CAN0_MSG_Mod0_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod0_volt_1 */
-        { {CAN0_MSG_Mod0_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod0_volt_2 */
-        { {CAN0_MSG_Mod0_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod0_volt_valid_3_5 */
-        { {CAN0_MSG_Mod0_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod0_volt_3 */
-        { {CAN0_MSG_Mod0_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod0_volt_4 */
-        { {CAN0_MSG_Mod0_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod0_volt_5 */
-        { {CAN0_MSG_Mod0_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod0_volt_valid_6_8 */
-        { {CAN0_MSG_Mod0_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod0_volt_6 */
-        { {CAN0_MSG_Mod0_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod0_volt_7 */
-        { {CAN0_MSG_Mod0_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod0_volt_8 */
-        { {CAN0_MSG_Mod0_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod0_volt_valid_9_11 */
-        { {CAN0_MSG_Mod0_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod0_volt_9 */
-        { {CAN0_MSG_Mod0_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod0_volt_10 */
-        { {CAN0_MSG_Mod0_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod0_volt_11 */
-
-        /* Module 0 cell temperatures */
-        { {CAN0_MSG_Mod0_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod0_volt_valid_0_2 */
-        { {CAN0_MSG_Mod0_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod0_temp_0 */
-        { {CAN0_MSG_Mod0_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod0_temp_1 */
-        { {CAN0_MSG_Mod0_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod0_temp_2 */
-        { {CAN0_MSG_Mod0_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod0_volt_valid_3_5 */
-        { {CAN0_MSG_Mod0_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod0_temp_3 */
-        { {CAN0_MSG_Mod0_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod0_temp_4 */
-        { {CAN0_MSG_Mod0_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod0_temp_5 */
-        { {CAN0_MSG_Mod0_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, &cans_gettemp },  /*!< CAN0_SIG_Mod0_volt_valid_6_8 */
-        { {CAN0_MSG_Mod0_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod0_temp_6 */
-        { {CAN0_MSG_Mod0_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod0_temp_7 */
-        { {CAN0_MSG_Mod0_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod0_temp_8 */
-        { {CAN0_MSG_Mod0_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod0_volt_valid_9_11 */
-        { {CAN0_MSG_Mod0_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod0_temp_9 */
-        { {CAN0_MSG_Mod0_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod0_temp_10 */
-        { {CAN0_MSG_Mod0_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod0_temp_11 */
-
-        /* Module 1 cell voltages */
-        { {CAN0_MSG_Mod1_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod1_volt_valid_0_2 */
-        { {CAN0_MSG_Mod1_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod1_volt_0 */
-        { {CAN0_MSG_Mod1_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod1_volt_1 */
-        { {CAN0_MSG_Mod1_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod1_volt_2 */
-        { {CAN0_MSG_Mod1_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod1_volt_valid_3_5 */
-        { {CAN0_MSG_Mod1_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod1_volt_3 */
-        { {CAN0_MSG_Mod1_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod1_volt_4 */
-        { {CAN0_MSG_Mod1_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod1_volt_5 */
-        { {CAN0_MSG_Mod1_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod1_volt_valid_6_8 */
-        { {CAN0_MSG_Mod1_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod1_volt_6 */
-        { {CAN0_MSG_Mod1_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod1_volt_7 */
-        { {CAN0_MSG_Mod1_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod1_volt_8 */
-        { {CAN0_MSG_Mod1_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod1_volt_valid_9_11 */
-        { {CAN0_MSG_Mod1_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod1_volt_9 */
-        { {CAN0_MSG_Mod1_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod1_volt_10 */
-        { {CAN0_MSG_Mod1_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod1_volt_11 */
-
-        /* Module 1 cell temperatures */
-        { {CAN0_MSG_Mod1_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod1_volt_valid_0_2 */
-        { {CAN0_MSG_Mod1_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod1_temp_0 */
-        { {CAN0_MSG_Mod1_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod1_temp_1 */
-        { {CAN0_MSG_Mod1_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod1_temp_2 */
-        { {CAN0_MSG_Mod1_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod1_volt_valid_3_5 */
-        { {CAN0_MSG_Mod1_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod1_temp_3 */
-        { {CAN0_MSG_Mod1_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod1_temp_4 */
-        { {CAN0_MSG_Mod1_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod1_temp_5 */
-        { {CAN0_MSG_Mod1_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod1_volt_valid_6_8 */
-        { {CAN0_MSG_Mod1_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod1_temp_6 */
-        { {CAN0_MSG_Mod1_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod1_temp_7 */
-        { {CAN0_MSG_Mod1_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod1_temp_8 */
-        { {CAN0_MSG_Mod1_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod1_volt_valid_9_11 */
-        { {CAN0_MSG_Mod1_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod1_temp_9 */
-        { {CAN0_MSG_Mod1_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod1_temp_10 */
-        { {CAN0_MSG_Mod1_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod1_temp_11 */
-
-        /* Module 2 cell voltages */
-        { {CAN0_MSG_Mod2_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod2_volt_valid_0_2 */
-        { {CAN0_MSG_Mod2_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod2_volt_0 */
-        { {CAN0_MSG_Mod2_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod2_volt_1 */
-        { {CAN0_MSG_Mod2_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod2_volt_2 */
-        { {CAN0_MSG_Mod2_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod2_volt_valid_3_5 */
-        { {CAN0_MSG_Mod2_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod2_volt_3 */
-        { {CAN0_MSG_Mod2_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod2_volt_4 */
-        { {CAN0_MSG_Mod2_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod2_volt_5 */
-        { {CAN0_MSG_Mod2_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod2_volt_valid_6_8 */
-        { {CAN0_MSG_Mod2_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod2_volt_6 */
-        { {CAN0_MSG_Mod2_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod2_volt_7 */
-        { {CAN0_MSG_Mod2_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod2_volt_8 */
-        { {CAN0_MSG_Mod2_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod2_volt_valid_9_11 */
-        { {CAN0_MSG_Mod2_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod2_volt_9 */
-        { {CAN0_MSG_Mod2_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod2_volt_10 */
-        { {CAN0_MSG_Mod2_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod2_volt_11 */
-
-        /* Module 2 cell temperatures */
-        { {CAN0_MSG_Mod2_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod2_volt_valid_0_2 */
-        { {CAN0_MSG_Mod2_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod2_temp_0 */
-        { {CAN0_MSG_Mod2_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod2_temp_1 */
-        { {CAN0_MSG_Mod2_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod2_temp_2 */
-        { {CAN0_MSG_Mod2_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod2_volt_valid_3_5 */
-        { {CAN0_MSG_Mod2_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod2_temp_3 */
-        { {CAN0_MSG_Mod2_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod2_temp_4 */
-        { {CAN0_MSG_Mod2_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod2_temp_5 */
-        { {CAN0_MSG_Mod2_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod2_volt_valid_6_8 */
-        { {CAN0_MSG_Mod2_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod2_temp_6 */
-        { {CAN0_MSG_Mod2_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod2_temp_7 */
-        { {CAN0_MSG_Mod2_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod2_temp_8 */
-        { {CAN0_MSG_Mod2_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod2_volt_valid_9_11 */
-        { {CAN0_MSG_Mod2_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod2_temp_9 */
-        { {CAN0_MSG_Mod2_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod2_temp_10 */
-        { {CAN0_MSG_Mod2_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod2_temp_11 */
-
-        /* Module 3 cell voltages */
-        { {CAN0_MSG_Mod3_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod3_volt_valid_0_2 */
-        { {CAN0_MSG_Mod3_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod3_volt_0 */
-        { {CAN0_MSG_Mod3_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod3_volt_1 */
-        { {CAN0_MSG_Mod3_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod3_volt_2 */
-        { {CAN0_MSG_Mod3_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod3_volt_valid_3_5 */
-        { {CAN0_MSG_Mod3_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod3_volt_3 */
-        { {CAN0_MSG_Mod3_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod3_volt_4 */
-        { {CAN0_MSG_Mod3_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod3_volt_5 */
-        { {CAN0_MSG_Mod3_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod3_volt_valid_6_8 */
-        { {CAN0_MSG_Mod3_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod3_volt_6 */
-        { {CAN0_MSG_Mod3_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod3_volt_7 */
-        { {CAN0_MSG_Mod3_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod3_volt_8 */
-        { {CAN0_MSG_Mod3_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod3_volt_valid_9_11 */
-        { {CAN0_MSG_Mod3_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod3_volt_9 */
-        { {CAN0_MSG_Mod3_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod3_volt_10 */
-        { {CAN0_MSG_Mod3_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod3_volt_11 */
-
-        /* Module 3 cell temperatures */
-        { {CAN0_MSG_Mod3_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod3_volt_valid_0_2 */
-        { {CAN0_MSG_Mod3_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod3_temp_0 */
-        { {CAN0_MSG_Mod3_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod3_temp_1 */
-        { {CAN0_MSG_Mod3_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod3_temp_2 */
-        { {CAN0_MSG_Mod3_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod3_volt_valid_3_5 */
-        { {CAN0_MSG_Mod3_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod3_temp_3 */
-        { {CAN0_MSG_Mod3_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod3_temp_4 */
-        { {CAN0_MSG_Mod3_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod3_temp_5 */
-        { {CAN0_MSG_Mod3_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod3_volt_valid_6_8 */
-        { {CAN0_MSG_Mod3_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod3_temp_6 */
-        { {CAN0_MSG_Mod3_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod3_temp_7 */
-        { {CAN0_MSG_Mod3_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod3_temp_8 */
-        { {CAN0_MSG_Mod3_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod3_volt_valid_9_11 */
-        { {CAN0_MSG_Mod3_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod3_temp_9 */
-        { {CAN0_MSG_Mod3_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod3_temp_10 */
-        { {CAN0_MSG_Mod3_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod3_temp_11 */
-
-        /* Module 4 cell voltages */
-        { {CAN0_MSG_Mod4_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod4_volt_valid_0_2 */
-        { {CAN0_MSG_Mod4_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod4_volt_0 */
-        { {CAN0_MSG_Mod4_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod4_volt_1 */
-        { {CAN0_MSG_Mod4_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod4_volt_2 */
-        { {CAN0_MSG_Mod4_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod4_volt_valid_3_5 */
-        { {CAN0_MSG_Mod4_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod4_volt_3 */
-        { {CAN0_MSG_Mod4_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod4_volt_4 */
-        { {CAN0_MSG_Mod4_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod4_volt_5 */
-        { {CAN0_MSG_Mod4_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod4_volt_valid_6_8 */
-        { {CAN0_MSG_Mod4_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod4_volt_6 */
-        { {CAN0_MSG_Mod4_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod4_volt_7 */
-        { {CAN0_MSG_Mod4_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod4_volt_8 */
-        { {CAN0_MSG_Mod4_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod4_volt_valid_9_11 */
-        { {CAN0_MSG_Mod4_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod4_volt_9 */
-        { {CAN0_MSG_Mod4_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod4_volt_10 */
-        { {CAN0_MSG_Mod4_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod4_volt_11 */
-
-        /* Module 4 cell temperatures */
-        { {CAN0_MSG_Mod4_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_volt_valid_0_2 */
-        { {CAN0_MSG_Mod4_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_0 */
-        { {CAN0_MSG_Mod4_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_1 */
-        { {CAN0_MSG_Mod4_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_2 */
-        { {CAN0_MSG_Mod4_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_volt_valid_3_5 */
-        { {CAN0_MSG_Mod4_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_3 */
-        { {CAN0_MSG_Mod4_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_4 */
-        { {CAN0_MSG_Mod4_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_5 */
-        { {CAN0_MSG_Mod4_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_volt_valid_6_8 */
-        { {CAN0_MSG_Mod4_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_6 */
-        { {CAN0_MSG_Mod4_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_7 */
-        { {CAN0_MSG_Mod4_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_8 */
-        { {CAN0_MSG_Mod4_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_volt_valid_9_11 */
-        { {CAN0_MSG_Mod4_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_9 */
-        { {CAN0_MSG_Mod4_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_10 */
-        { {CAN0_MSG_Mod4_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_11 */
-
-        /* Module 5 cell voltages */
-        { {CAN0_MSG_Mod5_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod5_volt_valid_0_2 */
-        { {CAN0_MSG_Mod5_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod5_volt_0 */
-        { {CAN0_MSG_Mod5_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod5_volt_1 */
-        { {CAN0_MSG_Mod5_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod5_volt_2 */
-        { {CAN0_MSG_Mod5_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod5_volt_valid_3_5 */
-        { {CAN0_MSG_Mod5_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod5_volt_3 */
-        { {CAN0_MSG_Mod5_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod5_volt_4 */
-        { {CAN0_MSG_Mod5_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod5_volt_5 */
-        { {CAN0_MSG_Mod5_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod5_volt_valid_6_8 */
-        { {CAN0_MSG_Mod5_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod5_volt_6 */
-        { {CAN0_MSG_Mod5_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod5_volt_7 */
-        { {CAN0_MSG_Mod5_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod5_volt_8 */
-        { {CAN0_MSG_Mod5_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod5_volt_valid_9_11 */
-        { {CAN0_MSG_Mod5_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod5_volt_9 */
-        { {CAN0_MSG_Mod5_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod5_volt_10 */
-        { {CAN0_MSG_Mod5_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod5_volt_11 */
-
-        /* Module 5 cell temperatures */
-        { {CAN0_MSG_Mod5_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod5_volt_valid_0_2 */
-        { {CAN0_MSG_Mod5_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod5_temp_0 */
-        { {CAN0_MSG_Mod5_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod5_temp_1 */
-        { {CAN0_MSG_Mod5_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod5_temp_2 */
-        { {CAN0_MSG_Mod5_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod5_volt_valid_3_5 */
-        { {CAN0_MSG_Mod5_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod5_temp_3 */
-        { {CAN0_MSG_Mod5_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod5_temp_4 */
-        { {CAN0_MSG_Mod5_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod5_temp_5 */
-        { {CAN0_MSG_Mod5_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod5_volt_valid_6_8 */
-        { {CAN0_MSG_Mod5_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod5_temp_6 */
-        { {CAN0_MSG_Mod5_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod5_temp_7 */
-        { {CAN0_MSG_Mod5_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod5_temp_8 */
-        { {CAN0_MSG_Mod5_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod5_volt_valid_9_11 */
-        { {CAN0_MSG_Mod5_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod5_temp_9 */
-        { {CAN0_MSG_Mod5_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod5_temp_10 */
-        { {CAN0_MSG_Mod5_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod5_temp_11 */
-
-        /* Module 6 cell voltages */
-        { {CAN0_MSG_Mod6_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod6_volt_valid_0_2 */
-        { {CAN0_MSG_Mod6_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod6_volt_0 */
-        { {CAN0_MSG_Mod6_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod6_volt_1 */
-        { {CAN0_MSG_Mod6_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod6_volt_2 */
-        { {CAN0_MSG_Mod6_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod6_volt_valid_3_5 */
-        { {CAN0_MSG_Mod6_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod6_volt_3 */
-        { {CAN0_MSG_Mod6_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod6_volt_4 */
-        { {CAN0_MSG_Mod6_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod6_volt_5 */
-        { {CAN0_MSG_Mod6_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod6_volt_valid_6_8 */
-        { {CAN0_MSG_Mod6_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod6_volt_6 */
-        { {CAN0_MSG_Mod6_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod6_volt_7 */
-        { {CAN0_MSG_Mod6_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod6_volt_8 */
-        { {CAN0_MSG_Mod6_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod6_volt_valid_9_11 */
-        { {CAN0_MSG_Mod6_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod6_volt_9 */
-        { {CAN0_MSG_Mod6_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod6_volt_10 */
-        { {CAN0_MSG_Mod6_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod6_volt_11 */
-
-        /* Module 6 cell temperatures */
-        { {CAN0_MSG_Mod6_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod6_volt_valid_0_2 */
-        { {CAN0_MSG_Mod6_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod6_temp_0 */
-        { {CAN0_MSG_Mod6_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod6_temp_1 */
-        { {CAN0_MSG_Mod6_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod6_temp_2 */
-        { {CAN0_MSG_Mod6_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod6_volt_valid_3_5 */
-        { {CAN0_MSG_Mod6_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod6_temp_3 */
-        { {CAN0_MSG_Mod6_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod6_temp_4 */
-        { {CAN0_MSG_Mod6_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod6_temp_5 */
-        { {CAN0_MSG_Mod6_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod6_volt_valid_6_8 */
-        { {CAN0_MSG_Mod6_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod6_temp_6 */
-        { {CAN0_MSG_Mod6_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod6_temp_7 */
-        { {CAN0_MSG_Mod6_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod6_temp_8 */
-        { {CAN0_MSG_Mod6_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod6_volt_valid_9_11 */
-        { {CAN0_MSG_Mod6_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod6_temp_9 */
-        { {CAN0_MSG_Mod6_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod6_temp_10 */
-        { {CAN0_MSG_Mod6_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod6_temp_11 */
-
-        /* Module 7 cell voltages */
-        { {CAN0_MSG_Mod7_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod7_volt_valid_0_2 */
-        { {CAN0_MSG_Mod7_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod7_volt_0 */
-        { {CAN0_MSG_Mod7_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod7_volt_1 */
-        { {CAN0_MSG_Mod7_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod7_volt_2 */
-        { {CAN0_MSG_Mod7_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod7_volt_valid_3_5 */
-        { {CAN0_MSG_Mod7_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod7_volt_3 */
-        { {CAN0_MSG_Mod7_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod7_volt_4 */
-        { {CAN0_MSG_Mod7_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod7_volt_5 */
-        { {CAN0_MSG_Mod7_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod7_volt_valid_6_8 */
-        { {CAN0_MSG_Mod7_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod7_volt_6 */
-        { {CAN0_MSG_Mod7_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod7_volt_7 */
-        { {CAN0_MSG_Mod7_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod7_volt_8 */
-        { {CAN0_MSG_Mod7_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod7_volt_valid_9_11 */
-        { {CAN0_MSG_Mod7_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod7_volt_9 */
-        { {CAN0_MSG_Mod7_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod7_volt_10 */
-        { {CAN0_MSG_Mod7_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },  /*!< CAN0_SIG_Mod7_volt_11 */
-
-        /* Module 7 cell temperatures */
-        { {CAN0_MSG_Mod7_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_volt_valid_0_2 */
-        { {CAN0_MSG_Mod7_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_0 */
-        { {CAN0_MSG_Mod7_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_1 */
-        { {CAN0_MSG_Mod7_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_2 */
-        { {CAN0_MSG_Mod7_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_volt_valid_3_5 */
-        { {CAN0_MSG_Mod7_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_3 */
-        { {CAN0_MSG_Mod7_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_4 */
-        { {CAN0_MSG_Mod7_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_5 */
-        { {CAN0_MSG_Mod7_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_volt_valid_6_8 */
-        { {CAN0_MSG_Mod7_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_6 */
-        { {CAN0_MSG_Mod7_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_7 */
-        { {CAN0_MSG_Mod7_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_8 */
-        { {CAN0_MSG_Mod7_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_volt_valid_9_11 */
-        { {CAN0_MSG_Mod7_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_9 */
-        { {CAN0_MSG_Mod7_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_10 */
-        { {CAN0_MSG_Mod7_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },  /*!< CAN0_SIG_Mod4_temp_11 */
+        { {CAN0_MSG_CanBusStatistics}, 0, 16, 0, 100, 10, 0, NULL_PTR, &cans_getcanbusstatistics },  /*!< CAN0_SIG_CanBus_Load */
+        { {CAN0_MSG_CanBusStatistics}, 16, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getcanbusstatistics },  /*!< CAN0_SIG_CanBus_ErrorRate */
+        { {CAN0_MSG_CanBusStatistics}, 32, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getcanbusstatistics },  /*!< CAN0_SIG_CanBus_TxErrorCounter */
+        { {CAN0_MSG_CanBusStatistics}, 40, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getcanbusstatistics },  /*!< CAN0_SIG_CanBus_RxErrorCounter */
+        { {CAN0_MSG_CanBusStatistics}, 48, 16, 0, 6553.5, 10, 0, NULL_PTR, &cans_getcanbusstatistics },  /*!< CAN0_SIG_CanBus_TxDelayMax */
 
 #ifdef CAN_ISABELLENHUETTE_TRIGGERED
         {{CAN0_MSG_BMS_CurrentTrigger}, 0, 32, 0, 0, 1, 0, NULL_PTR, &cans_gettriggercurrent }  /*!< CAN0_SIG_ISA_Trigger */
 #endif
 
-#if defined(ITRI_MOD_5)
-        // Module 8 cell voltages
-        { {CAN0_MSG_Mod8_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod8_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod8_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod8_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod8_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod8_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod8_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod8_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod8_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod8_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod8_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod8_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod8_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod8_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod8_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod8_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-
-        // Module 8 cell temperatures
-        { {CAN0_MSG_Mod8_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod8_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod8_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod8_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod8_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod8_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod8_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod8_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod8_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod8_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod8_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod8_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod8_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod8_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod8_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod8_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-
-        // Module 9 cell voltages
-        { {CAN0_MSG_Mod9_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod9_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod9_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod9_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod9_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod9_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod9_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod9_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod9_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod9_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod9_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod9_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod9_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod9_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod9_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod9_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-
-        // Module 9 cell temperatures
-        { {CAN0_MSG_Mod9_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod9_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod9_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod9_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod9_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod9_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod9_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod9_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod9_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod9_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod9_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod9_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod9_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod9_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod9_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod9_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-
-        // Module 10 cell voltages
-        { {CAN0_MSG_Mod10_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod10_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod10_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod10_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod10_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod10_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod10_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod10_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod10_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod10_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod10_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod10_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod10_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod10_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod10_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod10_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-
-        // Module 10 cell temperatures
-        { {CAN0_MSG_Mod10_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod10_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod10_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod10_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod10_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod10_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod10_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod10_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod10_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod10_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod10_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod10_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod10_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod10_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod10_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod10_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-
-        // Module 11 cell voltages
-        { {CAN0_MSG_Mod11_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod11_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod11_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod11_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod11_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod11_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod11_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod11_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod11_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod11_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod11_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod11_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod11_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod11_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod11_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod11_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-
-        // Module 11 cell temperatures
-        { {CAN0_MSG_Mod11_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod11_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod11_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod11_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod11_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod11_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod11_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod11_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod11_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod11_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod11_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod11_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod11_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod11_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod11_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod11_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-
-        // Module 12 cell voltages
-        { {CAN0_MSG_Mod12_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod12_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod12_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod12_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod12_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod12_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod12_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod12_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod12_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod12_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod12_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod12_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod12_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod12_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod12_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod12_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-
-        // Module 12 cell temperatures
-        { {CAN0_MSG_Mod12_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod12_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod12_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod12_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod12_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod12_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod12_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod12_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod12_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod12_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod12_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod12_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod12_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod12_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod12_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod12_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-
-        // Module 13 cell voltages
-        { {CAN0_MSG_Mod13_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod13_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod13_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod13_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod13_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod13_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod13_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod13_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod13_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod13_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod13_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod13_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod13_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod13_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod13_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod13_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-
-        // Module 13 cell temperatures
-        { {CAN0_MSG_Mod13_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod13_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod13_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod13_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod13_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod13_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod13_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod13_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod13_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod13_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod13_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod13_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod13_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod13_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod13_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod13_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-
-        // Module 14 cell voltages
-        { {CAN0_MSG_Mod14_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod14_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod14_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod14_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod14_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod14_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod14_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod14_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod14_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod14_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod14_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod14_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod14_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod14_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod14_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod14_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-
-        // Module 14 cell temperatures
-        { {CAN0_MSG_Mod14_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod14_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod14_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod14_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod14_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod14_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod14_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod14_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod14_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod14_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod14_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod14_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod14_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod14_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod14_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod14_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-
-        // Module 15 cell voltages
-        { {CAN0_MSG_Mod15_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod15_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod15_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod15_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod15_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod15_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod15_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod15_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod15_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod15_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod15_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod15_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod15_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod15_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod15_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod15_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-
-        // Module 15 cell temperatures
-        { {CAN0_MSG_Mod15_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod15_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod15_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod15_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod15_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod15_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod15_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod15_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod15_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod15_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod15_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod15_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod15_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod15_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod15_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod15_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-
-        // Module 16 cell voltages
-        { {CAN0_MSG_Mod16_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod16_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod16_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod16_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod16_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod16_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod16_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod16_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod16_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod16_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod16_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod16_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod16_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod16_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod16_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod16_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-
-        // Module 16 cell temperatures
-        { {CAN0_MSG_Mod16_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod16_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod16_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod16_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod16_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod16_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod16_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod16_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod16_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod16_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod16_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod16_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod16_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod16_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod16_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod16_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-
-        // Module 17 cell voltages
-        { {CAN0_MSG_Mod17_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod17_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod17_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod17_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod17_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod17_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod17_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod17_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod17_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod17_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod17_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod17_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod17_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod17_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod17_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod17_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-
-        // Module 17 cell temperatures
-        { {CAN0_MSG_Mod17_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod17_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod17_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod17_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod17_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod17_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod17_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod17_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod17_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod17_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod17_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod17_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod17_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod17_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod17_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod17_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-
-        // Module 18 cell voltages
-        { {CAN0_MSG_Mod18_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod18_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod18_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod18_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod18_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod18_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod18_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod18_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod18_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod18_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod18_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod18_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod18_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod18_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod18_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod18_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-
-        // Module 18 cell temperatures
-        { {CAN0_MSG_Mod18_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod18_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod18_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod18_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod18_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod18_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod18_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod18_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod18_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod18_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod18_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod18_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod18_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod18_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod18_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod18_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-
-        // Module 19 cell voltages
-        { {CAN0_MSG_Mod19_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod19_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod19_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod19_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod19_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod19_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod19_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod19_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod19_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod19_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod19_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod19_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod19_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod19_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod19_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod19_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-
-        // Module 19 cell temperatures
-        { {CAN0_MSG_Mod19_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod19_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod19_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod19_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod19_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod19_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod19_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod19_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod19_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod19_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod19_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod19_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod19_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod19_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod19_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod19_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-
-        // Module 20 cell voltages
-        { {CAN0_MSG_Mod20_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod20_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod20_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod20_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod20_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod20_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod20_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod20_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod20_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod20_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod20_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod20_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod20_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod20_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod20_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod20_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-
-        // Module 20 cell temperatures
-        { {CAN0_MSG_Mod20_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod20_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod20_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod20_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod20_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod20_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod20_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod20_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod20_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod20_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod20_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod20_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod20_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod20_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod20_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod20_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-
-        // Module 21 cell voltages
-        { {CAN0_MSG_Mod21_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod21_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod21_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod21_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod21_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod21_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod21_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod21_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod21_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod21_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod21_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod21_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod21_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod21_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod21_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod21_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-
-        // Module 21 cell temperatures
-        { {CAN0_MSG_Mod21_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod21_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod21_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod21_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod21_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod21_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod21_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod21_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod21_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod21_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod21_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod21_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod21_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod21_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod21_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod21_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-
-        // Module 22 cell voltages
-        { {CAN0_MSG_Mod22_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod22_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod22_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod22_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod22_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod22_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod22_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod22_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod22_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod22_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod22_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod22_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod22_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod22_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod22_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod22_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-
-        // Module 22 cell temperatures
-        { {CAN0_MSG_Mod22_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod22_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod22_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod22_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod22_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod22_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod22_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod22_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod22_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod22_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod22_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod22_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod22_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod22_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod22_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod22_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-
-        // Module 23 cell voltages
-        { {CAN0_MSG_Mod23_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod23_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod23_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod23_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod23_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod23_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod23_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod23_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod23_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod23_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod23_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod23_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod23_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod23_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod23_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod23_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-
-        // Module 23 cell temperatures
-        { {CAN0_MSG_Mod23_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod23_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod23_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod23_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod23_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod23_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod23_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod23_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod23_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod23_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod23_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod23_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod23_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod23_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod23_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod23_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-
-        // Module 24 cell voltages
-        { {CAN0_MSG_Mod24_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod24_Cellvolt_0}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod24_Cellvolt_0}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod24_Cellvolt_0}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod24_Cellvolt_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod24_Cellvolt_1}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod24_Cellvolt_1}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod24_Cellvolt_1}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod24_Cellvolt_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod24_Cellvolt_2}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod24_Cellvolt_2}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod24_Cellvolt_2}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod24_Cellvolt_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod24_Cellvolt_3}, 8, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod24_Cellvolt_3}, 24, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-        { {CAN0_MSG_Mod24_Cellvolt_3}, 40, 16, 0, UINT16_MAX, 1, 0, NULL_PTR, &cans_getvolt },
-
-        // Module 24 cell temperatures
-        { {CAN0_MSG_Mod24_Celltemp_0}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod24_Celltemp_0}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod24_Celltemp_0}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod24_Celltemp_0}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod24_Celltemp_1}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod24_Celltemp_1}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod24_Celltemp_1}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod24_Celltemp_1}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod24_Celltemp_2}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod24_Celltemp_2}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod24_Celltemp_2}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod24_Celltemp_2}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod24_Celltemp_3}, 0, 8, 0, UINT8_MAX, 1, 0, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod24_Celltemp_3}, 8, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod24_Celltemp_3}, 24, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-        { {CAN0_MSG_Mod24_Celltemp_3}, 40, 16, -128, 527.35, 100, 128, NULL_PTR, &cans_gettemp },
-#endif // ITRI_MOD_5
 };
 
 
@@ -1201,1163 +291,256 @@ const uint16_t cans_CAN1_signals_tx_length = sizeof(cans_CAN1_signals_tx)/sizeof
 const uint16_t cans_CAN0_signals_rx_length = sizeof(cans_CAN0_signals_rx)/sizeof(cans_CAN0_signals_rx[0]);
 const uint16_t cans_CAN1_signals_rx_length = sizeof(cans_CAN1_signals_rx)/sizeof(cans_CAN1_signals_rx[0]);
 
-/*================== Function Implementations =============================*/
-
-static uint32_t cans_getvolt(uint32_t sigIdx, void *value) {
-    static DATA_BLOCK_CELLVOLTAGE_s volt_tab;
-    uint16_t modIdx = 0;
-    uint32_t cellIdx = 0;
-    uint32_t tmp = 0;
-    uint32_t tmpVal = 0;
-    float canData = 0;
-
-    /* first signal to transmit cell voltages */
-    if (sigIdx == CAN0_SIG_Mod0_volt_valid_0_2) {
-        DB_ReadBlock(&volt_tab, DATA_BLOCK_ID_CELLVOLTAGE);
-    }
+#if CANS_HEARTBEAT_SUPERVISION == TRUE
+const CANS_HEARTBEAT_CFG_s cans_heartbeat_cfg[CANS_NR_OF_HEARTBEAT_PEERS] = {
+#if defined(ITRI_MOD_11)
+    { HEARTBEAT_MAX_WAIT_TIME_MS, cans_heartbeat_lost },     /* CANS_HEARTBEAT_EBM_CONTROLLER */
+#endif
+};
+#endif
 
-    /* Determine module and cell number */
-    if (sigIdx - CAN0_SIG_Mod0_volt_valid_0_2 < CANS_MODULSIGNALS_VOLT) {
-        modIdx = 0;
-        cellIdx = sigIdx - CAN0_SIG_Mod0_volt_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod1_volt_valid_0_2 < CANS_MODULSIGNALS_VOLT) {
-        modIdx = 1;
-        cellIdx = sigIdx - CAN0_SIG_Mod1_volt_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod2_volt_valid_0_2 < CANS_MODULSIGNALS_VOLT) {
-        modIdx = 2;
-        cellIdx = sigIdx - CAN0_SIG_Mod2_volt_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod3_volt_valid_0_2 < CANS_MODULSIGNALS_VOLT) {
-        modIdx = 3;
-        cellIdx = sigIdx - CAN0_SIG_Mod3_volt_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod4_volt_valid_0_2 < CANS_MODULSIGNALS_VOLT) {
-        modIdx = 4;
-        cellIdx = sigIdx - CAN0_SIG_Mod4_volt_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod5_volt_valid_0_2 < CANS_MODULSIGNALS_VOLT) {
-        modIdx = 5;
-        cellIdx = sigIdx - CAN0_SIG_Mod5_volt_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod6_volt_valid_0_2 < CANS_MODULSIGNALS_VOLT) {
-        modIdx = 6;
-        cellIdx = sigIdx - CAN0_SIG_Mod6_volt_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod7_volt_valid_0_2 < CANS_MODULSIGNALS_VOLT) {
-        modIdx = 7;
-        cellIdx = sigIdx - CAN0_SIG_Mod7_volt_valid_0_2;
-    }
-#if defined(ITRI_MOD_5)
-    else if (sigIdx - CAN0_SIG_Mod8_volt_valid_0_2 <= CANS_MODULSIGNALS_VOLT) {
-		modIdx = 8;
-		cellIdx = sigIdx - CAN0_SIG_Mod8_volt_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod9_volt_valid_0_2 <= CANS_MODULSIGNALS_VOLT) {
-		modIdx = 9;
-		cellIdx = sigIdx - CAN0_SIG_Mod9_volt_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod10_volt_valid_0_2 <= CANS_MODULSIGNALS_VOLT) {
-		modIdx = 10;
-		cellIdx = sigIdx - CAN0_SIG_Mod10_volt_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod11_volt_valid_0_2 <= CANS_MODULSIGNALS_VOLT) {
-		modIdx = 11;
-		cellIdx = sigIdx - CAN0_SIG_Mod11_volt_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod12_volt_valid_0_2 <= CANS_MODULSIGNALS_VOLT) {
-		modIdx = 12;
-		cellIdx = sigIdx - CAN0_SIG_Mod12_volt_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod13_volt_valid_0_2 <= CANS_MODULSIGNALS_VOLT) {
-		modIdx = 13;
-		cellIdx = sigIdx - CAN0_SIG_Mod13_volt_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod14_volt_valid_0_2 <= CANS_MODULSIGNALS_VOLT) {
-		modIdx = 14;
-		cellIdx = sigIdx - CAN0_SIG_Mod14_volt_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod15_volt_valid_0_2 <= CANS_MODULSIGNALS_VOLT) {
-		modIdx = 15;
-		cellIdx = sigIdx - CAN0_SIG_Mod15_volt_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod16_volt_valid_0_2 <= CANS_MODULSIGNALS_VOLT) {
-		modIdx = 16;
-		cellIdx = sigIdx - CAN0_SIG_Mod16_volt_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod17_volt_valid_0_2 <= CANS_MODULSIGNALS_VOLT) {
-		modIdx = 17;
-		cellIdx = sigIdx - CAN0_SIG_Mod17_volt_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod18_volt_valid_0_2 <= CANS_MODULSIGNALS_VOLT) {
-		modIdx = 18;
-		cellIdx = sigIdx - CAN0_SIG_Mod18_volt_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod19_volt_valid_0_2 <= CANS_MODULSIGNALS_VOLT) {
-		modIdx = 19;
-		cellIdx = sigIdx - CAN0_SIG_Mod19_volt_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod20_volt_valid_0_2 <= CANS_MODULSIGNALS_VOLT) {
-		modIdx = 20;
-		cellIdx = sigIdx - CAN0_SIG_Mod20_volt_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod21_volt_valid_0_2 <= CANS_MODULSIGNALS_VOLT) {
-		modIdx = 21;
-		cellIdx = sigIdx - CAN0_SIG_Mod21_volt_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod22_volt_valid_0_2 <= CANS_MODULSIGNALS_VOLT) {
-		modIdx = 22;
-		cellIdx = sigIdx - CAN0_SIG_Mod22_volt_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod23_volt_valid_0_2 <= CANS_MODULSIGNALS_VOLT) {
-		modIdx = 23;
-		cellIdx = sigIdx - CAN0_SIG_Mod23_volt_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod24_volt_valid_0_2 <= CANS_MODULSIGNALS_VOLT) {
-		modIdx = 24;
-		cellIdx = sigIdx - CAN0_SIG_Mod24_volt_valid_0_2;
-	}
-#endif // ITRI_MOD_5
+/**
+ * TRUE if the message of a module is a cell voltage message. With multiplexed cell voltages
+ * the modules have no cell voltage messages.
+ */
+#define CANS_IS_CELLVOLT_MESSAGE(msgInModule)   (((msgInModule) >= CANS_GEN_CELLVOLT_FIRST_MESSAGE) && \
+                                                 ((msgInModule) < (CANS_GEN_CELLVOLT_FIRST_MESSAGE + CANS_GEN_CELLVOLT_NR_OF_MESSAGES)))
 
-    if (value != NULL_PTR) {
-        switch (sigIdx) {
-            case CAN0_SIG_Mod0_volt_valid_0_2:
-            case CAN0_SIG_Mod1_volt_valid_0_2:
-            case CAN0_SIG_Mod2_volt_valid_0_2:
-            case CAN0_SIG_Mod3_volt_valid_0_2:
-            case CAN0_SIG_Mod4_volt_valid_0_2:  /* Valid flags for cell voltages 0 - 2 */
-            case CAN0_SIG_Mod5_volt_valid_0_2:
-            case CAN0_SIG_Mod6_volt_valid_0_2:
-            case CAN0_SIG_Mod7_volt_valid_0_2:
-#if defined(ITRI_MOD_5)
-            case CAN0_SIG_Mod8_volt_valid_0_2:
-            case CAN0_SIG_Mod9_volt_valid_0_2:
-            case CAN0_SIG_Mod10_volt_valid_0_2:
-            case CAN0_SIG_Mod11_volt_valid_0_2:
-            case CAN0_SIG_Mod12_volt_valid_0_2:
-            case CAN0_SIG_Mod13_volt_valid_0_2:
-            case CAN0_SIG_Mod14_volt_valid_0_2:
-            case CAN0_SIG_Mod15_volt_valid_0_2:
-            case CAN0_SIG_Mod16_volt_valid_0_2:
-            case CAN0_SIG_Mod17_volt_valid_0_2:
-            case CAN0_SIG_Mod18_volt_valid_0_2:
-            case CAN0_SIG_Mod19_volt_valid_0_2:
-            case CAN0_SIG_Mod20_volt_valid_0_2:
-            case CAN0_SIG_Mod21_volt_valid_0_2:
-            case CAN0_SIG_Mod22_volt_valid_0_2:
-            case CAN0_SIG_Mod23_volt_valid_0_2:
-            case CAN0_SIG_Mod24_volt_valid_0_2:
-#endif // ITRI_MOD_5
-                tmp = volt_tab.valid_voltPECs[modIdx];
-                *(uint32_t *)value = 0x07 & tmp;
-                break;
+#if CANS_TX_ON_DELTA == TRUE
+#if (CANS_GEN_CELLVOLT_COUNTER_SHIFT != CANS_GEN_CELLTEMP_COUNTER_SHIFT) || \
+    (CANS_GEN_CELLVOLT_COUNTER_MASK != CANS_GEN_CELLTEMP_COUNTER_MASK)
+#error "cell voltage and cell temperature messages must have their rolling counter at the same position"
+#endif
 
-            case CAN0_SIG_Mod0_volt_valid_3_5:
-            case CAN0_SIG_Mod1_volt_valid_3_5:
-            case CAN0_SIG_Mod2_volt_valid_3_5:
-            case CAN0_SIG_Mod3_volt_valid_3_5:
-            case CAN0_SIG_Mod4_volt_valid_3_5:  /* Valid flags for cell voltages 3 - 5 */
-            case CAN0_SIG_Mod5_volt_valid_3_5:
-            case CAN0_SIG_Mod6_volt_valid_3_5:
-            case CAN0_SIG_Mod7_volt_valid_3_5:
-#if defined(ITRI_MOD_5)
-            case CAN0_SIG_Mod8_volt_valid_3_5:
-            case CAN0_SIG_Mod9_volt_valid_3_5:
-            case CAN0_SIG_Mod10_volt_valid_3_5:
-            case CAN0_SIG_Mod11_volt_valid_3_5:
-            case CAN0_SIG_Mod12_volt_valid_3_5:
-            case CAN0_SIG_Mod13_volt_valid_3_5:
-            case CAN0_SIG_Mod14_volt_valid_3_5:
-            case CAN0_SIG_Mod15_volt_valid_3_5:
-            case CAN0_SIG_Mod16_volt_valid_3_5:
-            case CAN0_SIG_Mod17_volt_valid_3_5:
-            case CAN0_SIG_Mod18_volt_valid_3_5:
-            case CAN0_SIG_Mod19_volt_valid_3_5:
-            case CAN0_SIG_Mod20_volt_valid_3_5:
-            case CAN0_SIG_Mod21_volt_valid_3_5:
-            case CAN0_SIG_Mod22_volt_valid_3_5:
-            case CAN0_SIG_Mod23_volt_valid_3_5:
-            case CAN0_SIG_Mod24_volt_valid_3_5:
-#endif // ITRI_MOD_5
-                tmp = volt_tab.valid_voltPECs[modIdx] >> 3;
-                tmpVal = 0x07 & tmp;
-                break;
+/**
+ * deadbands of the cell data messages in raw CAN values
+ */
+#define CANS_CELLVOLT_DEADBAND_RAW  ((uint32_t)(((float)CANS_CELLVOLT_DEADBAND_MV / CANS_GEN_CELLVOLT_FACTOR) + 0.5f))
+#define CANS_CELLTEMP_DEADBAND_RAW  ((uint32_t)((CANS_CELLTEMP_DEADBAND_DEGC / CANS_GEN_CELLTEMP_FACTOR) + 0.5f))
 
-            case CAN0_SIG_Mod0_volt_valid_6_8:
-            case CAN0_SIG_Mod1_volt_valid_6_8:
-            case CAN0_SIG_Mod2_volt_valid_6_8:
-            case CAN0_SIG_Mod3_volt_valid_6_8:
-            case CAN0_SIG_Mod4_volt_valid_6_8:  /* Valid flags for cell voltages 6 - 8 */
-            case CAN0_SIG_Mod5_volt_valid_6_8:
-            case CAN0_SIG_Mod6_volt_valid_6_8:
-            case CAN0_SIG_Mod7_volt_valid_6_8:
-#if defined(ITRI_MOD_5)
-            case CAN0_SIG_Mod8_volt_valid_6_8:
-            case CAN0_SIG_Mod9_volt_valid_6_8:
-            case CAN0_SIG_Mod10_volt_valid_6_8:
-            case CAN0_SIG_Mod11_volt_valid_6_8:
-            case CAN0_SIG_Mod12_volt_valid_6_8:
-            case CAN0_SIG_Mod13_volt_valid_6_8:
-            case CAN0_SIG_Mod14_volt_valid_6_8:
-            case CAN0_SIG_Mod15_volt_valid_6_8:
-            case CAN0_SIG_Mod16_volt_valid_6_8:
-            case CAN0_SIG_Mod17_volt_valid_6_8:
-            case CAN0_SIG_Mod18_volt_valid_6_8:
-            case CAN0_SIG_Mod19_volt_valid_6_8:
-            case CAN0_SIG_Mod20_volt_valid_6_8:
-            case CAN0_SIG_Mod21_volt_valid_6_8:
-            case CAN0_SIG_Mod22_volt_valid_6_8:
-            case CAN0_SIG_Mod23_volt_valid_6_8:
-            case CAN0_SIG_Mod24_volt_valid_6_8:
-#endif // ITRI_MOD_5
-                tmp = volt_tab.valid_voltPECs[modIdx] >> 6;
-                tmpVal = 0x07 & tmp;
-                break;
+const CANS_TX_ON_DELTA_CFG_s cans_tx_ondelta_cfg[] = {
+    { CANS_GEN_CAN0_FIRST_CELL_MESSAGE, CANS_GEN_NR_OF_MODULE_MESSAGES, CANS_CELL_MAX_SILENCE_MS,
+      CANS_GEN_CELLTEMP_COUNTER_SHIFT, CANS_GEN_CELLTEMP_COUNTER_MASK, &cans_celldata_changed },     /* cell voltages and temperatures of the modules */
+};
 
-            case CAN0_SIG_Mod0_volt_valid_9_11:
-            case CAN0_SIG_Mod1_volt_valid_9_11:
-            case CAN0_SIG_Mod2_volt_valid_9_11:
-            case CAN0_SIG_Mod3_volt_valid_9_11:
-            case CAN0_SIG_Mod4_volt_valid_9_11:  /* Valid flags for cell voltages 9 - 11 */
-            case CAN0_SIG_Mod5_volt_valid_9_11:
-            case CAN0_SIG_Mod6_volt_valid_9_11:
-            case CAN0_SIG_Mod7_volt_valid_9_11:
-#if defined(ITRI_MOD_5)
-            case CAN0_SIG_Mod8_volt_valid_9_11:
-            case CAN0_SIG_Mod9_volt_valid_9_11:
-            case CAN0_SIG_Mod10_volt_valid_9_11:
-            case CAN0_SIG_Mod11_volt_valid_9_11:
-            case CAN0_SIG_Mod12_volt_valid_9_11:
-            case CAN0_SIG_Mod13_volt_valid_9_11:
-            case CAN0_SIG_Mod14_volt_valid_9_11:
-            case CAN0_SIG_Mod15_volt_valid_9_11:
-            case CAN0_SIG_Mod16_volt_valid_9_11:
-            case CAN0_SIG_Mod17_volt_valid_9_11:
-            case CAN0_SIG_Mod18_volt_valid_9_11:
-            case CAN0_SIG_Mod19_volt_valid_9_11:
-            case CAN0_SIG_Mod20_volt_valid_9_11:
-            case CAN0_SIG_Mod21_volt_valid_9_11:
-            case CAN0_SIG_Mod22_volt_valid_9_11:
-            case CAN0_SIG_Mod23_volt_valid_9_11:
-            case CAN0_SIG_Mod24_volt_valid_9_11:
-#endif // ITRI_MOD_5
-                tmp = volt_tab.valid_voltPECs[modIdx] >> 9;
-                tmpVal = 0x07 & tmp;
-                break;
+const uint16_t cans_tx_ondelta_cfg_length = sizeof(cans_tx_ondelta_cfg)/sizeof(cans_tx_ondelta_cfg[0]);
+#endif
 
-            case CAN0_SIG_Mod0_volt_0:
-            case CAN0_SIG_Mod0_volt_1:
-            case CAN0_SIG_Mod0_volt_2:
-            case CAN0_SIG_Mod1_volt_0:
-            case CAN0_SIG_Mod1_volt_1:
-            case CAN0_SIG_Mod1_volt_2:
-            case CAN0_SIG_Mod2_volt_0:
-            case CAN0_SIG_Mod2_volt_1:
-            case CAN0_SIG_Mod2_volt_2:
-            case CAN0_SIG_Mod3_volt_0:
-            case CAN0_SIG_Mod3_volt_1:
-            case CAN0_SIG_Mod3_volt_2:
-            case CAN0_SIG_Mod4_volt_0:
-            case CAN0_SIG_Mod4_volt_1:
-            case CAN0_SIG_Mod4_volt_2:
-            case CAN0_SIG_Mod5_volt_0:
-            case CAN0_SIG_Mod5_volt_1:
-            case CAN0_SIG_Mod5_volt_2:
-            case CAN0_SIG_Mod6_volt_0:
-            case CAN0_SIG_Mod6_volt_1:
-            case CAN0_SIG_Mod6_volt_2:
-            case CAN0_SIG_Mod7_volt_0:
-            case CAN0_SIG_Mod7_volt_1:
-            case CAN0_SIG_Mod7_volt_2:
-#if defined(ITRI_MOD_5)
-            case CAN0_SIG_Mod8_volt_0:
-			case CAN0_SIG_Mod8_volt_1:
-			case CAN0_SIG_Mod8_volt_2:
-            case CAN0_SIG_Mod9_volt_0:
-			case CAN0_SIG_Mod9_volt_1:
-			case CAN0_SIG_Mod9_volt_2:
-            case CAN0_SIG_Mod10_volt_0:
-			case CAN0_SIG_Mod10_volt_1:
-			case CAN0_SIG_Mod10_volt_2:
-            case CAN0_SIG_Mod11_volt_0:
-			case CAN0_SIG_Mod11_volt_1:
-			case CAN0_SIG_Mod11_volt_2:
-            case CAN0_SIG_Mod12_volt_0:
-			case CAN0_SIG_Mod12_volt_1:
-			case CAN0_SIG_Mod12_volt_2:
-            case CAN0_SIG_Mod13_volt_0:
-			case CAN0_SIG_Mod13_volt_1:
-			case CAN0_SIG_Mod13_volt_2:
-            case CAN0_SIG_Mod14_volt_0:
-			case CAN0_SIG_Mod14_volt_1:
-			case CAN0_SIG_Mod14_volt_2:
-            case CAN0_SIG_Mod15_volt_0:
-			case CAN0_SIG_Mod15_volt_1:
-			case CAN0_SIG_Mod15_volt_2:
-            case CAN0_SIG_Mod16_volt_0:
-			case CAN0_SIG_Mod16_volt_1:
-			case CAN0_SIG_Mod16_volt_2:
-            case CAN0_SIG_Mod17_volt_0:
-			case CAN0_SIG_Mod17_volt_1:
-			case CAN0_SIG_Mod17_volt_2:
-            case CAN0_SIG_Mod18_volt_0:
-			case CAN0_SIG_Mod18_volt_1:
-			case CAN0_SIG_Mod18_volt_2:
-            case CAN0_SIG_Mod19_volt_0:
-			case CAN0_SIG_Mod19_volt_1:
-			case CAN0_SIG_Mod19_volt_2:
-            case CAN0_SIG_Mod20_volt_0:
-			case CAN0_SIG_Mod20_volt_1:
-			case CAN0_SIG_Mod20_volt_2:
-            case CAN0_SIG_Mod21_volt_0:
-			case CAN0_SIG_Mod21_volt_1:
-			case CAN0_SIG_Mod21_volt_2:
-            case CAN0_SIG_Mod22_volt_0:
-			case CAN0_SIG_Mod22_volt_1:
-			case CAN0_SIG_Mod22_volt_2:
-            case CAN0_SIG_Mod23_volt_0:
-			case CAN0_SIG_Mod23_volt_1:
-			case CAN0_SIG_Mod23_volt_2:
-            case CAN0_SIG_Mod24_volt_0:
-			case CAN0_SIG_Mod24_volt_1:
-			case CAN0_SIG_Mod24_volt_2:
-#endif // ITRI_MOD_5
-                cellIdx--;  /* Because cell 0 - valid flag = 1, decrement by one to get the right index */
-                tmpVal = volt_tab.voltage[(modIdx * BS_NR_OF_BAT_CELLS_PER_MODULE) + cellIdx];
-                break;
+/*================== Function Implementations =============================*/
 
-            case CAN0_SIG_Mod0_volt_3:
-            case CAN0_SIG_Mod0_volt_4:
-            case CAN0_SIG_Mod0_volt_5:
-            case CAN0_SIG_Mod1_volt_3:
-            case CAN0_SIG_Mod1_volt_4:
-            case CAN0_SIG_Mod1_volt_5:
-            case CAN0_SIG_Mod2_volt_3:
-            case CAN0_SIG_Mod2_volt_4:
-            case CAN0_SIG_Mod2_volt_5:
-            case CAN0_SIG_Mod3_volt_3:
-            case CAN0_SIG_Mod3_volt_4:
-            case CAN0_SIG_Mod3_volt_5:
-            case CAN0_SIG_Mod4_volt_3:
-            case CAN0_SIG_Mod4_volt_4:
-            case CAN0_SIG_Mod4_volt_5:
-            case CAN0_SIG_Mod5_volt_3:
-            case CAN0_SIG_Mod5_volt_4:
-            case CAN0_SIG_Mod5_volt_5:
-            case CAN0_SIG_Mod6_volt_3:
-            case CAN0_SIG_Mod6_volt_4:
-            case CAN0_SIG_Mod6_volt_5:
-            case CAN0_SIG_Mod7_volt_3:
-            case CAN0_SIG_Mod7_volt_4:
-            case CAN0_SIG_Mod7_volt_5:
-#if defined(ITRI_MOD_5)
-            case CAN0_SIG_Mod8_volt_3:
-			case CAN0_SIG_Mod8_volt_4:
-			case CAN0_SIG_Mod8_volt_5:
-            case CAN0_SIG_Mod9_volt_3:
-			case CAN0_SIG_Mod9_volt_4:
-			case CAN0_SIG_Mod9_volt_5:
-            case CAN0_SIG_Mod10_volt_3:
-			case CAN0_SIG_Mod10_volt_4:
-			case CAN0_SIG_Mod10_volt_5:
-            case CAN0_SIG_Mod11_volt_3:
-			case CAN0_SIG_Mod11_volt_4:
-			case CAN0_SIG_Mod11_volt_5:
-            case CAN0_SIG_Mod12_volt_3:
-			case CAN0_SIG_Mod12_volt_4:
-			case CAN0_SIG_Mod12_volt_5:
-            case CAN0_SIG_Mod13_volt_3:
-			case CAN0_SIG_Mod13_volt_4:
-			case CAN0_SIG_Mod13_volt_5:
-            case CAN0_SIG_Mod14_volt_3:
-			case CAN0_SIG_Mod14_volt_4:
-			case CAN0_SIG_Mod14_volt_5:
-            case CAN0_SIG_Mod15_volt_3:
-			case CAN0_SIG_Mod15_volt_4:
-			case CAN0_SIG_Mod15_volt_5:
-            case CAN0_SIG_Mod16_volt_3:
-			case CAN0_SIG_Mod16_volt_4:
-			case CAN0_SIG_Mod16_volt_5:
-            case CAN0_SIG_Mod17_volt_3:
-			case CAN0_SIG_Mod17_volt_4:
-			case CAN0_SIG_Mod17_volt_5:
-            case CAN0_SIG_Mod18_volt_3:
-			case CAN0_SIG_Mod18_volt_4:
-			case CAN0_SIG_Mod18_volt_5:
-            case CAN0_SIG_Mod19_volt_3:
-			case CAN0_SIG_Mod19_volt_4:
-			case CAN0_SIG_Mod19_volt_5:
-            case CAN0_SIG_Mod20_volt_3:
-			case CAN0_SIG_Mod20_volt_4:
-			case CAN0_SIG_Mod20_volt_5:
-            case CAN0_SIG_Mod21_volt_3:
-			case CAN0_SIG_Mod21_volt_4:
-			case CAN0_SIG_Mod21_volt_5:
-            case CAN0_SIG_Mod22_volt_3:
-			case CAN0_SIG_Mod22_volt_4:
-			case CAN0_SIG_Mod22_volt_5:
-            case CAN0_SIG_Mod23_volt_3:
-			case CAN0_SIG_Mod23_volt_4:
-			case CAN0_SIG_Mod23_volt_5:
-            case CAN0_SIG_Mod24_volt_3:
-			case CAN0_SIG_Mod24_volt_4:
-			case CAN0_SIG_Mod24_volt_5:
-#endif // ITRI_MOD_5
-                cellIdx--;  /* Because cell 0 - valid flag = 1, decrement by one to get the right index */
-                cellIdx--;  /* Because of signal: CAN0_SIG_Modx_volt_valid_3_5 */
-                tmpVal = volt_tab.voltage[(modIdx * BS_NR_OF_BAT_CELLS_PER_MODULE) + cellIdx];
-                break;
+uint8_t CANS_ComposeCellDataMessage(CANS_messagesTx_e msgIdx, uint8_t dataptr[]) {
+    uint32_t msgOffset = 0;
+    uint32_t modIdx = 0;
+    uint32_t msgInModule = 0;
+    uint64_t *dataPtr64 = (uint64_t *)dataptr;
 
-            case CAN0_SIG_Mod0_volt_6:
-            case CAN0_SIG_Mod0_volt_7:
-            case CAN0_SIG_Mod0_volt_8:
-            case CAN0_SIG_Mod1_volt_6:
-            case CAN0_SIG_Mod1_volt_7:
-            case CAN0_SIG_Mod1_volt_8:
-            case CAN0_SIG_Mod2_volt_6:
-            case CAN0_SIG_Mod2_volt_7:
-            case CAN0_SIG_Mod2_volt_8:
-            case CAN0_SIG_Mod3_volt_6:
-            case CAN0_SIG_Mod3_volt_7:
-            case CAN0_SIG_Mod3_volt_8:
-            case CAN0_SIG_Mod4_volt_6:
-            case CAN0_SIG_Mod4_volt_7:
-            case CAN0_SIG_Mod4_volt_8:
-            case CAN0_SIG_Mod5_volt_6:
-            case CAN0_SIG_Mod5_volt_7:
-            case CAN0_SIG_Mod5_volt_8:
-            case CAN0_SIG_Mod6_volt_6:
-            case CAN0_SIG_Mod6_volt_7:
-            case CAN0_SIG_Mod6_volt_8:
-            case CAN0_SIG_Mod7_volt_6:
-            case CAN0_SIG_Mod7_volt_7:
-            case CAN0_SIG_Mod7_volt_8:
-#if defined(ITRI_MOD_5)
-            case CAN0_SIG_Mod8_volt_6:
-			case CAN0_SIG_Mod8_volt_7:
-			case CAN0_SIG_Mod8_volt_8:
-            case CAN0_SIG_Mod9_volt_6:
-			case CAN0_SIG_Mod9_volt_7:
-			case CAN0_SIG_Mod9_volt_8:
-            case CAN0_SIG_Mod10_volt_6:
-			case CAN0_SIG_Mod10_volt_7:
-			case CAN0_SIG_Mod10_volt_8:
-            case CAN0_SIG_Mod11_volt_6:
-			case CAN0_SIG_Mod11_volt_7:
-			case CAN0_SIG_Mod11_volt_8:
-            case CAN0_SIG_Mod12_volt_6:
-			case CAN0_SIG_Mod12_volt_7:
-			case CAN0_SIG_Mod12_volt_8:
-            case CAN0_SIG_Mod13_volt_6:
-			case CAN0_SIG_Mod13_volt_7:
-			case CAN0_SIG_Mod13_volt_8:
-            case CAN0_SIG_Mod14_volt_6:
-			case CAN0_SIG_Mod14_volt_7:
-			case CAN0_SIG_Mod14_volt_8:
-            case CAN0_SIG_Mod15_volt_6:
-			case CAN0_SIG_Mod15_volt_7:
-			case CAN0_SIG_Mod15_volt_8:
-            case CAN0_SIG_Mod16_volt_6:
-			case CAN0_SIG_Mod16_volt_7:
-			case CAN0_SIG_Mod16_volt_8:
-            case CAN0_SIG_Mod17_volt_6:
-			case CAN0_SIG_Mod17_volt_7:
-			case CAN0_SIG_Mod17_volt_8:
-            case CAN0_SIG_Mod18_volt_6:
-			case CAN0_SIG_Mod18_volt_7:
-			case CAN0_SIG_Mod18_volt_8:
-            case CAN0_SIG_Mod19_volt_6:
-			case CAN0_SIG_Mod19_volt_7:
-			case CAN0_SIG_Mod19_volt_8:
-            case CAN0_SIG_Mod20_volt_6:
-			case CAN0_SIG_Mod20_volt_7:
-			case CAN0_SIG_Mod20_volt_8:
-            case CAN0_SIG_Mod21_volt_6:
-			case CAN0_SIG_Mod21_volt_7:
-			case CAN0_SIG_Mod21_volt_8:
-            case CAN0_SIG_Mod22_volt_6:
-			case CAN0_SIG_Mod22_volt_7:
-			case CAN0_SIG_Mod22_volt_8:
-            case CAN0_SIG_Mod23_volt_6:
-			case CAN0_SIG_Mod23_volt_7:
-			case CAN0_SIG_Mod23_volt_8:
-            case CAN0_SIG_Mod24_volt_6:
-			case CAN0_SIG_Mod24_volt_7:
-			case CAN0_SIG_Mod24_volt_8:
-#endif // ITRI_MOD_5
-                cellIdx--;  /* Because cell 0 - valid flag = 1, decrement by one to get the right index */
-                cellIdx--;  /* Because of signal: CAN0_SIG_Modx_volt_valid_3_5 */
-                cellIdx--;  /* Because of signal: CAN0_SIG_Modx_volt_valid_6_8 */
-                tmpVal = volt_tab.voltage[(modIdx * BS_NR_OF_BAT_CELLS_PER_MODULE) + cellIdx];
-                break;
+    if ((msgIdx < CANS_GEN_CAN0_FIRST_CELL_MESSAGE) ||
+            (msgIdx >= (CANS_GEN_CAN0_FIRST_CELL_MESSAGE + CANS_GEN_NR_OF_CELL_MESSAGES))) {
+        return FALSE;
+    }
 
-            case CAN0_SIG_Mod0_volt_9:
-            case CAN0_SIG_Mod0_volt_10:
-            case CAN0_SIG_Mod0_volt_11:
-            case CAN0_SIG_Mod1_volt_9:
-            case CAN0_SIG_Mod1_volt_10:
-            case CAN0_SIG_Mod1_volt_11:
-            case CAN0_SIG_Mod2_volt_9:
-            case CAN0_SIG_Mod2_volt_10:
-            case CAN0_SIG_Mod2_volt_11:
-            case CAN0_SIG_Mod3_volt_9:
-            case CAN0_SIG_Mod3_volt_10:
-            case CAN0_SIG_Mod3_volt_11:
-            case CAN0_SIG_Mod4_volt_9:
-            case CAN0_SIG_Mod4_volt_10:
-            case CAN0_SIG_Mod4_volt_11:
-            case CAN0_SIG_Mod5_volt_9:
-            case CAN0_SIG_Mod5_volt_10:
-            case CAN0_SIG_Mod5_volt_11:
-            case CAN0_SIG_Mod6_volt_9:
-            case CAN0_SIG_Mod6_volt_10:
-            case CAN0_SIG_Mod6_volt_11:
-            case CAN0_SIG_Mod7_volt_9:
-            case CAN0_SIG_Mod7_volt_10:
-            case CAN0_SIG_Mod7_volt_11:
-#if defined(ITRI_MOD_5)
-            case CAN0_SIG_Mod8_volt_9:
-			case CAN0_SIG_Mod8_volt_10:
-			case CAN0_SIG_Mod8_volt_11:
-			case CAN0_SIG_Mod9_volt_9:
-			case CAN0_SIG_Mod9_volt_10:
-			case CAN0_SIG_Mod9_volt_11:
-			case CAN0_SIG_Mod10_volt_9:
-			case CAN0_SIG_Mod10_volt_10:
-			case CAN0_SIG_Mod10_volt_11:
-			case CAN0_SIG_Mod11_volt_9:
-			case CAN0_SIG_Mod11_volt_10:
-			case CAN0_SIG_Mod11_volt_11:
-			case CAN0_SIG_Mod12_volt_9:
-			case CAN0_SIG_Mod12_volt_10:
-			case CAN0_SIG_Mod12_volt_11:
-			case CAN0_SIG_Mod13_volt_9:
-			case CAN0_SIG_Mod13_volt_10:
-			case CAN0_SIG_Mod13_volt_11:
-			case CAN0_SIG_Mod14_volt_9:
-			case CAN0_SIG_Mod14_volt_10:
-			case CAN0_SIG_Mod14_volt_11:
-			case CAN0_SIG_Mod15_volt_9:
-			case CAN0_SIG_Mod15_volt_10:
-			case CAN0_SIG_Mod15_volt_11:
-			case CAN0_SIG_Mod16_volt_9:
-			case CAN0_SIG_Mod16_volt_10:
-			case CAN0_SIG_Mod16_volt_11:
-			case CAN0_SIG_Mod17_volt_9:
-			case CAN0_SIG_Mod17_volt_10:
-			case CAN0_SIG_Mod17_volt_11:
-			case CAN0_SIG_Mod18_volt_9:
-			case CAN0_SIG_Mod18_volt_10:
-			case CAN0_SIG_Mod18_volt_11:
-			case CAN0_SIG_Mod19_volt_9:
-			case CAN0_SIG_Mod19_volt_10:
-			case CAN0_SIG_Mod19_volt_11:
-			case CAN0_SIG_Mod20_volt_9:
-			case CAN0_SIG_Mod20_volt_10:
-			case CAN0_SIG_Mod20_volt_11:
-			case CAN0_SIG_Mod21_volt_9:
-			case CAN0_SIG_Mod21_volt_10:
-			case CAN0_SIG_Mod21_volt_11:
-			case CAN0_SIG_Mod22_volt_9:
-			case CAN0_SIG_Mod22_volt_10:
-			case CAN0_SIG_Mod22_volt_11:
-			case CAN0_SIG_Mod23_volt_9:
-			case CAN0_SIG_Mod23_volt_10:
-			case CAN0_SIG_Mod23_volt_11:
-			case CAN0_SIG_Mod24_volt_9:
-			case CAN0_SIG_Mod24_volt_10:
-			case CAN0_SIG_Mod24_volt_11:
-#endif // ITRI_MOD_5
-                cellIdx--;  /* Because cell 0 - valid flag = 1, decrement by one to get the right index */
-                cellIdx--;  /* Because of signal: CAN0_SIG_Modx_volt_valid_3_5 */
-                cellIdx--;  /* Because of signal: CAN0_SIG_Modx_volt_valid_6_8 */
-                cellIdx--;  /* Because of signal: CAN0_SIG_Modx_volt_valid_9_11 */
-                tmpVal = volt_tab.voltage[(modIdx * BS_NR_OF_BAT_CELLS_PER_MODULE) + cellIdx];
-                break;
+    msgOffset = (uint32_t)msgIdx - CANS_GEN_CAN0_FIRST_CELL_MESSAGE;
 
-            default:
-                break;
-        }
-        /* Check limits */
-        canData = cans_checkLimits((float)tmpVal, sigIdx);
-        /* Apply offset and factor */
-        *(uint32_t *)value = (uint32_t)((canData + cans_CAN0_signals_tx[sigIdx].offset) * cans_CAN0_signals_tx[sigIdx].factor);
+#if CAN_CELLVOLT_MULTIPLEXED == TRUE
+    if (msgOffset >= CANS_GEN_CELLVOLTMUX_FIRST_MESSAGE) {
+        dataPtr64[0] = cans_composecellvoltmux(msgOffset - CANS_GEN_CELLVOLTMUX_FIRST_MESSAGE);
+        return TRUE;
     }
+#endif
 
-    return 0;
-}
-
-uint32_t cans_gettemp(uint32_t sigIdx, void *value) {
-    static DATA_BLOCK_CELLTEMPERATURE_s temp_tab;
-    uint16_t modIdx = 0;
-    uint32_t cellIdx = 0;
-    uint32_t tmp = 0;
-    float tmpVal = 0;
-    float canData = 0;
+    /* Determine module and message number */
+    modIdx = msgOffset / CANS_GEN_MESSAGES_PER_MODULE;
+    msgInModule = msgOffset % CANS_GEN_MESSAGES_PER_MODULE;
 
-    /* first signal to transmit cell temperatures */
-    if (sigIdx == CAN0_SIG_Mod0_temp_valid_0_2) {
-        DB_ReadBlock(&temp_tab, DATA_BLOCK_ID_CELLTEMPERATURE);
+    if (CANS_IS_CELLVOLT_MESSAGE(msgInModule)) {
+        dataPtr64[0] = cans_composecellvolt(modIdx, msgInModule - CANS_GEN_CELLVOLT_FIRST_MESSAGE);
+    } else {
+        dataPtr64[0] = cans_composecelltemp(modIdx, msgInModule - CANS_GEN_CELLTEMP_FIRST_MESSAGE);
     }
+    return TRUE;
+}
 
-    /* Determine module and cell number */
-    if (sigIdx - CAN0_SIG_Mod0_temp_valid_0_2 < CANS_MODULSIGNALS_TEMP) {
-        modIdx = 0;
-        cellIdx = sigIdx - CAN0_SIG_Mod0_temp_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod1_temp_valid_0_2 < CANS_MODULSIGNALS_TEMP) {
-        modIdx = 1;
-        cellIdx = sigIdx - CAN0_SIG_Mod1_temp_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod2_temp_valid_0_2 < CANS_MODULSIGNALS_TEMP) {
-        modIdx = 2;
-        cellIdx = sigIdx - CAN0_SIG_Mod2_temp_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod3_temp_valid_0_2 < CANS_MODULSIGNALS_TEMP) {
-        modIdx = 3;
-        cellIdx = sigIdx - CAN0_SIG_Mod3_temp_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod4_temp_valid_0_2 < CANS_MODULSIGNALS_TEMP) {
-        modIdx = 4;
-        cellIdx = sigIdx - CAN0_SIG_Mod4_temp_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod5_temp_valid_0_2 < CANS_MODULSIGNALS_TEMP) {
-        modIdx = 5;
-        cellIdx = sigIdx - CAN0_SIG_Mod5_temp_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod6_temp_valid_0_2 < CANS_MODULSIGNALS_TEMP) {
-        modIdx = 6;
-        cellIdx = sigIdx - CAN0_SIG_Mod6_temp_valid_0_2;
-    } else if (sigIdx - CAN0_SIG_Mod7_temp_valid_0_2 < CANS_MODULSIGNALS_TEMP) {
-        modIdx = 7;
-        cellIdx = sigIdx - CAN0_SIG_Mod7_temp_valid_0_2;
+/**
+ * reads consecutive cell voltages of a module from the database
+ *
+ * @param[in]  modIdx       module
+ * @param[in]  firstCell    first cell within the module
+ * @param[in]  nrOfValues   number of cells to read, cells beyond the module are set to 0 and invalid
+ * @param[out] voltage      cell voltages in mV
+ *
+ * @return valid flags, bit i is set if the voltage of cell firstCell + i is valid
+ */
+static uint32_t cans_readcellvoltages(uint32_t modIdx, uint32_t firstCell, uint32_t nrOfValues, uint16_t voltage[]) {
+    uint32_t valid_voltPECs = 0;
+    uint32_t nrOfCells = 0;
+    DATA_BLOCK_RANGE_s ranges[2];
+    uint32_t i = 0;
+
+    for (i = 0; i < nrOfValues; i++) {
+        voltage[i] = 0;
     }
-#if defined(ITRI_MOD_5)
-    else if (sigIdx - CAN0_SIG_Mod8_temp_valid_0_2 <= CANS_MODULSIGNALS_TEMP) {
-            modIdx = 8;
-            cellIdx = sigIdx - CAN0_SIG_Mod8_temp_valid_0_2;
+    if ((modIdx >= BS_NR_OF_MODULES) || (firstCell >= BS_NR_OF_BAT_CELLS_PER_MODULE)) {
+        return 0;
     }
-    else if (sigIdx - CAN0_SIG_Mod9_temp_valid_0_2 <= CANS_MODULSIGNALS_TEMP) {
-        modIdx = 9;
-        cellIdx = sigIdx - CAN0_SIG_Mod9_temp_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod10_temp_valid_0_2 <= CANS_MODULSIGNALS_TEMP) {
-		modIdx = 10;
-		cellIdx = sigIdx - CAN0_SIG_Mod10_temp_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod11_temp_valid_0_2 <= CANS_MODULSIGNALS_TEMP) {
-		modIdx = 11;
-		cellIdx = sigIdx - CAN0_SIG_Mod11_temp_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod12_temp_valid_0_2 <= CANS_MODULSIGNALS_TEMP) {
-		modIdx = 12;
-		cellIdx = sigIdx - CAN0_SIG_Mod12_temp_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod13_temp_valid_0_2 <= CANS_MODULSIGNALS_TEMP) {
-		modIdx = 13;
-		cellIdx = sigIdx - CAN0_SIG_Mod13_temp_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod14_temp_valid_0_2 <= CANS_MODULSIGNALS_TEMP) {
-		modIdx = 14;
-		cellIdx = sigIdx - CAN0_SIG_Mod14_temp_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod15_temp_valid_0_2 <= CANS_MODULSIGNALS_TEMP) {
-		modIdx = 15;
-		cellIdx = sigIdx - CAN0_SIG_Mod15_temp_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod16_temp_valid_0_2 <= CANS_MODULSIGNALS_TEMP) {
-		modIdx = 16;
-		cellIdx = sigIdx - CAN0_SIG_Mod16_temp_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod17_temp_valid_0_2 <= CANS_MODULSIGNALS_TEMP) {
-		modIdx = 17;
-		cellIdx = sigIdx - CAN0_SIG_Mod17_temp_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod18_temp_valid_0_2 <= CANS_MODULSIGNALS_TEMP) {
-		modIdx = 18;
-		cellIdx = sigIdx - CAN0_SIG_Mod18_temp_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod19_temp_valid_0_2 <= CANS_MODULSIGNALS_TEMP) {
-		modIdx = 19;
-		cellIdx = sigIdx - CAN0_SIG_Mod19_temp_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod20_temp_valid_0_2 <= CANS_MODULSIGNALS_TEMP) {
-		modIdx = 20;
-		cellIdx = sigIdx - CAN0_SIG_Mod20_temp_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod21_temp_valid_0_2 <= CANS_MODULSIGNALS_TEMP) {
-		modIdx = 21;
-		cellIdx = sigIdx - CAN0_SIG_Mod21_temp_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod22_temp_valid_0_2 <= CANS_MODULSIGNALS_TEMP) {
-		modIdx = 22;
-		cellIdx = sigIdx - CAN0_SIG_Mod22_temp_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod23_temp_valid_0_2 <= CANS_MODULSIGNALS_TEMP) {
-		modIdx = 23;
-		cellIdx = sigIdx - CAN0_SIG_Mod23_temp_valid_0_2;
-	}
-    else if (sigIdx - CAN0_SIG_Mod24_temp_valid_0_2 <= CANS_MODULSIGNALS_TEMP) {
-		modIdx = 24;
-		cellIdx = sigIdx - CAN0_SIG_Mod24_temp_valid_0_2;
-	}
-#endif // ITRI_MOD_5
-
-    if (value != NULL_PTR) {
-        switch (sigIdx) {
-            case CAN0_SIG_Mod0_temp_valid_0_2:
-            case CAN0_SIG_Mod1_temp_valid_0_2:
-            case CAN0_SIG_Mod2_temp_valid_0_2:
-            case CAN0_SIG_Mod3_temp_valid_0_2:
-            case CAN0_SIG_Mod4_temp_valid_0_2:
-            case CAN0_SIG_Mod5_temp_valid_0_2:
-            case CAN0_SIG_Mod6_temp_valid_0_2:
-            case CAN0_SIG_Mod7_temp_valid_0_2:
-#if defined(ITRI_MOD_5)
-            case CAN0_SIG_Mod8_temp_valid_0_2:
-            case CAN0_SIG_Mod9_temp_valid_0_2:
-            case CAN0_SIG_Mod10_temp_valid_0_2:
-            case CAN0_SIG_Mod11_temp_valid_0_2:
-            case CAN0_SIG_Mod12_temp_valid_0_2:
-            case CAN0_SIG_Mod13_temp_valid_0_2:
-            case CAN0_SIG_Mod14_temp_valid_0_2:
-            case CAN0_SIG_Mod15_temp_valid_0_2:
-            case CAN0_SIG_Mod16_temp_valid_0_2:
-            case CAN0_SIG_Mod17_temp_valid_0_2:
-            case CAN0_SIG_Mod18_temp_valid_0_2:
-            case CAN0_SIG_Mod19_temp_valid_0_2:
-            case CAN0_SIG_Mod20_temp_valid_0_2:
-            case CAN0_SIG_Mod21_temp_valid_0_2:
-            case CAN0_SIG_Mod22_temp_valid_0_2:
-            case CAN0_SIG_Mod23_temp_valid_0_2:
-            case CAN0_SIG_Mod24_temp_valid_0_2:
-#endif // ITRI_MOD_5
-                tmp = temp_tab.valid_temperaturePECs[modIdx];
-                tmpVal = 0x07 & tmp;
-                break;
 
-            case CAN0_SIG_Mod0_temp_valid_3_5:
-            case CAN0_SIG_Mod1_temp_valid_3_5:
-            case CAN0_SIG_Mod2_temp_valid_3_5:
-            case CAN0_SIG_Mod3_temp_valid_3_5:
-            case CAN0_SIG_Mod4_temp_valid_3_5:
-            case CAN0_SIG_Mod5_temp_valid_3_5:
-            case CAN0_SIG_Mod6_temp_valid_3_5:
-            case CAN0_SIG_Mod7_temp_valid_3_5:
-#if defined(ITRI_MOD_5)
-            case CAN0_SIG_Mod8_temp_valid_3_5:
-            case CAN0_SIG_Mod9_temp_valid_3_5:
-            case CAN0_SIG_Mod10_temp_valid_3_5:
-            case CAN0_SIG_Mod11_temp_valid_3_5:
-            case CAN0_SIG_Mod12_temp_valid_3_5:
-            case CAN0_SIG_Mod13_temp_valid_3_5:
-            case CAN0_SIG_Mod14_temp_valid_3_5:
-            case CAN0_SIG_Mod15_temp_valid_3_5:
-            case CAN0_SIG_Mod16_temp_valid_3_5:
-            case CAN0_SIG_Mod17_temp_valid_3_5:
-            case CAN0_SIG_Mod18_temp_valid_3_5:
-            case CAN0_SIG_Mod19_temp_valid_3_5:
-            case CAN0_SIG_Mod20_temp_valid_3_5:
-            case CAN0_SIG_Mod21_temp_valid_3_5:
-            case CAN0_SIG_Mod22_temp_valid_3_5:
-            case CAN0_SIG_Mod23_temp_valid_3_5:
-            case CAN0_SIG_Mod24_temp_valid_3_5:
-#endif // ITRI_MOD_5
-                tmp = temp_tab.valid_temperaturePECs[modIdx] >> 3;
-                tmpVal = 0x07 & tmp;
-                break;
-
-            case CAN0_SIG_Mod0_temp_valid_6_8:
-            case CAN0_SIG_Mod1_temp_valid_6_8:
-            case CAN0_SIG_Mod2_temp_valid_6_8:
-            case CAN0_SIG_Mod3_temp_valid_6_8:
-            case CAN0_SIG_Mod4_temp_valid_6_8:
-            case CAN0_SIG_Mod5_temp_valid_6_8:
-            case CAN0_SIG_Mod6_temp_valid_6_8:
-            case CAN0_SIG_Mod7_temp_valid_6_8:
-#if defined(ITRI_MOD_5)
-            case CAN0_SIG_Mod8_temp_valid_6_8:
-            case CAN0_SIG_Mod9_temp_valid_6_8:
-            case CAN0_SIG_Mod10_temp_valid_6_8:
-            case CAN0_SIG_Mod11_temp_valid_6_8:
-            case CAN0_SIG_Mod12_temp_valid_6_8:
-            case CAN0_SIG_Mod13_temp_valid_6_8:
-            case CAN0_SIG_Mod14_temp_valid_6_8:
-            case CAN0_SIG_Mod15_temp_valid_6_8:
-            case CAN0_SIG_Mod16_temp_valid_6_8:
-            case CAN0_SIG_Mod17_temp_valid_6_8:
-            case CAN0_SIG_Mod18_temp_valid_6_8:
-            case CAN0_SIG_Mod19_temp_valid_6_8:
-            case CAN0_SIG_Mod20_temp_valid_6_8:
-            case CAN0_SIG_Mod21_temp_valid_6_8:
-            case CAN0_SIG_Mod22_temp_valid_6_8:
-            case CAN0_SIG_Mod23_temp_valid_6_8:
-            case CAN0_SIG_Mod24_temp_valid_6_8:
-#endif // ITRI_MOD_5
-                tmp = temp_tab.valid_temperaturePECs[modIdx] >> 6;
-                tmpVal = 0x07 & tmp;
-                break;
-
-            case CAN0_SIG_Mod0_temp_valid_9_11:
-            case CAN0_SIG_Mod1_temp_valid_9_11:
-            case CAN0_SIG_Mod2_temp_valid_9_11:
-            case CAN0_SIG_Mod3_temp_valid_9_11:
-            case CAN0_SIG_Mod4_temp_valid_9_11:
-            case CAN0_SIG_Mod5_temp_valid_9_11:
-            case CAN0_SIG_Mod6_temp_valid_9_11:
-            case CAN0_SIG_Mod7_temp_valid_9_11:
-#if defined(ITRI_MOD_5)
-            case CAN0_SIG_Mod8_temp_valid_9_11:
-            case CAN0_SIG_Mod9_temp_valid_9_11:
-            case CAN0_SIG_Mod10_temp_valid_9_11:
-            case CAN0_SIG_Mod11_temp_valid_9_11:
-            case CAN0_SIG_Mod12_temp_valid_9_11:
-            case CAN0_SIG_Mod13_temp_valid_9_11:
-            case CAN0_SIG_Mod14_temp_valid_9_11:
-            case CAN0_SIG_Mod15_temp_valid_9_11:
-            case CAN0_SIG_Mod16_temp_valid_9_11:
-            case CAN0_SIG_Mod17_temp_valid_9_11:
-            case CAN0_SIG_Mod18_temp_valid_9_11:
-            case CAN0_SIG_Mod19_temp_valid_9_11:
-            case CAN0_SIG_Mod20_temp_valid_9_11:
-            case CAN0_SIG_Mod21_temp_valid_9_11:
-            case CAN0_SIG_Mod22_temp_valid_9_11:
-            case CAN0_SIG_Mod23_temp_valid_9_11:
-            case CAN0_SIG_Mod24_temp_valid_9_11:
-#endif // ITRI_MOD_5
-                tmp = temp_tab.valid_temperaturePECs[modIdx] >> 9;
-                tmpVal = 0x07 & tmp;
-                break;
+    /* only the cells of this module are read, the remaining values stay 0 */
+    nrOfCells = BS_NR_OF_BAT_CELLS_PER_MODULE - firstCell;
+    if (nrOfCells > nrOfValues) {
+        nrOfCells = nrOfValues;
+    }
+    /* voltages and valid flags from the same measurement */
+    ranges[0].dataptrtoReceiver = voltage;
+    ranges[0].offset = DATA_FIELD_OFFSET(DATA_BLOCK_CELLVOLTAGE_s, voltage) +
+            (((modIdx * BS_NR_OF_BAT_CELLS_PER_MODULE) + firstCell) * sizeof(uint16_t));
+    ranges[0].length = nrOfCells * sizeof(uint16_t);
+    ranges[1].dataptrtoReceiver = &valid_voltPECs;
+    ranges[1].offset = DATA_FIELD_OFFSET(DATA_BLOCK_CELLVOLTAGE_s, valid_voltPECs) + (modIdx * sizeof(uint32_t));
+    ranges[1].length = sizeof(uint32_t);
+    DB_ReadBlockRanges(ranges, 2, DATA_BLOCK_ID_CELLVOLTAGE);
+    return (valid_voltPECs >> firstCell) & ((1u << nrOfCells) - 1u);
+}
 
-            case CAN0_SIG_Mod0_temp_0:
-            case CAN0_SIG_Mod0_temp_1:
-            case CAN0_SIG_Mod0_temp_2:
-            case CAN0_SIG_Mod1_temp_0:
-            case CAN0_SIG_Mod1_temp_1:
-            case CAN0_SIG_Mod1_temp_2:
-            case CAN0_SIG_Mod2_temp_0:
-            case CAN0_SIG_Mod2_temp_1:
-            case CAN0_SIG_Mod2_temp_2:
-            case CAN0_SIG_Mod3_temp_0:
-            case CAN0_SIG_Mod3_temp_1:
-            case CAN0_SIG_Mod3_temp_2:
-            case CAN0_SIG_Mod4_temp_0:
-            case CAN0_SIG_Mod4_temp_1:
-            case CAN0_SIG_Mod4_temp_2:
-            case CAN0_SIG_Mod5_temp_0:
-            case CAN0_SIG_Mod5_temp_1:
-            case CAN0_SIG_Mod5_temp_2:
-            case CAN0_SIG_Mod6_temp_0:
-            case CAN0_SIG_Mod6_temp_1:
-            case CAN0_SIG_Mod6_temp_2:
-            case CAN0_SIG_Mod7_temp_0:
-            case CAN0_SIG_Mod7_temp_1:
-            case CAN0_SIG_Mod7_temp_2:
-#if defined(ITRI_MOD_5)
-            case CAN0_SIG_Mod8_temp_0:
-            case CAN0_SIG_Mod8_temp_1:
-            case CAN0_SIG_Mod8_temp_2:
-            case CAN0_SIG_Mod9_temp_0:
-            case CAN0_SIG_Mod9_temp_1:
-            case CAN0_SIG_Mod9_temp_2:
-            case CAN0_SIG_Mod10_temp_0:
-            case CAN0_SIG_Mod10_temp_1:
-            case CAN0_SIG_Mod10_temp_2:
-            case CAN0_SIG_Mod11_temp_0:
-            case CAN0_SIG_Mod11_temp_1:
-            case CAN0_SIG_Mod11_temp_2:
-            case CAN0_SIG_Mod12_temp_0:
-            case CAN0_SIG_Mod12_temp_1:
-            case CAN0_SIG_Mod12_temp_2:
-            case CAN0_SIG_Mod13_temp_0:
-            case CAN0_SIG_Mod13_temp_1:
-            case CAN0_SIG_Mod13_temp_2:
-            case CAN0_SIG_Mod14_temp_0:
-            case CAN0_SIG_Mod14_temp_1:
-            case CAN0_SIG_Mod14_temp_2:
-            case CAN0_SIG_Mod15_temp_0:
-            case CAN0_SIG_Mod15_temp_1:
-            case CAN0_SIG_Mod15_temp_2:
-            case CAN0_SIG_Mod16_temp_0:
-            case CAN0_SIG_Mod16_temp_1:
-            case CAN0_SIG_Mod16_temp_2:
-            case CAN0_SIG_Mod17_temp_0:
-            case CAN0_SIG_Mod17_temp_1:
-            case CAN0_SIG_Mod17_temp_2:
-            case CAN0_SIG_Mod18_temp_0:
-            case CAN0_SIG_Mod18_temp_1:
-            case CAN0_SIG_Mod18_temp_2:
-            case CAN0_SIG_Mod19_temp_0:
-            case CAN0_SIG_Mod19_temp_1:
-            case CAN0_SIG_Mod19_temp_2:
-            case CAN0_SIG_Mod20_temp_0:
-            case CAN0_SIG_Mod20_temp_1:
-            case CAN0_SIG_Mod20_temp_2:
-            case CAN0_SIG_Mod21_temp_0:
-            case CAN0_SIG_Mod21_temp_1:
-            case CAN0_SIG_Mod21_temp_2:
-            case CAN0_SIG_Mod22_temp_0:
-            case CAN0_SIG_Mod22_temp_1:
-            case CAN0_SIG_Mod22_temp_2:
-            case CAN0_SIG_Mod23_temp_0:
-            case CAN0_SIG_Mod23_temp_1:
-            case CAN0_SIG_Mod23_temp_2:
-            case CAN0_SIG_Mod24_temp_0:
-            case CAN0_SIG_Mod24_temp_1:
-            case CAN0_SIG_Mod24_temp_2:
-#endif // ITRI_MOD_5
-                cellIdx--;  /* Because cell 0 - valid flag = 1, decrement by one to get the right index */
-                tmpVal = temp_tab.temperature[(modIdx * BS_NR_OF_TEMP_SENSORS_PER_MODULE) + cellIdx];
-                break;
+/**
+ * composes the data of a cell voltage message of a module
+ *
+ * @param modIdx    module
+ * @param message   cell voltage message within the module
+ *
+ * @return message data
+ */
+static uint64_t cans_composecellvolt(uint32_t modIdx, uint32_t message) {
+    uint32_t raw[CANS_GEN_CELLVOLT_VALUES_PER_MESSAGE] = {0};
+    uint16_t voltage[CANS_GEN_CELLVOLT_VALUES_PER_MESSAGE] = {0};
+    uint32_t valid = 0;
+    uint32_t i = 0;
+
+    valid = cans_readcellvoltages(modIdx, message * CANS_GEN_CELLVOLT_VALUES_PER_MESSAGE,
+            CANS_GEN_CELLVOLT_VALUES_PER_MESSAGE, voltage);
+    for (i = 0; i < CANS_GEN_CELLVOLT_VALUES_PER_MESSAGE; i++) {
+        raw[i] = CANS_GEN_CellvoltToRaw((float)voltage[i]);
+    }
+    return CANS_GEN_PackCellvolt(valid, raw);
+}
 
-            case CAN0_SIG_Mod0_temp_3:
-            case CAN0_SIG_Mod0_temp_4:
-            case CAN0_SIG_Mod0_temp_5:
-            case CAN0_SIG_Mod1_temp_3:
-            case CAN0_SIG_Mod1_temp_4:
-            case CAN0_SIG_Mod1_temp_5:
-            case CAN0_SIG_Mod2_temp_3:
-            case CAN0_SIG_Mod2_temp_4:
-            case CAN0_SIG_Mod2_temp_5:
-            case CAN0_SIG_Mod3_temp_3:
-            case CAN0_SIG_Mod3_temp_4:
-            case CAN0_SIG_Mod3_temp_5:
-            case CAN0_SIG_Mod4_temp_3:
-            case CAN0_SIG_Mod4_temp_4:
-            case CAN0_SIG_Mod4_temp_5:
-            case CAN0_SIG_Mod5_temp_3:
-            case CAN0_SIG_Mod5_temp_4:
-            case CAN0_SIG_Mod5_temp_5:
-            case CAN0_SIG_Mod6_temp_3:
-            case CAN0_SIG_Mod6_temp_4:
-            case CAN0_SIG_Mod6_temp_5:
-            case CAN0_SIG_Mod7_temp_3:
-            case CAN0_SIG_Mod7_temp_4:
-            case CAN0_SIG_Mod7_temp_5:
-#if defined(ITRI_MOD_5)
-            case CAN0_SIG_Mod8_temp_3:
-            case CAN0_SIG_Mod8_temp_4:
-            case CAN0_SIG_Mod8_temp_5:
-            case CAN0_SIG_Mod9_temp_3:
-            case CAN0_SIG_Mod9_temp_4:
-            case CAN0_SIG_Mod9_temp_5:
-            case CAN0_SIG_Mod10_temp_3:
-            case CAN0_SIG_Mod10_temp_4:
-            case CAN0_SIG_Mod10_temp_5:
-            case CAN0_SIG_Mod11_temp_3:
-            case CAN0_SIG_Mod11_temp_4:
-            case CAN0_SIG_Mod11_temp_5:
-            case CAN0_SIG_Mod12_temp_3:
-            case CAN0_SIG_Mod12_temp_4:
-            case CAN0_SIG_Mod12_temp_5:
-            case CAN0_SIG_Mod13_temp_3:
-            case CAN0_SIG_Mod13_temp_4:
-            case CAN0_SIG_Mod13_temp_5:
-            case CAN0_SIG_Mod14_temp_3:
-            case CAN0_SIG_Mod14_temp_4:
-            case CAN0_SIG_Mod14_temp_5:
-            case CAN0_SIG_Mod15_temp_3:
-            case CAN0_SIG_Mod15_temp_4:
-            case CAN0_SIG_Mod15_temp_5:
-            case CAN0_SIG_Mod16_temp_3:
-            case CAN0_SIG_Mod16_temp_4:
-            case CAN0_SIG_Mod16_temp_5:
-            case CAN0_SIG_Mod17_temp_3:
-            case CAN0_SIG_Mod17_temp_4:
-            case CAN0_SIG_Mod17_temp_5:
-            case CAN0_SIG_Mod18_temp_3:
-            case CAN0_SIG_Mod18_temp_4:
-            case CAN0_SIG_Mod18_temp_5:
-            case CAN0_SIG_Mod19_temp_3:
-            case CAN0_SIG_Mod19_temp_4:
-            case CAN0_SIG_Mod19_temp_5:
-            case CAN0_SIG_Mod20_temp_3:
-            case CAN0_SIG_Mod20_temp_4:
-            case CAN0_SIG_Mod20_temp_5:
-            case CAN0_SIG_Mod21_temp_3:
-            case CAN0_SIG_Mod21_temp_4:
-            case CAN0_SIG_Mod21_temp_5:
-            case CAN0_SIG_Mod22_temp_3:
-            case CAN0_SIG_Mod22_temp_4:
-            case CAN0_SIG_Mod22_temp_5:
-            case CAN0_SIG_Mod23_temp_3:
-            case CAN0_SIG_Mod23_temp_4:
-            case CAN0_SIG_Mod23_temp_5:
-            case CAN0_SIG_Mod24_temp_3:
-            case CAN0_SIG_Mod24_temp_4:
-            case CAN0_SIG_Mod24_temp_5:
-#endif // ITRI_MOD_5
-                cellIdx--;  /* Because cell 0 - valid flag = 1, decrement by one to get the right index */
-                cellIdx--;  /* Because of signal: CAN0_SIG_Modx_temp_valid_3_5 */
-                tmpVal = temp_tab.temperature[(modIdx * BS_NR_OF_TEMP_SENSORS_PER_MODULE) + cellIdx];
-                break;
+#if CAN_CELLVOLT_MULTIPLEXED == TRUE
+/**
+ * composes the data of a multiplexed cell voltage message
+ *
+ * @param mux   multiplexer value, selects module and cell group
+ *
+ * @return message data
+ */
+static uint64_t cans_composecellvoltmux(uint32_t mux) {
+    uint32_t raw[CANS_GEN_CELLVOLTMUX_VALUES_PER_MESSAGE] = {0};
+    uint16_t voltage[CANS_GEN_CELLVOLTMUX_VALUES_PER_MESSAGE] = {0};
+    uint32_t modIdx = mux / CANS_GEN_CELLVOLTMUX_NR_OF_MESSAGES;
+    uint32_t message = mux % CANS_GEN_CELLVOLTMUX_NR_OF_MESSAGES;
+    uint32_t valid = 0;
+    uint32_t i = 0;
+
+    valid = cans_readcellvoltages(modIdx, message * CANS_GEN_CELLVOLTMUX_VALUES_PER_MESSAGE,
+            CANS_GEN_CELLVOLTMUX_VALUES_PER_MESSAGE, voltage);
+    for (i = 0; i < CANS_GEN_CELLVOLTMUX_VALUES_PER_MESSAGE; i++) {
+        raw[i] = CANS_GEN_CellvoltMuxToRaw((float)voltage[i]);
+    }
+    return CANS_GEN_PackCellvoltMux(mux, valid, raw);
+}
+#endif
 
-            case CAN0_SIG_Mod0_temp_6:
-            case CAN0_SIG_Mod0_temp_7:
-            case CAN0_SIG_Mod0_temp_8:
-            case CAN0_SIG_Mod1_temp_6:
-            case CAN0_SIG_Mod1_temp_7:
-            case CAN0_SIG_Mod1_temp_8:
-            case CAN0_SIG_Mod2_temp_6:
-            case CAN0_SIG_Mod2_temp_7:
-            case CAN0_SIG_Mod2_temp_8:
-            case CAN0_SIG_Mod3_temp_6:
-            case CAN0_SIG_Mod3_temp_7:
-            case CAN0_SIG_Mod3_temp_8:
-            case CAN0_SIG_Mod4_temp_6:
-            case CAN0_SIG_Mod4_temp_7:
-            case CAN0_SIG_Mod4_temp_8:
-            case CAN0_SIG_Mod5_temp_6:
-            case CAN0_SIG_Mod5_temp_7:
-            case CAN0_SIG_Mod5_temp_8:
-            case CAN0_SIG_Mod6_temp_6:
-            case CAN0_SIG_Mod6_temp_7:
-            case CAN0_SIG_Mod6_temp_8:
-            case CAN0_SIG_Mod7_temp_6:
-            case CAN0_SIG_Mod7_temp_7:
-            case CAN0_SIG_Mod7_temp_8:
-#if defined(ITRI_MOD_5)
-            case CAN0_SIG_Mod8_temp_6:
-            case CAN0_SIG_Mod8_temp_7:
-            case CAN0_SIG_Mod8_temp_8:
-            case CAN0_SIG_Mod9_temp_6:
-            case CAN0_SIG_Mod9_temp_7:
-            case CAN0_SIG_Mod9_temp_8:
-            case CAN0_SIG_Mod10_temp_6:
-            case CAN0_SIG_Mod10_temp_7:
-            case CAN0_SIG_Mod10_temp_8:
-            case CAN0_SIG_Mod11_temp_6:
-            case CAN0_SIG_Mod11_temp_7:
-            case CAN0_SIG_Mod11_temp_8:
-            case CAN0_SIG_Mod12_temp_6:
-            case CAN0_SIG_Mod12_temp_7:
-            case CAN0_SIG_Mod12_temp_8:
-            case CAN0_SIG_Mod13_temp_6:
-            case CAN0_SIG_Mod13_temp_7:
-            case CAN0_SIG_Mod13_temp_8:
-            case CAN0_SIG_Mod14_temp_6:
-            case CAN0_SIG_Mod14_temp_7:
-            case CAN0_SIG_Mod14_temp_8:
-            case CAN0_SIG_Mod15_temp_6:
-            case CAN0_SIG_Mod15_temp_7:
-            case CAN0_SIG_Mod15_temp_8:
-            case CAN0_SIG_Mod16_temp_6:
-            case CAN0_SIG_Mod16_temp_7:
-            case CAN0_SIG_Mod16_temp_8:
-            case CAN0_SIG_Mod17_temp_6:
-            case CAN0_SIG_Mod17_temp_7:
-            case CAN0_SIG_Mod17_temp_8:
-            case CAN0_SIG_Mod18_temp_6:
-            case CAN0_SIG_Mod18_temp_7:
-            case CAN0_SIG_Mod18_temp_8:
-            case CAN0_SIG_Mod19_temp_6:
-            case CAN0_SIG_Mod19_temp_7:
-            case CAN0_SIG_Mod19_temp_8:
-            case CAN0_SIG_Mod20_temp_6:
-            case CAN0_SIG_Mod20_temp_7:
-            case CAN0_SIG_Mod20_temp_8:
-            case CAN0_SIG_Mod21_temp_6:
-            case CAN0_SIG_Mod21_temp_7:
-            case CAN0_SIG_Mod21_temp_8:
-            case CAN0_SIG_Mod22_temp_6:
-            case CAN0_SIG_Mod22_temp_7:
-            case CAN0_SIG_Mod22_temp_8:
-            case CAN0_SIG_Mod23_temp_6:
-            case CAN0_SIG_Mod23_temp_7:
-            case CAN0_SIG_Mod23_temp_8:
-            case CAN0_SIG_Mod24_temp_6:
-            case CAN0_SIG_Mod24_temp_7:
-            case CAN0_SIG_Mod24_temp_8:
-#endif // ITRI_MOD_5
-                cellIdx--;  /* Because cell 0 - valid flag = 1, decrement by one to get the right index */
-                cellIdx--;  /* Because of signal: CAN0_SIG_Modx_temp_valid_3_5 */
-                cellIdx--;  /* Because of signal: CAN0_SIG_Modx_temp_valid_6_8 */
-                tmpVal = temp_tab.temperature[(modIdx * BS_NR_OF_TEMP_SENSORS_PER_MODULE) + cellIdx];
-                break;
+/**
+ * composes the data of a cell temperature message of a module
+ *
+ * @param modIdx    module
+ * @param message   cell temperature message within the module
+ *
+ * @return message data
+ */
+static uint64_t cans_composecelltemp(uint32_t modIdx, uint32_t message) {
+    uint32_t raw[CANS_GEN_CELLTEMP_VALUES_PER_MESSAGE] = {0};
+    int16_t temperature[CANS_GEN_CELLTEMP_VALUES_PER_MESSAGE] = {0};
+    uint16_t valid_temperaturePECs = 0;
+    uint32_t firstSensor = message * CANS_GEN_CELLTEMP_VALUES_PER_MESSAGE;
+    uint32_t nrOfSensors = 0;
+    DATA_BLOCK_RANGE_s ranges[2];
+    uint32_t valid = 0;
+    uint32_t i = 0;
+
+    /* only the sensors of this module are sent, the remaining values of the message stay 0 */
+    if ((modIdx < BS_NR_OF_MODULES) && (firstSensor < BS_NR_OF_TEMP_SENSORS_PER_MODULE)) {
+        nrOfSensors = BS_NR_OF_TEMP_SENSORS_PER_MODULE - firstSensor;
+        if (nrOfSensors > CANS_GEN_CELLTEMP_VALUES_PER_MESSAGE) {
+            nrOfSensors = CANS_GEN_CELLTEMP_VALUES_PER_MESSAGE;
+        }
+        /* temperatures and valid flags from the same measurement */
+        ranges[0].dataptrtoReceiver = temperature;
+        ranges[0].offset = DATA_FIELD_OFFSET(DATA_BLOCK_CELLTEMPERATURE_s, temperature) +
+                (((modIdx * BS_NR_OF_TEMP_SENSORS_PER_MODULE) + firstSensor) * sizeof(int16_t));
+        ranges[0].length = nrOfSensors * sizeof(int16_t);
+        ranges[1].dataptrtoReceiver = &valid_temperaturePECs;
+        ranges[1].offset = DATA_FIELD_OFFSET(DATA_BLOCK_CELLTEMPERATURE_s, valid_temperaturePECs) + (modIdx * sizeof(uint16_t));
+        ranges[1].length = sizeof(uint16_t);
+        DB_ReadBlockRanges(ranges, 2, DATA_BLOCK_ID_CELLTEMPERATURE);
+        valid = (uint32_t)valid_temperaturePECs >> firstSensor;
+        for (i = 0; i < nrOfSensors; i++) {
+            raw[i] = CANS_GEN_CelltempToRaw((float)temperature[i]);
+        }
+    }
+    return CANS_GEN_PackCelltemp(valid, raw);
+}
 
-            case CAN0_SIG_Mod0_temp_9:
-            case CAN0_SIG_Mod0_temp_10:
-            case CAN0_SIG_Mod0_temp_11:
-            case CAN0_SIG_Mod1_temp_9:
-            case CAN0_SIG_Mod1_temp_10:
-            case CAN0_SIG_Mod1_temp_11:
-            case CAN0_SIG_Mod2_temp_9:
-            case CAN0_SIG_Mod2_temp_10:
-            case CAN0_SIG_Mod2_temp_11:
-            case CAN0_SIG_Mod3_temp_9:
-            case CAN0_SIG_Mod3_temp_10:
-            case CAN0_SIG_Mod3_temp_11:
-            case CAN0_SIG_Mod4_temp_9:
-            case CAN0_SIG_Mod4_temp_10:
-            case CAN0_SIG_Mod4_temp_11:
-            case CAN0_SIG_Mod5_temp_9:
-            case CAN0_SIG_Mod5_temp_10:
-            case CAN0_SIG_Mod5_temp_11:
-            case CAN0_SIG_Mod6_temp_9:
-            case CAN0_SIG_Mod6_temp_10:
-            case CAN0_SIG_Mod6_temp_11:
-            case CAN0_SIG_Mod7_temp_9:
-            case CAN0_SIG_Mod7_temp_10:
-            case CAN0_SIG_Mod7_temp_11:
-#if defined(ITRI_MOD_5)
-            case CAN0_SIG_Mod8_temp_9:
-            case CAN0_SIG_Mod8_temp_10:
-            case CAN0_SIG_Mod8_temp_11:
-            case CAN0_SIG_Mod9_temp_9:
-			case CAN0_SIG_Mod9_temp_10:
-			case CAN0_SIG_Mod9_temp_11:
-			case CAN0_SIG_Mod10_temp_9:
-			case CAN0_SIG_Mod10_temp_10:
-			case CAN0_SIG_Mod10_temp_11:
-			case CAN0_SIG_Mod11_temp_9:
-			case CAN0_SIG_Mod11_temp_10:
-			case CAN0_SIG_Mod11_temp_11:
-			case CAN0_SIG_Mod12_temp_9:
-			case CAN0_SIG_Mod12_temp_10:
-			case CAN0_SIG_Mod12_temp_11:
-			case CAN0_SIG_Mod13_temp_9:
-			case CAN0_SIG_Mod13_temp_10:
-			case CAN0_SIG_Mod13_temp_11:
-			case CAN0_SIG_Mod14_temp_9:
-			case CAN0_SIG_Mod14_temp_10:
-			case CAN0_SIG_Mod14_temp_11:
-			case CAN0_SIG_Mod15_temp_9:
-			case CAN0_SIG_Mod15_temp_10:
-			case CAN0_SIG_Mod15_temp_11:
-			case CAN0_SIG_Mod16_temp_9:
-			case CAN0_SIG_Mod16_temp_10:
-			case CAN0_SIG_Mod16_temp_11:
-			case CAN0_SIG_Mod17_temp_9:
-			case CAN0_SIG_Mod17_temp_10:
-			case CAN0_SIG_Mod17_temp_11:
-			case CAN0_SIG_Mod18_temp_9:
-			case CAN0_SIG_Mod18_temp_10:
-			case CAN0_SIG_Mod18_temp_11:
-			case CAN0_SIG_Mod19_temp_9:
-			case CAN0_SIG_Mod19_temp_10:
-			case CAN0_SIG_Mod19_temp_11:
-			case CAN0_SIG_Mod20_temp_9:
-			case CAN0_SIG_Mod20_temp_10:
-			case CAN0_SIG_Mod20_temp_11:
-			case CAN0_SIG_Mod21_temp_9:
-			case CAN0_SIG_Mod21_temp_10:
-			case CAN0_SIG_Mod21_temp_11:
-			case CAN0_SIG_Mod22_temp_9:
-			case CAN0_SIG_Mod22_temp_10:
-			case CAN0_SIG_Mod22_temp_11:
-			case CAN0_SIG_Mod23_temp_9:
-			case CAN0_SIG_Mod23_temp_10:
-			case CAN0_SIG_Mod23_temp_11:
-			case CAN0_SIG_Mod24_temp_9:
-			case CAN0_SIG_Mod24_temp_10:
-			case CAN0_SIG_Mod24_temp_11:
-#endif // ITRI_MOD_5
-                cellIdx--;  /* Because cell 0 - valid flag = 1, decrement by one to get the right index */
-                cellIdx--;  /* Because of signal: CAN0_SIG_Modx_temp_valid_3_5 */
-                cellIdx--;  /* Because of signal: CAN0_SIG_Modx_temp_valid_6_8 */
-                cellIdx--;  /* Because of signal: CAN0_SIG_Modx_temp_valid_9_11 */
-                tmpVal = temp_tab.temperature[(modIdx * BS_NR_OF_TEMP_SENSORS_PER_MODULE) + cellIdx];
-                break;
+#if CANS_TX_ON_DELTA == TRUE
+/**
+ * compares the data of a cell voltage or cell temperature message to its last transmitted data.
+ *
+ * A change of the valid flags or a change of one of the values by more than the deadband of
+ * the message family is reported. The multiplexed cell voltage messages have no room for the
+ * rolling counter and are always transmitted periodically.
+ *
+ * @param msgIdx    message index
+ * @param lastData  data of the last transmission
+ * @param data      composed data
+ *
+ * @return TRUE if the message needs to be transmitted, FALSE otherwise
+ */
+static uint8_t cans_celldata_changed(CANS_messagesTx_e msgIdx, uint64_t lastData, uint64_t data) {
+    uint32_t lastRaw[CANS_GEN_CELLVOLT_VALUES_PER_MESSAGE > CANS_GEN_CELLTEMP_VALUES_PER_MESSAGE ?
+                     CANS_GEN_CELLVOLT_VALUES_PER_MESSAGE : CANS_GEN_CELLTEMP_VALUES_PER_MESSAGE] = {0};
+    uint32_t raw[CANS_GEN_CELLVOLT_VALUES_PER_MESSAGE > CANS_GEN_CELLTEMP_VALUES_PER_MESSAGE ?
+                 CANS_GEN_CELLVOLT_VALUES_PER_MESSAGE : CANS_GEN_CELLTEMP_VALUES_PER_MESSAGE] = {0};
+    uint32_t lastValid = 0;
+    uint32_t valid = 0;
+    uint32_t msgInModule = 0;
+    uint32_t nrOfValues = 0;
+    uint32_t deadband = 0;
+    uint32_t difference = 0;
+    uint32_t i = 0;
+
+    msgInModule = ((uint32_t)msgIdx - CANS_GEN_CAN0_FIRST_CELL_MESSAGE) % CANS_GEN_MESSAGES_PER_MODULE;
+
+    if (CANS_IS_CELLVOLT_MESSAGE(msgInModule)) {
+        CANS_GEN_UnpackCellvolt(lastData, &lastValid, lastRaw);
+        CANS_GEN_UnpackCellvolt(data, &valid, raw);
+        nrOfValues = CANS_GEN_CELLVOLT_VALUES_PER_MESSAGE;
+        deadband = CANS_CELLVOLT_DEADBAND_RAW;
+    } else {
+        CANS_GEN_UnpackCelltemp(lastData, &lastValid, lastRaw);
+        CANS_GEN_UnpackCelltemp(data, &valid, raw);
+        nrOfValues = CANS_GEN_CELLTEMP_VALUES_PER_MESSAGE;
+        deadband = CANS_CELLTEMP_DEADBAND_RAW;
+    }
 
-            default:
-                break;
+    if (valid != lastValid) {
+        return TRUE;
+    }
+    for (i = 0; i < nrOfValues; i++) {
+        difference = (raw[i] > lastRaw[i]) ? (raw[i] - lastRaw[i]) : (lastRaw[i] - raw[i]);
+        if (difference > deadband) {
+            return TRUE;
         }
-        /* Check limits */
-        canData = cans_checkLimits((float)tmpVal, sigIdx);
-        /* Apply offset and factor */
-        *(uint32_t *)value = (uint32_t)((canData + cans_CAN0_signals_tx[sigIdx].offset) * cans_CAN0_signals_tx[sigIdx].factor);
     }
-
-    return 0;
+    return FALSE;
 }
+#endif
 
 
 uint32_t cans_gettempering(uint32_t sigIdx, void *value) {
@@ -2645,8 +828,9 @@ static uint32_t cans_getminmaxvolt(uint32_t sigIdx, void *value) {
     if (value != NULL_PTR) {
         switch (sigIdx) {
             case CAN0_SIG_Cellvolt_mean:
-                /* First signal that is called */
-                DB_ReadBlock(&minmax_volt_tab, DATA_BLOCK_ID_MINMAX);
+                /* First signal that is called, only the voltage values are needed */
+                DB_ReadFieldRange(&minmax_volt_tab.voltage_mean, DATA_BLOCK_ID_MINMAX, DATA_BLOCK_MINMAX_s,
+                        voltage_mean, voltage_module_number_max);
 
                 /* Check limits */
                 canData = cans_checkLimits((float)minmax_volt_tab.voltage_mean, sigIdx);
@@ -2697,8 +881,9 @@ uint32_t cans_getminmaxtemp(uint32_t sigIdx, void *value) {
     if (value != NULL_PTR) {
         switch (sigIdx) {
         case CAN0_SIG_Celltemp_mean:
-            /* First signal that is called */
-            DB_ReadBlock(&minmax_temp_tab, DATA_BLOCK_ID_MINMAX);
+            /* First signal that is called, only the temperature values are needed */
+            DB_ReadFieldRange(&minmax_temp_tab.temperature_mean, DATA_BLOCK_ID_MINMAX, DATA_BLOCK_MINMAX_s,
+                    temperature_mean, temperature_module_number_max);
 
             /*  Check limits */
             canData = cans_checkLimits((float)minmax_temp_tab.temperature_mean, sigIdx);
@@ -2903,6 +1088,48 @@ static uint32_t cans_getPackVoltage(uint32_t sigIdx, void *value) {
 }
 
 
+static uint32_t cans_getcanbusstatistics(uint32_t sigIdx, void *value) {
+    static CAN_BUS_STATISTICS_s busstatistics_tab;
+    float canData = 0;
+
+    if (value != NULL_PTR) {
+        switch (sigIdx) {
+            case CAN0_SIG_CanBus_Load:
+                /* first signal to call function */
+                OS_TaskEnter_Critical();
+                (void)CAN_GetBusStatistics(CAN_NODE0, &busstatistics_tab);
+                OS_TaskExit_Critical();
+                /* bus load in % */
+                canData = cans_checkLimits((float)busstatistics_tab.busload_permille / 10.0f, sigIdx);
+                break;
+
+            case CAN0_SIG_CanBus_ErrorRate:
+                canData = cans_checkLimits((float)busstatistics_tab.errors_per_second, sigIdx);
+                break;
+
+            case CAN0_SIG_CanBus_TxErrorCounter:
+                canData = cans_checkLimits((float)busstatistics_tab.tx_error_counter, sigIdx);
+                break;
+
+            case CAN0_SIG_CanBus_RxErrorCounter:
+                canData = cans_checkLimits((float)busstatistics_tab.rx_error_counter, sigIdx);
+                break;
+
+            case CAN0_SIG_CanBus_TxDelayMax:
+                /* maximum queueing delay of the last window in ms */
+                canData = cans_checkLimits((float)busstatistics_tab.tx_delay_window_max_us / 1000.0f, sigIdx);
+                break;
+
+            default:
+                break;
+        }
+        /* Apply offset and factor */
+        *(uint32_t *)value = (uint32_t)((canData + cans_CAN0_signals_tx[sigIdx].offset) * cans_CAN0_signals_tx[sigIdx].factor);
+    }
+    return 0;
+}
+
+
 static uint32_t cans_setcurr(uint32_t sigIdx, void *value) {
     int32_t currentValue;
     int32_t temperatureValue;
@@ -2971,7 +1198,8 @@ static uint32_t cans_setcurr(uint32_t sigIdx, void *value) {
                     cans_current_tab.current = (float)(currentValue);
                     cans_current_tab.newCurrent++;
                     cans_current_tab.previous_timestamp_cur = cans_current_tab.timestamp_cur;
-                    cans_current_tab.timestamp_cur = OS_getOSSysTick();
+                    cans_current_tab.timestamp_cur = CANS_GetRxTimestamp();
+                    SOC_IntegrateCurrent(currentValue, cans_current_tab.timestamp_cur);
                     DB_WriteBlock(&cans_current_tab, DATA_BLOCK_ID_CURRENT_SENSOR);
                     break;
                 case CAN0_SIG_IVT_Voltage_1_Measurement:
@@ -3018,7 +1246,7 @@ static uint32_t cans_setcurr(uint32_t sigIdx, void *value) {
                     currentcounterValue = (int32_t)(dummy[3] | dummy[2] << 8
                             | dummy[1] << 16 | dummy[0] << 24);
                     cans_current_tab.previous_timestamp_cc = cans_current_tab.timestamp_cc;
-                    cans_current_tab.timestamp_cc = OS_getOSSysTick();
+                    cans_current_tab.timestamp_cc = CANS_GetRxTimestamp();
                     cans_current_tab.current_counter = (float)(currentcounterValue);
                     DB_WriteBlock(&cans_current_tab, DATA_BLOCK_ID_CURRENT_SENSOR);
                     break;
@@ -3161,7 +1389,7 @@ uint32_t cans_setdebug(uint32_t sigIdx, void *value) {
 #if defined(ITRI_MOD_11)
 			case 30:
 				{
-					cans_send_heartbeat_pulse();
+					CANS_ReceiveHeartbeat(CANS_HEARTBEAT_EBM_CONTROLLER);
 					//DEBUG_PRINTF(("[%s:%d]receive heart beat (time:%u)\r\n", __FILE__, __LINE__, cans_heart_beat.timestamp));
 				}
 				break;
@@ -55,10 +55,16 @@
 
 /*================== Includes =============================================*/
 #include "general.h"
+#include "batterysystem_cfg.h"
 #include "can_cfg.h"
+#include "cansignal_gen_cfg.h"
 
 /*================== Macros and Definitions ===============================*/
 
+#if CANS_GEN_NR_OF_MODULES != BS_NR_OF_MODULES
+#error "cansignal_gen_cfg.h was generated for another number of modules than BS_NR_OF_MODULES, run tools/dbc/cansignal_gen.py again!"
+#endif
+
 /**
  * @ingroup CONFIG_CANSIGNAL
  * task timeslot where the CANS main function is called. Repetition time of periodic CAN messages must be multiple of this
@@ -71,6 +77,157 @@
 #define CANS_TICK_MS 10
 /* #define CANS_TICK_MS 100 */
 
+/**
+ * @ingroup CONFIG_CANSIGNAL
+ * maximum number of periodic transmit messages (CAN0 and CAN1 together) handled by the transmit scheduler.
+ * Messages beyond this number are not transmitted periodically.
+ * \par Type:
+ * int
+ * \par Range:
+ * 1 <= x <= 510
+ * \par Default:
+ * 256
+*/
+#define CANS_MAX_PERIODIC_TX_MESSAGES   256
+
+/**
+ * @ingroup CONFIG_CANSIGNAL
+ * maximum number of receive messages (CAN0 and CAN1 together) for which the signals are looked up
+ * in the message to signal index built by CANS_Init(). Signals of further messages are found by
+ * a search over all signals.
+ * \par Type:
+ * int
+ * \par Default:
+ * 64
+*/
+#define CANS_MAX_RX_MESSAGES            64
+
+/**
+ * @ingroup CONFIG_CANSIGNAL
+ * maximum number of transmit signals (CAN0 and CAN1 together) in the message to signal index.
+ * If more signals are configured, the index is not used.
+ * \par Type:
+ * int
+ * \par Range:
+ * 1 <= x <= 32767
+ * \par Default:
+ * 1024
+*/
+#define CANS_MAX_TX_SIGNALS             1024
+
+/**
+ * @ingroup CONFIG_CANSIGNAL
+ * maximum number of receive signals (CAN0 and CAN1 together) in the message to signal index.
+ * If more signals are configured, the index is not used.
+ * \par Type:
+ * int
+ * \par Range:
+ * 1 <= x <= 32767
+ * \par Default:
+ * 128
+*/
+#define CANS_MAX_RX_SIGNALS             128
+
+/**
+ * @ingroup CONFIG_CANSIGNAL
+ * if TRUE, the transmit phases of the periodic messages are spread at initialization: every
+ * message is moved to the least loaded tick within one repetition time after its configured
+ * phase, so that as few messages as possible are due in the same CANS tick.
+ * If FALSE, the configured repetition phases are used as they are.
+ * \par Type:
+ * toggle
+ * \par Default:
+ * TRUE
+*/
+/* #define CANS_TX_PHASE_SPREADING FALSE */
+#define CANS_TX_PHASE_SPREADING TRUE
+
+/**
+ * @ingroup CONFIG_CANSIGNAL
+ * number of periodic messages that may be due in the same CANS tick. The transmit messages of
+ * can_cfg.c have to be configured so that the phase spreading stays within this limit, which is
+ * checked by the host test tools/hosttest/bench_cansignal.c.
+ * \par Type:
+ * int
+ * \par Default:
+ * 6
+*/
+#define CANS_MAX_TX_MESSAGES_PER_TICK   6
+
+/**
+ * @ingroup CONFIG_CANSIGNAL
+ * maximum number of CANS ticks over which the bus load is tracked by the phase spreading.
+ * The load is tracked over the hyperperiod, the least common multiple of the repetition times
+ * of all periodic messages in ticks. If the hyperperiod is longer, the load is only tracked over
+ * this number of ticks and the spreading is approximate. Needs one byte of RAM per tick.
+ * \par Type:
+ * int
+ * \par Range:
+ * 1 <= x
+ * \par Default:
+ * 8000
+*/
+#define CANS_TX_SPREAD_MAX_TICKS        8000
+
+/**
+ * @ingroup CONFIG_CANSIGNAL
+ * if TRUE, the messages listed in cans_tx_ondelta_cfg[] are transmitted on delta: at every
+ * repetition the message is composed, but only transmitted if one of its values changed by more
+ * than its deadband since the last transmission or if its maximum silence time has expired.
+ * Each transmission increments the rolling counter of the message.
+ * If FALSE, all messages are transmitted periodically with their repetition time, as expected
+ * by receivers that rely on a fixed rate of the cell data messages.
+ * \par Type:
+ * toggle
+ * \par Default:
+ * FALSE
+*/
+/* #define CANS_TX_ON_DELTA TRUE */
+#define CANS_TX_ON_DELTA FALSE
+
+/**
+ * @ingroup CONFIG_CANSIGNAL
+ * maximum number of messages transmitted on delta, further messages of cans_tx_ondelta_cfg[] are
+ * transmitted periodically
+ * \par Type:
+ * int
+ * \par Range:
+ * 1 <= x <= CANS_MAX_PERIODIC_TX_MESSAGES
+ * \par Default:
+ * 200
+*/
+#define CANS_MAX_ON_DELTA_TX_MESSAGES   200
+
+/**
+ * @ingroup CONFIG_CANSIGNAL
+ * deadband of the cell voltage messages in mV
+ * \par Type:
+ * int
+ * \par Default:
+ * 2
+*/
+#define CANS_CELLVOLT_DEADBAND_MV       2
+
+/**
+ * @ingroup CONFIG_CANSIGNAL
+ * deadband of the cell temperature messages in &deg;C
+ * \par Type:
+ * float
+ * \par Default:
+ * 0.5
+*/
+#define CANS_CELLTEMP_DEADBAND_DEGC     (0.5f)
+
+/**
+ * @ingroup CONFIG_CANSIGNAL
+ * maximum time in ms between two transmissions of a cell data message
+ * \par Type:
+ * int
+ * \par Default:
+ * 3000
+*/
+#define CANS_CELL_MAX_SILENCE_MS        3000
+
 /**
  * Delay in ms after which it is considered the current sensor is not responding anymore.
  */
@@ -105,238 +262,14 @@ typedef enum {
     CAN0_MSG_Current_1,  /*!< Moving average current 10s 30s */
     CAN0_MSG_Current_2,  /*!< Moving average current 60s configurable duration */
     CAN0_MSG_PackVoltage,  /*!< Pack voltage */
+    CAN0_MSG_CanBusStatistics,  /*!< Bus load, error rate and queueing delay of CAN0 */
 
-    CAN0_MSG_Mod0_Cellvolt_0,  /*!< Module 0 Cell voltages 0-2 */
-    CAN0_MSG_Mod0_Cellvolt_1,  /*!< Module 0 Cell voltages 3-5 */
-    CAN0_MSG_Mod0_Cellvolt_2,  /*!< Module 0 Cell voltages 6-8 */
-    CAN0_MSG_Mod0_Cellvolt_3,  /*!< Module 0 Cell voltages 9-11 */
-    CAN0_MSG_Mod0_Celltemp_0,  /*!< Module 0 Cell temperatures 0-2 */
-    CAN0_MSG_Mod0_Celltemp_1,  /*!< Module 0 Cell temperatures 3-5 */
-    CAN0_MSG_Mod0_Celltemp_2,  /*!< Module 0 Cell temperatures 6-8 */
-    CAN0_MSG_Mod0_Celltemp_3,  /*!< Module 0 Cell temperatures 9-11 */
-
-    CAN0_MSG_Mod1_Cellvolt_0,  /*!< Module 1 Cell voltages 0-2 */
-    CAN0_MSG_Mod1_Cellvolt_1,  /*!< Module 1 Cell voltages 3-5 */
-    CAN0_MSG_Mod1_Cellvolt_2,  /*!< Module 1 Cell voltages 6-8 */
-    CAN0_MSG_Mod1_Cellvolt_3,  /*!< Module 1 Cell voltages 9-11 */
-    CAN0_MSG_Mod1_Celltemp_0,  /*!< Module 1 Cell temperatures 0-2 */
-    CAN0_MSG_Mod1_Celltemp_1,  /*!< Module 1 Cell temperatures 3-5 */
-    CAN0_MSG_Mod1_Celltemp_2,  /*!< Module 1 Cell temperatures 6-8 */
-    CAN0_MSG_Mod1_Celltemp_3,  /*!< Module 1 Cell temperatures 9-11 */
-
-    CAN0_MSG_Mod2_Cellvolt_0,  /*!< Module 2 Cell voltages 0-2 */
-    CAN0_MSG_Mod2_Cellvolt_1,  /*!< Module 2 Cell voltages 3-5 */
-    CAN0_MSG_Mod2_Cellvolt_2,  /*!< Module 2 Cell voltages 6-8 */
-    CAN0_MSG_Mod2_Cellvolt_3,  /*!< Module 2 Cell voltages 9-11 */
-    CAN0_MSG_Mod2_Celltemp_0,  /*!< Module 2 Cell temperatures 0-2 */
-    CAN0_MSG_Mod2_Celltemp_1,  /*!< Module 2 Cell temperatures 3-5 */
-    CAN0_MSG_Mod2_Celltemp_2,  /*!< Module 2 Cell temperatures 6-8 */
-    CAN0_MSG_Mod2_Celltemp_3,  /*!< Module 2 Cell temperatures 9-11 */
-
-    CAN0_MSG_Mod3_Cellvolt_0,  /*!< Module 3 Cell voltages 0-2 */
-    CAN0_MSG_Mod3_Cellvolt_1,  /*!< Module 3 Cell voltages 3-5 */
-    CAN0_MSG_Mod3_Cellvolt_2,  /*!< Module 3 Cell voltages 6-8 */
-    CAN0_MSG_Mod3_Cellvolt_3,  /*!< Module 3 Cell voltages 9-11 */
-    CAN0_MSG_Mod3_Celltemp_0,  /*!< Module 3 Cell temperatures 0-2 */
-    CAN0_MSG_Mod3_Celltemp_1,  /*!< Module 3 Cell temperatures 3-5 */
-    CAN0_MSG_Mod3_Celltemp_2,  /*!< Module 3 Cell temperatures 6-8 */
-    CAN0_MSG_Mod3_Celltemp_3,  /*!< Module 3 Cell temperatures 9-11 */
-
-    CAN0_MSG_Mod4_Cellvolt_0,  /*!< Module 4 Cell voltages 0-2 */
-    CAN0_MSG_Mod4_Cellvolt_1,  /*!< Module 4 Cell voltages 3-5 */
-    CAN0_MSG_Mod4_Cellvolt_2,  /*!< Module 4 Cell voltages 6-8 */
-    CAN0_MSG_Mod4_Cellvolt_3,  /*!< Module 4 Cell voltages 9-11 */
-    CAN0_MSG_Mod4_Celltemp_0,  /*!< Module 4 Cell temperatures 0-2 */
-    CAN0_MSG_Mod4_Celltemp_1,  /*!< Module 4 Cell temperatures 3-5 */
-    CAN0_MSG_Mod4_Celltemp_2,  /*!< Module 4 Cell temperatures 6-8 */
-    CAN0_MSG_Mod4_Celltemp_3,  /*!< Module 4 Cell temperatures 9-11 */
-
-    CAN0_MSG_Mod5_Cellvolt_0,  /*!< Module 5 Cell voltages 0-2 */
-    CAN0_MSG_Mod5_Cellvolt_1,  /*!< Module 5 Cell voltages 3-5 */
-    CAN0_MSG_Mod5_Cellvolt_2,  /*!< Module 5 Cell voltages 6-8 */
-    CAN0_MSG_Mod5_Cellvolt_3,  /*!< Module 5 Cell voltages 9-11 */
-    CAN0_MSG_Mod5_Celltemp_0,  /*!< Module 5 Cell temperatures 0-2 */
-    CAN0_MSG_Mod5_Celltemp_1,  /*!< Module 5 Cell temperatures 3-5 */
-    CAN0_MSG_Mod5_Celltemp_2,  /*!< Module 5 Cell temperatures 6-8 */
-    CAN0_MSG_Mod5_Celltemp_3,  /*!< Module 5 Cell temperatures 9-11 */
-
-    CAN0_MSG_Mod6_Cellvolt_0,  /*!< Module 6 Cell voltages 0-2 */
-    CAN0_MSG_Mod6_Cellvolt_1,  /*!< Module 6 Cell voltages 3-5 */
-    CAN0_MSG_Mod6_Cellvolt_2,  /*!< Module 6 Cell voltages 6-8 */
-    CAN0_MSG_Mod6_Cellvolt_3,  /*!< Module 6 Cell voltages 9-11 */
-    CAN0_MSG_Mod6_Celltemp_0,  /*!< Module 6 Cell temperatures 0-2 */
-    CAN0_MSG_Mod6_Celltemp_1,  /*!< Module 6 Cell temperatures 3-5 */
-    CAN0_MSG_Mod6_Celltemp_2,  /*!< Module 6 Cell temperatures 6-8 */
-    CAN0_MSG_Mod6_Celltemp_3,  /*!< Module 6 Cell temperatures 9-11 */
-
-    CAN0_MSG_Mod7_Cellvolt_0,  /*!< Module 7 Cell voltages 0-2 */
-    CAN0_MSG_Mod7_Cellvolt_1,  /*!< Module 7 Cell voltages 3-5 */
-    CAN0_MSG_Mod7_Cellvolt_2,  /*!< Module 7 Cell voltages 6-8 */
-    CAN0_MSG_Mod7_Cellvolt_3,  /*!< Module 7 Cell voltages 9-11 */
-    CAN0_MSG_Mod7_Celltemp_0,  /*!< Module 7 Cell temperatures 0-2 */
-    CAN0_MSG_Mod7_Celltemp_1,  /*!< Module 7 Cell temperatures 3-5 */
-    CAN0_MSG_Mod7_Celltemp_2,  /*!< Module 7 Cell temperatures 6-8 */
-    CAN0_MSG_Mod7_Celltemp_3,  /*!< Module 7 Cell temperatures 9-11 */
+    CANS_GEN_CAN0_CELL_MESSAGES_TX  /* cell voltages and temperatures of all modules, see cansignal_gen_cfg.h */
 
 #ifdef CAN_ISABELLENHUETTE_TRIGGERED
     CAN0_MSG_BMS_CurrentTrigger,    /*!< Cell Voltages Max Min Average */
 #endif
 
-#if defined(ITRI_MOD_5)
-    CAN0_MSG_Mod8_Cellvolt_0,  //!< Module 8 Cell voltages 0-2
-    CAN0_MSG_Mod8_Cellvolt_1,
-    CAN0_MSG_Mod8_Cellvolt_2,
-    CAN0_MSG_Mod8_Cellvolt_3,
-    CAN0_MSG_Mod8_Celltemp_0,  //!< Module 8 Cell temperatures 0-2
-    CAN0_MSG_Mod8_Celltemp_1,
-    CAN0_MSG_Mod8_Celltemp_2,
-    CAN0_MSG_Mod8_Celltemp_3,
-
-	CAN0_MSG_Mod9_Cellvolt_0,  //!< Module 9 Cell voltages 0-2
-	    CAN0_MSG_Mod9_Cellvolt_1,
-	    CAN0_MSG_Mod9_Cellvolt_2,
-	    CAN0_MSG_Mod9_Cellvolt_3,
-	    CAN0_MSG_Mod9_Celltemp_0,  //!< Module 9 Cell temperatures 0-2
-	    CAN0_MSG_Mod9_Celltemp_1,
-	    CAN0_MSG_Mod9_Celltemp_2,
-	    CAN0_MSG_Mod9_Celltemp_3,
-
-	    CAN0_MSG_Mod10_Cellvolt_0,  //!< Module 10 Cell voltages 0-2
-	    CAN0_MSG_Mod10_Cellvolt_1,
-	    CAN0_MSG_Mod10_Cellvolt_2,
-	    CAN0_MSG_Mod10_Cellvolt_3,
-	    CAN0_MSG_Mod10_Celltemp_0,  //!< Module 10 Cell temperatures 0-2
-	    CAN0_MSG_Mod10_Celltemp_1,
-	    CAN0_MSG_Mod10_Celltemp_2,
-	    CAN0_MSG_Mod10_Celltemp_3,
-
-	    CAN0_MSG_Mod11_Cellvolt_0,  //!< Module 11 Cell voltages 0-2
-	    CAN0_MSG_Mod11_Cellvolt_1,
-	    CAN0_MSG_Mod11_Cellvolt_2,
-	    CAN0_MSG_Mod11_Cellvolt_3,
-	    CAN0_MSG_Mod11_Celltemp_0,  //!< Module 11 Cell temperatures 0-2
-	    CAN0_MSG_Mod11_Celltemp_1,
-	    CAN0_MSG_Mod11_Celltemp_2,
-	    CAN0_MSG_Mod11_Celltemp_3,
-
-	    CAN0_MSG_Mod12_Cellvolt_0,  //!< Module 12 Cell voltages 0-2
-	    CAN0_MSG_Mod12_Cellvolt_1,
-	    CAN0_MSG_Mod12_Cellvolt_2,
-	    CAN0_MSG_Mod12_Cellvolt_3,
-	    CAN0_MSG_Mod12_Celltemp_0,  //!< Module 12 Cell temperatures 0-2
-	    CAN0_MSG_Mod12_Celltemp_1,
-	    CAN0_MSG_Mod12_Celltemp_2,
-	    CAN0_MSG_Mod12_Celltemp_3,
-
-	    CAN0_MSG_Mod13_Cellvolt_0,  //!< Module 13 Cell voltages 0-2
-	    CAN0_MSG_Mod13_Cellvolt_1,
-	    CAN0_MSG_Mod13_Cellvolt_2,
-	    CAN0_MSG_Mod13_Cellvolt_3,
-	    CAN0_MSG_Mod13_Celltemp_0,  //!< Module 13 Cell temperatures 0-2
-	    CAN0_MSG_Mod13_Celltemp_1,
-	    CAN0_MSG_Mod13_Celltemp_2,
-	    CAN0_MSG_Mod13_Celltemp_3,
-
-	    CAN0_MSG_Mod14_Cellvolt_0,  //!< Module 14 Cell voltages 0-2
-	    CAN0_MSG_Mod14_Cellvolt_1,
-	    CAN0_MSG_Mod14_Cellvolt_2,
-	    CAN0_MSG_Mod14_Cellvolt_3,
-	    CAN0_MSG_Mod14_Celltemp_0,  //!< Module 14 Cell temperatures 0-2
-	    CAN0_MSG_Mod14_Celltemp_1,
-	    CAN0_MSG_Mod14_Celltemp_2,
-	    CAN0_MSG_Mod14_Celltemp_3,
-
-	    CAN0_MSG_Mod15_Cellvolt_0,  //!< Module 15 Cell voltages 0-2
-	    CAN0_MSG_Mod15_Cellvolt_1,
-	    CAN0_MSG_Mod15_Cellvolt_2,
-	    CAN0_MSG_Mod15_Cellvolt_3,
-	    CAN0_MSG_Mod15_Celltemp_0,  //!< Module 15 Cell temperatures 0-2
-	    CAN0_MSG_Mod15_Celltemp_1,
-	    CAN0_MSG_Mod15_Celltemp_2,
-	    CAN0_MSG_Mod15_Celltemp_3,
-
-	    CAN0_MSG_Mod16_Cellvolt_0,  //!< Module 16 Cell voltages 0-2
-	    CAN0_MSG_Mod16_Cellvolt_1,
-	    CAN0_MSG_Mod16_Cellvolt_2,
-	    CAN0_MSG_Mod16_Cellvolt_3,
-	    CAN0_MSG_Mod16_Celltemp_0,  //!< Module 16 Cell temperatures 0-2
-	    CAN0_MSG_Mod16_Celltemp_1,
-	    CAN0_MSG_Mod16_Celltemp_2,
-	    CAN0_MSG_Mod16_Celltemp_3,
-
-	    CAN0_MSG_Mod17_Cellvolt_0,  //!< Module 17 Cell voltages 0-2
-	    CAN0_MSG_Mod17_Cellvolt_1,
-	    CAN0_MSG_Mod17_Cellvolt_2,
-	    CAN0_MSG_Mod17_Cellvolt_3,
-	    CAN0_MSG_Mod17_Celltemp_0,  //!< Module 17 Cell temperatures 0-2
-	    CAN0_MSG_Mod17_Celltemp_1,
-	    CAN0_MSG_Mod17_Celltemp_2,
-	    CAN0_MSG_Mod17_Celltemp_3,
-
-	    CAN0_MSG_Mod18_Cellvolt_0,  //!< Module 18 Cell voltages 0-2
-	    CAN0_MSG_Mod18_Cellvolt_1,
-	    CAN0_MSG_Mod18_Cellvolt_2,
-	    CAN0_MSG_Mod18_Cellvolt_3,
-	    CAN0_MSG_Mod18_Celltemp_0,  //!< Module 18 Cell temperatures 0-2
-	    CAN0_MSG_Mod18_Celltemp_1,
-	    CAN0_MSG_Mod18_Celltemp_2,
-	    CAN0_MSG_Mod18_Celltemp_3,
-
-	    CAN0_MSG_Mod19_Cellvolt_0,  //!< Module 19 Cell voltages 0-2
-	    CAN0_MSG_Mod19_Cellvolt_1,
-	    CAN0_MSG_Mod19_Cellvolt_2,
-	    CAN0_MSG_Mod19_Cellvolt_3,
-	    CAN0_MSG_Mod19_Celltemp_0,  //!< Module 19 Cell temperatures 0-2
-	    CAN0_MSG_Mod19_Celltemp_1,
-	    CAN0_MSG_Mod19_Celltemp_2,
-	    CAN0_MSG_Mod19_Celltemp_3,
-
-	    CAN0_MSG_Mod20_Cellvolt_0,  //!< Module 20 Cell voltages 0-2
-	    CAN0_MSG_Mod20_Cellvolt_1,
-	    CAN0_MSG_Mod20_Cellvolt_2,
-	    CAN0_MSG_Mod20_Cellvolt_3,
-	    CAN0_MSG_Mod20_Celltemp_0,  //!< Module 20 Cell temperatures 0-2
-	    CAN0_MSG_Mod20_Celltemp_1,
-	    CAN0_MSG_Mod20_Celltemp_2,
-	    CAN0_MSG_Mod20_Celltemp_3,
-
-	    CAN0_MSG_Mod21_Cellvolt_0,  //!< Module 21 Cell voltages 0-2
-	    CAN0_MSG_Mod21_Cellvolt_1,
-	    CAN0_MSG_Mod21_Cellvolt_2,
-	    CAN0_MSG_Mod21_Cellvolt_3,
-	    CAN0_MSG_Mod21_Celltemp_0,  //!< Module 21 Cell temperatures 0-2
-	    CAN0_MSG_Mod21_Celltemp_1,
-	    CAN0_MSG_Mod21_Celltemp_2,
-	    CAN0_MSG_Mod21_Celltemp_3,
-
-	    CAN0_MSG_Mod22_Cellvolt_0,  //!< Module 22 Cell voltages 0-2
-	    CAN0_MSG_Mod22_Cellvolt_1,
-	    CAN0_MSG_Mod22_Cellvolt_2,
-	    CAN0_MSG_Mod22_Cellvolt_3,
-	    CAN0_MSG_Mod22_Celltemp_0,  //!< Module 22 Cell temperatures 0-2
-	    CAN0_MSG_Mod22_Celltemp_1,
-	    CAN0_MSG_Mod22_Celltemp_2,
-	    CAN0_MSG_Mod22_Celltemp_3,
-
-	    CAN0_MSG_Mod23_Cellvolt_0,  //!< Module 23 Cell voltages 0-2
-	    CAN0_MSG_Mod23_Cellvolt_1,
-	    CAN0_MSG_Mod23_Cellvolt_2,
-	    CAN0_MSG_Mod23_Cellvolt_3,
-	    CAN0_MSG_Mod23_Celltemp_0,  //!< Module 23 Cell temperatures 0-2
-	    CAN0_MSG_Mod23_Celltemp_1,
-	    CAN0_MSG_Mod23_Celltemp_2,
-	    CAN0_MSG_Mod23_Celltemp_3,
-
-	    CAN0_MSG_Mod24_Cellvolt_0,  //!< Module 24 Cell voltages 0-2
-	    CAN0_MSG_Mod24_Cellvolt_1,
-	    CAN0_MSG_Mod24_Cellvolt_2,
-	    CAN0_MSG_Mod24_Cellvolt_3,
-	    CAN0_MSG_Mod24_Celltemp_0,  //!< Module 24 Cell temperatures 0-2
-	    CAN0_MSG_Mod24_Celltemp_1,
-	    CAN0_MSG_Mod24_Celltemp_2,
-	    CAN0_MSG_Mod24_Celltemp_3,
-#endif // ITRI_MOD_5
-
     /* Insert here symbolic names for CAN1 messages */
 } CANS_messagesTx_e;
 
@@ -452,862 +385,16 @@ typedef enum {
     CAN0_SIG_PackVolt_Battery,
     CAN0_SIG_PackVolt_PowerNet,
 
-    CAN0_SIG_Mod0_volt_valid_0_2,
-    CAN0_SIG_Mod0_volt_0,
-    CAN0_SIG_Mod0_volt_1,
-    CAN0_SIG_Mod0_volt_2,
-    CAN0_SIG_Mod0_volt_valid_3_5,
-    CAN0_SIG_Mod0_volt_3,
-    CAN0_SIG_Mod0_volt_4,
-    CAN0_SIG_Mod0_volt_5,
-    CAN0_SIG_Mod0_volt_valid_6_8,
-    CAN0_SIG_Mod0_volt_6,
-    CAN0_SIG_Mod0_volt_7,
-    CAN0_SIG_Mod0_volt_8,
-    CAN0_SIG_Mod0_volt_valid_9_11,
-    CAN0_SIG_Mod0_volt_9,
-    CAN0_SIG_Mod0_volt_10,
-    CAN0_SIG_Mod0_volt_11,
-
-    CAN0_SIG_Mod0_temp_valid_0_2,
-    CAN0_SIG_Mod0_temp_0,
-    CAN0_SIG_Mod0_temp_1,
-    CAN0_SIG_Mod0_temp_2,
-    CAN0_SIG_Mod0_temp_valid_3_5,
-    CAN0_SIG_Mod0_temp_3,
-    CAN0_SIG_Mod0_temp_4,
-    CAN0_SIG_Mod0_temp_5,
-    CAN0_SIG_Mod0_temp_valid_6_8,
-    CAN0_SIG_Mod0_temp_6,
-    CAN0_SIG_Mod0_temp_7,
-    CAN0_SIG_Mod0_temp_8,
-    CAN0_SIG_Mod0_temp_valid_9_11,
-    CAN0_SIG_Mod0_temp_9,
-    CAN0_SIG_Mod0_temp_10,
-    CAN0_SIG_Mod0_temp_11,
-
-    CAN0_SIG_Mod1_volt_valid_0_2,
-    CAN0_SIG_Mod1_volt_0,
-    CAN0_SIG_Mod1_volt_1,
-    CAN0_SIG_Mod1_volt_2,
-    CAN0_SIG_Mod1_volt_valid_3_5,
-    CAN0_SIG_Mod1_volt_3,
-    CAN0_SIG_Mod1_volt_4,
-    CAN0_SIG_Mod1_volt_5,
-    CAN0_SIG_Mod1_volt_valid_6_8,
-    CAN0_SIG_Mod1_volt_6,
-    CAN0_SIG_Mod1_volt_7,
-    CAN0_SIG_Mod1_volt_8,
-    CAN0_SIG_Mod1_volt_valid_9_11,
-    CAN0_SIG_Mod1_volt_9,
-    CAN0_SIG_Mod1_volt_10,
-    CAN0_SIG_Mod1_volt_11,
-
-    CAN0_SIG_Mod1_temp_valid_0_2,
-    CAN0_SIG_Mod1_temp_0,
-    CAN0_SIG_Mod1_temp_1,
-    CAN0_SIG_Mod1_temp_2,
-    CAN0_SIG_Mod1_temp_valid_3_5,
-    CAN0_SIG_Mod1_temp_3,
-    CAN0_SIG_Mod1_temp_4,
-    CAN0_SIG_Mod1_temp_5,
-    CAN0_SIG_Mod1_temp_valid_6_8,
-    CAN0_SIG_Mod1_temp_6,
-    CAN0_SIG_Mod1_temp_7,
-    CAN0_SIG_Mod1_temp_8,
-    CAN0_SIG_Mod1_temp_valid_9_11,
-    CAN0_SIG_Mod1_temp_9,
-    CAN0_SIG_Mod1_temp_10,
-    CAN0_SIG_Mod1_temp_11,
-
-    CAN0_SIG_Mod2_volt_valid_0_2,
-    CAN0_SIG_Mod2_volt_0,
-    CAN0_SIG_Mod2_volt_1,
-    CAN0_SIG_Mod2_volt_2,
-    CAN0_SIG_Mod2_volt_valid_3_5,
-    CAN0_SIG_Mod2_volt_3,
-    CAN0_SIG_Mod2_volt_4,
-    CAN0_SIG_Mod2_volt_5,
-    CAN0_SIG_Mod2_volt_valid_6_8,
-    CAN0_SIG_Mod2_volt_6,
-    CAN0_SIG_Mod2_volt_7,
-    CAN0_SIG_Mod2_volt_8,
-    CAN0_SIG_Mod2_volt_valid_9_11,
-    CAN0_SIG_Mod2_volt_9,
-    CAN0_SIG_Mod2_volt_10,
-    CAN0_SIG_Mod2_volt_11,
-
-    CAN0_SIG_Mod2_temp_valid_0_2,
-    CAN0_SIG_Mod2_temp_0,
-    CAN0_SIG_Mod2_temp_1,
-    CAN0_SIG_Mod2_temp_2,
-    CAN0_SIG_Mod2_temp_valid_3_5,
-    CAN0_SIG_Mod2_temp_3,
-    CAN0_SIG_Mod2_temp_4,
-    CAN0_SIG_Mod2_temp_5,
-    CAN0_SIG_Mod2_temp_valid_6_8,
-    CAN0_SIG_Mod2_temp_6,
-    CAN0_SIG_Mod2_temp_7,
-    CAN0_SIG_Mod2_temp_8,
-    CAN0_SIG_Mod2_temp_valid_9_11,
-    CAN0_SIG_Mod2_temp_9,
-    CAN0_SIG_Mod2_temp_10,
-    CAN0_SIG_Mod2_temp_11,
-
-    CAN0_SIG_Mod3_volt_valid_0_2,
-    CAN0_SIG_Mod3_volt_0,
-    CAN0_SIG_Mod3_volt_1,
-    CAN0_SIG_Mod3_volt_2,
-    CAN0_SIG_Mod3_volt_valid_3_5,
-    CAN0_SIG_Mod3_volt_3,
-    CAN0_SIG_Mod3_volt_4,
-    CAN0_SIG_Mod3_volt_5,
-    CAN0_SIG_Mod3_volt_valid_6_8,
-    CAN0_SIG_Mod3_volt_6,
-    CAN0_SIG_Mod3_volt_7,
-    CAN0_SIG_Mod3_volt_8,
-    CAN0_SIG_Mod3_volt_valid_9_11,
-    CAN0_SIG_Mod3_volt_9,
-    CAN0_SIG_Mod3_volt_10,
-    CAN0_SIG_Mod3_volt_11,
-
-    CAN0_SIG_Mod3_temp_valid_0_2,
-    CAN0_SIG_Mod3_temp_0,
-    CAN0_SIG_Mod3_temp_1,
-    CAN0_SIG_Mod3_temp_2,
-    CAN0_SIG_Mod3_temp_valid_3_5,
-    CAN0_SIG_Mod3_temp_3,
-    CAN0_SIG_Mod3_temp_4,
-    CAN0_SIG_Mod3_temp_5,
-    CAN0_SIG_Mod3_temp_valid_6_8,
-    CAN0_SIG_Mod3_temp_6,
-    CAN0_SIG_Mod3_temp_7,
-    CAN0_SIG_Mod3_temp_8,
-    CAN0_SIG_Mod3_temp_valid_9_11,
-    CAN0_SIG_Mod3_temp_9,
-    CAN0_SIG_Mod3_temp_10,
-    CAN0_SIG_Mod3_temp_11,
-
-    CAN0_SIG_Mod4_volt_valid_0_2,
-    CAN0_SIG_Mod4_volt_0,
-    CAN0_SIG_Mod4_volt_1,
-    CAN0_SIG_Mod4_volt_2,
-    CAN0_SIG_Mod4_volt_valid_3_5,
-    CAN0_SIG_Mod4_volt_3,
-    CAN0_SIG_Mod4_volt_4,
-    CAN0_SIG_Mod4_volt_5,
-    CAN0_SIG_Mod4_volt_valid_6_8,
-    CAN0_SIG_Mod4_volt_6,
-    CAN0_SIG_Mod4_volt_7,
-    CAN0_SIG_Mod4_volt_8,
-    CAN0_SIG_Mod4_volt_valid_9_11,
-    CAN0_SIG_Mod4_volt_9,
-    CAN0_SIG_Mod4_volt_10,
-    CAN0_SIG_Mod4_volt_11,
-
-    CAN0_SIG_Mod4_temp_valid_0_2,
-    CAN0_SIG_Mod4_temp_0,
-    CAN0_SIG_Mod4_temp_1,
-    CAN0_SIG_Mod4_temp_2,
-    CAN0_SIG_Mod4_temp_valid_3_5,
-    CAN0_SIG_Mod4_temp_3,
-    CAN0_SIG_Mod4_temp_4,
-    CAN0_SIG_Mod4_temp_5,
-    CAN0_SIG_Mod4_temp_valid_6_8,
-    CAN0_SIG_Mod4_temp_6,
-    CAN0_SIG_Mod4_temp_7,
-    CAN0_SIG_Mod4_temp_8,
-    CAN0_SIG_Mod4_temp_valid_9_11,
-    CAN0_SIG_Mod4_temp_9,
-    CAN0_SIG_Mod4_temp_10,
-    CAN0_SIG_Mod4_temp_11,
-
-    CAN0_SIG_Mod5_volt_valid_0_2,
-    CAN0_SIG_Mod5_volt_0,
-    CAN0_SIG_Mod5_volt_1,
-    CAN0_SIG_Mod5_volt_2,
-    CAN0_SIG_Mod5_volt_valid_3_5,
-    CAN0_SIG_Mod5_volt_3,
-    CAN0_SIG_Mod5_volt_4,
-    CAN0_SIG_Mod5_volt_5,
-    CAN0_SIG_Mod5_volt_valid_6_8,
-    CAN0_SIG_Mod5_volt_6,
-    CAN0_SIG_Mod5_volt_7,
-    CAN0_SIG_Mod5_volt_8,
-    CAN0_SIG_Mod5_volt_valid_9_11,
-    CAN0_SIG_Mod5_volt_9,
-    CAN0_SIG_Mod5_volt_10,
-    CAN0_SIG_Mod5_volt_11,
-
-    CAN0_SIG_Mod5_temp_valid_0_2,
-    CAN0_SIG_Mod5_temp_0,
-    CAN0_SIG_Mod5_temp_1,
-    CAN0_SIG_Mod5_temp_2,
-    CAN0_SIG_Mod5_temp_valid_3_5,
-    CAN0_SIG_Mod5_temp_3,
-    CAN0_SIG_Mod5_temp_4,
-    CAN0_SIG_Mod5_temp_5,
-    CAN0_SIG_Mod5_temp_valid_6_8,
-    CAN0_SIG_Mod5_temp_6,
-    CAN0_SIG_Mod5_temp_7,
-    CAN0_SIG_Mod5_temp_8,
-    CAN0_SIG_Mod5_temp_valid_9_11,
-    CAN0_SIG_Mod5_temp_9,
-    CAN0_SIG_Mod5_temp_10,
-    CAN0_SIG_Mod5_temp_11,
-
-    CAN0_SIG_Mod6_volt_valid_0_2,
-    CAN0_SIG_Mod6_volt_0,
-    CAN0_SIG_Mod6_volt_1,
-    CAN0_SIG_Mod6_volt_2,
-    CAN0_SIG_Mod6_volt_valid_3_5,
-    CAN0_SIG_Mod6_volt_3,
-    CAN0_SIG_Mod6_volt_4,
-    CAN0_SIG_Mod6_volt_5,
-    CAN0_SIG_Mod6_volt_valid_6_8,
-    CAN0_SIG_Mod6_volt_6,
-    CAN0_SIG_Mod6_volt_7,
-    CAN0_SIG_Mod6_volt_8,
-    CAN0_SIG_Mod6_volt_valid_9_11,
-    CAN0_SIG_Mod6_volt_9,
-    CAN0_SIG_Mod6_volt_10,
-    CAN0_SIG_Mod6_volt_11,
-
-    CAN0_SIG_Mod6_temp_valid_0_2,
-    CAN0_SIG_Mod6_temp_0,
-    CAN0_SIG_Mod6_temp_1,
-    CAN0_SIG_Mod6_temp_2,
-    CAN0_SIG_Mod6_temp_valid_3_5,
-    CAN0_SIG_Mod6_temp_3,
-    CAN0_SIG_Mod6_temp_4,
-    CAN0_SIG_Mod6_temp_5,
-    CAN0_SIG_Mod6_temp_valid_6_8,
-    CAN0_SIG_Mod6_temp_6,
-    CAN0_SIG_Mod6_temp_7,
-    CAN0_SIG_Mod6_temp_8,
-    CAN0_SIG_Mod6_temp_valid_9_11,
-    CAN0_SIG_Mod6_temp_9,
-    CAN0_SIG_Mod6_temp_10,
-    CAN0_SIG_Mod6_temp_11,
-
-    CAN0_SIG_Mod7_volt_valid_0_2,
-    CAN0_SIG_Mod7_volt_0,
-    CAN0_SIG_Mod7_volt_1,
-    CAN0_SIG_Mod7_volt_2,
-    CAN0_SIG_Mod7_volt_valid_3_5,
-    CAN0_SIG_Mod7_volt_3,
-    CAN0_SIG_Mod7_volt_4,
-    CAN0_SIG_Mod7_volt_5,
-    CAN0_SIG_Mod7_volt_valid_6_8,
-    CAN0_SIG_Mod7_volt_6,
-    CAN0_SIG_Mod7_volt_7,
-    CAN0_SIG_Mod7_volt_8,
-    CAN0_SIG_Mod7_volt_valid_9_11,
-    CAN0_SIG_Mod7_volt_9,
-    CAN0_SIG_Mod7_volt_10,
-    CAN0_SIG_Mod7_volt_11,
-
-    CAN0_SIG_Mod7_temp_valid_0_2,
-    CAN0_SIG_Mod7_temp_0,
-    CAN0_SIG_Mod7_temp_1,
-    CAN0_SIG_Mod7_temp_2,
-    CAN0_SIG_Mod7_temp_valid_3_5,
-    CAN0_SIG_Mod7_temp_3,
-    CAN0_SIG_Mod7_temp_4,
-    CAN0_SIG_Mod7_temp_5,
-    CAN0_SIG_Mod7_temp_valid_6_8,
-    CAN0_SIG_Mod7_temp_6,
-    CAN0_SIG_Mod7_temp_7,
-    CAN0_SIG_Mod7_temp_8,
-    CAN0_SIG_Mod7_temp_valid_9_11,
-    CAN0_SIG_Mod7_temp_9,
-    CAN0_SIG_Mod7_temp_10,
-    CAN0_SIG_Mod7_temp_11,
+    CAN0_SIG_CanBus_Load,
+    CAN0_SIG_CanBus_ErrorRate,
+    CAN0_SIG_CanBus_TxErrorCounter,
+    CAN0_SIG_CanBus_RxErrorCounter,
+    CAN0_SIG_CanBus_TxDelayMax,
 
 #ifdef CAN_ISABELLENHUETTE_TRIGGERED
     CAN0_SIG_ISA_Trigger,
 #endif
 
-#if defined(ITRI_MOD_5)
-    CAN0_SIG_Mod8_volt_valid_0_2,
-    CAN0_SIG_Mod8_volt_0,
-    CAN0_SIG_Mod8_volt_1,
-    CAN0_SIG_Mod8_volt_2,
-    CAN0_SIG_Mod8_volt_valid_3_5,
-    CAN0_SIG_Mod8_volt_3,
-    CAN0_SIG_Mod8_volt_4,
-    CAN0_SIG_Mod8_volt_5,
-    CAN0_SIG_Mod8_volt_valid_6_8,
-    CAN0_SIG_Mod8_volt_6,
-    CAN0_SIG_Mod8_volt_7,
-    CAN0_SIG_Mod8_volt_8,
-    CAN0_SIG_Mod8_volt_valid_9_11,
-    CAN0_SIG_Mod8_volt_9,
-    CAN0_SIG_Mod8_volt_10,
-    CAN0_SIG_Mod8_volt_11,
-
-    CAN0_SIG_Mod8_temp_valid_0_2,
-    CAN0_SIG_Mod8_temp_0,
-    CAN0_SIG_Mod8_temp_1,
-    CAN0_SIG_Mod8_temp_2,
-    CAN0_SIG_Mod8_temp_valid_3_5,
-    CAN0_SIG_Mod8_temp_3,
-    CAN0_SIG_Mod8_temp_4,
-    CAN0_SIG_Mod8_temp_5,
-    CAN0_SIG_Mod8_temp_valid_6_8,
-    CAN0_SIG_Mod8_temp_6,
-    CAN0_SIG_Mod8_temp_7,
-    CAN0_SIG_Mod8_temp_8,
-    CAN0_SIG_Mod8_temp_valid_9_11,
-    CAN0_SIG_Mod8_temp_9,
-    CAN0_SIG_Mod8_temp_10,
-    CAN0_SIG_Mod8_temp_11,
-
-	CAN0_SIG_Mod9_volt_valid_0_2,
-	    CAN0_SIG_Mod9_volt_0,
-	    CAN0_SIG_Mod9_volt_1,
-	    CAN0_SIG_Mod9_volt_2,
-	    CAN0_SIG_Mod9_volt_valid_3_5,
-	    CAN0_SIG_Mod9_volt_3,
-	    CAN0_SIG_Mod9_volt_4,
-	    CAN0_SIG_Mod9_volt_5,
-	    CAN0_SIG_Mod9_volt_valid_6_8,
-	    CAN0_SIG_Mod9_volt_6,
-	    CAN0_SIG_Mod9_volt_7,
-	    CAN0_SIG_Mod9_volt_8,
-	    CAN0_SIG_Mod9_volt_valid_9_11,
-	    CAN0_SIG_Mod9_volt_9,
-	    CAN0_SIG_Mod9_volt_10,
-	    CAN0_SIG_Mod9_volt_11,
-
-	    CAN0_SIG_Mod9_temp_valid_0_2,
-	    CAN0_SIG_Mod9_temp_0,
-	    CAN0_SIG_Mod9_temp_1,
-	    CAN0_SIG_Mod9_temp_2,
-	    CAN0_SIG_Mod9_temp_valid_3_5,
-	    CAN0_SIG_Mod9_temp_3,
-	    CAN0_SIG_Mod9_temp_4,
-	    CAN0_SIG_Mod9_temp_5,
-	    CAN0_SIG_Mod9_temp_valid_6_8,
-	    CAN0_SIG_Mod9_temp_6,
-	    CAN0_SIG_Mod9_temp_7,
-	    CAN0_SIG_Mod9_temp_8,
-	    CAN0_SIG_Mod9_temp_valid_9_11,
-	    CAN0_SIG_Mod9_temp_9,
-	    CAN0_SIG_Mod9_temp_10,
-	    CAN0_SIG_Mod9_temp_11,
-
-	    CAN0_SIG_Mod10_volt_valid_0_2,
-	    CAN0_SIG_Mod10_volt_0,
-	    CAN0_SIG_Mod10_volt_1,
-	    CAN0_SIG_Mod10_volt_2,
-	    CAN0_SIG_Mod10_volt_valid_3_5,
-	    CAN0_SIG_Mod10_volt_3,
-	    CAN0_SIG_Mod10_volt_4,
-	    CAN0_SIG_Mod10_volt_5,
-	    CAN0_SIG_Mod10_volt_valid_6_8,
-	    CAN0_SIG_Mod10_volt_6,
-	    CAN0_SIG_Mod10_volt_7,
-	    CAN0_SIG_Mod10_volt_8,
-	    CAN0_SIG_Mod10_volt_valid_9_11,
-	    CAN0_SIG_Mod10_volt_9,
-	    CAN0_SIG_Mod10_volt_10,
-	    CAN0_SIG_Mod10_volt_11,
-
-	    CAN0_SIG_Mod10_temp_valid_0_2,
-	    CAN0_SIG_Mod10_temp_0,
-	    CAN0_SIG_Mod10_temp_1,
-	    CAN0_SIG_Mod10_temp_2,
-	    CAN0_SIG_Mod10_temp_valid_3_5,
-	    CAN0_SIG_Mod10_temp_3,
-	    CAN0_SIG_Mod10_temp_4,
-	    CAN0_SIG_Mod10_temp_5,
-	    CAN0_SIG_Mod10_temp_valid_6_8,
-	    CAN0_SIG_Mod10_temp_6,
-	    CAN0_SIG_Mod10_temp_7,
-	    CAN0_SIG_Mod10_temp_8,
-	    CAN0_SIG_Mod10_temp_valid_9_11,
-	    CAN0_SIG_Mod10_temp_9,
-	    CAN0_SIG_Mod10_temp_10,
-	    CAN0_SIG_Mod10_temp_11,
-
-	    CAN0_SIG_Mod11_volt_valid_0_2,
-	    CAN0_SIG_Mod11_volt_0,
-	    CAN0_SIG_Mod11_volt_1,
-	    CAN0_SIG_Mod11_volt_2,
-	    CAN0_SIG_Mod11_volt_valid_3_5,
-	    CAN0_SIG_Mod11_volt_3,
-	    CAN0_SIG_Mod11_volt_4,
-	    CAN0_SIG_Mod11_volt_5,
-	    CAN0_SIG_Mod11_volt_valid_6_8,
-	    CAN0_SIG_Mod11_volt_6,
-	    CAN0_SIG_Mod11_volt_7,
-	    CAN0_SIG_Mod11_volt_8,
-	    CAN0_SIG_Mod11_volt_valid_9_11,
-	    CAN0_SIG_Mod11_volt_9,
-	    CAN0_SIG_Mod11_volt_10,
-	    CAN0_SIG_Mod11_volt_11,
-
-	    CAN0_SIG_Mod11_temp_valid_0_2,
-	    CAN0_SIG_Mod11_temp_0,
-	    CAN0_SIG_Mod11_temp_1,
-	    CAN0_SIG_Mod11_temp_2,
-	    CAN0_SIG_Mod11_temp_valid_3_5,
-	    CAN0_SIG_Mod11_temp_3,
-	    CAN0_SIG_Mod11_temp_4,
-	    CAN0_SIG_Mod11_temp_5,
-	    CAN0_SIG_Mod11_temp_valid_6_8,
-	    CAN0_SIG_Mod11_temp_6,
-	    CAN0_SIG_Mod11_temp_7,
-	    CAN0_SIG_Mod11_temp_8,
-	    CAN0_SIG_Mod11_temp_valid_9_11,
-	    CAN0_SIG_Mod11_temp_9,
-	    CAN0_SIG_Mod11_temp_10,
-	    CAN0_SIG_Mod11_temp_11,
-
-	    CAN0_SIG_Mod12_volt_valid_0_2,
-	    CAN0_SIG_Mod12_volt_0,
-	    CAN0_SIG_Mod12_volt_1,
-	    CAN0_SIG_Mod12_volt_2,
-	    CAN0_SIG_Mod12_volt_valid_3_5,
-	    CAN0_SIG_Mod12_volt_3,
-	    CAN0_SIG_Mod12_volt_4,
-	    CAN0_SIG_Mod12_volt_5,
-	    CAN0_SIG_Mod12_volt_valid_6_8,
-	    CAN0_SIG_Mod12_volt_6,
-	    CAN0_SIG_Mod12_volt_7,
-	    CAN0_SIG_Mod12_volt_8,
-	    CAN0_SIG_Mod12_volt_valid_9_11,
-	    CAN0_SIG_Mod12_volt_9,
-	    CAN0_SIG_Mod12_volt_10,
-	    CAN0_SIG_Mod12_volt_11,
-
-	    CAN0_SIG_Mod12_temp_valid_0_2,
-	    CAN0_SIG_Mod12_temp_0,
-	    CAN0_SIG_Mod12_temp_1,
-	    CAN0_SIG_Mod12_temp_2,
-	    CAN0_SIG_Mod12_temp_valid_3_5,
-	    CAN0_SIG_Mod12_temp_3,
-	    CAN0_SIG_Mod12_temp_4,
-	    CAN0_SIG_Mod12_temp_5,
-	    CAN0_SIG_Mod12_temp_valid_6_8,
-	    CAN0_SIG_Mod12_temp_6,
-	    CAN0_SIG_Mod12_temp_7,
-	    CAN0_SIG_Mod12_temp_8,
-	    CAN0_SIG_Mod12_temp_valid_9_11,
-	    CAN0_SIG_Mod12_temp_9,
-	    CAN0_SIG_Mod12_temp_10,
-	    CAN0_SIG_Mod12_temp_11,
-
-	    CAN0_SIG_Mod13_volt_valid_0_2,
-	    CAN0_SIG_Mod13_volt_0,
-	    CAN0_SIG_Mod13_volt_1,
-	    CAN0_SIG_Mod13_volt_2,
-	    CAN0_SIG_Mod13_volt_valid_3_5,
-	    CAN0_SIG_Mod13_volt_3,
-	    CAN0_SIG_Mod13_volt_4,
-	    CAN0_SIG_Mod13_volt_5,
-	    CAN0_SIG_Mod13_volt_valid_6_8,
-	    CAN0_SIG_Mod13_volt_6,
-	    CAN0_SIG_Mod13_volt_7,
-	    CAN0_SIG_Mod13_volt_8,
-	    CAN0_SIG_Mod13_volt_valid_9_11,
-	    CAN0_SIG_Mod13_volt_9,
-	    CAN0_SIG_Mod13_volt_10,
-	    CAN0_SIG_Mod13_volt_11,
-
-	    CAN0_SIG_Mod13_temp_valid_0_2,
-	    CAN0_SIG_Mod13_temp_0,
-	    CAN0_SIG_Mod13_temp_1,
-	    CAN0_SIG_Mod13_temp_2,
-	    CAN0_SIG_Mod13_temp_valid_3_5,
-	    CAN0_SIG_Mod13_temp_3,
-	    CAN0_SIG_Mod13_temp_4,
-	    CAN0_SIG_Mod13_temp_5,
-	    CAN0_SIG_Mod13_temp_valid_6_8,
-	    CAN0_SIG_Mod13_temp_6,
-	    CAN0_SIG_Mod13_temp_7,
-	    CAN0_SIG_Mod13_temp_8,
-	    CAN0_SIG_Mod13_temp_valid_9_11,
-	    CAN0_SIG_Mod13_temp_9,
-	    CAN0_SIG_Mod13_temp_10,
-	    CAN0_SIG_Mod13_temp_11,
-
-	    CAN0_SIG_Mod14_volt_valid_0_2,
-	    CAN0_SIG_Mod14_volt_0,
-	    CAN0_SIG_Mod14_volt_1,
-	    CAN0_SIG_Mod14_volt_2,
-	    CAN0_SIG_Mod14_volt_valid_3_5,
-	    CAN0_SIG_Mod14_volt_3,
-	    CAN0_SIG_Mod14_volt_4,
-	    CAN0_SIG_Mod14_volt_5,
-	    CAN0_SIG_Mod14_volt_valid_6_8,
-	    CAN0_SIG_Mod14_volt_6,
-	    CAN0_SIG_Mod14_volt_7,
-	    CAN0_SIG_Mod14_volt_8,
-	    CAN0_SIG_Mod14_volt_valid_9_11,
-	    CAN0_SIG_Mod14_volt_9,
-	    CAN0_SIG_Mod14_volt_10,
-	    CAN0_SIG_Mod14_volt_11,
-
-	    CAN0_SIG_Mod14_temp_valid_0_2,
-	    CAN0_SIG_Mod14_temp_0,
-	    CAN0_SIG_Mod14_temp_1,
-	    CAN0_SIG_Mod14_temp_2,
-	    CAN0_SIG_Mod14_temp_valid_3_5,
-	    CAN0_SIG_Mod14_temp_3,
-	    CAN0_SIG_Mod14_temp_4,
-	    CAN0_SIG_Mod14_temp_5,
-	    CAN0_SIG_Mod14_temp_valid_6_8,
-	    CAN0_SIG_Mod14_temp_6,
-	    CAN0_SIG_Mod14_temp_7,
-	    CAN0_SIG_Mod14_temp_8,
-	    CAN0_SIG_Mod14_temp_valid_9_11,
-	    CAN0_SIG_Mod14_temp_9,
-	    CAN0_SIG_Mod14_temp_10,
-	    CAN0_SIG_Mod14_temp_11,
-
-	    CAN0_SIG_Mod15_volt_valid_0_2,
-	    CAN0_SIG_Mod15_volt_0,
-	    CAN0_SIG_Mod15_volt_1,
-	    CAN0_SIG_Mod15_volt_2,
-	    CAN0_SIG_Mod15_volt_valid_3_5,
-	    CAN0_SIG_Mod15_volt_3,
-	    CAN0_SIG_Mod15_volt_4,
-	    CAN0_SIG_Mod15_volt_5,
-	    CAN0_SIG_Mod15_volt_valid_6_8,
-	    CAN0_SIG_Mod15_volt_6,
-	    CAN0_SIG_Mod15_volt_7,
-	    CAN0_SIG_Mod15_volt_8,
-	    CAN0_SIG_Mod15_volt_valid_9_11,
-	    CAN0_SIG_Mod15_volt_9,
-	    CAN0_SIG_Mod15_volt_10,
-	    CAN0_SIG_Mod15_volt_11,
-
-	    CAN0_SIG_Mod15_temp_valid_0_2,
-	    CAN0_SIG_Mod15_temp_0,
-	    CAN0_SIG_Mod15_temp_1,
-	    CAN0_SIG_Mod15_temp_2,
-	    CAN0_SIG_Mod15_temp_valid_3_5,
-	    CAN0_SIG_Mod15_temp_3,
-	    CAN0_SIG_Mod15_temp_4,
-	    CAN0_SIG_Mod15_temp_5,
-	    CAN0_SIG_Mod15_temp_valid_6_8,
-	    CAN0_SIG_Mod15_temp_6,
-	    CAN0_SIG_Mod15_temp_7,
-	    CAN0_SIG_Mod15_temp_8,
-	    CAN0_SIG_Mod15_temp_valid_9_11,
-	    CAN0_SIG_Mod15_temp_9,
-	    CAN0_SIG_Mod15_temp_10,
-	    CAN0_SIG_Mod15_temp_11,
-
-	    CAN0_SIG_Mod16_volt_valid_0_2,
-	    CAN0_SIG_Mod16_volt_0,
-	    CAN0_SIG_Mod16_volt_1,
-	    CAN0_SIG_Mod16_volt_2,
-	    CAN0_SIG_Mod16_volt_valid_3_5,
-	    CAN0_SIG_Mod16_volt_3,
-	    CAN0_SIG_Mod16_volt_4,
-	    CAN0_SIG_Mod16_volt_5,
-	    CAN0_SIG_Mod16_volt_valid_6_8,
-	    CAN0_SIG_Mod16_volt_6,
-	    CAN0_SIG_Mod16_volt_7,
-	    CAN0_SIG_Mod16_volt_8,
-	    CAN0_SIG_Mod16_volt_valid_9_11,
-	    CAN0_SIG_Mod16_volt_9,
-	    CAN0_SIG_Mod16_volt_10,
-	    CAN0_SIG_Mod16_volt_11,
-
-	    CAN0_SIG_Mod16_temp_valid_0_2,
-	    CAN0_SIG_Mod16_temp_0,
-	    CAN0_SIG_Mod16_temp_1,
-	    CAN0_SIG_Mod16_temp_2,
-	    CAN0_SIG_Mod16_temp_valid_3_5,
-	    CAN0_SIG_Mod16_temp_3,
-	    CAN0_SIG_Mod16_temp_4,
-	    CAN0_SIG_Mod16_temp_5,
-	    CAN0_SIG_Mod16_temp_valid_6_8,
-	    CAN0_SIG_Mod16_temp_6,
-	    CAN0_SIG_Mod16_temp_7,
-	    CAN0_SIG_Mod16_temp_8,
-	    CAN0_SIG_Mod16_temp_valid_9_11,
-	    CAN0_SIG_Mod16_temp_9,
-	    CAN0_SIG_Mod16_temp_10,
-	    CAN0_SIG_Mod16_temp_11,
-
-	    CAN0_SIG_Mod17_volt_valid_0_2,
-	    CAN0_SIG_Mod17_volt_0,
-	    CAN0_SIG_Mod17_volt_1,
-	    CAN0_SIG_Mod17_volt_2,
-	    CAN0_SIG_Mod17_volt_valid_3_5,
-	    CAN0_SIG_Mod17_volt_3,
-	    CAN0_SIG_Mod17_volt_4,
-	    CAN0_SIG_Mod17_volt_5,
-	    CAN0_SIG_Mod17_volt_valid_6_8,
-	    CAN0_SIG_Mod17_volt_6,
-	    CAN0_SIG_Mod17_volt_7,
-	    CAN0_SIG_Mod17_volt_8,
-	    CAN0_SIG_Mod17_volt_valid_9_11,
-	    CAN0_SIG_Mod17_volt_9,
-	    CAN0_SIG_Mod17_volt_10,
-	    CAN0_SIG_Mod17_volt_11,
-
-	    CAN0_SIG_Mod17_temp_valid_0_2,
-	    CAN0_SIG_Mod17_temp_0,
-	    CAN0_SIG_Mod17_temp_1,
-	    CAN0_SIG_Mod17_temp_2,
-	    CAN0_SIG_Mod17_temp_valid_3_5,
-	    CAN0_SIG_Mod17_temp_3,
-	    CAN0_SIG_Mod17_temp_4,
-	    CAN0_SIG_Mod17_temp_5,
-	    CAN0_SIG_Mod17_temp_valid_6_8,
-	    CAN0_SIG_Mod17_temp_6,
-	    CAN0_SIG_Mod17_temp_7,
-	    CAN0_SIG_Mod17_temp_8,
-	    CAN0_SIG_Mod17_temp_valid_9_11,
-	    CAN0_SIG_Mod17_temp_9,
-	    CAN0_SIG_Mod17_temp_10,
-	    CAN0_SIG_Mod17_temp_11,
-
-	    CAN0_SIG_Mod18_volt_valid_0_2,
-	    CAN0_SIG_Mod18_volt_0,
-	    CAN0_SIG_Mod18_volt_1,
-	    CAN0_SIG_Mod18_volt_2,
-	    CAN0_SIG_Mod18_volt_valid_3_5,
-	    CAN0_SIG_Mod18_volt_3,
-	    CAN0_SIG_Mod18_volt_4,
-	    CAN0_SIG_Mod18_volt_5,
-	    CAN0_SIG_Mod18_volt_valid_6_8,
-	    CAN0_SIG_Mod18_volt_6,
-	    CAN0_SIG_Mod18_volt_7,
-	    CAN0_SIG_Mod18_volt_8,
-	    CAN0_SIG_Mod18_volt_valid_9_11,
-	    CAN0_SIG_Mod18_volt_9,
-	    CAN0_SIG_Mod18_volt_10,
-	    CAN0_SIG_Mod18_volt_11,
-
-	    CAN0_SIG_Mod18_temp_valid_0_2,
-	    CAN0_SIG_Mod18_temp_0,
-	    CAN0_SIG_Mod18_temp_1,
-	    CAN0_SIG_Mod18_temp_2,
-	    CAN0_SIG_Mod18_temp_valid_3_5,
-	    CAN0_SIG_Mod18_temp_3,
-	    CAN0_SIG_Mod18_temp_4,
-	    CAN0_SIG_Mod18_temp_5,
-	    CAN0_SIG_Mod18_temp_valid_6_8,
-	    CAN0_SIG_Mod18_temp_6,
-	    CAN0_SIG_Mod18_temp_7,
-	    CAN0_SIG_Mod18_temp_8,
-	    CAN0_SIG_Mod18_temp_valid_9_11,
-	    CAN0_SIG_Mod18_temp_9,
-	    CAN0_SIG_Mod18_temp_10,
-	    CAN0_SIG_Mod18_temp_11,
-
-	    CAN0_SIG_Mod19_volt_valid_0_2,
-	    CAN0_SIG_Mod19_volt_0,
-	    CAN0_SIG_Mod19_volt_1,
-	    CAN0_SIG_Mod19_volt_2,
-	    CAN0_SIG_Mod19_volt_valid_3_5,
-	    CAN0_SIG_Mod19_volt_3,
-	    CAN0_SIG_Mod19_volt_4,
-	    CAN0_SIG_Mod19_volt_5,
-	    CAN0_SIG_Mod19_volt_valid_6_8,
-	    CAN0_SIG_Mod19_volt_6,
-	    CAN0_SIG_Mod19_volt_7,
-	    CAN0_SIG_Mod19_volt_8,
-	    CAN0_SIG_Mod19_volt_valid_9_11,
-	    CAN0_SIG_Mod19_volt_9,
-	    CAN0_SIG_Mod19_volt_10,
-	    CAN0_SIG_Mod19_volt_11,
-
-	    CAN0_SIG_Mod19_temp_valid_0_2,
-	    CAN0_SIG_Mod19_temp_0,
-	    CAN0_SIG_Mod19_temp_1,
-	    CAN0_SIG_Mod19_temp_2,
-	    CAN0_SIG_Mod19_temp_valid_3_5,
-	    CAN0_SIG_Mod19_temp_3,
-	    CAN0_SIG_Mod19_temp_4,
-	    CAN0_SIG_Mod19_temp_5,
-	    CAN0_SIG_Mod19_temp_valid_6_8,
-	    CAN0_SIG_Mod19_temp_6,
-	    CAN0_SIG_Mod19_temp_7,
-	    CAN0_SIG_Mod19_temp_8,
-	    CAN0_SIG_Mod19_temp_valid_9_11,
-	    CAN0_SIG_Mod19_temp_9,
-	    CAN0_SIG_Mod19_temp_10,
-	    CAN0_SIG_Mod19_temp_11,
-
-	    CAN0_SIG_Mod20_volt_valid_0_2,
-	    CAN0_SIG_Mod20_volt_0,
-	    CAN0_SIG_Mod20_volt_1,
-	    CAN0_SIG_Mod20_volt_2,
-	    CAN0_SIG_Mod20_volt_valid_3_5,
-	    CAN0_SIG_Mod20_volt_3,
-	    CAN0_SIG_Mod20_volt_4,
-	    CAN0_SIG_Mod20_volt_5,
-	    CAN0_SIG_Mod20_volt_valid_6_8,
-	    CAN0_SIG_Mod20_volt_6,
-	    CAN0_SIG_Mod20_volt_7,
-	    CAN0_SIG_Mod20_volt_8,
-	    CAN0_SIG_Mod20_volt_valid_9_11,
-	    CAN0_SIG_Mod20_volt_9,
-	    CAN0_SIG_Mod20_volt_10,
-	    CAN0_SIG_Mod20_volt_11,
-
-	    CAN0_SIG_Mod20_temp_valid_0_2,
-	    CAN0_SIG_Mod20_temp_0,
-	    CAN0_SIG_Mod20_temp_1,
-	    CAN0_SIG_Mod20_temp_2,
-	    CAN0_SIG_Mod20_temp_valid_3_5,
-	    CAN0_SIG_Mod20_temp_3,
-	    CAN0_SIG_Mod20_temp_4,
-	    CAN0_SIG_Mod20_temp_5,
-	    CAN0_SIG_Mod20_temp_valid_6_8,
-	    CAN0_SIG_Mod20_temp_6,
-	    CAN0_SIG_Mod20_temp_7,
-	    CAN0_SIG_Mod20_temp_8,
-	    CAN0_SIG_Mod20_temp_valid_9_11,
-	    CAN0_SIG_Mod20_temp_9,
-	    CAN0_SIG_Mod20_temp_10,
-	    CAN0_SIG_Mod20_temp_11,
-
-	    CAN0_SIG_Mod21_volt_valid_0_2,
-	    CAN0_SIG_Mod21_volt_0,
-	    CAN0_SIG_Mod21_volt_1,
-	    CAN0_SIG_Mod21_volt_2,
-	    CAN0_SIG_Mod21_volt_valid_3_5,
-	    CAN0_SIG_Mod21_volt_3,
-	    CAN0_SIG_Mod21_volt_4,
-	    CAN0_SIG_Mod21_volt_5,
-	    CAN0_SIG_Mod21_volt_valid_6_8,
-	    CAN0_SIG_Mod21_volt_6,
-	    CAN0_SIG_Mod21_volt_7,
-	    CAN0_SIG_Mod21_volt_8,
-	    CAN0_SIG_Mod21_volt_valid_9_11,
-	    CAN0_SIG_Mod21_volt_9,
-	    CAN0_SIG_Mod21_volt_10,
-	    CAN0_SIG_Mod21_volt_11,
-
-	    CAN0_SIG_Mod21_temp_valid_0_2,
-	    CAN0_SIG_Mod21_temp_0,
-	    CAN0_SIG_Mod21_temp_1,
-	    CAN0_SIG_Mod21_temp_2,
-	    CAN0_SIG_Mod21_temp_valid_3_5,
-	    CAN0_SIG_Mod21_temp_3,
-	    CAN0_SIG_Mod21_temp_4,
-	    CAN0_SIG_Mod21_temp_5,
-	    CAN0_SIG_Mod21_temp_valid_6_8,
-	    CAN0_SIG_Mod21_temp_6,
-	    CAN0_SIG_Mod21_temp_7,
-	    CAN0_SIG_Mod21_temp_8,
-	    CAN0_SIG_Mod21_temp_valid_9_11,
-	    CAN0_SIG_Mod21_temp_9,
-	    CAN0_SIG_Mod21_temp_10,
-	    CAN0_SIG_Mod21_temp_11,
-
-	    CAN0_SIG_Mod22_volt_valid_0_2,
-	    CAN0_SIG_Mod22_volt_0,
-	    CAN0_SIG_Mod22_volt_1,
-	    CAN0_SIG_Mod22_volt_2,
-	    CAN0_SIG_Mod22_volt_valid_3_5,
-	    CAN0_SIG_Mod22_volt_3,
-	    CAN0_SIG_Mod22_volt_4,
-	    CAN0_SIG_Mod22_volt_5,
-	    CAN0_SIG_Mod22_volt_valid_6_8,
-	    CAN0_SIG_Mod22_volt_6,
-	    CAN0_SIG_Mod22_volt_7,
-	    CAN0_SIG_Mod22_volt_8,
-	    CAN0_SIG_Mod22_volt_valid_9_11,
-	    CAN0_SIG_Mod22_volt_9,
-	    CAN0_SIG_Mod22_volt_10,
-	    CAN0_SIG_Mod22_volt_11,
-
-	    CAN0_SIG_Mod22_temp_valid_0_2,
-	    CAN0_SIG_Mod22_temp_0,
-	    CAN0_SIG_Mod22_temp_1,
-	    CAN0_SIG_Mod22_temp_2,
-	    CAN0_SIG_Mod22_temp_valid_3_5,
-	    CAN0_SIG_Mod22_temp_3,
-	    CAN0_SIG_Mod22_temp_4,
-	    CAN0_SIG_Mod22_temp_5,
-	    CAN0_SIG_Mod22_temp_valid_6_8,
-	    CAN0_SIG_Mod22_temp_6,
-	    CAN0_SIG_Mod22_temp_7,
-	    CAN0_SIG_Mod22_temp_8,
-	    CAN0_SIG_Mod22_temp_valid_9_11,
-	    CAN0_SIG_Mod22_temp_9,
-	    CAN0_SIG_Mod22_temp_10,
-	    CAN0_SIG_Mod22_temp_11,
-
-	    CAN0_SIG_Mod23_volt_valid_0_2,
-	    CAN0_SIG_Mod23_volt_0,
-	    CAN0_SIG_Mod23_volt_1,
-	    CAN0_SIG_Mod23_volt_2,
-	    CAN0_SIG_Mod23_volt_valid_3_5,
-	    CAN0_SIG_Mod23_volt_3,
-	    CAN0_SIG_Mod23_volt_4,
-	    CAN0_SIG_Mod23_volt_5,
-	    CAN0_SIG_Mod23_volt_valid_6_8,
-	    CAN0_SIG_Mod23_volt_6,
-	    CAN0_SIG_Mod23_volt_7,
-	    CAN0_SIG_Mod23_volt_8,
-	    CAN0_SIG_Mod23_volt_valid_9_11,
-	    CAN0_SIG_Mod23_volt_9,
-	    CAN0_SIG_Mod23_volt_10,
-	    CAN0_SIG_Mod23_volt_11,
-
-	    CAN0_SIG_Mod23_temp_valid_0_2,
-	    CAN0_SIG_Mod23_temp_0,
-	    CAN0_SIG_Mod23_temp_1,
-	    CAN0_SIG_Mod23_temp_2,
-	    CAN0_SIG_Mod23_temp_valid_3_5,
-	    CAN0_SIG_Mod23_temp_3,
-	    CAN0_SIG_Mod23_temp_4,
-	    CAN0_SIG_Mod23_temp_5,
-	    CAN0_SIG_Mod23_temp_valid_6_8,
-	    CAN0_SIG_Mod23_temp_6,
-	    CAN0_SIG_Mod23_temp_7,
-	    CAN0_SIG_Mod23_temp_8,
-	    CAN0_SIG_Mod23_temp_valid_9_11,
-	    CAN0_SIG_Mod23_temp_9,
-	    CAN0_SIG_Mod23_temp_10,
-	    CAN0_SIG_Mod23_temp_11,
-
-	    CAN0_SIG_Mod24_volt_valid_0_2,
-	    CAN0_SIG_Mod24_volt_0,
-	    CAN0_SIG_Mod24_volt_1,
-	    CAN0_SIG_Mod24_volt_2,
-	    CAN0_SIG_Mod24_volt_valid_3_5,
-	    CAN0_SIG_Mod24_volt_3,
-	    CAN0_SIG_Mod24_volt_4,
-	    CAN0_SIG_Mod24_volt_5,
-	    CAN0_SIG_Mod24_volt_valid_6_8,
-	    CAN0_SIG_Mod24_volt_6,
-	    CAN0_SIG_Mod24_volt_7,
-	    CAN0_SIG_Mod24_volt_8,
-	    CAN0_SIG_Mod24_volt_valid_9_11,
-	    CAN0_SIG_Mod24_volt_9,
-	    CAN0_SIG_Mod24_volt_10,
-	    CAN0_SIG_Mod24_volt_11,
-
-	    CAN0_SIG_Mod24_temp_valid_0_2,
-	    CAN0_SIG_Mod24_temp_0,
-	    CAN0_SIG_Mod24_temp_1,
-	    CAN0_SIG_Mod24_temp_2,
-	    CAN0_SIG_Mod24_temp_valid_3_5,
-	    CAN0_SIG_Mod24_temp_3,
-	    CAN0_SIG_Mod24_temp_4,
-	    CAN0_SIG_Mod24_temp_5,
-	    CAN0_SIG_Mod24_temp_valid_6_8,
-	    CAN0_SIG_Mod24_temp_6,
-	    CAN0_SIG_Mod24_temp_7,
-	    CAN0_SIG_Mod24_temp_8,
-	    CAN0_SIG_Mod24_temp_valid_9_11,
-	    CAN0_SIG_Mod24_temp_9,
-	    CAN0_SIG_Mod24_temp_10,
-	    CAN0_SIG_Mod24_temp_11,
-#endif // ITRI_MOD_5
-
     CAN0_SIGNAL_NONE = 0xFFFF
 } CANS_CAN0_signalsTx_e;
 
@@ -1397,6 +484,51 @@ typedef struct  {
     can_callback_funcPtr getter;
 } CANS_signal_s;
 
+/**
+ * @ingroup CONFIG_CANSIGNAL
+ * TRUE if the heartbeat of at least one CAN peer in CANS_heartbeatPeer_e is supervised.
+ * Without peers it has to be FALSE, as the supervision would need arrays of length 0.
+ * \par Type:
+ * toggle
+ * \par Default:
+ * TRUE with ITRI_MOD_11
+*/
+#if defined(ITRI_MOD_11)
+#define CANS_HEARTBEAT_SUPERVISION TRUE
+#else
+#define CANS_HEARTBEAT_SUPERVISION FALSE
+#endif
+
+/**
+ * symbolic names for the CAN peers whose heartbeat is supervised
+ */
+typedef enum {
+#if defined(ITRI_MOD_11)
+    CANS_HEARTBEAT_EBM_CONTROLLER,      /*!< controller of the EBMs, heartbeat sent in the debug message */
+#endif
+    CANS_NR_OF_HEARTBEAT_PEERS,         /*!< number of supervised peers */
+} CANS_heartbeatPeer_e;
+
+/**
+ * type definition for the heartbeat supervision of a CAN peer
+ */
+typedef struct {
+    uint32_t timeout_ms;                            /*!< maximum time between two heartbeats in ms */
+    void (*reaction)(CANS_heartbeatPeer_e peer);    /*!< called once when the heartbeat times out, may be NULL_PTR */
+} CANS_HEARTBEAT_CFG_s;
+
+/**
+ * type definition for a range of consecutive transmit messages that are transmitted on delta
+ */
+typedef struct {
+    CANS_messagesTx_e first_msg;    /*!< first message of the range */
+    uint16_t nr_of_messages;        /*!< number of messages in the range */
+    uint32_t max_silence_ms;        /*!< maximum time between two transmissions in ms */
+    uint8_t counter_shift;          /*!< bit position of the rolling counter in the message data */
+    uint8_t counter_mask;           /*!< mask of the rolling counter */
+    uint8_t (*changed)(CANS_messagesTx_e msgIdx, uint64_t lastData, uint64_t data);   /*!< returns TRUE if data differs from the last transmitted data by more than the deadband, NULL_PTR to transmit on any change */
+} CANS_TX_ON_DELTA_CFG_s;
+
 /*================== Constant and Variable Definitions ====================*/
 
 /**
@@ -1439,8 +571,33 @@ extern const uint16_t cans_CAN0_signals_rx_length;
  */
 extern const uint16_t cans_CAN1_signals_rx_length;
 
-/*================== Function Prototypes ==================================*/
+#if CANS_HEARTBEAT_SUPERVISION == TRUE
+/**
+ * heartbeat supervision of the CAN peers, indexed by CANS_heartbeatPeer_e
+ */
+extern const CANS_HEARTBEAT_CFG_s cans_heartbeat_cfg[CANS_NR_OF_HEARTBEAT_PEERS];
+#endif
 
+/**
+ * ranges of transmit messages that are transmitted on delta
+ */
+extern const CANS_TX_ON_DELTA_CFG_s cans_tx_ondelta_cfg[];
+
+/**
+ * length of the array of ranges of transmit messages that are transmitted on delta
+ */
+extern const uint16_t cans_tx_ondelta_cfg_length;
+
+/*================== Function Prototypes ==================================*/
+/**
+ * composes the data of a cell voltage or cell temperature message (see cansignal_gen_cfg.h)
+ *
+ * @param msgIdx    message index
+ * @param dataptr   message data that is composed
+ *
+ * @return TRUE if msgIdx is a cell data message and has been composed, FALSE otherwise
+ */
+extern uint8_t CANS_ComposeCellDataMessage(CANS_messagesTx_e msgIdx, uint8_t dataptr[]);
 
 /*================== Function Implementations =============================*/
 
@@ -183,6 +183,38 @@ LTC_MUX_SEQUENZ_s ltc_mux_seq = {
 };
 
 
+/**
+ * Measurement plan: rate of the measurements made in addition to the cell voltages.
+ * The cell voltages are measured in every cycle. After the cell voltages (and
+ * the multiplexer step), at most one further measurement is made per cycle:
+ * the first entry of the table that is due. Entries that are due but not made
+ * are made in one of the next cycles, so measurements with a low rate must be
+ * placed first. Requests made with LTC_SetStateRequest() take precedence.
+ * Must be adapted to the application
+ */
+const LTC_PLAN_ENTRY_s ltc_measurement_plan_entries[] = {
+    /* measurement                  divider offset */
+    {LTC_PLAN_OPENWIRE_CHECK,       0,      0},     /* only on request, e.g., 1000 for every 1000th cycle */
+#if defined(ITRI_MOD_2_c)
+    {LTC_PLAN_ALLGPIOMEASUREMENT,   1,      0},     /* all GPIOs are measured instead of the balance control */
+    {LTC_PLAN_BALANCECONTROL,       0,      0},
+#else
+    {LTC_PLAN_ALLGPIOMEASUREMENT,   0,      0},
+    {LTC_PLAN_BALANCECONTROL,       1,      0},
+#endif // ITRI_MOD_2_c
+    {LTC_PLAN_MUXMEASUREMENT,       1,      0},     /* not used with ITRI_MOD_2_d */
+};
+
+
+LTC_PLAN_s ltc_measurement_plan = {
+    .nr_of_entries  =  (sizeof(ltc_measurement_plan_entries)/sizeof(LTC_PLAN_ENTRY_s)),
+    .entries        =  &ltc_measurement_plan_entries[0],
+};
+
+/* the build fails with a negative array size if the measurement plan has too many entries */
+typedef uint8_t LTC_PLAN_SIZE_CHECK[((sizeof(ltc_measurement_plan_entries)/sizeof(LTC_PLAN_ENTRY_s)) <= LTC_PLAN_MAX_ENTRIES) ? 1 : -1];
+
+
 const uint8_t ltc_muxsensortemperatur_cfg[BS_NR_OF_TEMP_SENSORS_PER_MODULE] = {
     1-1 ,       /*!< index 0 = mux 0, ch 0 */
     2-1 ,       /*!< index 1 = mux 0, ch 1 */
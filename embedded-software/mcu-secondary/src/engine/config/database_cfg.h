@@ -69,6 +69,31 @@
  */
 #define DATA_MAX_BLOCK_NR                24        /* max 24 Blocks currently supported*/
 
+/**
+ * @brief enables the access statistics of the database
+ *
+ * If enabled, the database records for every data block the latency of
+ * read and write accesses, dropped writes and contention between accesses.
+ */
+#define DATA_ENABLE_ACCESS_STATISTICS       1
+/* #define DATA_ENABLE_ACCESS_STATISTICS       0 */
+
+/**
+ * @brief number of bins of the access latency histogram
+ *
+ * bin i counts the accesses that took i OS ticks, the last bin counts all
+ * accesses that took longer
+ */
+#define DATA_LATENCY_HISTOGRAM_BINS         16
+
+/**
+ * @brief maximum number of subscriptions to data blocks
+ *
+ * A subscribed task gets a task notification whenever new data of the data
+ * block is stored, see DATA_Subscribe()
+ */
+#define DATA_MAX_SUBSCRIPTIONS              8
+
 /**
  * @brief data block identification number
  */
@@ -180,6 +205,8 @@ typedef struct {
     uint32_t valid_voltPECs[BS_NR_OF_MODULES];  /*!< bitmask if PEC was okay. 0->ok, 1->error   */
     uint32_t sumOfCells[BS_NR_OF_MODULES];      /*!< unit: mV                                   */
     uint8_t valid_socPECs[BS_NR_OF_MODULES];   /*!< 0 -> if PEC okay; 1 -> PEC error           */
+    uint16_t voltage_min;                       /*!< unit: mV, minimum of voltage[]             */
+    uint16_t voltage_min_index;                 /*!< index of voltage_min in voltage[]          */
     uint8_t state;                              /*!< for future use                             */
 } DATA_BLOCK_CELLVOLTAGE_s;
 
@@ -373,6 +400,11 @@ typedef struct {
     int16_t temperature_max;
     uint16_t temperature_module_number_max;
     uint16_t temperature_sensor_number_max;
+    uint32_t voltage_module_sum[BS_NR_OF_MODULES];          /*!< sum of the cell voltages of each module in mV  */
+    uint16_t voltage_module_min[BS_NR_OF_MODULES];          /*!< minimum cell voltage of each module in mV      */
+    uint16_t voltage_module_max[BS_NR_OF_MODULES];          /*!< maximum cell voltage of each module in mV      */
+    int16_t temperature_module_min[BS_NR_OF_MODULES];       /*!< minimum temperature of each module             */
+    int16_t temperature_module_max[BS_NR_OF_MODULES];       /*!< maximum temperature of each module             */
     uint8_t state;
 } DATA_BLOCK_MINMAX_s;
 
@@ -559,6 +591,7 @@ typedef struct {
     uint32_t timestamp;                                                       /*!< timestamp of database entry                */
     uint32_t previous_timestamp;                                              /*!< timestamp of last database entry           */
     uint16_t gpiovoltage[BS_NR_OF_MODULES * BS_NR_OF_GPIOS_PER_MODULE];       /*!< unit: mV                                   */
+    uint16_t valid_gpioPECs[BS_NR_OF_MODULES];                                /*!< bitmask if PEC was okay. 0->ok, 1->error   */
     uint8_t state;                                                            /*!< for future use                             */
 } DATA_BLOCK_ALLGPIOVOLTAGE_s;
 
@@ -71,6 +71,7 @@ OS_Task_Definition_s eng_tskdef_cyclic_10ms  = { 2,     10,  OS_PRIORITY_HIGH,
 OS_Task_Definition_s eng_tskdef_cyclic_100ms = { 56,    100,  OS_PRIORITY_ABOVE_NORMAL,     1024/4};
 OS_Task_Definition_s eng_tskdef_eventhandler = { 0,      1,  OS_PRIORITY_VERY_HIGH,         1024/4};
 OS_Task_Definition_s eng_tskdef_diagnosis    = { 0,      1,  OS_PRIORITY_BELOW_REALTIME,    1024/4};
+OS_Task_Definition_s eng_tskdef_ltc          = { 0,      1,  OS_PRIORITY_ABOVE_HIGH,        1024/4};
 
 /*================== Function Prototypes ==================================*/
 
@@ -129,7 +130,9 @@ void ENG_Init(void) {
 void ENG_Cyclic_1ms(void) {
     SYS_Trigger();
     ILCK_Trigger();
+#if LTC_EVENT_DRIVEN_SCHEDULING == FALSE
     LTC_Trigger();
+#endif
 }
 
 void ENG_Cyclic_10ms(void) {
@@ -93,6 +93,16 @@ extern OS_Task_Definition_s eng_tskdef_cyclic_100ms;
 extern OS_Task_Definition_s eng_tskdef_eventhandler;
 extern OS_Task_Definition_s eng_tskdef_diagnosis;
 
+/**
+ * @brief   Task configuration of the event driven LTC task
+ *
+ * @details Only used with LTC_EVENT_DRIVEN_SCHEDULING, the cycle time is not
+ *          evaluated as the task is woken up by the SPI driver
+ *
+ * @ingroup API_OS
+ */
+extern OS_Task_Definition_s eng_tskdef_ltc;
+
 /*================== Function Prototypes ==================================*/
 /**
  * @brief   Initializes modules that were not initialized before scheduler
@@ -54,6 +54,7 @@
 #include "enginetask.h"
 
 #include "database.h"
+#include "ltc.h"
 
 /*================== Macros and Definitions ===============================*/
 
@@ -91,6 +92,13 @@ static TaskHandle_t eng_handle_tsk_diagnosis;
  */
 static TaskHandle_t eng_handle_tsk_eventhandler;
 
+#if LTC_EVENT_DRIVEN_SCHEDULING == TRUE
+/**
+ * Definition of task handle of the event driven LTC task
+ */
+static TaskHandle_t eng_handle_tsk_ltc;
+#endif
+
 /*================== Function Prototypes ==================================*/
 
 
@@ -150,6 +158,18 @@ void ENG_CreateTask(void) {
             /* TODO: explain why infinite loop */
       }
     }
+
+#if LTC_EVENT_DRIVEN_SCHEDULING == TRUE
+    /* LTC Task */
+    if (xTaskCreate((TaskFunction_t)ENG_TSK_LTC, (const portCHAR *)"TSK_LTC",
+            eng_tskdef_ltc.Stacksize, NULL, eng_tskdef_ltc.Priority,
+                &eng_handle_tsk_ltc) != pdPASS)  {
+      while (1) {
+            /* TODO: explain why infinite loop */
+      }
+    }
+    LTC_InitEventDrivenScheduling(eng_handle_tsk_ltc);
+#endif
 }
 
 void ENG_CreateMutex(void) {
@@ -246,3 +266,17 @@ void ENG_TSK_Diagnosis(void) {
         OS_taskDelayUntil(&currentTime, eng_tskdef_diagnosis.CycleTime);
     }
 }
+
+#if LTC_EVENT_DRIVEN_SCHEDULING == TRUE
+void ENG_TSK_LTC(void) {
+    while (os_boot != OS_SYSTEM_RUNNING) {
+    }
+
+    OS_taskDelayUntil(&os_schedulerstarttime, eng_tskdef_ltc.Phase);
+
+    while (1) {
+        LTC_Trigger();
+        LTC_WaitForEvent();
+    }
+}
+#endif
@@ -101,6 +101,7 @@ int main(void) {
 #endif
     BKP_SRAM_Init();    /* at this point diagnosis event memory in BKP_SRAM will be available */
     SystemClock_Config();
+    MCU_InitCycleCounter();
 
     retval = DIAG_Init(&diag_dev, RTC_getRegisterValueBKPSRAM(BKPREGISTER_BKPSRAM_DIAG_VALID));
     if (retval == E_OK) {
@@ -78,6 +78,25 @@
 /* #define LTC_DISCARD_MUX_CHECK TRUE */
 #define LTC_DISCARD_MUX_CHECK FALSE
 
+/**
+ * @ingroup CONFIG_LTC
+ * If set to TRUE, the LTC state machine runs in its own task (TSK_LTC) and is
+ * advanced as soon as an SPI transmission to the daisy-chain has finished,
+ * instead of being polled every 1ms from ENG_Cyclic_1ms().
+ * Waiting times (e.g., ADC conversion) are still counted in OS ticks.
+*/
+/* #define LTC_EVENT_DRIVEN_SCHEDULING TRUE */
+#define LTC_EVENT_DRIVEN_SCHEDULING FALSE
+
+/**
+ * @ingroup CONFIG_LTC
+ * If set to TRUE, the conversions of the LTC are pipelined with the register
+ * readout: the GPIO conversion runs while the cell voltages are read and the
+ * next cell voltage conversion runs while the GPIO registers are read.
+*/
+/* #define LTC_PIPELINED_MEASUREMENT TRUE */
+#define LTC_PIPELINED_MEASUREMENT FALSE
+
 
 /**
  * Number of used LTC-ICs
@@ -336,6 +355,11 @@
  */
 extern LTC_MUX_SEQUENZ_s ltc_mux_seq;
 
+/**
+ * Measurement plan, defines the rate of the measurements made in addition to the cell voltages
+ */
+extern LTC_PLAN_s ltc_measurement_plan;
+
 /**
  * On the foxBMS slave board there are 6 multiplexer inputs dedicated to temperature
  * sensors by default.
@@ -0,0 +1,630 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+# @copyright &copy; 2010 - 2019, Fraunhofer-Gesellschaft zur Foerderung der
+#   angewandten Forschung e.V. All rights reserved.
+#
+# BSD 3-Clause License
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+# 1.  Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+# 2.  Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+# 3.  Neither the name of the copyright holder nor the names of its
+#     contributors may be used to endorse or promote products derived from this
+#     software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# &Prime;This product uses parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product includes parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product is derived from foxBMS&reg;&Prime;
+
+"""Generator for the cell data CAN messages of the cansignal configuration.
+The per module cell voltage and cell temperature messages are described once in
+the DBC file (module 0 serves as template) and in a small mapping file. This
+script reads both together with the number of battery modules from
+batterysystem_cfg.h and writes cansignal_gen_cfg.h, which contains the
+symbolic message names, the transmit table entries, the bit layout of the
+messages as compile-time constants and pack/unpack functions for every message
+family. Multiplexed families, which send the cells of all modules under one
+CAN ID, are selected at build time by a macro of the embedded configuration.
+It is invoked as a build step by waf.
+"""
+
+import io
+import os
+import re
+import sys
+import yaml
+import argparse
+import logging
+
+__version__ = 0.1
+__date__ = '2019-09-02'
+__updated__ = '2019-09-02'
+
+RE_MESSAGE = re.compile(r'^BO_\s+(\d+)\s+(\w+)\s*:\s*(\d+)\s+(\w+)')
+RE_SIGNAL = re.compile(r'^\s*SG_\s+(\w+)\s*(M|m\d+)?\s*:\s*(\d+)\|(\d+)@([01])([+-])\s*'
+                       r'\(([^,]+),([^)]+)\)\s*\[([^|]+)\|([^\]]+)\]')
+RE_NR_OF_MODULES = re.compile(r'^\s*#define\s+BS_NR_OF_MODULES\s+(\d+)', re.M)
+
+
+class DbcSignal(object):
+    """Signal of a DBC message"""
+    def __init__(self, match):
+        self.name = match.group(1)
+        # None for plain signals, 'M' for the multiplexer, else the multiplexer value
+        self.mux = match.group(2)
+        if self.mux is not None and self.mux != 'M':
+            self.mux = int(self.mux[1:])
+        self.start = int(match.group(3))
+        self.length = int(match.group(4))
+        self.intel = match.group(5) == '1'
+        self.signed = match.group(6) == '-'
+        self.factor = float(match.group(7))
+        self.offset = float(match.group(8))
+        self.minimum = float(match.group(9))
+        self.maximum = float(match.group(10))
+
+    def layout(self):
+        """Layout of the signal without its name and position"""
+        return (self.length, self.intel, self.signed, self.factor,
+                self.offset, self.minimum, self.maximum)
+
+
+class DbcMessage(object):
+    """Message of a DBC file"""
+    def __init__(self, match):
+        self.id = int(match.group(1))
+        self.name = match.group(2)
+        self.dlc = int(match.group(3))
+        self.signals = []
+
+    def multiplexer(self):
+        """Multiplexer signal of the message, None if it is not multiplexed"""
+        found = [s for s in self.signals if s.mux == 'M']
+        return found[0] if found else None
+
+    def multiplexed(self, value):
+        """The message as seen with the multiplexer set to value, None if no
+        signal is multiplexed with this value
+        """
+        signals = [s for s in self.signals if s.mux == value]
+        if not signals:
+            return None
+        view = DbcMessage.__new__(DbcMessage)
+        view.id = self.id
+        view.name = '{} m{}'.format(self.name, value)
+        view.dlc = self.dlc
+        view.signals = signals
+        return view
+
+
+def read_dbc(file_path):
+    """Reads the messages and signals of a DBC file into a dict, indexed by
+    message name.
+    """
+    messages = {}
+    message = None
+    with io.open(file_path, 'r', encoding='latin-1') as f:
+        for line in f:
+            match = RE_MESSAGE.match(line)
+            if match:
+                message = DbcMessage(match)
+                messages[message.name] = message
+                continue
+            match = RE_SIGNAL.match(line)
+            if match and message is not None:
+                message.signals.append(DbcSignal(match))
+            elif not line.strip():
+                message = None
+    return messages
+
+
+def read_nr_of_modules(file_path):
+    """Reads BS_NR_OF_MODULES from batterysystem_cfg.h"""
+    with io.open(file_path, 'r', encoding='latin-1') as f:
+        found = RE_NR_OF_MODULES.findall(f.read())
+    if not found:
+        raise ValueError('BS_NR_OF_MODULES not found in \'{}\''.format(file_path))
+    if len(set(found)) > 1:
+        logging.warning('BS_NR_OF_MODULES defined several times in \'%s\', '
+                        'using %s', file_path, found[0])
+    return int(found[0])
+
+
+def c_define(name, value):
+    """Formats a macro definition with aligned value"""
+    return '#define {} {}'.format(name.ljust(40), value)
+
+
+def c_float(value):
+    """Formats a value as C float constant"""
+    return '{!r}f'.format(float(value))
+
+
+class Family(object):
+    """Group of messages that is repeated for every battery module. The
+    messages of a multiplexed family share one CAN ID for all modules, the
+    multiplexer value selects the module and the message within the module.
+    """
+    def __init__(self, cfg, dbc, nr_of_modules):
+        self.name = cfg['name']
+        self.description = cfg.get('description', cfg['name'])
+        self.enum_name = cfg['enum_name']
+        self.nr_of_messages = int(cfg['nr_of_messages'])
+        self.macro = 'CANS_GEN_' + self.name.upper()
+        self.dbc_message = cfg['dbc_message']
+        self.multiplexed = bool(cfg.get('multiplexed', False))
+        self.replaces = cfg.get('replaces')
+        self.select = cfg.get('select')
+        self.mux = None
+
+        if self.multiplexed:
+            if self.replaces is None or self.select is None:
+                raise ValueError('multiplexed family \'{}\' needs replaces and select'.format(self.name))
+            if self.dbc_message not in dbc:
+                raise ValueError('message \'{}\' not found in DBC file'.format(self.dbc_message))
+            message = dbc[self.dbc_message]
+            self.mux = message.multiplexer()
+            if self.mux is None or not self.mux.intel or self.mux.signed:
+                raise ValueError('message \'{}\' has no unsigned Intel multiplexer'.format(message.name))
+            if nr_of_modules * self.nr_of_messages > (1 << self.mux.length):
+                raise ValueError('multiplexer of family \'{}\' is too short for {} modules'.format(
+                    self.name, nr_of_modules))
+            self.stride = 0
+            templates = []
+            for value in range(self.nr_of_messages):
+                template = message.multiplexed(value)
+                if template is None:
+                    raise ValueError('message \'{}\' has no signals for multiplexer value {}'.format(
+                        message.name, value))
+                templates.append(template)
+            self.id_base = message.id
+        else:
+            self.stride = int(cfg['id_module_stride'])
+            templates = []
+            for message in range(self.nr_of_messages):
+                name = self.dbc_message.format(module=0, message=message)
+                if name not in dbc:
+                    raise ValueError('message \'{}\' not found in DBC file'.format(name))
+                templates.append(dbc[name])
+            self.id_base = templates[0].id
+            for message, template in enumerate(templates):
+                if template.id != self.id_base + message:
+                    raise ValueError('message \'{}\' has no consecutive ID'.format(template.name))
+        self.dlc = templates[0].dlc
+
+        self.re_valid = re.compile(cfg['valid_signal'])
+        self.re_counter = re.compile(cfg['counter_signal']) if 'counter_signal' in cfg else None
+        self.valid = sorted([s for s in templates[0].signals if self.kind(s) == 'valid'],
+                            key=lambda s: s.start)
+        self.counter = [s for s in templates[0].signals if self.kind(s) == 'counter']
+        self.values = sorted([s for s in templates[0].signals if self.kind(s) == 'value'],
+                             key=lambda s: s.start)
+        self.check_layout(templates)
+        self.id_offsets = [0] * nr_of_modules
+
+    def kind(self, signal):
+        """Role of a signal in the message: 'valid', 'counter' or 'value'"""
+        if self.re_valid.search(signal.name):
+            return 'valid'
+        if self.re_counter is not None and self.re_counter.search(signal.name):
+            return 'counter'
+        return 'value'
+
+    def check_modules(self, dbc):
+        """Checks that further modules in the DBC file follow the template"""
+        for module in range(1, len(self.id_offsets)):
+            for message in range(self.nr_of_messages):
+                if self.multiplexed:
+                    view = dbc[self.dbc_message].multiplexed(self.mux_value(module, message))
+                    if view is not None:
+                        self.check_layout([view])
+                    continue
+                name = self.dbc_message.format(module=module, message=message)
+                if name not in dbc:
+                    continue
+                if dbc[name].id != self.message_id(module, message):
+                    raise ValueError('message \'{}\' has ID 0x{:X}, expected 0x{:X}'.format(
+                        name, dbc[name].id, self.message_id(module, message)))
+                self.check_layout([dbc[name]])
+
+    def check_layout(self, messages):
+        """Checks that all messages have the layout of the first template"""
+        if not self.values:
+            raise ValueError('family \'{}\' has no value signals'.format(self.name))
+        for s in self.valid:
+            if s.length != 1 or not s.intel:
+                raise ValueError('valid signal \'{}\' must be a 1 bit Intel signal'.format(s.name))
+        for i, s in enumerate(self.valid):
+            if s.start != self.valid[0].start + i:
+                raise ValueError('valid signals of family \'{}\' are not contiguous'.format(self.name))
+        if len(self.counter) > 1:
+            raise ValueError('family \'{}\' has more than one counter signal'.format(self.name))
+        for s in self.counter:
+            if not s.intel or s.signed or s.length > 8:
+                raise ValueError('counter signal \'{}\' must be an unsigned Intel signal '
+                                 'of at most 8 bit'.format(s.name))
+        for s in self.values:
+            if not s.intel or s.signed:
+                raise ValueError('value signal \'{}\' must be an unsigned Intel signal'.format(s.name))
+            if s.layout() != self.values[0].layout():
+                raise ValueError('value signals of family \'{}\' differ in layout'.format(self.name))
+        for message in messages:
+            valid = [s.start for s in message.signals if self.kind(s) == 'valid']
+            counter = [s.start for s in message.signals if self.kind(s) == 'counter']
+            values = [s.start for s in message.signals if self.kind(s) == 'value']
+            if sorted(valid) != [s.start for s in self.valid] or \
+                    counter != [s.start for s in self.counter] or \
+                    sorted(values) != [s.start for s in self.values]:
+                raise ValueError('message \'{}\' differs from the template layout'.format(message.name))
+
+    def message_id(self, module, message):
+        """CAN ID of a message"""
+        if self.multiplexed:
+            return self.id_base
+        return self.id_base + module * self.stride + self.id_offsets[module] + message
+
+    def mux_value(self, module, message):
+        """Multiplexer value of a message of a multiplexed family"""
+        return module * self.nr_of_messages + message
+
+    def definitions(self):
+        """Layout constants, conversion and pack/unpack functions"""
+        value = self.values[0]
+        m = self.macro
+        mux_param = 'uint32_t mux, ' if self.multiplexed else ''
+        lines = []
+        lines.append('/*================== {} ==================*/'.format(self.description))
+        lines.append('/**')
+        if self.multiplexed:
+            lines.append(' * {} of a module, {} multiplexed messages with {} values each'.format(
+                self.description, self.nr_of_messages, len(self.values)))
+        else:
+            lines.append(' * {} of a module, {} messages with {} values each'.format(
+                self.description, self.nr_of_messages, len(self.values)))
+        lines.append(' */')
+        lines.append(c_define('{}_VALUES_PER_MESSAGE'.format(m), len(self.values)))
+        if self.multiplexed:
+            lines.append(c_define('{}_MUX_SHIFT'.format(m), '{}u'.format(self.mux.start)))
+            lines.append(c_define('{}_MUX_MASK'.format(m), '0x{:X}u'.format((1 << self.mux.length) - 1)))
+        lines.append(c_define('{}_VALID_SHIFT'.format(m), '{}u'.format(self.valid[0].start if self.valid else 0)))
+        lines.append(c_define('{}_VALID_MASK'.format(m), '0x{:X}u'.format((1 << len(self.valid)) - 1)))
+        lines.append(c_define('{}_VALUE_MASK'.format(m), '0x{:X}u'.format((1 << value.length) - 1)))
+        for i, s in enumerate(self.values):
+            lines.append(c_define('{}_VALUE_{}_SHIFT'.format(m, i), '{}u'.format(s.start)))
+        if self.counter:
+            lines.append(c_define('{}_COUNTER_SHIFT'.format(m), '{}u'.format(self.counter[0].start)))
+            lines.append(c_define('{}_COUNTER_MASK'.format(m), '0x{:X}u'.format((1 << self.counter[0].length) - 1)))
+        lines.append(c_define('{}_FACTOR'.format(m), '({})'.format(c_float(value.factor))))
+        lines.append(c_define('{}_MIN'.format(m), '({})'.format(c_float(value.minimum))))
+        lines.append(c_define('{}_MAX'.format(m), '({})'.format(c_float(value.maximum))))
+        lines.append('')
+
+        scale = 1.0 / value.factor
+        if abs(scale - round(scale)) < 1e-9:
+            to_raw = '(value - ({})) * {}'.format(c_float(value.offset), c_float(round(scale)))
+        else:
+            to_raw = '(value - ({})) / {}'.format(c_float(value.offset), c_float(value.factor))
+
+        lines.append('/**')
+        lines.append(' * converts a physical value to its raw CAN value, limited to the signal range')
+        lines.append(' */')
+        lines.append('static inline uint32_t CANS_GEN_{}ToRaw(float value) {{'.format(self.name))
+        lines.append('    if (value < {}_MIN) {{'.format(m))
+        lines.append('        value = {}_MIN;'.format(m))
+        lines.append('    } else if (value > %s_MAX) {' % m)
+        lines.append('        value = {}_MAX;'.format(m))
+        lines.append('    }')
+        lines.append('    return (uint32_t)(({}) + 0.5f);'.format(to_raw))
+        lines.append('}')
+        lines.append('')
+        lines.append('/**')
+        lines.append(' * converts a raw CAN value to its physical value')
+        lines.append(' */')
+        lines.append('static inline float CANS_GEN_{}FromRaw(uint32_t raw) {{'.format(self.name))
+        lines.append('    return ((float)raw * {}) + ({});'.format(c_float(value.factor), c_float(value.offset)))
+        lines.append('}')
+        lines.append('')
+        lines.append('/**')
+        if self.multiplexed:
+            lines.append(' * packs the multiplexer value, valid flags and raw values of one message into the message data')
+        else:
+            lines.append(' * packs the valid flags and raw values of one message into the message data')
+        lines.append(' */')
+        lines.append('static inline uint64_t CANS_GEN_Pack{}({}uint32_t valid, const uint32_t raw[{}_VALUES_PER_MESSAGE]) {{'.format(
+            self.name, mux_param, m))
+        lines.append('    uint64_t data = 0;')
+        if self.multiplexed:
+            lines.append('    data |= ((uint64_t)(mux & {0}_MUX_MASK)) << {0}_MUX_SHIFT;'.format(m))
+        lines.append('    data |= ((uint64_t)(valid & {0}_VALID_MASK)) << {0}_VALID_SHIFT;'.format(m))
+        for i in range(len(self.values)):
+            lines.append('    data |= ((uint64_t)(raw[{1}] & {0}_VALUE_MASK)) << {0}_VALUE_{1}_SHIFT;'.format(m, i))
+        lines.append('    return data;')
+        lines.append('}')
+        lines.append('')
+        lines.append('/**')
+        if self.multiplexed:
+            lines.append(' * unpacks the multiplexer value, valid flags and raw values of one message from the message data')
+        else:
+            lines.append(' * unpacks the valid flags and raw values of one message from the message data')
+        lines.append(' */')
+        lines.append('static inline void CANS_GEN_Unpack{}(uint64_t data, {}uint32_t *valid, uint32_t raw[{}_VALUES_PER_MESSAGE]) {{'.format(
+            self.name, 'uint32_t *mux, ' if self.multiplexed else '', m))
+        if self.multiplexed:
+            lines.append('    *mux = (uint32_t)(data >> {0}_MUX_SHIFT) & {0}_MUX_MASK;'.format(m))
+        lines.append('    *valid = (uint32_t)(data >> {0}_VALID_SHIFT) & {0}_VALID_MASK;'.format(m))
+        for i in range(len(self.values)):
+            lines.append('    raw[{1}] = (uint32_t)(data >> {0}_VALUE_{1}_SHIFT) & {0}_VALUE_MASK;'.format(m, i))
+        lines.append('}')
+        lines.append('')
+        return lines
+
+
+def macro_lines(name, lines):
+    """Formats a multi line macro"""
+    width = max([len(l) for l in [name] + lines]) + 1
+    out = ['{} \\'.format(name.ljust(width - 1))]
+    for l in lines[:-1]:
+        out.append('{}\\'.format(l.ljust(width)))
+    out.append(lines[-1])
+    return out
+
+
+def module_id_offsets(families, nr_of_modules, reserved):
+    """ID offset of every module, modules are moved behind reserved ID ranges"""
+    offsets = []
+    offset = 0
+    for module in range(nr_of_modules):
+        moved = True
+        while moved:
+            moved = False
+            first = min([f.id_base + module * f.stride for f in families]) + offset
+            last = max([f.id_base + module * f.stride + f.nr_of_messages - 1 for f in families]) + offset
+            for start, end in reserved:
+                if first <= end and last >= start:
+                    offset += end + 1 - first
+                    moved = True
+        offsets.append(offset)
+    return offsets
+
+
+def variant_lines(families, all_families, nr_of_modules, phase_start, phase_step):
+    """Message enum, transmit table and message positions for one selection of
+    families. The messages of the regular families are grouped by module, the
+    messages of the multiplexed families follow after those of all modules.
+    Families of all_families that are not selected get no messages.
+    """
+    regular = [f for f in families if not f.multiplexed]
+    multiplexed = [f for f in families if f.multiplexed]
+    messages_per_module = sum([f.nr_of_messages for f in regular])
+
+    enum_lines = []
+    table_lines = []
+    group = 0
+    order = [(module, family) for module in range(nr_of_modules) for family in regular]
+    order += [(module, family) for family in multiplexed for module in range(nr_of_modules)]
+    for module, family in order:
+        phase = phase_start + group * phase_step
+        group += 1
+        for message in range(family.nr_of_messages):
+            first = message * len(family.values)
+            enum_lines.append('    {},  /* Module {} {} {}-{} */'.format(
+                family.enum_name.format(module=module, message=message), module,
+                family.description, first, first + len(family.values) - 1))
+            table_lines.append('        {{ 0x{:X}, {}, (repetition_time), ({} % (repetition_time)), NULL_PTR }},'.format(
+                family.message_id(module, message), family.dlc, phase))
+
+    out = []
+    out.append('/**')
+    out.append(' * number of cell data messages per module, without the multiplexed messages')
+    out.append(' */')
+    out.append('#define CANS_GEN_MESSAGES_PER_MODULE        {}'.format(messages_per_module))
+    out.append('')
+    out.append('/**')
+    out.append(' * number of cell data messages of all modules, without the multiplexed messages')
+    out.append(' */')
+    out.append('#define CANS_GEN_NR_OF_MODULE_MESSAGES      (CANS_GEN_NR_OF_MODULES * CANS_GEN_MESSAGES_PER_MODULE)')
+    out.append('')
+    out.append('/**')
+    out.append(' * number of cell data messages')
+    out.append(' */')
+    out.append('#define CANS_GEN_NR_OF_CELL_MESSAGES        ({})'.format(' + '.join(
+        ['CANS_GEN_NR_OF_MODULE_MESSAGES'] + ['(CANS_GEN_NR_OF_MODULES * {})'.format(f.nr_of_messages) for f in multiplexed])))
+    out.append('')
+    out.append('/**')
+    out.append(' * symbolic name of the first cell data message')
+    out.append(' */')
+    out.append('#define CANS_GEN_CAN0_FIRST_CELL_MESSAGE    {}'.format(order[0][1].enum_name.format(module=0, message=0)))
+    out.append('')
+    out.append('/**')
+    out.append(' * position of the messages of the families: the messages of a regular family are')
+    out.append(' * counted within the messages of a module, those of a multiplexed family from the')
+    out.append(' * first cell data message on, ordered by module. Families that are not sent have')
+    out.append(' * no messages.')
+    out.append(' */')
+    first = 0
+    for family in regular:
+        out.append(c_define('{}_FIRST_MESSAGE'.format(family.macro), first))
+        out.append(c_define('{}_NR_OF_MESSAGES'.format(family.macro), family.nr_of_messages))
+        first += family.nr_of_messages
+    for family in [f for f in all_families if not f.multiplexed and f not in families]:
+        out.append(c_define('{}_FIRST_MESSAGE'.format(family.macro), 0))
+        out.append(c_define('{}_NR_OF_MESSAGES'.format(family.macro), 0))
+    first = 'CANS_GEN_NR_OF_MODULE_MESSAGES'
+    for family in multiplexed:
+        out.append(c_define('{}_FIRST_MESSAGE'.format(family.macro), '({})'.format(first)))
+        out.append(c_define('{}_NR_OF_MESSAGES'.format(family.macro), family.nr_of_messages))
+        first += ' + (CANS_GEN_NR_OF_MODULES * {})'.format(family.nr_of_messages)
+    for family in [f for f in all_families if f.multiplexed and f not in families]:
+        out.append(c_define('{}_FIRST_MESSAGE'.format(family.macro), 'CANS_GEN_NR_OF_CELL_MESSAGES'))
+        out.append(c_define('{}_NR_OF_MESSAGES'.format(family.macro), 0))
+    out.append('')
+    out.append('/**')
+    out.append(' * symbolic names of the cell data messages, to be inserted in CANS_messagesTx_e')
+    out.append(' */')
+    out.extend(macro_lines('#define CANS_GEN_CAN0_CELL_MESSAGES_TX', enum_lines))
+    out.append('')
+    out.append('/**')
+    out.append(' * transmit configuration of the cell data messages, to be inserted in can_CAN0_messages_tx[]')
+    out.append(' * in the order of CANS_GEN_CAN0_CELL_MESSAGES_TX')
+    out.append(' */')
+    out.extend(macro_lines('#define CANS_GEN_CAN0_CELL_MESSAGES_TX_CFG(repetition_time)', table_lines))
+    out.append('')
+    return out
+
+
+def generate(mapping, dbc, nr_of_modules, header_name):
+    """Creates the content of the generated header"""
+    families = [Family(cfg, dbc, nr_of_modules) for cfg in mapping['families']]
+    regular = [f for f in families if not f.multiplexed]
+    multiplexed = [f for f in families if f.multiplexed]
+    reserved = [(int(r[0]), int(r[1])) for r in mapping.get('reserved_ids', [])]
+    offsets = module_id_offsets(regular, nr_of_modules, reserved)
+    for family in families:
+        family.id_offsets = offsets
+        family.check_modules(dbc)
+    phase_start = int(mapping.get('repetition_phase_start', 0))
+    phase_step = int(mapping.get('repetition_phase_step', 0))
+    guard = header_name.upper().replace('.', '_') + '_'
+
+    # a multiplexed family replaces a regular family if its select macro is TRUE
+    selects = sorted(set([f.select for f in multiplexed]))
+    if len(selects) > 1:
+        raise ValueError('all multiplexed families need the same select macro')
+    for family in multiplexed:
+        if family.replaces not in [f.name for f in regular]:
+            raise ValueError('family \'{}\' replaces unknown family \'{}\''.format(family.name, family.replaces))
+    selected = [f for f in regular if f.name not in [m.replaces for m in multiplexed]] + multiplexed
+
+    out = []
+    out.append('/**')
+    out.append(' *')
+    out.append(' * @file    {}'.format(header_name))
+    out.append(' * @author  foxBMS Team')
+    out.append(' * @ingroup DRIVERS_CONF')
+    out.append(' * @prefix  CANS_GEN')
+    out.append(' *')
+    out.append(' * @brief   Cell data CAN messages generated from the DBC file')
+    out.append(' *')
+    out.append(' * Generated by {} for {} battery modules.'.format(os.path.basename(__file__), nr_of_modules))
+    out.append(' * Do not edit, the file is overwritten by the next build.')
+    out.append(' *')
+    out.append(' */')
+    out.append('')
+    out.append('#ifndef {}'.format(guard))
+    out.append('#define {}'.format(guard))
+    out.append('')
+    out.append('/*================== Includes =============================================*/')
+    out.append('#include "general.h"')
+    if selects:
+        out.append('#include "{}"'.format(mapping['select_include']))
+    out.append('')
+    out.append('/*================== Macros and Definitions ===============================*/')
+    out.append('/**')
+    out.append(' * number of battery modules the cell data messages are generated for')
+    out.append(' */')
+    out.append('#define CANS_GEN_NR_OF_MODULES              {}'.format(nr_of_modules))
+    out.append('')
+    if selects:
+        out.append('#if {} == TRUE'.format(selects[0]))
+        out.extend(variant_lines(selected, families, nr_of_modules, phase_start, phase_step))
+        out.append('#else')
+        out.extend(variant_lines(regular, families, nr_of_modules, phase_start, phase_step))
+        out.append('#endif')
+        out.append('')
+    else:
+        out.extend(variant_lines(regular, families, nr_of_modules, phase_start, phase_step))
+    for family in families:
+        out.extend(family.definitions())
+    out.append('#endif /* {} */'.format(guard))
+    out.append('')
+    return '\n'.join(out)
+
+
+def main():
+    program_name = os.path.basename(sys.argv[0])
+    program_version = '{}'.format(__version__)
+    program_build_date = str(__updated__)
+    program_version_message = '{} {}'.format(
+        program_version, program_build_date)
+    program_shortdesc = __import__('__main__').__doc__.split('\n')[0]
+    program_license = '''{}
+    {}
+
+    Created by the foxBMS Team on {}.
+    Copyright 2019 foxBMS. All rights reserved.
+
+    Licensed under the BSD 3-Clause License.
+
+    Distributed on an "AS IS" basis without warranties
+    or conditions of any kind, either express or implied.
+
+USAGE
+'''.format(program_name, program_shortdesc, str(__date__))
+    parser = argparse.ArgumentParser(
+        description=program_license,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('dbc_file', help='DBC file')
+    parser.add_argument('mapping_file', help='mapping of the DBC messages (yml)')
+    parser.add_argument('batterysystem_cfg', help='batterysystem_cfg.h with BS_NR_OF_MODULES')
+    parser.add_argument('-o', '--output', default='cansignal_gen_cfg.h',
+                        help='generated header file')
+    parser.add_argument(
+        '-v',
+        '--verbosity',
+        dest='verbosity',
+        action='count',
+        default=0,
+        help='set verbosity level')
+    parser.add_argument(
+        '-V',
+        '--version',
+        action='version',
+        version=program_version_message)
+    args = parser.parse_args()
+
+    if args.verbosity == 1:
+        logging.basicConfig(level=logging.INFO)
+    elif args.verbosity > 1:
+        logging.basicConfig(level=logging.DEBUG)
+    else:
+        logging.basicConfig(level=logging.ERROR)
+
+    with open(args.mapping_file, 'r') as stream:
+        mapping = yaml.safe_load(stream)
+    dbc = read_dbc(args.dbc_file)
+    nr_of_modules = read_nr_of_modules(args.batterysystem_cfg)
+    logging.info('%d messages in DBC file, %d battery modules', len(dbc), nr_of_modules)
+
+    try:
+        content = generate(mapping, dbc, nr_of_modules, os.path.basename(args.output))
+    except ValueError as err:
+        print('Error: {}'.format(err))
+        sys.exit(1)
+
+    with open(args.output, 'w') as f:
+        f.write(content)
+
+
+if __name__ == '__main__':
+    main()
@@ -1432,6 +1432,19 @@ class MainFrame(wx.Frame):
                                 self.panel_list[1 + module_number + 1].voltage_label_list[3 *
                                                                                           voltage_bank + i].SetValue(str(voltage[i]) + ' mV')
 
+            if decoded_can_data[0] == 'voltage_mux':
+                module_number = int(decoded_can_data[1])
+                voltage_group = decoded_can_data[2]
+                voltage = [0] * 4
+                for i in range(len(voltage)):
+                    voltage[i] = decoded_can_data[3 + i]
+                    if (module_number) < len(self.panel_list) - 1:
+                        if (4 * voltage_group + i) < len(
+                                self.panel_list[1 + module_number + 1].voltage_label_list):
+                            if voltage[i] != 'NONE':
+                                self.panel_list[1 + module_number + 1].voltage_label_list[4 *
+                                                                                          voltage_group + i].SetValue(str(voltage[i]) + ' mV')
+
             if decoded_can_data[0] == 'voltageminmax':
                 self.min_voltage_label.SetValue(
                     str(decoded_can_data[2]) + ' mV')
@@ -1774,6 +1787,27 @@ class MainFrame(wx.Frame):
                         decoded_can_data.append(voltage[i])
                     return decoded_can_data
 
+        # multiplexed voltages
+        if (can_data.id == 0x1F8):
+            mux = int(decode_CAN_data(
+                can_data.data, 0, 8, 1, 0, can_data.dlc, "LITTLE", "UNSIGNED"))
+            module_number = mux // 3
+            voltage_group = mux % 3
+            if module_number < number_of_modules:
+                voltage = [0] * 4
+                for i in range(len(voltage)):
+                    if (4 * voltage_group + i) < number_of_cells:
+                        voltage[i] = decode_CAN_data(
+                            can_data.data, 12 + 13 * i, 13, 1, 0, can_data.dlc, "LITTLE", "UNSIGNED")
+                    else:
+                        voltage[i] = 'NONE'
+
+                decoded_can_data = ['voltage_mux'] + \
+                    [module_number] + [voltage_group]
+                for i in range(len(voltage)):
+                    decoded_can_data.append(voltage[i])
+                return decoded_can_data
+
         # min-max SOC
         if (can_data.id == 0x140):
             mean_soc = decode_CAN_data(
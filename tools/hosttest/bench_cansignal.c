@@ -0,0 +1,377 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2019, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    bench_cansignal.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup HOSTTEST
+ * @prefix  TCANS
+ *
+ * @brief   Test and benchmark of the transmit scheduler of the periodic CAN messages
+ *
+ * The module cansignal.c is included in this file, so that its static
+ * functions can be called. The transmit messages are the ones of can_cfg.c
+ * of the primary MCU. The CAN driver is replaced by functions that record
+ * the transmitted messages, the signals are empty and the cell data
+ * messages are composed without reading the database blocks.
+ *
+ * The reference is the former scheduler, which checks all messages in every
+ * tick with a modulo of the time. Both schedulers are run over the same
+ * simulated time. The test checks that every message is transmitted as often
+ * as before and exactly with its repetition time, and that the phase
+ * spreading keeps the number of messages in a tick within
+ * CANS_MAX_TX_MESSAGES_PER_TICK. The benchmark measures the mean and maximum
+ * cost per tick and the peak number of messages in a tick.
+ *
+ * Usage: bench_cansignal [simulated time in s]
+ */
+
+/*================== Includes =============================================*/
+#include "hosttest.h"
+
+#include "cansignal.c"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*================== Macros and Definitions ===============================*/
+#define TCANS_DEFAULT_TIME_S        600
+#define TCANS_NR_OF_IDS             0x800
+#define TCANS_NR_OF_MESSAGES        ((uint32_t)can_CAN0_tx_length + can_CAN1_tx_length)
+
+/**
+ * result of the simulation of one scheduler
+ */
+typedef struct {
+    double meanTickNs;          /*!< mean cost of a tick in ns */
+    uint64_t maxTickNs;         /*!< maximum cost of a tick in ns */
+    uint32_t peakBurst;         /*!< maximum number of messages transmitted in one tick */
+    uint32_t overloadedTicks;   /*!< ticks with more than CANS_MAX_TX_MESSAGES_PER_TICK messages */
+} TCANS_RESULT_s;
+
+/*================== Constant and Variable Definitions ====================*/
+unsigned long hosttest_failures = 0;
+
+const CANS_signal_s cans_CAN0_signals_tx[1];
+const CANS_signal_s cans_CAN1_signals_tx[1];
+const CANS_signal_s cans_CAN0_signals_rx[1];
+const CANS_signal_s cans_CAN1_signals_rx[1];
+const uint16_t cans_CAN0_signals_tx_length = 0;
+const uint16_t cans_CAN1_signals_tx_length = 0;
+const uint16_t cans_CAN0_signals_rx_length = 0;
+const uint16_t cans_CAN1_signals_rx_length = 0;
+#if CANS_HEARTBEAT_SUPERVISION == TRUE
+const CANS_HEARTBEAT_CFG_s cans_heartbeat_cfg[CANS_NR_OF_HEARTBEAT_PEERS];
+#endif
+
+/** index of the transmit message of each CAN ID, -1 if the ID is not transmitted */
+static int16_t tcans_idToMessage[TCANS_NR_OF_IDS];
+
+/** simulated time in ms of the current tick */
+static uint32_t tcans_time_ms = 0;
+static uint32_t tcans_sentInTick = 0;
+
+static uint32_t tcans_nrOfSent[CANS_MAX_PERIODIC_TX_MESSAGES];
+static uint32_t tcans_firstSent_ms[CANS_MAX_PERIODIC_TX_MESSAGES];
+static uint32_t tcans_lastSent_ms[CANS_MAX_PERIODIC_TX_MESSAGES];
+static uint32_t tcans_wrongIntervals[CANS_MAX_PERIODIC_TX_MESSAGES];
+
+/*================== Function Implementations =============================*/
+STD_RETURN_TYPE_e CAN_Send(CAN_NodeTypeDef_e canNode, uint32_t msgID, uint8_t* ptrMsgData,
+        uint32_t msgLength, uint32_t RTR) {
+    int16_t msgIdx = (msgID < TCANS_NR_OF_IDS) ? tcans_idToMessage[msgID] : -1;
+    const CAN_MSG_TX_TYPE_s *txMsg = NULL_PTR;
+
+    tcans_sentInTick++;
+    if (msgIdx >= 0) {
+        txMsg = (msgIdx < can_CAN0_tx_length) ? &can_CAN0_messages_tx[msgIdx] : &can_CAN1_messages_tx[msgIdx - can_CAN0_tx_length];
+        if (tcans_nrOfSent[msgIdx] == 0) {
+            tcans_firstSent_ms[msgIdx] = tcans_time_ms;
+        } else if ((tcans_time_ms - tcans_lastSent_ms[msgIdx]) != txMsg->repetition_time) {
+            tcans_wrongIntervals[msgIdx]++;
+        }
+        tcans_lastSent_ms[msgIdx] = tcans_time_ms;
+        tcans_nrOfSent[msgIdx]++;
+    }
+    return E_OK;
+}
+
+STD_RETURN_TYPE_e CAN_TxMsgBuffer(CAN_NodeTypeDef_e canNode) {
+    return E_OK;
+}
+
+STD_RETURN_TYPE_e CAN_TxMsg(CAN_NodeTypeDef_e canNode, uint32_t msgID, uint8_t* ptrMsgData,
+        uint32_t msgLength, uint32_t RTR) {
+    return E_OK;
+}
+
+void CAN_UpdateTxRate(CAN_NodeTypeDef_e canNode, uint32_t timestamp) {
+}
+
+void CAN_UpdateBusStatistics(CAN_NodeTypeDef_e canNode, uint32_t timestamp) {
+}
+
+STD_RETURN_TYPE_e CAN_ReceiveBuffer(CAN_NodeTypeDef_e canNode, Can_PduType* msg) {
+    return E_NOT_OK;
+}
+
+uint8_t CAN_GetRxMessageIndex(CAN_NodeTypeDef_e canNode, uint32_t msgID) {
+    return CAN_RX_INVALID_INDEX;
+}
+
+void CAN_UpdateRxDispatchCycles(CAN_NodeTypeDef_e canNode, uint32_t cycles) {
+}
+
+STD_RETURN_TYPE_e CAN_GetRxStatistics(CAN_NodeTypeDef_e canNode, CAN_RX_STATISTICS_s *rxstatistics) {
+    return E_NOT_OK;
+}
+
+DIAG_RETURNTYPE_e DIAG_Handler(DIAG_CH_ID_e diag_ch_id, DIAG_EVENT_e event, uint32_t item_nr, void* data) {
+    return DIAG_HANDLER_RETURN_OK;
+}
+
+uint32_t MCU_GetCycleCounter(void) {
+    return 0;
+}
+
+uint8_t CANS_ComposeCellDataMessage(CANS_messagesTx_e msgIdx, uint8_t dataptr[]) {
+    uint8_t retVal = FALSE;
+    if (((uint32_t)msgIdx >= CANS_GEN_CAN0_FIRST_CELL_MESSAGE) &&
+            ((uint32_t)msgIdx < (CANS_GEN_CAN0_FIRST_CELL_MESSAGE + CANS_GEN_NR_OF_CELL_MESSAGES))) {
+        dataptr[0] = (uint8_t)msgIdx;
+        retVal = TRUE;
+    }
+    return retVal;
+}
+
+
+/**
+ * @brief   former scheduler: checks every message with a modulo of the time
+ *
+ * @param   reset   TRUE to restart the time at 0
+ */
+static void TCANS_ModuloTransmit(uint8_t reset) {
+    static uint32_t counter_ticks = 0;
+    uint32_t i = 0;
+    STD_RETURN_TYPE_e result = E_NOT_OK;
+
+    if (reset == TRUE) {
+        counter_ticks = 0;
+        return;
+    }
+
+    for (i = 0; i < can_CAN0_tx_length; i++) {
+        if (((counter_ticks * CANS_TICK_MS) % (can_CAN0_messages_tx[i].repetition_time)) == can_CAN0_messages_tx[i].repetition_phase) {
+            Can_PduType PduToSend = { {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 0x0, 8 };
+            CANS_ComposeMessage(CAN_NODE0, (CANS_messagesTx_e)(i), PduToSend.sdu);
+            PduToSend.id = can_CAN0_messages_tx[i].ID;
+
+            result = CANS_AddMessage(CAN_NODE0, PduToSend.id, PduToSend.sdu, PduToSend.dlc, 0);
+
+            if (result == E_NOT_OK) {
+                DIAG_Handler(DIAG_CH_CANS_CAN_MOD_FAILURE, DIAG_EVENT_NOK, 1, NULL_PTR);
+            } else {
+                DIAG_Handler(DIAG_CH_CANS_CAN_MOD_FAILURE, DIAG_EVENT_OK, 1, NULL_PTR);
+            }
+            if (can_CAN0_messages_tx[i].cbk_func != NULL_PTR && result == E_OK) {
+                can_CAN0_messages_tx[i].cbk_func(i, NULL_PTR);
+            }
+        }
+    }
+
+    for (i = 0; i < can_CAN1_tx_length; i++) {
+        if (((counter_ticks * CANS_TICK_MS) % (can_CAN1_messages_tx[i].repetition_time)) == can_CAN1_messages_tx[i].repetition_phase) {
+            Can_PduType PduToSend = { {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 0x0, 8 };
+            CANS_ComposeMessage(CAN_NODE1, (CANS_messagesTx_e)i + can_CAN0_tx_length, PduToSend.sdu);
+            PduToSend.id = can_CAN1_messages_tx[i].ID;
+
+            result = CANS_AddMessage(CAN_NODE1, PduToSend.id, PduToSend.sdu, PduToSend.dlc, 0);
+
+            if (result == E_NOT_OK) {
+                DIAG_Handler(DIAG_CH_CANS_CAN_MOD_FAILURE, DIAG_EVENT_NOK, 0, NULL_PTR);
+            } else {
+                DIAG_Handler(DIAG_CH_CANS_CAN_MOD_FAILURE, DIAG_EVENT_OK, 0, NULL_PTR);
+            }
+            if (can_CAN1_messages_tx[i].cbk_func != NULL_PTR && result == E_OK) {
+                can_CAN1_messages_tx[i].cbk_func(i, NULL_PTR);
+            }
+        }
+    }
+
+    counter_ticks++;
+}
+
+
+/**
+ * @brief   maps the CAN IDs to the transmit messages
+ */
+static void TCANS_InitIdMap(void) {
+    uint32_t i = 0;
+    uint32_t id = 0;
+
+    for (i = 0; i < TCANS_NR_OF_IDS; i++) {
+        tcans_idToMessage[i] = -1;
+    }
+    for (i = 0; i < TCANS_NR_OF_MESSAGES; i++) {
+        id = (i < can_CAN0_tx_length) ? can_CAN0_messages_tx[i].ID : can_CAN1_messages_tx[i - can_CAN0_tx_length].ID;
+        if (id >= TCANS_NR_OF_IDS) {
+            HOSTTEST_CHECK(FALSE, "extended ID 0x%X not supported by the test", id);
+        } else {
+            HOSTTEST_CHECK(tcans_idToMessage[id] < 0, "ID 0x%X transmitted by two messages", id);
+            tcans_idToMessage[id] = (int16_t)i;
+        }
+    }
+}
+
+
+/**
+ * @brief   runs one of the schedulers over the simulated time
+ *
+ * @param   heap        TRUE for CANS_PeriodicTransmit(), FALSE for the former scheduler
+ * @param   duration_ms simulated time in ms
+ * @param   result      cost per tick and bursts
+ */
+static void TCANS_Simulate(uint8_t heap, uint32_t duration_ms, TCANS_RESULT_s *result) {
+    uint64_t totalNs = 0;
+    uint64_t tickNs = 0;
+    uint64_t start = 0;
+    uint32_t nrOfTicks = duration_ms / CANS_TICK_MS;
+
+    memset(result, 0, sizeof(*result));
+    memset(tcans_nrOfSent, 0, sizeof(tcans_nrOfSent));
+    memset(tcans_wrongIntervals, 0, sizeof(tcans_wrongIntervals));
+    if (heap == TRUE) {
+        CANS_Init();
+    } else {
+        TCANS_ModuloTransmit(TRUE);
+    }
+
+    for (uint32_t tick = 0; tick < nrOfTicks; tick++) {
+        tcans_time_ms = tick * CANS_TICK_MS;
+        tcans_sentInTick = 0;
+        start = HOSTTEST_GetTimeNs();
+        if (heap == TRUE) {
+            (void)CANS_PeriodicTransmit();
+        } else {
+            TCANS_ModuloTransmit(FALSE);
+        }
+        tickNs = HOSTTEST_GetTimeNs() - start;
+
+        totalNs += tickNs;
+        if (tickNs > result->maxTickNs) {
+            result->maxTickNs = tickNs;
+        }
+        if (tcans_sentInTick > result->peakBurst) {
+            result->peakBurst = tcans_sentInTick;
+        }
+        if (tcans_sentInTick > CANS_MAX_TX_MESSAGES_PER_TICK) {
+            result->overloadedTicks++;
+        }
+    }
+    result->meanTickNs = (double)totalNs / nrOfTicks;
+}
+
+
+/**
+ * @brief   checks the transmissions of the last simulation against the configured timing
+ *
+ * @param   duration_ms simulated time in ms
+ * @param   spread      TRUE if the first transmission may be delayed by the phase spreading
+ */
+static void TCANS_CheckTransmissions(uint32_t duration_ms, uint8_t spread) {
+    const CAN_MSG_TX_TYPE_s *txMsg = NULL_PTR;
+    uint32_t expected = 0;
+
+    for (uint32_t i = 0; i < TCANS_NR_OF_MESSAGES; i++) {
+        txMsg = (i < can_CAN0_tx_length) ? &can_CAN0_messages_tx[i] : &can_CAN1_messages_tx[i - can_CAN0_tx_length];
+        if (txMsg->repetition_time == 0) {
+            continue;
+        }
+        /* messages with a phase in the last period may be sent once less */
+        expected = (duration_ms - txMsg->repetition_phase + txMsg->repetition_time - 1) / txMsg->repetition_time;
+        HOSTTEST_CHECK((tcans_nrOfSent[i] == expected) || ((spread == TRUE) && ((tcans_nrOfSent[i] + 1) == expected)),
+                "message 0x%X sent %u times instead of %u", txMsg->ID, tcans_nrOfSent[i], expected);
+        HOSTTEST_CHECK(tcans_wrongIntervals[i] == 0, "message 0x%X sent %u times not after its repetition time",
+                txMsg->ID, tcans_wrongIntervals[i]);
+        if (tcans_nrOfSent[i] > 0) {
+            HOSTTEST_CHECK((tcans_firstSent_ms[i] >= txMsg->repetition_phase) &&
+                    (tcans_firstSent_ms[i] < (txMsg->repetition_phase + txMsg->repetition_time)),
+                    "message 0x%X first sent at %u ms, phase %u ms", txMsg->ID, tcans_firstSent_ms[i], txMsg->repetition_phase);
+            HOSTTEST_CHECK((spread == TRUE) || (tcans_firstSent_ms[i] == txMsg->repetition_phase),
+                    "message 0x%X first sent at %u ms, phase %u ms", txMsg->ID, tcans_firstSent_ms[i], txMsg->repetition_phase);
+        }
+    }
+}
+
+
+int main(int argc, char *argv[]) {
+    uint32_t duration_ms = TCANS_DEFAULT_TIME_S * 1000u;
+    TCANS_RESULT_s modulo;
+    TCANS_RESULT_s deadline;
+
+    if (argc > 1) {
+        duration_ms = (uint32_t)strtoul(argv[1], NULL, 10) * 1000u;
+    }
+
+    TCANS_InitIdMap();
+
+    TCANS_Simulate(FALSE, duration_ms, &modulo);
+    TCANS_CheckTransmissions(duration_ms, FALSE);
+    TCANS_Simulate(TRUE, duration_ms, &deadline);
+    TCANS_CheckTransmissions(duration_ms, CANS_TX_PHASE_SPREADING);
+
+    printf("%u periodic messages, tick %d ms, %u s simulated\n", TCANS_NR_OF_MESSAGES, CANS_TICK_MS, duration_ms / 1000u);
+    printf("                       mean/tick   max/tick   peak burst   ticks > %d msgs\n", CANS_MAX_TX_MESSAGES_PER_TICK);
+    printf("  modulo scan (former) %7.0f ns %7lu ns   %10u   %14u\n", modulo.meanTickNs,
+            (unsigned long)modulo.maxTickNs, modulo.peakBurst, modulo.overloadedTicks);
+    printf("  deadline heap        %7.0f ns %7lu ns   %10u   %14u\n", deadline.meanTickNs,
+            (unsigned long)deadline.maxTickNs, deadline.peakBurst, deadline.overloadedTicks);
+
+#if CANS_TX_PHASE_SPREADING == TRUE
+    printf("  phase spreading over a hyperperiod of %u ticks\n", cans_tx_spread_ticks);
+    HOSTTEST_CHECK(deadline.peakBurst <= modulo.peakBurst, "phase spreading increased the peak burst");
+    HOSTTEST_CHECK(deadline.peakBurst <= CANS_MAX_TX_MESSAGES_PER_TICK, "%u messages in one tick, at most %d are allowed",
+            deadline.peakBurst, CANS_MAX_TX_MESSAGES_PER_TICK);
+#endif
+
+    return HOSTTEST_Result("bench_cansignal");
+}
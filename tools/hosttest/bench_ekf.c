@@ -0,0 +1,375 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2019, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    bench_ekf.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup HOSTTEST
+ * @prefix  TEKF
+ *
+ * @brief   Convergence test and benchmark of the SOC estimation of the cells
+ *
+ * The module sox.c is included in this file, so that the estimated state
+ * of every cell can be read. It is built with a copy of sox_cfg.h in which
+ * SOX_CELL_SOC_ESTIMATION is TRUE. The OS tick is simulated.
+ *
+ * Every cell is simulated in double precision with the same equivalent
+ * circuit model as the estimation (SOX_CELL_R0_MOHM, SOX_CELL_R1_MOHM,
+ * SOX_CELL_TAU_S and the OCV curves of batterycell_cfg.h). The cells start
+ * with SOCs spread around the initial SOC of the estimation and are loaded
+ * with a cycle of discharge, rest and charge. Their voltages are rounded to
+ * mV with a noise of the measurement and written to the database like the
+ * LTC driver does. After the settling time, the estimated SOC of every cell
+ * has to stay within TEKF_MAX_SOC_ERROR of the simulated SOC, and the
+ * published minimum and maximum have to match the estimated cells.
+ *
+ * The estimation is called like the algorithm in algo_cfg.c, one module per
+ * call. The benchmark reports the time of a pass over all
+ * BS_NR_OF_BAT_CELLS cells as measured by SOC_EstimateCellsStep() itself,
+ * for which MCU_GetCycleCounter() counts ns of the host. Scaled to
+ * TEKF_BENCH_NR_OF_CELLS cells, the pass has to fit into the 10 ms slot of
+ * the algorithm. The MCU is slower than the host, the printed margin is the
+ * factor that is left for this.
+ *
+ * Usage: bench_ekf [simulated time in s]
+ */
+
+/*================== Includes =============================================*/
+#include "hosttest.h"
+
+#include "sox.c"
+
+#include <stdlib.h>
+
+/*================== Macros and Definitions ===============================*/
+#if SOX_CELL_SOC_ESTIMATION != TRUE
+#error "bench_ekf has to be built with SOX_CELL_SOC_ESTIMATION set to TRUE"
+#endif
+
+#define TEKF_DEFAULT_TIME_S         7200u
+
+/** period of the cell voltage measurement in ms */
+#define TEKF_MEASUREMENT_PERIOD_MS  100u
+
+/** the simulated OS tick starts here, 0 is not a valid timestamp of a measurement */
+#define TEKF_START_TICK             1000u
+
+/** initial SOC of the estimation and spread of the simulated cells around it in % */
+#define TEKF_INITIAL_SOC            50.0
+#define TEKF_SOC_SPREAD             20.0
+
+#define TEKF_TEMPERATURE            25.0f
+
+/** load cycle: discharge, rest, charge with the same charge, rest */
+#define TEKF_LOAD_CURRENT_MA        20000.0
+#define TEKF_LOAD_DURATION_S        600u
+#define TEKF_REST_DURATION_S        300u
+
+/** amplitude of the uniform noise of the voltage measurement in mV */
+#define TEKF_VOLTAGE_NOISE_MV       2.0
+
+/** time after which every cell has to be estimated within TEKF_MAX_SOC_ERROR */
+#define TEKF_SETTLING_TIME_S        600u
+#define TEKF_MAX_SOC_ERROR          1.0
+
+/** number of cells and time slot of the algorithm for which the runtime is checked */
+#define TEKF_BENCH_NR_OF_CELLS      300u
+#define TEKF_SLOT_NS                10000000.0
+
+/**
+ * simulated cell
+ */
+typedef struct {
+    double soc;         /*!< SOC in %                           */
+    double vrc;         /*!< voltage over the RC element in mV  */
+} TEKF_CELL_s;
+
+/*================== Constant and Variable Definitions ====================*/
+unsigned long hosttest_failures = 0;
+
+static TEKF_CELL_s tekf_cell[BS_NR_OF_BAT_CELLS];
+
+static DATA_BLOCK_CELLVOLTAGE_s tekf_cellvoltage;
+static DATA_BLOCK_CURRENT_SENSOR_s tekf_current;
+static DATA_BLOCK_MINMAX_s tekf_minmax;
+
+static uint32_t tekf_random = 1;
+
+/*================== Function Implementations =============================*/
+STD_RETURN_TYPE_e NVM_getSOC(SOX_SOC_s *dest_ptr) {
+    dest_ptr->mean = TEKF_INITIAL_SOC;
+    dest_ptr->min = TEKF_INITIAL_SOC;
+    dest_ptr->max = TEKF_INITIAL_SOC;
+    return E_OK;
+}
+
+STD_RETURN_TYPE_e NVM_setSOC(SOX_SOC_s* ptr) {
+    return E_OK;
+}
+
+uint32_t MCU_GetCycleCounter(void) {
+    return (uint32_t)HOSTTEST_GetTimeNs();
+}
+
+
+/**
+ * @brief   xorshift random number generator, the noise is the same on every host
+ */
+static uint32_t TEKF_Random(void) {
+    tekf_random ^= tekf_random << 13;
+    tekf_random ^= tekf_random >> 17;
+    tekf_random ^= tekf_random << 5;
+    return tekf_random;
+}
+
+
+/**
+ * @brief   interpolates the OCV in the curves and the temperature in double precision
+ */
+static double TEKF_Ocv(double soc, double temperature) {
+    uint8_t c = 0;
+    uint8_t segment = 0;
+    double ocv[2] = {0.0, 0.0};
+
+    if (temperature <= soc_ocv_temperatures[0]) {
+        temperature = soc_ocv_temperatures[0];
+    } else if (temperature >= soc_ocv_temperatures[BC_OCV_NR_OF_TEMPERATURES - 1]) {
+        temperature = soc_ocv_temperatures[BC_OCV_NR_OF_TEMPERATURES - 1];
+        c = BC_OCV_NR_OF_TEMPERATURES - 2;
+    } else {
+        while (temperature >= soc_ocv_temperatures[c + 1]) {
+            c++;
+        }
+    }
+    while ((segment < (BC_OCV_NR_OF_SOC_POINTS - 2)) && (soc > soc_ocv_soc_points[segment + 1])) {
+        segment++;
+    }
+    for (uint8_t k = 0; k < 2; k++) {
+        const float *curve = soc_ocv_curves[c + k];
+        ocv[k] = curve[segment] + ((curve[segment + 1] - (double)curve[segment]) * (soc - soc_ocv_soc_points[segment]) /
+                ((double)soc_ocv_soc_points[segment + 1] - soc_ocv_soc_points[segment]));
+    }
+    return ocv[0] + ((ocv[1] - ocv[0]) * (temperature - soc_ocv_temperatures[c]) /
+            ((double)soc_ocv_temperatures[c + 1] - soc_ocv_temperatures[c]));
+}
+
+
+/**
+ * @brief   current of the load cycle, positive in discharge direction
+ *
+ * @param   time_ms:  time since the start of the simulation
+ *
+ * @return  current in mA
+ */
+static double TEKF_LoadCurrent(uint32_t time_ms) {
+    uint32_t phase = (time_ms / 1000u) % (2u * (TEKF_LOAD_DURATION_S + TEKF_REST_DURATION_S));
+    double current = 0.0;
+
+    if (phase < TEKF_LOAD_DURATION_S) {
+        current = TEKF_LOAD_CURRENT_MA;
+    } else if ((phase >= (TEKF_LOAD_DURATION_S + TEKF_REST_DURATION_S)) &&
+            (phase < ((2u * TEKF_LOAD_DURATION_S) + TEKF_REST_DURATION_S))) {
+        current = -TEKF_LOAD_CURRENT_MA;
+    }
+    return current;
+}
+
+
+/**
+ * @brief   simulates the cells over one measurement period and writes the measurement to the database
+ *
+ * @param   current:  current of the period in mA, positive in discharge direction
+ */
+static void TEKF_MeasureCells(double current) {
+    const double dt = TEKF_MEASUREMENT_PERIOD_MS / 1000.0;
+    const double decay = exp(-dt / SOX_CELL_TAU_S);
+    double voltage = 0.0;
+    double noise = 0.0;
+
+    for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        tekf_cell[i].soc -= current * dt / (36.0 * SOX_CELL_CAPACITY);
+        tekf_cell[i].vrc = (decay * tekf_cell[i].vrc) + ((1.0 - decay) * SOX_CELL_R1_MOHM * current / 1000.0);
+        noise = TEKF_VOLTAGE_NOISE_MV * ((2.0 * TEKF_Random() / 4294967295.0) - 1.0);
+        voltage = TEKF_Ocv(tekf_cell[i].soc, TEKF_TEMPERATURE) - tekf_cell[i].vrc - (SOX_CELL_R0_MOHM * current / 1000.0) + noise;
+        tekf_cellvoltage.voltage[i] = (uint16_t)lround(voltage);
+    }
+
+    if (POSITIVE_DISCHARGE_CURRENT == TRUE) {
+        tekf_current.current = (float)current;
+    } else {
+        tekf_current.current = (float)-current;
+    }
+    tekf_minmax.temperature_mean = TEKF_TEMPERATURE;
+    DB_WriteBlock(&tekf_current, DATA_BLOCK_ID_CURRENT_SENSOR);
+    DB_WriteBlock(&tekf_minmax, DATA_BLOCK_ID_MINMAX);
+    DB_WriteBlock(&tekf_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
+}
+
+
+/**
+ * @brief   compares the estimated SOC of every cell with the simulated SOC
+ *
+ * @param   worstCell:  cell with the maximum deviation
+ *
+ * @return  maximum deviation in %
+ */
+static double TEKF_MaxSocError(uint16_t *worstCell) {
+    double maxError = 0.0;
+    double error = 0.0;
+
+    for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        error = fabs(soc_cell_state.soc[i] - tekf_cell[i].soc);
+        if (error > maxError) {
+            maxError = error;
+            *worstCell = i;
+        }
+    }
+    return maxError;
+}
+
+
+/**
+ * @brief   checks that the published minimum and maximum SOC are the ones of the estimated cells
+ */
+static void TEKF_CheckPublished(void) {
+    SOC_CELL_ESTIMATION_s estimation;
+    uint16_t cellMin = 0;
+    uint16_t cellMax = 0;
+
+    for (uint16_t i = 1; i < BS_NR_OF_BAT_CELLS; i++) {
+        if (soc_cell_state.soc[i] < soc_cell_state.soc[cellMin]) {
+            cellMin = i;
+        }
+        if (soc_cell_state.soc[i] > soc_cell_state.soc[cellMax]) {
+            cellMax = i;
+        }
+    }
+    HOSTTEST_CHECK(SOC_GetCellEstimation(&estimation) == E_OK, "no estimation published");
+    HOSTTEST_CHECK((estimation.cell_min == cellMin) && (estimation.soc_min == soc_cell_state.soc[cellMin]),
+            "published minimum %f %% of cell %u instead of %f %% of cell %u",
+            estimation.soc_min, estimation.cell_min, soc_cell_state.soc[cellMin], cellMin);
+    HOSTTEST_CHECK((estimation.cell_max == cellMax) && (estimation.soc_max == soc_cell_state.soc[cellMax]),
+            "published maximum %f %% of cell %u instead of %f %% of cell %u",
+            estimation.soc_max, estimation.cell_max, soc_cell_state.soc[cellMax], cellMax);
+}
+
+
+int main(int argc, char *argv[]) {
+    SOC_CELL_ESTIMATION_s estimation;
+    uint32_t duration_ms = TEKF_DEFAULT_TIME_S * 1000u;
+    uint32_t time_ms = 0;
+    uint32_t passes = 0;
+    uint32_t steps = 0;
+    uint64_t passNsSum = 0;
+    double maxError = 0.0;
+    double settledError = 0.0;
+    double initialError = 0.0;
+    double passNs = 0.0;
+    double benchNs = 0.0;
+    uint16_t worstCell = 0;
+    uint16_t settledWorstCell = 0;
+    uint32_t settledWorstTime_ms = 0;
+
+    if (argc > 1) {
+        duration_ms = (uint32_t)strtoul(argv[1], NULL, 10) * 1000u;
+    }
+
+    OS_SetSimulatedSysTick(TEKF_START_TICK);
+    DATA_Init();
+    SOC_Init(FALSE);
+
+    for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        tekf_cell[i].soc = TEKF_INITIAL_SOC - TEKF_SOC_SPREAD + ((2.0 * TEKF_SOC_SPREAD * i) / (BS_NR_OF_BAT_CELLS - 1));
+        tekf_cell[i].vrc = 0.0;
+    }
+    initialError = TEKF_MaxSocError(&worstCell);
+
+    /* the first measurement only gives the time base of the estimation */
+    TEKF_MeasureCells(0.0);
+    SOC_EstimateCellsStep(BS_NR_OF_BAT_CELLS_PER_MODULE);
+
+    while (time_ms < duration_ms) {
+        time_ms += TEKF_MEASUREMENT_PERIOD_MS;
+        OS_SetSimulatedSysTick(TEKF_START_TICK + time_ms);
+        TEKF_MeasureCells(TEKF_LoadCurrent(time_ms - TEKF_MEASUREMENT_PERIOD_MS));
+
+        /* one module per call, as the algorithm in algo_cfg.c */
+        steps = 1;
+        while (SOC_EstimateCellsStep(BS_NR_OF_BAT_CELLS_PER_MODULE) == FALSE) {
+            steps++;
+        }
+        HOSTTEST_CHECK(steps == BS_NR_OF_MODULES, "pass over all cells in %u steps instead of %u", steps, BS_NR_OF_MODULES);
+        SOC_GetCellEstimation(&estimation);
+        passNsSum += estimation.cycles_last;
+        passes++;
+
+        maxError = TEKF_MaxSocError(&worstCell);
+        if ((time_ms >= (TEKF_SETTLING_TIME_S * 1000u)) && (maxError > settledError)) {
+            settledError = maxError;
+            settledWorstCell = worstCell;
+            settledWorstTime_ms = time_ms;
+        }
+    }
+    HOSTTEST_CHECK(passes > 0, "no pass of the estimation");
+    HOSTTEST_CHECK(settledError <= TEKF_MAX_SOC_ERROR, "SOC of cell %u deviates %.3f %% after %u s",
+            settledWorstCell, settledError, settledWorstTime_ms / 1000u);
+    TEKF_CheckPublished();
+
+    printf("%d cells, %u s simulated, %u passes\n", BS_NR_OF_BAT_CELLS, duration_ms / 1000u, passes);
+    printf("  SOC deviation at the start       %7.3f %%\n", initialError);
+    printf("  SOC deviation after %5u s      %7.3f %%  (limit %.3f %%)\n", TEKF_SETTLING_TIME_S, settledError, TEKF_MAX_SOC_ERROR);
+    printf("  SOC deviation at the end         %7.3f %%\n", maxError);
+
+    if (passes > 0) {
+        passNs = (double)passNsSum / passes;
+        benchNs = passNs * TEKF_BENCH_NR_OF_CELLS / BS_NR_OF_BAT_CELLS;
+        SOC_GetCellEstimation(&estimation);
+        printf("  pass over %d cells    mean %9.0f ns, max %9u ns\n", BS_NR_OF_BAT_CELLS, passNs, estimation.cycles_max);
+        printf("  per cell                   %9.1f ns\n", passNs / BS_NR_OF_BAT_CELLS);
+        printf("  pass over %u cells    mean %9.0f ns, margin to the %.0f ms slot %.0fx\n",
+                TEKF_BENCH_NR_OF_CELLS, benchNs, TEKF_SLOT_NS / 1000000.0, TEKF_SLOT_NS / benchNs);
+        HOSTTEST_CHECK(benchNs < TEKF_SLOT_NS, "pass over %u cells takes %.0f ns, more than the slot of %.0f ns",
+                TEKF_BENCH_NR_OF_CELLS, benchNs, TEKF_SLOT_NS);
+    }
+
+    return HOSTTEST_Result("bench_ekf");
+}
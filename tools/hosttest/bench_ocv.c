@@ -0,0 +1,313 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2019, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    bench_ocv.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup HOSTTEST
+ * @prefix  TOCV
+ *
+ * @brief   Accuracy test and benchmark of the SOC lookup in the OCV curves
+ *
+ * The reference interpolates the curves of batterycell_cfg.h in double
+ * precision and searches the segment of the voltage linearly. The test
+ * compares SOC_GetFromVoltage() and SOC_GetFromVoltageBatch() with the
+ * reference for voltages and temperatures inside and outside of the curves
+ * and checks that the SOC rises with the voltage. The benchmark measures the
+ * conversion of all BS_NR_OF_BAT_CELLS cells with both functions and with a
+ * linear search of the segment in single precision.
+ *
+ * Usage: bench_ocv [iterations]
+ */
+
+/*================== Includes =============================================*/
+#include "hosttest.h"
+
+#include "sox.h"
+
+#include "batterycell_cfg.h"
+#include "batterysystem_cfg.h"
+#include "nvramhandler.h"
+#include <math.h>
+#include <stdlib.h>
+
+/*================== Macros and Definitions ===============================*/
+#define TOCV_DEFAULT_ITERATIONS     20000
+
+/** maximum deviation from the reference in % SOC, rounding of single precision */
+#define TOCV_MAX_ERROR              0.001
+
+/** voltages below and above the curves that are tested in mV */
+#define TOCV_VOLTAGE_MARGIN         100.0
+#define TOCV_VOLTAGE_STEP           0.25
+
+/** temperatures below and above the curves that are tested in &deg;C */
+#define TOCV_TEMPERATURE_MARGIN     10.0
+#define TOCV_TEMPERATURE_STEP       0.5
+
+/*================== Constant and Variable Definitions ====================*/
+unsigned long hosttest_failures = 0;
+
+static const float tocv_temperatures[BC_OCV_NR_OF_TEMPERATURES] = BC_OCV_TEMPERATURES;
+static const float tocv_soc_points[BC_OCV_NR_OF_SOC_POINTS] = BC_OCV_SOC_POINTS;
+static const float tocv_curves[BC_OCV_NR_OF_TEMPERATURES][BC_OCV_NR_OF_SOC_POINTS] = BC_OCV_CURVES;
+
+static uint16_t tocv_voltage[BS_NR_OF_BAT_CELLS];
+static float tocv_soc[BS_NR_OF_BAT_CELLS];
+static volatile float tocv_sink = 0.0f;
+
+/*================== Function Implementations =============================*/
+STD_RETURN_TYPE_e NVM_getSOC(SOX_SOC_s *dest_ptr) {
+    return E_NOT_OK;
+}
+
+STD_RETURN_TYPE_e NVM_setSOC(SOX_SOC_s* ptr) {
+    return E_NOT_OK;
+}
+
+
+/**
+ * @brief   interpolates the SOC in one OCV curve in double precision
+ */
+static double TOCV_ReferenceCurve(uint8_t curve, double voltage) {
+    const float *ocv = tocv_curves[curve];
+    uint8_t segment = 0;
+
+    if (voltage <= ocv[0]) {
+        return tocv_soc_points[0];
+    }
+    if (voltage >= ocv[BC_OCV_NR_OF_SOC_POINTS - 1]) {
+        return tocv_soc_points[BC_OCV_NR_OF_SOC_POINTS - 1];
+    }
+    while (voltage > ocv[segment + 1]) {
+        segment++;
+    }
+    return tocv_soc_points[segment] + ((tocv_soc_points[segment + 1] - tocv_soc_points[segment]) *
+            (voltage - ocv[segment]) / ((double)ocv[segment + 1] - ocv[segment]));
+}
+
+
+/**
+ * @brief   interpolates the SOC in the OCV curves and the temperature in double precision
+ */
+static double TOCV_ReferenceSoc(double voltage, double temperature) {
+    uint8_t c = 0;
+    double socLower = 0.0;
+    double socUpper = 0.0;
+
+    if (temperature <= tocv_temperatures[0]) {
+        return TOCV_ReferenceCurve(0, voltage);
+    }
+    if (temperature >= tocv_temperatures[BC_OCV_NR_OF_TEMPERATURES - 1]) {
+        return TOCV_ReferenceCurve(BC_OCV_NR_OF_TEMPERATURES - 1, voltage);
+    }
+    while (temperature >= tocv_temperatures[c + 1]) {
+        c++;
+    }
+    socLower = TOCV_ReferenceCurve(c, voltage);
+    socUpper = TOCV_ReferenceCurve(c + 1, voltage);
+    return socLower + ((socUpper - socLower) * (temperature - tocv_temperatures[c]) /
+            ((double)tocv_temperatures[c + 1] - tocv_temperatures[c]));
+}
+
+
+/**
+ * @brief   straightforward lookup with a linear search of the segment in single precision
+ */
+static float TOCV_LinearSearchSoc(float voltage, float temperature) {
+    uint8_t c = 0;
+    uint8_t segment = 0;
+    float soc[2] = {0.0f, 0.0f};
+
+    if (temperature <= tocv_temperatures[0]) {
+        temperature = tocv_temperatures[0];
+    } else if (temperature >= tocv_temperatures[BC_OCV_NR_OF_TEMPERATURES - 1]) {
+        temperature = tocv_temperatures[BC_OCV_NR_OF_TEMPERATURES - 1];
+        c = BC_OCV_NR_OF_TEMPERATURES - 2;
+    } else {
+        while (temperature >= tocv_temperatures[c + 1]) {
+            c++;
+        }
+    }
+    for (uint8_t k = 0; k < 2; k++) {
+        const float *ocv = tocv_curves[c + k];
+        if (voltage <= ocv[0]) {
+            soc[k] = tocv_soc_points[0];
+        } else if (voltage >= ocv[BC_OCV_NR_OF_SOC_POINTS - 1]) {
+            soc[k] = tocv_soc_points[BC_OCV_NR_OF_SOC_POINTS - 1];
+        } else {
+            segment = 0;
+            while (voltage > ocv[segment + 1]) {
+                segment++;
+            }
+            soc[k] = tocv_soc_points[segment] + ((tocv_soc_points[segment + 1] - tocv_soc_points[segment]) *
+                    (voltage - ocv[segment]) / (ocv[segment + 1] - ocv[segment]));
+        }
+    }
+    return soc[0] + ((soc[1] - soc[0]) * (temperature - tocv_temperatures[c]) /
+            (tocv_temperatures[c + 1] - tocv_temperatures[c]));
+}
+
+
+/**
+ * @brief   compares SOC_GetFromVoltage() with the reference and checks that the SOC rises with the voltage
+ */
+static void TOCV_TestAccuracy(void) {
+    double minVoltage = tocv_curves[0][0];
+    double maxVoltage = tocv_curves[0][BC_OCV_NR_OF_SOC_POINTS - 1];
+    double maxError = 0.0;
+    double error = 0.0;
+    double worstVoltage = 0.0;
+    double worstTemperature = 0.0;
+    float soc = 0.0f;
+    float lastSoc = 0.0f;
+    unsigned long nrOfLookups = 0;
+
+    for (uint8_t c = 0; c < BC_OCV_NR_OF_TEMPERATURES; c++) {
+        minVoltage = fmin(minVoltage, tocv_curves[c][0]);
+        maxVoltage = fmax(maxVoltage, tocv_curves[c][BC_OCV_NR_OF_SOC_POINTS - 1]);
+    }
+
+    for (double t = tocv_temperatures[0] - TOCV_TEMPERATURE_MARGIN;
+            t <= tocv_temperatures[BC_OCV_NR_OF_TEMPERATURES - 1] + TOCV_TEMPERATURE_MARGIN; t += TOCV_TEMPERATURE_STEP) {
+        lastSoc = -1.0f;
+        for (double v = minVoltage - TOCV_VOLTAGE_MARGIN; v <= maxVoltage + TOCV_VOLTAGE_MARGIN; v += TOCV_VOLTAGE_STEP) {
+            soc = SOC_GetFromVoltage((float)v, (float)t);
+            error = fabs(soc - TOCV_ReferenceSoc(v, t));
+            if (error > maxError) {
+                maxError = error;
+                worstVoltage = v;
+                worstTemperature = t;
+            }
+            HOSTTEST_CHECK(soc >= lastSoc, "SOC falls from %f to %f %% at %.2f mV, %.1f degC", lastSoc, soc, v, t);
+            lastSoc = soc;
+            nrOfLookups++;
+        }
+    }
+
+    printf("%lu lookups, maximum deviation from the reference %.2e %% SOC at %.2f mV, %.1f degC\n",
+            nrOfLookups, maxError, worstVoltage, worstTemperature);
+    HOSTTEST_CHECK(maxError <= TOCV_MAX_ERROR, "deviation from the reference %.2e %% SOC above %.2e %%", maxError, TOCV_MAX_ERROR);
+}
+
+
+/**
+ * @brief   checks that SOC_GetFromVoltageBatch() gives the same SOC as SOC_GetFromVoltage()
+ */
+static void TOCV_TestBatch(void) {
+    float soc = 0.0f;
+
+    for (double t = tocv_temperatures[0] - TOCV_TEMPERATURE_MARGIN;
+            t <= tocv_temperatures[BC_OCV_NR_OF_TEMPERATURES - 1] + TOCV_TEMPERATURE_MARGIN; t += 1.0) {
+        for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+            tocv_voltage[i] = (uint16_t)(1500 + (rand() % 3000));
+        }
+        SOC_GetFromVoltageBatch(tocv_voltage, (float)t, tocv_soc, BS_NR_OF_BAT_CELLS);
+        for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+            soc = SOC_GetFromVoltage((float)tocv_voltage[i], (float)t);
+            HOSTTEST_CHECK(tocv_soc[i] == soc, "batch SOC %f instead of %f %% at %u mV, %.1f degC",
+                    tocv_soc[i], soc, tocv_voltage[i], t);
+        }
+    }
+}
+
+
+/**
+ * @brief   measures the conversion of all cells of the battery system
+ */
+static void TOCV_Benchmark(uint32_t iterations) {
+    const float temperature = 30.0f;    /* between two curves, both are interpolated */
+    uint64_t start = 0;
+    double linearNs = 0.0;
+    double singleNs = 0.0;
+    double batchNs = 0.0;
+
+    for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        tocv_voltage[i] = (uint16_t)(tocv_curves[1][0] + (rand() % (int)(tocv_curves[1][BC_OCV_NR_OF_SOC_POINTS - 1] - tocv_curves[1][0])));
+    }
+
+    start = HOSTTEST_GetTimeNs();
+    for (uint32_t n = 0; n < iterations; n++) {
+        for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+            tocv_soc[i] = TOCV_LinearSearchSoc((float)tocv_voltage[i], temperature);
+        }
+        tocv_sink += tocv_soc[n % BS_NR_OF_BAT_CELLS];
+    }
+    linearNs = (double)(HOSTTEST_GetTimeNs() - start) / iterations;
+
+    start = HOSTTEST_GetTimeNs();
+    for (uint32_t n = 0; n < iterations; n++) {
+        for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+            tocv_soc[i] = SOC_GetFromVoltage((float)tocv_voltage[i], temperature);
+        }
+        tocv_sink += tocv_soc[n % BS_NR_OF_BAT_CELLS];
+    }
+    singleNs = (double)(HOSTTEST_GetTimeNs() - start) / iterations;
+
+    start = HOSTTEST_GetTimeNs();
+    for (uint32_t n = 0; n < iterations; n++) {
+        SOC_GetFromVoltageBatch(tocv_voltage, temperature, tocv_soc, BS_NR_OF_BAT_CELLS);
+        tocv_sink += tocv_soc[n % BS_NR_OF_BAT_CELLS];
+    }
+    batchNs = (double)(HOSTTEST_GetTimeNs() - start) / iterations;
+
+    printf("conversion of %d cells, %u iterations\n", BS_NR_OF_BAT_CELLS, iterations);
+    printf("  linear search                 %9.0f ns\n", linearNs);
+    printf("  SOC_GetFromVoltage()          %9.0f ns  (%.2fx)\n", singleNs, linearNs / singleNs);
+    printf("  SOC_GetFromVoltageBatch()     %9.0f ns  (%.2fx)\n", batchNs, linearNs / batchNs);
+}
+
+
+int main(int argc, char *argv[]) {
+    uint32_t iterations = TOCV_DEFAULT_ITERATIONS;
+
+    if (argc > 1) {
+        iterations = (uint32_t)strtoul(argv[1], NULL, 10);
+    }
+
+    srand(1);
+    TOCV_TestAccuracy();
+    TOCV_TestBatch();
+    TOCV_Benchmark(iterations);
+
+    return HOSTTEST_Result("bench_ocv");
+}
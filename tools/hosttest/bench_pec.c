@@ -0,0 +1,251 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2019, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    bench_pec.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup HOSTTEST
+ * @prefix  TPEC
+ *
+ * @brief   Accuracy test and benchmark of the LTC PEC calculation
+ *
+ * The reference is the former implementation: a byte by byte CRC15 with the
+ * table generated as described in ltc_pec.h, and a check of the daisy-chain
+ * that copies every register group into a scratch buffer first.
+ *
+ * The test compares LTC_pec15_calc() with the reference for random data of
+ * all lengths and checks that LTC_pec15_checkChain() reports exactly the
+ * corrupted register groups. The benchmark measures the check of the
+ * register groups of all BS_NR_OF_MODULES LTCs of a daisy-chain.
+ *
+ * Usage: bench_pec [iterations]
+ */
+
+/*================== Includes =============================================*/
+#include "hosttest.h"
+
+#include "batterysystem_cfg.h"
+#include "ltc_pec.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*================== Macros and Definitions ===============================*/
+#define TPEC_DEFAULT_ITERATIONS     200000
+#define TPEC_RANDOM_RUNS            20000
+#define TPEC_MAX_LENGTH             64
+
+/**
+ * offset of the first register group in the SPI receive buffer (command and its PEC)
+ */
+#define TPEC_RX_OFFSET              4
+
+#define TPEC_NR_OF_LTC              BS_NR_OF_MODULES
+#define TPEC_BUFFER_LENGTH          (TPEC_RX_OFFSET + (TPEC_NR_OF_LTC * LTC_PEC_FRAME_LENGTH))
+
+/*================== Constant and Variable Definitions ====================*/
+unsigned long hosttest_failures = 0;
+
+static uint16_t tpec_crc15Table[256];
+static volatile uint32_t tpec_sink = 0;
+
+/*================== Function Implementations =============================*/
+/**
+ * @brief   generates the table of the reference as described in ltc_pec.h
+ */
+static void TPEC_GenerateTable(void) {
+    for (int i = 0; i < 256; i++) {
+        int remainder = i << 7;
+        for (int bit = 8; bit > 0; --bit) {
+            if ((remainder & 0x4000) > 0) {
+                remainder = (remainder << 1) ^ 0x4599;
+            } else {
+                remainder = remainder << 1;
+            }
+        }
+        tpec_crc15Table[i] = remainder & 0xFFFF;
+    }
+}
+
+
+/**
+ * @brief   former byte by byte PEC calculation
+ */
+static uint16_t TPEC_ReferenceCalc(uint8_t len, const uint8_t *data) {
+    uint16_t remainder = 16;
+    uint16_t addr = 0;
+
+    for (uint8_t i = 0; i < len; i++) {
+        addr = ((remainder >> 7) ^ data[i]) & 0xff;
+        remainder = (remainder << 8) ^ tpec_crc15Table[addr];
+    }
+    return (uint16_t)(remainder * 2);
+}
+
+
+/**
+ * @brief   former check of the daisy-chain with a copy of every register group
+ *
+ * @return  number of register groups with a wrong PEC
+ */
+static uint16_t TPEC_ReferenceCheckChain(const uint8_t *rxBuffer, uint16_t nr_of_ltc) {
+    uint8_t PEC_Check[6] = {0};
+    uint16_t PEC_result = 0;
+    uint16_t nr_of_errors = 0;
+
+    for (uint16_t i = 0; i < nr_of_ltc; i++) {
+        memcpy(PEC_Check, &rxBuffer[TPEC_RX_OFFSET + (i * 8)], sizeof(PEC_Check));
+        PEC_result = TPEC_ReferenceCalc(6, PEC_Check);
+        if ((rxBuffer[TPEC_RX_OFFSET + 6 + (i * 8)] != (uint8_t)((PEC_result >> 8) & 0xff)) ||
+                (rxBuffer[TPEC_RX_OFFSET + 7 + (i * 8)] != (uint8_t)(PEC_result & 0xff))) {
+            nr_of_errors++;
+        }
+    }
+    return nr_of_errors;
+}
+
+
+/**
+ * @brief   compares LTC_pec15_calc() with the reference for random data
+ */
+static void TPEC_TestCalc(void) {
+    uint8_t data[TPEC_MAX_LENGTH];
+
+    for (int run = 0; run < TPEC_RANDOM_RUNS; run++) {
+        uint8_t len = (uint8_t)(run % (TPEC_MAX_LENGTH + 1));
+        for (int i = 0; i < len; i++) {
+            data[i] = (uint8_t)rand();
+        }
+        uint16_t expected = TPEC_ReferenceCalc(len, data);
+        uint16_t result = LTC_pec15_calc(len, data);
+        HOSTTEST_CHECK(result == expected, "PEC of %u bytes: 0x%04X instead of 0x%04X", len, result, expected);
+        if (result != expected) {
+            return;
+        }
+    }
+}
+
+
+/**
+ * @brief   checks that the daisy-chain check reports exactly the corrupted register groups
+ */
+static void TPEC_TestChain(void) {
+    uint8_t rxBuffer[TPEC_BUFFER_LENGTH];
+    uint32_t pecErrors[LTC_PEC_BITMAP_WORDS(TPEC_NR_OF_LTC)];
+    uint32_t expected[LTC_PEC_BITMAP_WORDS(TPEC_NR_OF_LTC)];
+    uint16_t nr_of_errors = 0;
+    uint16_t expectedErrors = 0;
+
+    for (int run = 0; run < 1000; run++) {
+        for (int i = 0; i < TPEC_BUFFER_LENGTH; i++) {
+            rxBuffer[i] = (uint8_t)rand();
+        }
+        LTC_pec15_fillChain(&rxBuffer[TPEC_RX_OFFSET], TPEC_NR_OF_LTC);
+        HOSTTEST_CHECK(TPEC_ReferenceCheckChain(rxBuffer, TPEC_NR_OF_LTC) == 0, "reference rejects the PECs of LTC_pec15_fillChain()");
+
+        /* corrupt one bit in some register groups, data or PEC */
+        memset(expected, 0, sizeof(expected));
+        expectedErrors = 0;
+        for (int i = 0; i < TPEC_NR_OF_LTC; i++) {
+            if ((rand() % 4) == 0) {
+                rxBuffer[TPEC_RX_OFFSET + (i * LTC_PEC_FRAME_LENGTH) + (rand() % LTC_PEC_FRAME_LENGTH)] ^= (uint8_t)(1u << (rand() % 8));
+                expected[i / 32] |= (uint32_t)1 << (i % 32);
+                expectedErrors++;
+            }
+        }
+        nr_of_errors = LTC_pec15_checkChain(&rxBuffer[TPEC_RX_OFFSET], TPEC_NR_OF_LTC, pecErrors);
+        HOSTTEST_CHECK(nr_of_errors == expectedErrors, "%u PEC errors reported instead of %u", nr_of_errors, expectedErrors);
+        HOSTTEST_CHECK(memcmp(pecErrors, expected, sizeof(expected)) == 0, "wrong LTCs reported with PEC errors");
+        HOSTTEST_CHECK(TPEC_ReferenceCheckChain(rxBuffer, TPEC_NR_OF_LTC) == expectedErrors, "reference disagrees on the PEC errors");
+    }
+}
+
+
+/**
+ * @brief   measures the check of a daisy-chain with both implementations
+ */
+static void TPEC_Benchmark(uint32_t iterations) {
+    uint8_t rxBuffer[TPEC_BUFFER_LENGTH];
+    uint32_t pecErrors[LTC_PEC_BITMAP_WORDS(TPEC_NR_OF_LTC)];
+    uint64_t start = 0;
+    double referenceNs = 0.0;
+    double chainNs = 0.0;
+
+    for (int i = 0; i < TPEC_BUFFER_LENGTH; i++) {
+        rxBuffer[i] = (uint8_t)rand();
+    }
+    LTC_pec15_fillChain(&rxBuffer[TPEC_RX_OFFSET], TPEC_NR_OF_LTC);
+
+    start = HOSTTEST_GetTimeNs();
+    for (uint32_t n = 0; n < iterations; n++) {
+        rxBuffer[TPEC_RX_OFFSET] = (uint8_t)n;  /* keeps the compiler from hoisting the calculation */
+        tpec_sink += TPEC_ReferenceCheckChain(rxBuffer, TPEC_NR_OF_LTC);
+    }
+    referenceNs = (double)(HOSTTEST_GetTimeNs() - start) / iterations;
+
+    start = HOSTTEST_GetTimeNs();
+    for (uint32_t n = 0; n < iterations; n++) {
+        rxBuffer[TPEC_RX_OFFSET] = (uint8_t)n;
+        tpec_sink += LTC_pec15_checkChain(&rxBuffer[TPEC_RX_OFFSET], TPEC_NR_OF_LTC, pecErrors);
+    }
+    chainNs = (double)(HOSTTEST_GetTimeNs() - start) / iterations;
+
+    printf("check of %d register groups, %u iterations\n", TPEC_NR_OF_LTC, iterations);
+    printf("  byte by byte with copy (former)  %9.1f ns\n", referenceNs);
+    printf("  slicing-by-4 in place            %9.1f ns  (%.2fx)\n", chainNs, referenceNs / chainNs);
+}
+
+
+int main(int argc, char *argv[]) {
+    uint32_t iterations = TPEC_DEFAULT_ITERATIONS;
+
+    if (argc > 1) {
+        iterations = (uint32_t)strtoul(argv[1], NULL, 10);
+    }
+
+    srand(1);
+    TPEC_GenerateTable();
+    TPEC_TestCalc();
+    TPEC_TestChain();
+    TPEC_Benchmark(iterations);
+
+    return HOSTTEST_Result("bench_pec");
+}
@@ -0,0 +1,112 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2019, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    hosttest.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup HOSTTEST
+ * @prefix  HOSTTEST
+ *
+ * @brief   Helpers shared by the host tests and benchmarks
+ *
+ * A host test is a program that returns 0 if all checks passed. Failed
+ * checks are printed and counted.
+ */
+
+#ifndef HOSTTEST_H_
+#define HOSTTEST_H_
+
+/*================== Includes =============================================*/
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/*================== Macros and Definitions ===============================*/
+/**
+ * checks a condition, prints and counts it as failure if it is false
+ */
+#define HOSTTEST_CHECK(condition, ...) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            hosttest_failures++; \
+        } \
+    } while (0)
+
+/*================== Constant and Variable Definitions ====================*/
+/**
+ * number of failed checks, defined by every host test
+ */
+extern unsigned long hosttest_failures;
+
+/*================== Function Implementations =============================*/
+/**
+ * @brief   reads the monotonic clock of the host
+ *
+ * @return  time in ns
+ */
+static inline uint64_t HOSTTEST_GetTimeNs(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief   prints the result of a host test
+ *
+ * @param   name    name of the test
+ *
+ * @return  exit code of the test, 0 if no check failed
+ */
+static inline int HOSTTEST_Result(const char *name) {
+    if (hosttest_failures == 0) {
+        printf("%s: PASSED\n", name);
+        return 0;
+    }
+    printf("%s: FAILED (%lu failed checks)\n", name, hosttest_failures);
+    return 1;
+}
+
+#endif /* HOSTTEST_H_ */
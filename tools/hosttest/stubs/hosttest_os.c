@@ -0,0 +1,176 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2019, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    hosttest_os.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup HOSTTEST
+ * @prefix  OS
+ *
+ * @brief   Implementation of the OS interface for the host tests
+ *
+ * On the target a critical section disables the interrupts. On the host, all
+ * critical sections share one recursive mutex, so they exclude each other.
+ * Code outside of critical sections runs truly concurrent on a multi-core
+ * host, which is a harder test for lock-free code than the single core MCU.
+ */
+
+/*================== Includes =============================================*/
+#include "os.h"
+
+#include "diag.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+static pthread_mutex_t os_critical_mutex;
+static pthread_once_t os_critical_once = PTHREAD_ONCE_INIT;
+static __thread uint32_t os_critical_nesting = 0;
+
+/** TRUE after the first call of OS_SetSimulatedSysTick() */
+static uint8_t os_tick_simulated = FALSE;
+static uint32_t os_simulated_tick = 0;
+
+/*================== Function Prototypes ==================================*/
+static void OS_InitCriticalMutex(void);
+
+/*================== Function Implementations =============================*/
+void OS_TaskEnter_Critical(void) {
+    pthread_once(&os_critical_once, OS_InitCriticalMutex);
+    pthread_mutex_lock(&os_critical_mutex);
+    os_critical_nesting++;
+}
+
+
+void OS_TaskExit_Critical(void) {
+    os_critical_nesting--;
+    pthread_mutex_unlock(&os_critical_mutex);
+}
+
+
+uint32_t OS_getOSSysTick(void) {
+    struct timespec now;
+
+    if (os_tick_simulated == TRUE) {
+        return os_simulated_tick;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((now.tv_sec * 1000u) + (now.tv_nsec / 1000000));
+}
+
+
+void OS_SetSimulatedSysTick(uint32_t tick) {
+    os_simulated_tick = tick;
+    os_tick_simulated = TRUE;
+}
+
+
+void OS_taskDelay(uint32_t delay_ms) {
+    struct timespec delay = { delay_ms / 1000u, (delay_ms % 1000u) * 1000000 };
+
+    nanosleep(&delay, NULL);
+}
+
+
+uint8_t vPortCheckCriticalSection(void) {
+    return (os_critical_nesting > 0) ? TRUE : FALSE;
+}
+
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+    pthread_mutex_t *mutex = malloc(sizeof(pthread_mutex_t));
+
+    if (mutex != NULL) {
+        pthread_mutex_init(mutex, NULL);
+    }
+    return mutex;
+}
+
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait) {
+    struct timespec timeout;
+
+    if (ticksToWait == 0) {
+        return (pthread_mutex_trylock(semaphore) == 0) ? pdTRUE : pdFALSE;
+    }
+    clock_gettime(CLOCK_REALTIME, &timeout);
+    timeout.tv_sec += ticksToWait / 1000u;
+    timeout.tv_nsec += (ticksToWait % 1000u) * 1000000;
+    if (timeout.tv_nsec >= 1000000000) {
+        timeout.tv_sec++;
+        timeout.tv_nsec -= 1000000000;
+    }
+    return (pthread_mutex_timedlock(semaphore, &timeout) == 0) ? pdTRUE : pdFALSE;
+}
+
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    return (pthread_mutex_unlock(semaphore) == 0) ? pdTRUE : pdFALSE;
+}
+
+
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action) {
+    /* no task waits for notifications in the host tests */
+    return pdTRUE;
+}
+
+
+void DIAG_SysMonNotify(DIAG_SYSMON_MODULE_ID_e module_id, uint32_t state) {
+    /* no system monitoring in the host tests */
+}
+
+/*================== Static functions =====================================*/
+/**
+ * @brief   creates the recursive mutex of the critical sections
+ */
+static void OS_InitCriticalMutex(void) {
+    pthread_mutexattr_t attr;
+
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&os_critical_mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
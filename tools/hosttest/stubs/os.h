@@ -0,0 +1,109 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2019, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    os.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup HOSTTEST
+ * @prefix  OS
+ *
+ * @brief   Replacement of the OS interface for the host tests
+ *
+ * Provides the parts of the OS module and of FreeRTOS that are used by the
+ * modules under test. Tasks are POSIX threads, a critical section is a
+ * recursive mutex shared by all threads and the OS tick is the monotonic
+ * clock in ms, unless a test sets a simulated tick.
+ */
+
+#ifndef OS_H_
+#define OS_H_
+
+/*================== Includes =============================================*/
+#include "general.h"
+
+#include <assert.h>
+
+/*================== Macros and Definitions ===============================*/
+#define portTICK_RATE_MS            1
+#define pdTRUE                      1
+#define pdFALSE                     0
+#define configASSERT(x)             assert(x)
+#define taskENTER_CRITICAL()        OS_TaskEnter_Critical()
+#define taskEXIT_CRITICAL()         OS_TaskExit_Critical()
+
+typedef void *TaskHandle_t;
+typedef void *SemaphoreHandle_t;
+typedef uint32_t TickType_t;
+typedef long BaseType_t;
+
+typedef enum {
+    eNoAction = 0,
+    eSetBits,
+    eIncrement,
+    eSetValueWithOverwrite,
+    eSetValueWithoutOverwrite,
+} eNotifyAction;
+
+/*================== Function Prototypes ==================================*/
+extern void OS_TaskEnter_Critical(void);
+extern void OS_TaskExit_Critical(void);
+extern uint32_t OS_getOSSysTick(void);
+
+/**
+ * @brief   replaces the monotonic clock by a simulated OS tick
+ *
+ * After the first call, OS_getOSSysTick() returns the last set tick, so that
+ * a test can run the modules in simulated time.
+ *
+ * @param   tick    OS tick in ms
+ */
+extern void OS_SetSimulatedSysTick(uint32_t tick);
+
+extern void OS_taskDelay(uint32_t delay_ms);
+
+extern uint8_t vPortCheckCriticalSection(void);
+extern SemaphoreHandle_t xSemaphoreCreateMutex(void);
+extern BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait);
+extern BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+extern BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action);
+
+#endif /* OS_H_ */
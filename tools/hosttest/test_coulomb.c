@@ -0,0 +1,568 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2019, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_coulomb.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup HOSTTEST
+ * @prefix  TCC
+ *
+ * @brief   Replay of a week-long current profile through the Coulomb counter
+ *
+ * Every current measurement of the profile is passed to
+ * SOC_IntegrateCurrent() as cans_setcurr() does. Once per second, the
+ * measurement is also written to the current sensor block and
+ * SOC_Calculation() is run. At the end the charge and the SOC of the SOX
+ * block are compared with a trapezoidal integration of the same
+ * measurements in double precision. The number of gaps is compared with
+ * the gaps of the profile.
+ *
+ * For comparison, the former integration is repeated. It subtracted the
+ * charge of every measurement from a single precision SOC. Its deviation
+ * from the same integration in double precision is printed.
+ *
+ * Afterwards, a day of the generated profile is replayed through the CAN
+ * receive path of the primary MCU. Every measurement is a frame of the
+ * current sensor that the receive interrupt of can.c gets at the time of
+ * the measurement. The CANS task runs every TCC_TASK_PERIOD_MS, but now and
+ * then it is delayed by up to TCC_TASK_DELAY_MS and parses several buffered
+ * frames in one run. The Coulomb counter has to integrate them with the time
+ * of their reception, the charge and the gaps are checked as above. For
+ * comparison, the deviation of an integration with the time of parsing, as
+ * done before, is printed.
+ *
+ * Without argument, a week of measurements every 10 ms with jitter,
+ * dropouts and a wrap-around of the timestamp is generated. A recorded
+ * profile can be replayed instead. It is a text file with one measurement
+ * per line, the timestamp in ms and the current in mA separated by a comma.
+ *
+ * Usage: test_coulomb [profile.csv]
+ */
+
+/*================== Includes =============================================*/
+#include "hosttest.h"
+
+#include "sox.h"
+
+#include "bal.h"
+#include "batterysystem_cfg.h"
+#include "can.h"
+#include "cansignal.h"
+#include "database.h"
+#include "diag.h"
+#include "io.h"
+#include "ltc.h"
+#include "mcu.h"
+#include "nvramhandler.h"
+#include "os.h"
+#include "sox_cfg.h"
+#include "sys.h"
+#include <math.h>
+#include <stdlib.h>
+
+/*================== Macros and Definitions ===============================*/
+#define TCC_DURATION_MS             (7u * 24u * 3600u * 1000u)
+#define TCC_SAMPLE_PERIOD_MS        10u
+#define TCC_SAMPLE_JITTER_MS        2u
+#define TCC_SOC_PERIOD_MS           1000u
+
+/** the generated profile starts 2 days before the wrap-around of the timestamp */
+#define TCC_START_TIMESTAMP         (0xFFFFFFFFu - (2u * 24u * 3600u * 1000u))
+
+/** mean number of measurements between two dropouts of the current sensor */
+#define TCC_DROPOUT_INTERVAL        100000u
+
+/** the generated profile keeps the SOC between these limits in % */
+#define TCC_SOC_LOW                 20.0
+#define TCC_SOC_HIGH                80.0
+
+#define TCC_INITIAL_SOC             50.0
+
+/** charge in mA.ms for 1 % SOC */
+#define TCC_CHARGE_PER_PERCENT      (36000.0 * SOX_CELL_CAPACITY)
+
+/** maximum deviation of the SOC of the SOX block in %, rounding of single precision */
+#define TCC_MAX_SOC_ERROR           0.001
+
+/** duration of the replay through the CAN receive path */
+#define TCC_BATCHED_DURATION_MS     (24u * 3600u * 1000u)
+
+/** the CANS task runs every TCC_TASK_PERIOD_MS, in one of TCC_TASK_DELAY_INTERVAL runs it is delayed */
+#define TCC_TASK_PERIOD_MS          10u
+#define TCC_TASK_DELAY_MS           60u
+#define TCC_TASK_DELAY_INTERVAL     10u
+
+/**
+ * state of the generated current profile
+ */
+typedef struct {
+    uint32_t random;            /*!< state of the random number generator           */
+    uint32_t timestamp;         /*!< time of the last measurement in ms             */
+    uint32_t elapsed;           /*!< time since the start of the profile in ms      */
+    uint32_t segmentEnd;        /*!< elapsed time at the end of the load segment    */
+    int32_t segmentCurrent;     /*!< current of the load segment in mA              */
+    uint32_t gaps;              /*!< generated gaps of more than SOX_CC_MAX_SAMPLE_GAP_MS */
+    uint32_t end;               /*!< elapsed time at the end of the generated profile */
+} TCC_PROFILE_s;
+
+/**
+ * trapezoidal integration of the measurements in double precision
+ */
+typedef struct {
+    double charge;              /*!< integral of the current in mA.ms               */
+    int32_t current;            /*!< last measurement in mA                         */
+    uint32_t timestamp;         /*!< time of the last measurement in ms             */
+    uint32_t gaps;              /*!< gaps of more than SOX_CC_MAX_SAMPLE_GAP_MS     */
+    unsigned long nrOfSamples;  /*!< number of measurements                         */
+} TCC_REFERENCE_s;
+
+/*================== Constant and Variable Definitions ====================*/
+unsigned long hosttest_failures = 0;
+
+static TCC_PROFILE_s tcc_profile = {
+    .random = 1,
+    .timestamp = TCC_START_TIMESTAMP,
+    .end = TCC_DURATION_MS,
+};
+
+static TCC_REFERENCE_s tcc_reference;
+
+/** registers of the CAN controller of CAN_NODE0 */
+static CAN_TypeDef tcc_can0;
+static CAN_TypeDef tcc_can1;
+
+/*================== Function Implementations =============================*/
+STD_RETURN_TYPE_e NVM_getSOC(SOX_SOC_s *dest_ptr) {
+    return E_NOT_OK;
+}
+
+STD_RETURN_TYPE_e NVM_setSOC(SOX_SOC_s* ptr) {
+    return E_OK;
+}
+
+HAL_StatusTypeDef HAL_CAN_Init(CAN_HandleTypeDef* hcan) {
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CAN_DeInit(CAN_HandleTypeDef* hcan) {
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CAN_ConfigFilter(CAN_HandleTypeDef* hcan, CAN_FilterConfTypeDef* sFilterConfig) {
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CAN_Receive_IT(CAN_HandleTypeDef *hcan, uint8_t FIFONumber) {
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CAN_Transmit_IT(CAN_HandleTypeDef *hcan) {
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CAN_Sleep(CAN_HandleTypeDef *hcan) {
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CAN_WakeUp(CAN_HandleTypeDef *hcan) {
+    return HAL_OK;
+}
+
+void HAL_NVIC_SystemReset(void) {
+}
+
+void IO_WritePin(IO_PORTS_e pin, IO_PIN_STATE_e requestedPinState) {
+}
+
+uint32_t MCU_GetCycleCounter(void) {
+    return 0;
+}
+
+uint32_t MCU_CyclesToMicroseconds(uint32_t cycles) {
+    return cycles;
+}
+
+DIAG_RETURNTYPE_e DIAG_Handler(DIAG_CH_ID_e diag_ch_id, DIAG_EVENT_e event, uint32_t item_nr, void* data) {
+    return DIAG_HANDLER_RETURN_OK;
+}
+
+BAL_RETURN_TYPE_e BAL_SetStateRequest(BAL_STATE_REQUEST_e statereq) {
+    return BAL_OK;
+}
+
+uint32_t LTC_ThirdParty_Set_Get_Property(char* prop, void* iParam1, void* iParam2, void* oParam1, void* oParam2) {
+    return 0;
+}
+
+void SYS_SendBootMessage(uint8_t directTransmission) {
+}
+
+
+/**
+ * @brief   xorshift random number generator, the profile is the same on every host
+ */
+static uint32_t TCC_Random(void) {
+    tcc_profile.random ^= tcc_profile.random << 13;
+    tcc_profile.random ^= tcc_profile.random >> 17;
+    tcc_profile.random ^= tcc_profile.random << 5;
+    return tcc_profile.random;
+}
+
+
+/**
+ * @brief   generates the next measurement of the profile
+ *
+ * The load changes in segments of 1 s to 5 min between rest, discharge and
+ * charge with up to 40 A, with a noise of 0.5 A. The direction is chosen so
+ * that the SOC stays between TCC_SOC_LOW and TCC_SOC_HIGH at the start of a
+ * segment. One segment changes the SOC by less than 20 %, so the SOC never
+ * reaches the limits of 0 % and 100 %.
+ *
+ * @param   soc         SOC of the reference in %
+ * @param   timestamp   time of the measurement in ms
+ * @param   current     measured current in mA
+ *
+ * @return  TRUE if a measurement was generated, FALSE at the end of the profile
+ */
+static uint8_t TCC_GenerateSample(double soc, uint32_t *timestamp, int32_t *current) {
+    uint32_t step = TCC_SAMPLE_PERIOD_MS - TCC_SAMPLE_JITTER_MS + (TCC_Random() % (2u * TCC_SAMPLE_JITTER_MS + 1u));
+
+    if ((TCC_Random() % TCC_DROPOUT_INTERVAL) == 0) {
+        step += 100u + (TCC_Random() % 2000u);
+    }
+    if (step > SOX_CC_MAX_SAMPLE_GAP_MS) {
+        tcc_profile.gaps++;
+    }
+    tcc_profile.elapsed += step;
+    tcc_profile.timestamp += step;
+    if (tcc_profile.elapsed >= tcc_profile.end) {
+        return FALSE;
+    }
+
+    if (tcc_profile.elapsed >= tcc_profile.segmentEnd) {
+        tcc_profile.segmentEnd = tcc_profile.elapsed + 1000u + (TCC_Random() % 300000u);
+        switch (TCC_Random() % 3u) {
+            case 0:
+                tcc_profile.segmentCurrent = 0;
+                break;
+            case 1:
+                tcc_profile.segmentCurrent = (int32_t)(TCC_Random() % 40000u);
+                break;
+            default:
+                tcc_profile.segmentCurrent = -(int32_t)(TCC_Random() % 40000u);
+                break;
+        }
+        /* positive current discharges the battery */
+        if (((soc < TCC_SOC_LOW) && (tcc_profile.segmentCurrent > 0)) ||
+                ((soc > TCC_SOC_HIGH) && (tcc_profile.segmentCurrent < 0))) {
+            tcc_profile.segmentCurrent = -tcc_profile.segmentCurrent;
+        }
+    }
+
+    *timestamp = tcc_profile.timestamp;
+    *current = tcc_profile.segmentCurrent + (int32_t)(TCC_Random() % 1001u) - 500;
+    return TRUE;
+}
+
+
+/**
+ * @brief   reads the next measurement of a recorded profile
+ *
+ * @param   first   TRUE for the first measurement of the profile
+ *
+ * @return  TRUE if a measurement was read, FALSE at the end of the file
+ */
+static uint8_t TCC_ReadSample(FILE *file, uint8_t first, uint32_t *timestamp, int32_t *current) {
+    unsigned long t = 0;
+    long i = 0;
+    uint8_t retVal = FALSE;
+
+    if (fscanf(file, " %lu , %ld", &t, &i) == 2) {
+        if (first == FALSE) {
+            if (((uint32_t)t - tcc_profile.timestamp) > SOX_CC_MAX_SAMPLE_GAP_MS) {
+                tcc_profile.gaps++;
+            }
+            tcc_profile.elapsed += ((uint32_t)t - tcc_profile.timestamp);
+        }
+        tcc_profile.timestamp = (uint32_t)t;
+        *timestamp = (uint32_t)t;
+        *current = (int32_t)i;
+        retVal = TRUE;
+    }
+    return retVal;
+}
+
+
+/**
+ * @brief   adds a measurement to a trapezoidal integration in double precision
+ */
+static void TCC_Integrate(TCC_REFERENCE_s *reference, uint32_t timestamp, int32_t current) {
+    uint32_t timestep = timestamp - reference->timestamp;
+
+    if (reference->nrOfSamples > 0) {
+        reference->charge += 0.5 * ((double)current + (double)reference->current) * (double)timestep;
+        if (timestep > SOX_CC_MAX_SAMPLE_GAP_MS) {
+            reference->gaps++;
+        }
+    }
+    reference->current = current;
+    reference->timestamp = timestamp;
+    reference->nrOfSamples++;
+}
+
+
+/**
+ * @brief   SOC of the reference integration in %
+ */
+static double TCC_ReferenceSoc(void) {
+    return TCC_INITIAL_SOC - (tcc_reference.charge / TCC_CHARGE_PER_PERCENT);
+}
+
+
+/**
+ * @brief   writes a measurement to the current sensor block and runs the SOC calculation
+ */
+static void TCC_UpdateSoc(uint32_t timestamp, int32_t current) {
+    static DATA_BLOCK_CURRENT_SENSOR_s current_tab;
+
+    current_tab.current = (float)current;
+    current_tab.previous_timestamp_cur = current_tab.timestamp_cur;
+    current_tab.timestamp_cur = timestamp;
+    DB_WriteBlock(&current_tab, DATA_BLOCK_ID_CURRENT_SENSOR);
+    SOC_Calculation();
+}
+
+
+/**
+ * @brief   compares the charge, the gaps and the SOC of the SOX block with the reference
+ *
+ * @param   name    name of the replay
+ */
+static void TCC_CheckCounter(const char *name) {
+    DATA_BLOCK_SOX_s sox_tab;
+
+    /* one more SOC calculation with the last measurement */
+    TCC_UpdateSoc(tcc_reference.timestamp + 1u, tcc_reference.current);
+    DB_ReadBlock(&sox_tab, DATA_BLOCK_ID_SOX);
+
+    printf("%s: %lu measurements over %.1f h, %u gaps\n", name, tcc_reference.nrOfSamples,
+            tcc_profile.elapsed / 3600000.0, tcc_profile.gaps);
+    printf("  charge: counter %lld mA.ms, reference %.1f mA.ms\n", (long long)sox_tab.charge_counter, tcc_reference.charge);
+    printf("  SOC:    counter %.6f %%, reference %.6f %%\n", sox_tab.soc_mean, TCC_ReferenceSoc());
+
+    /* the counter holds twice the charge, sox_tab.charge_counter is rounded towards zero */
+    HOSTTEST_CHECK(fabs((double)sox_tab.charge_counter - tcc_reference.charge) <= 0.5,
+            "%s: charge counter deviates by %.1f mA.ms from the reference", name,
+            (double)sox_tab.charge_counter - tcc_reference.charge);
+    HOSTTEST_CHECK(sox_tab.charge_counter_gaps == tcc_profile.gaps, "%s: %u gaps counted instead of %u",
+            name, sox_tab.charge_counter_gaps, tcc_profile.gaps);
+    if ((TCC_ReferenceSoc() > 0.0) && (TCC_ReferenceSoc() < 100.0)) {
+        HOSTTEST_CHECK(fabs(sox_tab.soc_mean - TCC_ReferenceSoc()) <= TCC_MAX_SOC_ERROR,
+                "%s: SOC deviates by %.6f %% from the reference", name, sox_tab.soc_mean - TCC_ReferenceSoc());
+    }
+}
+
+
+/**
+ * @brief   passes a measurement as frame of the current sensor to the receive interrupt of CAN_NODE0
+ *
+ * @param   msgID       CAN ID of the current measurement
+ * @param   timestamp   time of the measurement in ms
+ * @param   current     measured current in mA
+ */
+static void TCC_ReceiveFrame(uint32_t msgID, uint32_t timestamp, int32_t current) {
+    CAN_FIFOMailBox_TypeDef *mailbox = &tcc_can0.sFIFOMailBox[CAN_FIFO0];
+    uint32_t value = (uint32_t)current;
+
+    OS_SetSimulatedSysTick(timestamp);
+    mailbox->RIR = msgID << 21;
+    mailbox->RDTR = 8u;
+    /* multiplexer and status in the bytes 0 and 1, the current in the bytes 2 to 5 with the most significant byte first */
+    mailbox->RDLR = (((value >> 24) & 0xFFu) << 16) | (((value >> 16) & 0xFFu) << 24);
+    mailbox->RDHR = ((value >> 8) & 0xFFu) | ((value & 0xFFu) << 8);
+    tcc_can0.IER = CAN_IT_FMP0;
+    tcc_can0.RF0R = 1u;
+    CAN_RX_IRQHandler(CAN_NODE0, &hcan0);
+}
+
+
+/**
+ * @brief   replays a day of the generated profile through the CAN receive path with a delayed CANS task
+ */
+static void TCC_ReplayBatched(void) {
+    const CANS_messagesRx_e msgIdx = cans_CAN0_signals_rx[CAN0_SIG_IVT_Current_Measurement].msgIdx.Rx;
+    const uint32_t msgID = can0_RxMsgs[msgIdx].ID;
+    CAN_RX_STATISTICS_s rxstatistics;
+    TCC_REFERENCE_s parsed = { 0 };
+    int32_t pending[CAN0_RX_BUFFER_LENGTH];
+    uint32_t nrOfPending = 0;
+    uint32_t maxBatch = 0;
+    uint32_t taskDue = 0;
+    uint32_t taskRun = 0;
+    uint32_t timestamp = 0;
+    int32_t current = 0;
+    uint32_t gapsAtStart = 0;
+    double chargeAtStart = 0.0;
+
+    /* the registers of the CAN controllers are simulated */
+    hcan0.Instance = &tcc_can0;
+    hcan1.Instance = &tcc_can1;
+    CAN_Init();
+    CANS_Init();
+
+    tcc_profile.end = tcc_profile.elapsed + TCC_BATCHED_DURATION_MS;
+    taskDue = tcc_profile.timestamp + TCC_TASK_PERIOD_MS;
+    taskRun = taskDue;
+
+    while (TCC_GenerateSample(TCC_ReferenceSoc(), &timestamp, &current) == TRUE) {
+        /* the CANS task parses the frames received before it runs */
+        while ((int32_t)(timestamp - taskRun) > 0) {
+            OS_SetSimulatedSysTick(taskRun);
+            CANS_MainFunction();
+            for (uint32_t i = 0; i < nrOfPending; i++) {
+                TCC_Integrate(&parsed, taskRun, pending[i]);
+            }
+            if (nrOfPending > maxBatch) {
+                maxBatch = nrOfPending;
+            }
+            nrOfPending = 0;
+
+            taskDue += TCC_TASK_PERIOD_MS;
+            if ((TCC_Random() % TCC_TASK_DELAY_INTERVAL) == 0) {
+                taskRun = taskDue + (TCC_Random() % (TCC_TASK_DELAY_MS + 1u));
+            } else if ((int32_t)(taskDue - taskRun) > 0) {
+                taskRun = taskDue;
+            } else {
+                /* a delayed task catches up with the runs it missed */
+            }
+        }
+
+        TCC_ReceiveFrame(msgID, timestamp, current);
+        if (nrOfPending < CAN0_RX_BUFFER_LENGTH) {
+            pending[nrOfPending] = current;
+            nrOfPending++;
+        }
+        TCC_Integrate(&tcc_reference, timestamp, current);
+        if (parsed.nrOfSamples == 0) {
+            chargeAtStart = tcc_reference.charge;
+            gapsAtStart = tcc_profile.gaps;
+        }
+    }
+
+    /* last run of the task for the frames that are still buffered */
+    OS_SetSimulatedSysTick(taskRun);
+    CANS_MainFunction();
+    for (uint32_t i = 0; i < nrOfPending; i++) {
+        TCC_Integrate(&parsed, taskRun, pending[i]);
+    }
+
+    TCC_CheckCounter("CAN receive path");
+    printf("  up to %u frames parsed in one run of the CANS task\n", maxBatch);
+    printf("  former time of parsing: deviation %.1f mA.ms (%.6f %% SOC), %u gaps instead of %u\n",
+            parsed.charge - (tcc_reference.charge - chargeAtStart),
+            (parsed.charge - (tcc_reference.charge - chargeAtStart)) / TCC_CHARGE_PER_PERCENT,
+            parsed.gaps, tcc_profile.gaps - gapsAtStart);
+
+    HOSTTEST_CHECK(maxBatch > 1, "the CANS task never parsed more than one frame in a run");
+    HOSTTEST_CHECK(CAN_GetRxStatistics(CAN_NODE0, &rxstatistics) == E_OK, "no receive statistics of CAN_NODE0");
+    HOSTTEST_CHECK(rxstatistics.nr_of_dropped_frames == 0, "%u frames dropped in the receive buffer",
+            rxstatistics.nr_of_dropped_frames);
+}
+
+
+int main(int argc, char *argv[]) {
+    FILE *file = NULL;
+    uint32_t timestamp = 0;
+    int32_t current = 0;
+    uint32_t nextSoc = 0;
+    double formerReferenceSoc = TCC_INITIAL_SOC;
+    float formerSoc = TCC_INITIAL_SOC;
+    uint8_t sampleValid = FALSE;
+
+    if (argc > 1) {
+        file = fopen(argv[1], "r");
+        if (file == NULL) {
+            printf("cannot open %s\n", argv[1]);
+            return 2;
+        }
+    }
+
+    DATA_Init();
+    SOC_Init(FALSE);
+
+    do {
+        if (file != NULL) {
+            sampleValid = TCC_ReadSample(file, (tcc_reference.nrOfSamples == 0) ? TRUE : FALSE, &timestamp, &current);
+        } else {
+            sampleValid = TCC_GenerateSample(TCC_ReferenceSoc(), &timestamp, &current);
+        }
+        if (sampleValid == TRUE) {
+            SOC_IntegrateCurrent(current, timestamp);
+            if (tcc_reference.nrOfSamples > 0) {
+                /* former integration: charge of every measurement subtracted from a float SOC */
+                formerSoc = formerSoc - (((current)*(float)(timestamp - tcc_reference.timestamp)/10))/(3600.0*SOX_CELL_CAPACITY);
+                formerReferenceSoc -= ((double)current * (double)(uint32_t)(timestamp - tcc_reference.timestamp)) / TCC_CHARGE_PER_PERCENT;
+            }
+            /* trapezoidal rule in double precision */
+            TCC_Integrate(&tcc_reference, timestamp, current);
+            if (tcc_profile.elapsed >= nextSoc) {
+                TCC_UpdateSoc(timestamp, current);
+                nextSoc += TCC_SOC_PERIOD_MS;
+            }
+        }
+    } while (sampleValid == TRUE);
+
+    if (file != NULL) {
+        fclose(file);
+    }
+    if (tcc_reference.nrOfSamples == 0) {
+        printf("no measurements in the profile\n");
+        return 2;
+    }
+
+    TCC_CheckCounter("direct");
+    printf("  former single precision integration: deviation %.6f %% SOC\n", fabs(formerSoc - formerReferenceSoc));
+
+    TCC_ReplayBatched();
+
+    return HOSTTEST_Result("test_coulomb");
+}
@@ -0,0 +1,381 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2019, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_database.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup HOSTTEST
+ * @prefix  TDB
+ *
+ * @brief   Stress test of the sequence locks of the database
+ *
+ * Writer threads store data blocks in which every value is derived from one
+ * generation number, reader threads check that every copy they get belongs
+ * to a single generation. A torn read shows up as values of two generations.
+ *
+ * The test uses the data block configuration of the primary MCU with the
+ * double buffered cell voltages and the single buffered MSL flags, and
+ * covers full writes, partial writes, full reads and reads of several ranges.
+ * It first runs a control phase in which the readers copy the blocks without
+ * the sequence lock. Torn reads in this phase show that the test provokes
+ * them on this host.
+ *
+ * Usage: test_database [seconds per phase]
+ */
+
+/*================== Includes =============================================*/
+#include "hosttest.h"
+
+#include "database.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*================== Macros and Definitions ===============================*/
+#define TDB_DEFAULT_SECONDS     2
+#define TDB_RANGE_FIRST_CELL    (BS_NR_OF_BAT_CELLS / 2)
+#define TDB_RANGE_NR_OF_CELLS   8
+#define TDB_RANGE_MODULE        (BS_NR_OF_MODULES - 1)
+
+/**
+ * access of the readers
+ */
+typedef enum {
+    TDB_READ_PROTECTED      = 0,    /*!< DB_ReadBlock() and DB_ReadBlockRanges()            */
+    TDB_READ_UNPROTECTED    = 1,    /*!< memcpy() from the read buffer without sequence lock */
+} TDB_READ_MODE_e;
+
+/**
+ * counters of a reader thread
+ */
+typedef struct {
+    uint64_t reads;
+    uint64_t torn;
+} TDB_READER_s;
+
+/*================== Constant and Variable Definitions ====================*/
+unsigned long hosttest_failures = 0;
+
+static volatile uint8_t tdb_stop = FALSE;
+static TDB_READ_MODE_e tdb_read_mode = TDB_READ_PROTECTED;
+
+/*================== Function Implementations =============================*/
+/**
+ * @brief   fills the cell voltage block with the values of a generation
+ */
+static void TDB_FillCellvoltage(DATA_BLOCK_CELLVOLTAGE_s *block, uint32_t generation) {
+    for (uint32_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        block->voltage[i] = (uint16_t)(generation + i);
+    }
+    for (uint32_t m = 0; m < BS_NR_OF_MODULES; m++) {
+        block->valid_voltPECs[m] = generation;
+        block->sumOfCells[m] = generation ^ m;
+        block->valid_socPECs[m] = (uint8_t)generation;
+    }
+    block->state = (uint8_t)generation;
+}
+
+
+/**
+ * @brief   checks that all values of a cell voltage block belong to one generation
+ */
+static uint8_t TDB_IsCellvoltageConsistent(const DATA_BLOCK_CELLVOLTAGE_s *block) {
+    uint32_t generation = block->valid_voltPECs[0];
+
+    for (uint32_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        if (block->voltage[i] != (uint16_t)(generation + i)) {
+            return FALSE;
+        }
+    }
+    for (uint32_t m = 0; m < BS_NR_OF_MODULES; m++) {
+        if ((block->valid_voltPECs[m] != generation) || (block->sumOfCells[m] != (generation ^ m)) ||
+                (block->valid_socPECs[m] != (uint8_t)generation)) {
+            return FALSE;
+        }
+    }
+    return (block->state == (uint8_t)generation) ? TRUE : FALSE;
+}
+
+
+/**
+ * @brief   fills the MSL flags with the values of a generation
+ */
+static void TDB_FillMsl(DATA_BLOCK_MSL_FLAG_s *block, uint32_t generation) {
+    uint8_t *first = &block->general_MSL;
+    uint16_t length = DATA_FIELD_RANGE_SIZE(DATA_BLOCK_MSL_FLAG_s, general_MSL, pcb_under_temperature);
+
+    memset(first, (uint8_t)generation, length);
+}
+
+
+/**
+ * @brief   checks that all MSL flags belong to one generation
+ */
+static uint8_t TDB_IsMslConsistent(const DATA_BLOCK_MSL_FLAG_s *block) {
+    const uint8_t *first = &block->general_MSL;
+    uint16_t length = DATA_FIELD_RANGE_SIZE(DATA_BLOCK_MSL_FLAG_s, general_MSL, pcb_under_temperature);
+
+    for (uint16_t i = 1; i < length; i++) {
+        if (first[i] != first[0]) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+
+/**
+ * @brief   writes the whole cell voltage block, generations 1, 3, 5, ...
+ */
+static void *TDB_CellvoltageWriter(void *arg) {
+    static DATA_BLOCK_CELLVOLTAGE_s block;
+    uint32_t generation = 1;
+
+    while (tdb_stop == FALSE) {
+        TDB_FillCellvoltage(&block, generation);
+        DB_WriteBlock(&block, DATA_BLOCK_ID_CELLVOLTAGE);
+        generation += 2;
+    }
+    return NULL;
+}
+
+
+/**
+ * @brief   writes all values of the cell voltage block without the timestamps, generations 2, 4, 6, ...
+ */
+static void *TDB_CellvoltagePartialWriter(void *arg) {
+    static DATA_BLOCK_CELLVOLTAGE_s block;
+    uint32_t generation = 2;
+
+    while (tdb_stop == FALSE) {
+        TDB_FillCellvoltage(&block, generation);
+        DB_WriteBlockPartial(&block.voltage, DATA_BLOCK_ID_CELLVOLTAGE,
+                DATA_FIELD_OFFSET(DATA_BLOCK_CELLVOLTAGE_s, voltage),
+                DATA_FIELD_RANGE_SIZE(DATA_BLOCK_CELLVOLTAGE_s, voltage, state));
+        generation += 2;
+    }
+    return NULL;
+}
+
+
+/**
+ * @brief   writes the MSL flags, alternating whole block and partial writes
+ */
+static void *TDB_MslWriter(void *arg) {
+    static DATA_BLOCK_MSL_FLAG_s block;
+    uint32_t generation = 0;
+
+    while (tdb_stop == FALSE) {
+        TDB_FillMsl(&block, generation);
+        if ((generation & 1u) == 0) {
+            DB_WriteBlock(&block, DATA_BLOCK_ID_MSL);
+        } else {
+            DB_WriteBlockPartial(&block.general_MSL, DATA_BLOCK_ID_MSL, DATA_FIELD_OFFSET(DATA_BLOCK_MSL_FLAG_s, general_MSL),
+                    DATA_FIELD_RANGE_SIZE(DATA_BLOCK_MSL_FLAG_s, general_MSL, pcb_under_temperature));
+        }
+        generation++;
+    }
+    return NULL;
+}
+
+
+/**
+ * @brief   reads the whole cell voltage block
+ */
+static void *TDB_CellvoltageReader(void *arg) {
+    TDB_READER_s *reader = (TDB_READER_s *)arg;
+    static DATA_BLOCK_CELLVOLTAGE_s block;
+
+    while (tdb_stop == FALSE) {
+        if (tdb_read_mode == TDB_READ_PROTECTED) {
+            DB_ReadBlock(&block, DATA_BLOCK_ID_CELLVOLTAGE);
+        } else {
+            memcpy(&block, DATA_GetTablePtrBeginCritical(DATA_BLOCK_ID_CELLVOLTAGE), sizeof(block));
+        }
+        reader->reads++;
+        if (TDB_IsCellvoltageConsistent(&block) == FALSE) {
+            reader->torn++;
+        }
+    }
+    return NULL;
+}
+
+
+/**
+ * @brief   reads some cell voltages and the valid flags of a module as two ranges
+ */
+static void *TDB_CellvoltageRangeReader(void *arg) {
+    TDB_READER_s *reader = (TDB_READER_s *)arg;
+    uint16_t voltage[TDB_RANGE_NR_OF_CELLS];
+    uint32_t valid_voltPECs = 0;
+    DATA_BLOCK_RANGE_s ranges[2];
+    const uint8_t *rdptr = NULL;
+
+    ranges[0].dataptrtoReceiver = voltage;
+    ranges[0].offset = DATA_FIELD_OFFSET(DATA_BLOCK_CELLVOLTAGE_s, voltage) + (TDB_RANGE_FIRST_CELL * sizeof(uint16_t));
+    ranges[0].length = sizeof(voltage);
+    ranges[1].dataptrtoReceiver = &valid_voltPECs;
+    ranges[1].offset = DATA_FIELD_OFFSET(DATA_BLOCK_CELLVOLTAGE_s, valid_voltPECs) + (TDB_RANGE_MODULE * sizeof(uint32_t));
+    ranges[1].length = sizeof(valid_voltPECs);
+
+    while (tdb_stop == FALSE) {
+        if (tdb_read_mode == TDB_READ_PROTECTED) {
+            DB_ReadBlockRanges(ranges, 2, DATA_BLOCK_ID_CELLVOLTAGE);
+        } else {
+            rdptr = (const uint8_t *)DATA_GetTablePtrBeginCritical(DATA_BLOCK_ID_CELLVOLTAGE);
+            memcpy(voltage, rdptr + ranges[0].offset, ranges[0].length);
+            memcpy(&valid_voltPECs, rdptr + ranges[1].offset, ranges[1].length);
+        }
+        reader->reads++;
+        for (uint32_t i = 0; i < TDB_RANGE_NR_OF_CELLS; i++) {
+            if (voltage[i] != (uint16_t)(valid_voltPECs + TDB_RANGE_FIRST_CELL + i)) {
+                reader->torn++;
+                break;
+            }
+        }
+    }
+    return NULL;
+}
+
+
+/**
+ * @brief   reads the whole MSL block
+ */
+static void *TDB_MslReader(void *arg) {
+    TDB_READER_s *reader = (TDB_READER_s *)arg;
+    DATA_BLOCK_MSL_FLAG_s block;
+
+    while (tdb_stop == FALSE) {
+        if (tdb_read_mode == TDB_READ_PROTECTED) {
+            DB_ReadBlock(&block, DATA_BLOCK_ID_MSL);
+        } else {
+            memcpy(&block, DATA_GetTablePtrBeginCritical(DATA_BLOCK_ID_MSL), sizeof(block));
+        }
+        reader->reads++;
+        if (TDB_IsMslConsistent(&block) == FALSE) {
+            reader->torn++;
+        }
+    }
+    return NULL;
+}
+
+
+/**
+ * @brief   runs all writers and readers for some time
+ *
+ * @param   mode        access of the readers
+ * @param   seconds     duration of the phase
+ *
+ * @return  number of torn reads
+ */
+static uint64_t TDB_RunPhase(TDB_READ_MODE_e mode, unsigned int seconds) {
+    void *(*writers[])(void *) = { TDB_CellvoltageWriter, TDB_CellvoltagePartialWriter, TDB_MslWriter };
+    void *(*readers[])(void *) = { TDB_CellvoltageReader, TDB_CellvoltageRangeReader, TDB_MslReader };
+    const char *names[] = { "cell voltages", "cell voltage ranges", "MSL flags" };
+    pthread_t writerThreads[3];
+    pthread_t readerThreads[3];
+    TDB_READER_s counters[3];
+    uint64_t torn = 0;
+
+    memset(counters, 0, sizeof(counters));
+    tdb_read_mode = mode;
+    tdb_stop = FALSE;
+    for (int i = 0; i < 3; i++) {
+        pthread_create(&writerThreads[i], NULL, writers[i], NULL);
+        pthread_create(&readerThreads[i], NULL, readers[i], &counters[i]);
+    }
+    sleep(seconds);
+    tdb_stop = TRUE;
+    for (int i = 0; i < 3; i++) {
+        pthread_join(writerThreads[i], NULL);
+        pthread_join(readerThreads[i], NULL);
+    }
+
+    for (int i = 0; i < 3; i++) {
+        printf("  %-20s %10llu reads, %6llu torn\n", names[i],
+                (unsigned long long)counters[i].reads, (unsigned long long)counters[i].torn);
+        torn += counters[i].torn;
+    }
+    return torn;
+}
+
+
+/**
+ * @brief   prints the access statistics of a data block
+ */
+static void TDB_PrintStatistics(const char *name, DATA_BLOCK_ID_TYPE_e blockID) {
+    DATA_ACCESS_STATISTICS_s statistics;
+
+    if (DATA_GetAccessStatistics(blockID, &statistics) == E_OK) {
+        printf("  %-20s %10lu writes, %8lu read retries, %8lu locked reads, %6lu dropped writes\n", name,
+                (unsigned long)statistics.write.nr_of_accesses, (unsigned long)statistics.read_retries,
+                (unsigned long)statistics.read_locked, (unsigned long)statistics.dropped_writes);
+    }
+}
+
+
+int main(int argc, char *argv[]) {
+    unsigned int seconds = TDB_DEFAULT_SECONDS;
+    uint64_t torn = 0;
+
+    if (argc > 1) {
+        seconds = (unsigned int)strtoul(argv[1], NULL, 10);
+    }
+
+    DATA_Init();
+
+    printf("control: readers copy without the sequence lock (%u s)\n", seconds);
+    torn = TDB_RunPhase(TDB_READ_UNPROTECTED, seconds);
+    if (torn == 0) {
+        printf("  note: no torn read provoked, the test has no evidence on this host\n");
+    }
+
+    DATA_ResetAccessStatistics();
+    printf("test: readers use the sequence lock (%u s)\n", seconds);
+    torn = TDB_RunPhase(TDB_READ_PROTECTED, seconds);
+    TDB_PrintStatistics("cell voltages", DATA_BLOCK_ID_CELLVOLTAGE);
+    TDB_PrintStatistics("MSL flags", DATA_BLOCK_ID_MSL);
+    HOSTTEST_CHECK(torn == 0, "%llu torn reads with the sequence lock", (unsigned long long)torn);
+
+    return HOSTTEST_Result("test_database");
+}
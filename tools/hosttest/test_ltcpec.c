@@ -0,0 +1,321 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2019, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_ltcpec.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup HOSTTEST
+ * @prefix  TLTC
+ *
+ * @brief   Test of the handling of PEC errors in the LTC daisy-chain
+ *
+ * The module ltc.c is included in this file, so that its static functions
+ * can be called. The SPI driver is replaced by empty functions, the register
+ * groups are written directly into the receive buffer of the driver.
+ *
+ * The test reads the cell voltage and GPIO register groups of all LTCs
+ * with valid PECs, then with a corrupt PEC of one LTC in the middle of the
+ * daisy-chain and then again with valid PECs. It checks that the bitmap
+ * of LTC_pec15_checkChain() and the error table flag exactly that LTC, that
+ * the data of the other LTCs is stored, and that only the cells and GPIOs
+ * of the register group of that LTC are marked in valid_voltPECs and
+ * valid_gpioPECs while their last valid values are kept. The minimum cell
+ * voltage written with the voltages must be the one of these voltages.
+ *
+ * Usage: test_ltcpec
+ */
+
+/*================== Includes =============================================*/
+#include "hosttest.h"
+
+#include "ltc.c"
+
+#include <string.h>
+
+/*================== Macros and Definitions ===============================*/
+/**
+ * offset of the first register group in the SPI receive buffer (command and its PEC)
+ */
+#define TLTC_RX_OFFSET              4
+
+/**
+ * LTC with the corrupt PEC, in the middle of the daisy-chain
+ */
+#define TLTC_FAULTY_LTC             (LTC_N_LTC / 2)
+
+/**
+ * register group with the corrupt PEC
+ */
+#define TLTC_FAULTY_REGISTER        1
+
+#define TLTC_NR_OF_VOLTAGE_REGISTERS    ((BS_NR_OF_BAT_CELLS_PER_MODULE + 2) / 3)
+#define TLTC_NR_OF_GPIO_REGISTERS       2
+
+/**
+ * GPIO 1 to 3 are in register group A, GPIO 4 and 5 in register group B
+ */
+#define TLTC_NR_OF_GPIOS                5
+
+/*================== Constant and Variable Definitions ====================*/
+unsigned long hosttest_failures = 0;
+
+SPI_HandleType_s spi_devices[1];
+
+/** cell voltages and GPIO voltages in the database after each read of the daisy-chain */
+static DATA_BLOCK_CELLVOLTAGE_s tltc_cellvoltage;
+static DATA_BLOCK_ALLGPIOVOLTAGE_s tltc_allgpiovoltage;
+
+/*================== Function Implementations =============================*/
+DIAG_RETURNTYPE_e DIAG_Handler(DIAG_CH_ID_e diag_ch_id, DIAG_EVENT_e event, uint32_t item_nr, void* data) {
+    return DIAG_HANDLER_RETURN_OK;
+}
+
+uint32_t HAL_RCC_GetPCLK1Freq(void) {
+    return 0;
+}
+
+uint32_t HAL_RCC_GetPCLK2Freq(void) {
+    return 0;
+}
+
+uint32_t MCU_GetCycleCounter(void) {
+    return 0;
+}
+
+uint32_t MCU_CyclesToMicroseconds(uint32_t cycles) {
+    return cycles;
+}
+
+STD_RETURN_TYPE_e SPI_Transmit(SPI_HandleType_s *hspi, uint8_t *pData, uint16_t Size) {
+    return E_OK;
+}
+
+STD_RETURN_TYPE_e SPI_TransmitReceive(SPI_HandleType_s *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size) {
+    return E_OK;
+}
+
+STD_RETURN_TYPE_e SPI_IsTransmitOngoing(void) {
+    return FALSE;
+}
+
+void SPI_SetTransmitOngoing(void) {
+}
+
+
+/**
+ * @brief   raw value of a register of the test data
+ *
+ * @param   generation  number of the read of the daisy-chain
+ * @param   ltc         LTC in the daisy-chain
+ * @param   reg         register in the LTC, cell or GPIO number
+ *
+ * @return  register value in 100 uV
+ */
+static uint16_t TLTC_RawValue(uint16_t generation, uint16_t ltc, uint16_t reg) {
+    return (uint16_t)(30000 + (generation * 1000) + (ltc * 20) + reg);
+}
+
+
+/**
+ * @brief   writes one register group of all LTCs with valid PECs into the receive buffer
+ *
+ * @param   generation  number of the read of the daisy-chain
+ * @param   offset      number of the first register of the group
+ * @param   corrupt     TRUE to corrupt the PEC of TLTC_FAULTY_LTC
+ */
+static void TLTC_FillRegisterGroup(uint16_t generation, uint16_t offset, uint8_t corrupt) {
+    uint8_t *frame = NULL_PTR;
+
+    memset(ltc_RXPECbuffer, 0, sizeof(ltc_RXPECbuffer));
+    for (uint16_t i = 0; i < LTC_N_LTC; i++) {
+        frame = &ltc_RXPECbuffer[TLTC_RX_OFFSET + (i * LTC_PEC_FRAME_LENGTH)];
+        for (uint16_t j = 0; j < 3; j++) {
+            uint16_t value = TLTC_RawValue(generation, i, offset + j);
+            frame[2 * j] = (uint8_t)(value & 0xFF);
+            frame[(2 * j) + 1] = (uint8_t)(value >> 8);
+        }
+    }
+    LTC_pec15_fillChain(&ltc_RXPECbuffer[TLTC_RX_OFFSET], LTC_N_LTC);
+    if (corrupt == TRUE) {
+        ltc_RXPECbuffer[TLTC_RX_OFFSET + (TLTC_FAULTY_LTC * LTC_PEC_FRAME_LENGTH) + LTC_PEC_DATA_LENGTH] ^= 0x01;
+    }
+}
+
+
+/**
+ * @brief   checks the PEC result of the last register group
+ *
+ * @param   result      return value of LTC_RX_PECCheck()
+ * @param   corrupt     TRUE if the PEC of TLTC_FAULTY_LTC was corrupted
+ */
+static void TLTC_CheckPecResult(STD_RETURN_TYPE_e result, uint8_t corrupt) {
+    uint32_t expected[LTC_PEC_BITMAP_WORDS(LTC_N_LTC)] = {0};
+
+    if (corrupt == TRUE) {
+        expected[TLTC_FAULTY_LTC / 32] = (uint32_t)1 << (TLTC_FAULTY_LTC % 32);
+    }
+    HOSTTEST_CHECK(result == ((corrupt == TRUE) ? E_NOT_OK : E_OK), "LTC_RX_PECCheck() returned %d", result);
+    HOSTTEST_CHECK(memcmp(ltc_RXPECerrors, expected, sizeof(expected)) == 0, "wrong LTCs in the PEC error bitmap");
+    for (uint16_t i = 0; i < LTC_N_LTC; i++) {
+        uint8_t flagged = ((corrupt == TRUE) && (i == TLTC_FAULTY_LTC)) ? 1 : 0;
+        HOSTTEST_CHECK(LTC_ErrorTable[i].LTC == flagged, "error table of LTC %u is %u", i, LTC_ErrorTable[i].LTC);
+    }
+}
+
+
+/**
+ * @brief   reads all cell voltage and GPIO register groups of the daisy-chain and stores them in the database
+ *
+ * @param   generation  number of the read of the daisy-chain
+ * @param   corrupt     TRUE to corrupt the PEC of TLTC_FAULTY_LTC in register group TLTC_FAULTY_REGISTER
+ */
+static void TLTC_ReadDaisyChain(uint16_t generation, uint8_t corrupt) {
+    STD_RETURN_TYPE_e result = E_NOT_OK;
+    uint8_t corruptGroup = FALSE;
+
+    for (uint8_t reg = 0; reg < TLTC_NR_OF_VOLTAGE_REGISTERS; reg++) {
+        corruptGroup = ((corrupt == TRUE) && (reg == TLTC_FAULTY_REGISTER)) ? TRUE : FALSE;
+        TLTC_FillRegisterGroup(generation, reg * 3, corruptGroup);
+        result = LTC_RX_PECCheck(ltc_RXPECbuffer);
+        TLTC_CheckPecResult(result, corruptGroup);
+        LTC_SaveRXtoVoltagebuffer(reg, ltc_RXPECbuffer);
+    }
+    LTC_SaveVoltages();
+
+    for (uint8_t reg = 0; reg < TLTC_NR_OF_GPIO_REGISTERS; reg++) {
+        corruptGroup = ((corrupt == TRUE) && (reg == TLTC_FAULTY_REGISTER)) ? TRUE : FALSE;
+        TLTC_FillRegisterGroup(generation, reg * 3, corruptGroup);
+        result = LTC_RX_PECCheck(ltc_RXPECbuffer);
+        TLTC_CheckPecResult(result, corruptGroup);
+        LTC_SaveRXtoGPIOBuffer(reg, ltc_RXPECbuffer);
+    }
+    LTC_SaveAllGPIOMeasurement();
+
+    DB_ReadBlock(&tltc_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
+    DB_ReadBlock(&tltc_allgpiovoltage, DATA_BLOCK_ID_ALLGPIOVOLTAGE);
+}
+
+
+/**
+ * @brief   checks the cell voltages and their PEC flags in the database
+ *
+ * @param   generation      number of the last read of the daisy-chain
+ * @param   faultyGeneration number of the read whose values TLTC_FAULTY_REGISTER of TLTC_FAULTY_LTC
+ *                          holds, equal to generation if all PECs were valid
+ */
+static void TLTC_CheckCellVoltages(uint16_t generation, uint16_t faultyGeneration) {
+    uint16_t minIndex = 0;
+
+    for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        if (tltc_cellvoltage.voltage[i] < tltc_cellvoltage.voltage[minIndex]) {
+            minIndex = i;
+        }
+    }
+    HOSTTEST_CHECK(tltc_cellvoltage.voltage_min_index == minIndex, "minimum at cell %u instead of %u", tltc_cellvoltage.voltage_min_index, minIndex);
+    HOSTTEST_CHECK(tltc_cellvoltage.voltage_min == tltc_cellvoltage.voltage[minIndex], "minimum %u mV instead of %u mV",
+            tltc_cellvoltage.voltage_min, tltc_cellvoltage.voltage[minIndex]);
+
+    for (uint16_t i = 0; i < LTC_N_LTC; i++) {
+        uint32_t expectedFlags = 0;
+        for (uint16_t cell = 0; cell < BS_NR_OF_BAT_CELLS_PER_MODULE; cell++) {
+            uint16_t valueGeneration = generation;
+            if ((i == TLTC_FAULTY_LTC) && ((cell / 3) == TLTC_FAULTY_REGISTER) && (faultyGeneration != generation)) {
+                valueGeneration = faultyGeneration;
+                expectedFlags |= (uint32_t)1 << cell;
+            }
+            uint16_t expected = (uint16_t)(((float)TLTC_RawValue(valueGeneration, i, cell))*100e-6*1000.0);
+            uint16_t voltage = tltc_cellvoltage.voltage[(i * BS_NR_OF_BAT_CELLS_PER_MODULE) + cell];
+            HOSTTEST_CHECK(voltage == expected, "cell %u of module %u: %u mV instead of %u mV", cell, i, voltage, expected);
+        }
+        HOSTTEST_CHECK(tltc_cellvoltage.valid_voltPECs[i] == expectedFlags, "valid_voltPECs of module %u: 0x%08X instead of 0x%08X",
+                i, (unsigned int)tltc_cellvoltage.valid_voltPECs[i], (unsigned int)expectedFlags);
+    }
+}
+
+
+/**
+ * @brief   checks the GPIO voltages and their PEC flags in the database
+ *
+ * @param   generation      number of the last read of the daisy-chain
+ * @param   faultyGeneration number of the read whose values TLTC_FAULTY_REGISTER of TLTC_FAULTY_LTC
+ *                          holds, equal to generation if all PECs were valid
+ */
+static void TLTC_CheckGpioVoltages(uint16_t generation, uint16_t faultyGeneration) {
+    for (uint16_t i = 0; i < LTC_N_LTC; i++) {
+        uint16_t expectedFlags = 0;
+        for (uint16_t gpio = 0; gpio < TLTC_NR_OF_GPIOS; gpio++) {
+            uint16_t valueGeneration = generation;
+            if ((i == TLTC_FAULTY_LTC) && ((gpio / 3) == TLTC_FAULTY_REGISTER) && (faultyGeneration != generation)) {
+                valueGeneration = faultyGeneration;
+                expectedFlags |= (uint16_t)(1u << gpio);
+            }
+            uint16_t expected = TLTC_RawValue(valueGeneration, i, gpio) / 10;
+            uint16_t voltage = tltc_allgpiovoltage.gpiovoltage[(i * BS_NR_OF_GPIOS_PER_MODULE) + gpio];
+            HOSTTEST_CHECK(voltage == expected, "GPIO %u of module %u: %u mV instead of %u mV", gpio + 1, i, voltage, expected);
+        }
+        HOSTTEST_CHECK(tltc_allgpiovoltage.valid_gpioPECs[i] == expectedFlags, "valid_gpioPECs of module %u: 0x%04X instead of 0x%04X",
+                i, tltc_allgpiovoltage.valid_gpioPECs[i], expectedFlags);
+    }
+}
+
+
+int main(int argc, char *argv[]) {
+    DATA_Init();
+    printf("daisy-chain of %d LTCs, corrupt PEC of LTC %d in register group %d\n", LTC_N_LTC, TLTC_FAULTY_LTC, TLTC_FAULTY_REGISTER);
+
+    /* all PECs valid */
+    TLTC_ReadDaisyChain(1, FALSE);
+    TLTC_CheckCellVoltages(1, 1);
+    TLTC_CheckGpioVoltages(1, 1);
+
+    /* one LTC with a corrupt PEC keeps its last valid values of that register group */
+    TLTC_ReadDaisyChain(2, TRUE);
+    TLTC_CheckCellVoltages(2, 1);
+    TLTC_CheckGpioVoltages(2, 1);
+
+    /* the next valid PEC clears the flags */
+    TLTC_ReadDaisyChain(3, FALSE);
+    TLTC_CheckCellVoltages(3, 3);
+    TLTC_CheckGpioVoltages(3, 3);
+
+    return HOSTTEST_Result("test_ltcpec");
+}
@@ -0,0 +1,245 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2019, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_prefixsum.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup HOSTTEST
+ * @prefix  TPS
+ *
+ * @brief   Test of the moving averages from a ring of prefix sums
+ *
+ * A long synthetic current trace is added to a ring of prefix sums with
+ * ALGO_PrefixSumAdd(). At regular intervals, the means of the windows of
+ * algo_cfg.c are taken with ALGO_PrefixSumMean() and compared with an
+ * exact recomputation over the same samples in double precision. The
+ * comparison also covers the windows that are not filled yet at the
+ * start. The prefix sums start shortly before their wrap-around at 2^64.
+ *
+ * For comparison, the former running float sums, which added and
+ * subtracted value/window with every sample, are calculated as well.
+ * Their maximum deviation from the recomputation is printed.
+ *
+ * Usage: test_prefixsum [number of samples]
+ */
+
+/*================== Includes =============================================*/
+#include "hosttest.h"
+
+#include "algo.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+
+/*================== Macros and Definitions ===============================*/
+#define TPS_DEFAULT_NR_OF_SAMPLES   10000000u
+
+/** a comparison every TPS_CHECK_INTERVAL samples, prime to cover all positions in the ring */
+#define TPS_CHECK_INTERVAL          997u
+
+/** resolution of the prefix sums, as ALGO_MOVING_AVERAGE_SCALE in algo_cfg.c */
+#define TPS_SCALE                   1000.0f
+
+/** windows of the moving averages of the current in algo_cfg.c */
+#define TPS_NR_OF_WINDOWS           6
+#define TPS_WINDOWS                 { 1000 / ISA_CURRENT_CYCLE_TIME_MS, 5000 / ISA_CURRENT_CYCLE_TIME_MS,   \
+                                      10000 / ISA_CURRENT_CYCLE_TIME_MS, 30000 / ISA_CURRENT_CYCLE_TIME_MS, \
+                                      60000 / ISA_CURRENT_CYCLE_TIME_MS,                                    \
+                                      MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS / ISA_CURRENT_CYCLE_TIME_MS }
+
+/** one element more than the longest window */
+#define TPS_RING_LENGTH             ((60000 / ISA_CURRENT_CYCLE_TIME_MS) + 1)
+
+/*================== Constant and Variable Definitions ====================*/
+unsigned long hosttest_failures = 0;
+
+ALGO_TASKS_s algo_algorithms[1];
+const uint16_t algo_length = 0;
+
+static const uint32_t tps_windows[TPS_NR_OF_WINDOWS] = TPS_WINDOWS;
+
+static uint64_t tps_prefix[TPS_RING_LENGTH];
+static ALGO_PREFIX_SUM_RING_s tps_ring;
+
+/** the newest samples, for the recomputation and the former running sums */
+static float tps_history[TPS_RING_LENGTH];
+
+/** former running float sums of the windows */
+static float tps_runningSum[TPS_NR_OF_WINDOWS];
+
+static uint32_t tps_random = 1;
+
+/*================== Function Implementations =============================*/
+uint32_t MCU_GetCycleCounter(void) {
+    return 0;
+}
+
+uint32_t MCU_CyclesToMicroseconds(uint32_t cycles) {
+    return cycles;
+}
+
+uint32_t MCU_MicrosecondsToCycles(uint32_t microseconds) {
+    return microseconds;
+}
+
+
+/**
+ * @brief   xorshift random number generator, the trace is the same on every host
+ */
+static uint32_t TPS_Random(void) {
+    tps_random ^= tps_random << 13;
+    tps_random ^= tps_random >> 17;
+    tps_random ^= tps_random << 5;
+    return tps_random;
+}
+
+
+/**
+ * @brief   generates the next current sample in mA
+ *
+ * Load segments of 0.1 s to 100 s with up to +-450 A, noise of +-2 A and
+ * fractions of a mA.
+ */
+static float TPS_GenerateSample(void) {
+    static uint32_t segmentLeft = 0;
+    static float segmentCurrent = 0.0f;
+
+    if (segmentLeft == 0) {
+        segmentLeft = 5u + (TPS_Random() % 5000u);
+        segmentCurrent = (float)((int32_t)(TPS_Random() % 900001u) - 450000);
+    }
+    segmentLeft--;
+    return segmentCurrent + ((float)((int32_t)(TPS_Random() % 4001u) - 2000)) + ((float)(TPS_Random() % 1000u) / 1000.0f);
+}
+
+
+/**
+ * @brief   compares the means of all windows with the recomputation over the samples
+ *
+ * @param   newest      index of the newest sample in tps_history
+ * @param   nrOfSamples number of samples added so far
+ * @param   maxError    maximum deviation of the former running sums, updated
+ */
+static void TPS_CheckWindows(uint32_t newest, uint64_t nrOfSamples, double *maxError) {
+    uint32_t n = 0;
+    uint32_t k = 0;
+    double exact = 0.0;
+    double maxAbs = 0.0;
+    double tolerance = 0.0;
+    float mean = 0.0f;
+
+    for (uint8_t w = 0; w < TPS_NR_OF_WINDOWS; w++) {
+        n = tps_windows[w];
+        if (n > nrOfSamples) {
+            n = (uint32_t)nrOfSamples;
+        }
+        exact = 0.0;
+        maxAbs = 0.0;
+        for (uint32_t i = 0; i < n; i++) {
+            k = (newest + TPS_RING_LENGTH - i) % TPS_RING_LENGTH;
+            exact += tps_history[k];
+            maxAbs = fmax(maxAbs, fabs(tps_history[k]));
+        }
+        exact /= n;
+
+        /* rounding of every sample to the fixed-point resolution and of the mean to float */
+        tolerance = (0.5 / TPS_SCALE) + (maxAbs * FLT_EPSILON) + (fabs(exact) * FLT_EPSILON);
+        mean = ALGO_PrefixSumMean(&tps_ring, tps_windows[w]);
+        HOSTTEST_CHECK(fabs(mean - exact) <= tolerance, "window of %u samples after %llu samples: mean %f instead of %f",
+                tps_windows[w], (unsigned long long)nrOfSamples, mean, exact);
+
+        if (nrOfSamples >= tps_windows[w]) {
+            *maxError = fmax(*maxError, fabs(tps_runningSum[w] - exact));
+        }
+    }
+}
+
+
+int main(int argc, char *argv[]) {
+    uint64_t nrOfSamples = TPS_DEFAULT_NR_OF_SAMPLES;
+    uint32_t newest = 0;
+    double formerMaxError = 0.0;
+    float value = 0.0f;
+
+    if (argc > 1) {
+        nrOfSamples = strtoull(argv[1], NULL, 10);
+    }
+
+    ALGO_PrefixSumInit(&tps_ring, tps_prefix, TPS_RING_LENGTH, TPS_SCALE);
+    /* start shortly before the wrap-around of the prefix sums */
+    tps_prefix[0] = UINT64_MAX - 1000000000u;
+
+    /* the mean without samples is 0 */
+    HOSTTEST_CHECK(ALGO_PrefixSumMean(&tps_ring, tps_windows[0]) == 0.0f, "mean without samples is not 0");
+
+    for (uint64_t s = 1; s <= nrOfSamples; s++) {
+        value = TPS_GenerateSample();
+        newest = (uint32_t)(s % TPS_RING_LENGTH);
+
+        /* former running sums: add the new sample and subtract the one leaving the window */
+        for (uint8_t w = 0; w < TPS_NR_OF_WINDOWS; w++) {
+            tps_runningSum[w] += value / (float)tps_windows[w];
+            if (s > tps_windows[w]) {
+                tps_runningSum[w] -= tps_history[(newest + TPS_RING_LENGTH - tps_windows[w]) % TPS_RING_LENGTH] / (float)tps_windows[w];
+            }
+        }
+        tps_history[newest] = value;
+        ALGO_PrefixSumAdd(&tps_ring, value);
+
+        if ((s < (2u * TPS_RING_LENGTH)) || ((s % TPS_CHECK_INTERVAL) == 0) || (s == nrOfSamples)) {
+            TPS_CheckWindows(newest, s, &formerMaxError);
+        }
+        if (hosttest_failures > 10) {
+            break;
+        }
+    }
+
+    printf("%llu samples, windows of", (unsigned long long)nrOfSamples);
+    for (uint8_t w = 0; w < TPS_NR_OF_WINDOWS; w++) {
+        printf(" %u", tps_windows[w]);
+    }
+    printf(" samples\n");
+    printf("  former running float sums: maximum deviation %.3f mA\n", formerMaxError);
+
+    return HOSTTEST_Result("test_prefixsum");
+}